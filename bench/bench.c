@@ -29,13 +29,38 @@
 
 
 // default include headers
+#ifdef __linux__
+#  define _GNU_SOURCE   // sched_setaffinity()
+#endif
 #include <stdio.h>
 #include <stdlib.h>
+#include <stdint.h>
 #include <getopt.h>
 #include <string.h>
 #include <math.h>
+#include <time.h>
 #include <sys/resource.h>
 
+#ifdef __linux__
+#  include <sched.h>
+#  include <unistd.h>
+#  include <sys/syscall.h>
+#  include <linux/perf_event.h>
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+#  include <x86intrin.h>    // __rdtsc()
+#endif
+
+#include "bench/bench.h"
+#include "bench/sweep.h"
+
+// minimum number of repetitions for which the 99th percentile is
+// reported; with fewer it is simply the maximum
+#define BENCH_P99_MIN_REPS (100)
+
+// maximum number of measured or warm-up repetitions
+#define BENCH_MAX_REPS (100000)
+
 // define benchmark function pointer
 typedef void(benchmark_function_t) (
     struct rusage *_start,
@@ -51,7 +76,14 @@ typedef struct {
     unsigned int num_trials;
     float extime;
     float rate;
-    float cycles_per_trial;
+    float cycles_per_trial;     // median over repetitions
+    unsigned int num_reps;      // number of measured repetitions
+    float cycles_p99;           // 99th percentile (see BENCH_P99_MIN_REPS)
+    float cycles_stddev;        // standard deviation
+    float cycles_min;           // minimum
+    float cycles_max;           // maximum
+    float sample_rate;          // nominal trial rate for real time (0: n/a)
+    int wall_time;              // timed by wall clock rather than cpu time?
 } benchmark_t;
 
 // define package_t
@@ -72,11 +104,26 @@ typedef struct {
 //   package_t packages[NUM_PACKAGES]
 #include "benchmark_include.h"
 
+// cycle counter sources, in order of preference
+enum {
+    COUNTER_CLOCK=0,    // estimated cpu clock x benchmark execution time
+    COUNTER_TSC,        // time-stamp counter (x86 only), reference cycles
+    COUNTER_PERF,       // core cycles of this process via perf_event (Linux only)
+};
+const char * counter_names[] = {"clock", "tsc", "perf"};
+
 // helper functions:
 void estimate_cpu_clock(void);
 void set_num_trials_from_cpu_speed(void);
+int  counter_open(int _source);
+uint64_t counter_read(void);
+double clock_seconds(clockid_t _id);
+int  pin_to_cpu(int _cpu);
+void run_benchmark(benchmark_t* _benchmark, unsigned long int * _n, double * _extime, double * _cycles);
 void execute_benchmark(benchmark_t* _benchmark, int _verbose);
 void execute_package(package_t* _package, int _verbose);
+int  parse_range(const char * _s, unsigned int * _start, unsigned int * _stop, unsigned int * _step, int * _geometric);
+void execute_sweep(sweep_t * _sweep, int _verbose);
 
 char convert_units(float * _s);
 void print_benchmark_results(benchmark_t* _benchmark);
@@ -86,9 +133,27 @@ double calculate_execution_time(struct rusage, struct rusage);
 unsigned long int num_base_trials = 1<<12;
 float cpu_clock = 1.0f; // cpu clock speed (Hz)
 float runtime=0.100f;   // minimum run time (s)
+unsigned int num_reps   = 3;    // measured repetitions per benchmark
+unsigned int num_warmup = 0;    // discarded repetitions (in addition to calibration)
+int counter = COUNTER_CLOCK;    // cycle counter source
+int perf_fd = -1;               // perf_event file descriptor
+
+// benchmark being executed
+benchmark_t * benchmark_current = NULL;
+
+// parameter sweeps
+int          sweep_range_set = 0;   // override default sweep ranges?
+unsigned int sweep_start, sweep_stop, sweep_step;
+int          sweep_geometric;
+sweep_t *    sweep_current = NULL;  // sweep being executed
+unsigned int sweep_value   = 0;     // parameter value being executed
+benchmark_t * sweep_results = NULL; // results of all sweep points
+const char ** sweep_packages = NULL;// sweep name for each result
+unsigned int num_sweep_results = 0;
 
 FILE * fid; // output file id
 void output_benchmark_to_file(FILE * _fid, benchmark_t * _benchmark);
+void output_benchmark_to_json(FILE * _fid, benchmark_t * _benchmark, const char * _package, int _last);
 
 void usage()
 {
@@ -109,6 +174,15 @@ void usage()
     printf("  -L           : list all available scripts\n");
     printf("  -s <search>  : run all packages/benchmarks matching search string\n");
     printf("  -o <file>    : export output\n");
+    printf("  -r <reps>    : set number of measured repetitions, default: %u\n", num_reps);
+    printf("                 (p99 is reported with at least %u)\n", BENCH_P99_MIN_REPS);
+    printf("  -w <reps>    : set number of warm-up repetitions, default: %u\n", num_warmup);
+    printf("  -T <counter> : cycle counter: perf, tsc, or clock (default: best available)\n");
+    printf("  -P <cpu>     : pin process to cpu core\n");
+    printf("  -j <file>    : export output as JSON\n");
+    printf("  -K           : list available parameter sweeps\n");
+    printf("  -S <search>  : run all parameter sweeps matching search string\n");
+    printf("  -R <range>   : set sweep range as start:stop[:step], or start:stop:x<factor>\n");
 }
 
 // main function
@@ -122,6 +196,7 @@ int main(int argc, char *argv[])
           RUN_SINGLE_BENCH,
           RUN_SINGLE_PACKAGE,
           RUN_SEARCH,
+          RUN_SWEEP,
     } mode = RUN_ALL;
     unsigned int benchmark_id = 0;
     unsigned int package_id = 0;
@@ -129,12 +204,17 @@ int main(int argc, char *argv[])
     int autoscale = 1;
     int cpu_clock_detect = 1;
     int output_to_file = 0;
+    int output_to_json = 0;
+    int counter_request = COUNTER_PERF;
+    int cpu = -1;
     char filename[128];
+    char filename_json[128];
     char search_string[128];
 
     // get input options
     int d;
-    while((d = getopt(argc,argv,"hvqfec:n:b:p:t:lLs:o:")) != EOF){
+    int reps;   // parsed repetition count (may be out of range)
+    while((d = getopt(argc,argv,"hvqfec:n:b:p:t:lLs:o:r:w:T:P:j:KS:R:")) != EOF){
         switch (d) {
         case 'h':   usage();        return 0;
         case 'v':   verbose = 1;    break;
@@ -142,6 +222,8 @@ int main(int argc, char *argv[])
         case 'f':
             num_base_trials = 100;
             runtime = 0.5e-3f;
+            num_reps = 1;
+            num_warmup = 0;
             break;
         case 'e':
             estimate_cpu_clock();
@@ -204,6 +286,60 @@ int main(int argc, char *argv[])
             output_to_file = 1;
             strcpy(filename, optarg);
             break;
+        case 'r':
+            reps = atoi(optarg);
+            if (reps < 1 || reps > BENCH_MAX_REPS) {
+                printf("error: number of repetitions must be in [1,%d]\n", BENCH_MAX_REPS);
+                return -1;
+            }
+            num_reps = reps;
+            break;
+        case 'w':
+            reps = atoi(optarg);
+            if (reps < 0 || reps > BENCH_MAX_REPS) {
+                printf("error: number of warm-up repetitions must be in [0,%d]\n", BENCH_MAX_REPS);
+                return -1;
+            }
+            num_warmup = reps;
+            break;
+        case 'T':
+            for (counter_request=COUNTER_PERF; counter_request>=0; counter_request--) {
+                if (strcmp(optarg, counter_names[counter_request])==0)
+                    break;
+            }
+            if (counter_request < 0) {
+                printf("error: unknown cycle counter '%s'\n", optarg);
+                return -1;
+            }
+            break;
+        case 'P':
+            cpu = atoi(optarg);
+            break;
+        case 'j':
+            output_to_json = 1;
+            strncpy(filename_json, optarg, 128);
+            filename_json[127] = '\0';
+            break;
+        case 'K':
+            // list sweeps and exit
+            for (i=0; i<num_sweeps; i++) {
+                printf("    %-24s: %-8s %u..%u, %s %u\n", sweeps[i].name, sweeps[i].param,
+                        sweeps[i].start, sweeps[i].stop,
+                        sweeps[i].geometric ? "factor" : "step", sweeps[i].step);
+            }
+            return 0;
+        case 'S':
+            mode = RUN_SWEEP;
+            strncpy(search_string, optarg, 128);
+            search_string[127] = '\0';
+            break;
+        case 'R':
+            if (parse_range(optarg, &sweep_start, &sweep_stop, &sweep_step, &sweep_geometric) != 0) {
+                printf("error: invalid sweep range '%s'\n", optarg);
+                return -1;
+            }
+            sweep_range_set = 1;
+            break;
         default:
             usage();
             return 0;
@@ -217,9 +353,18 @@ int main(int argc, char *argv[])
         // do nothing
     }
 
+    // pin to core before measuring anything
+    if (cpu >= 0 && pin_to_cpu(cpu) != 0)
+        return -1;
+
     if (cpu_clock_detect)
         estimate_cpu_clock();
 
+    // open cycle counter, falling back to less precise sources
+    counter = counter_open(counter_request);
+    printf("  cycle counter: %s, %u repetition(s) after %u warm-up\n",
+            counter_names[counter], num_reps, num_warmup);
+
     if (autoscale)
         set_num_trials_from_cpu_speed();
 
@@ -257,6 +402,13 @@ int main(int argc, char *argv[])
             }
         }
         break;
+    case RUN_SWEEP:
+        printf("running all parameter sweeps matching '%s'...\n", search_string);
+        for (i=0; i<num_sweeps; i++) {
+            if (strstr(sweeps[i].name, search_string) != NULL)
+                execute_sweep( &sweeps[i], verbose );
+        }
+        break;
     default:
         fprintf(stderr,"invalid mode\n");
         exit(1);
@@ -282,7 +434,7 @@ int main(int argc, char *argv[])
         fprintf(fid,"#  verbose             :   %s\n", verbose ? "true" : "false");
         fprintf(fid,"#  autoscale           :   %s\n", autoscale ? "true" : "false");
         fprintf(fid,"#  cpu_clock_detect    :   %s\n", cpu_clock_detect ? "true" : "false");
-        fprintf(fid,"#  search string       :   '%s'\n", mode == RUN_SEARCH ? search_string : "");
+        fprintf(fid,"#  search string       :   '%s'\n", mode == RUN_SEARCH || mode == RUN_SWEEP ? search_string : "");
         fprintf(fid,"#  runtime             :   %12.8f s\n", runtime);
         fprintf(fid,"#  cpu_clock           :   %e Hz\n", cpu_clock);
         fprintf(fid,"#  cpu_clock determined:   %s\n", cpu_clock_detect ? "estimated" : "specified");
@@ -295,11 +447,68 @@ int main(int argc, char *argv[])
             if (scripts[i].num_trials > 0)
                 output_benchmark_to_file(fid, &scripts[i]);
         }
+        for (i=0; i<num_sweep_results; i++)
+            output_benchmark_to_file(fid, &sweep_results[i]);
 
         fclose(fid);
         printf("results written to %s\n", filename);
     }
 
+    if (output_to_json) {
+        fid = fopen(filename_json,"w");
+        if (!fid) {
+            printf("error: could not open file %s for writing\n", filename_json);
+            return 1;
+        }
+
+        fprintf(fid,"{\n");
+        fprintf(fid,"  \"autoscript_version\": \"%s\",\n", AUTOSCRIPT_VERSION);
+        fprintf(fid,"  \"counter\": \"%s\",\n", counter_names[counter]);
+        fprintf(fid,"  \"cpu_clock\": %e,\n", cpu_clock);
+        fprintf(fid,"  \"cpu\": %d,\n", cpu);
+        fprintf(fid,"  \"runtime\": %e,\n", runtime);
+        fprintf(fid,"  \"repetitions\": %u,\n", num_reps);
+        fprintf(fid,"  \"warmup\": %u,\n", num_warmup);
+        fprintf(fid,"  \"benchmarks\": [\n");
+        int last = -1;
+        for (i=0; i<NUM_AUTOSCRIPTS; i++) {
+            if (scripts[i].num_trials > 0)
+                last = i;
+        }
+        for (i=0; i<NUM_AUTOSCRIPTS; i++) {
+            if (scripts[i].num_trials == 0)
+                continue;
+
+            // find package containing benchmark
+            for (j=0; j<NUM_PACKAGES; j++) {
+                if (i >= packages[j].index && i < packages[j].index + packages[j].num_scripts)
+                    break;
+            }
+            output_benchmark_to_json(fid, &scripts[i], j < NUM_PACKAGES ? packages[j].name : "",
+                                     (int)i == last && num_sweep_results == 0);
+        }
+        for (i=0; i<num_sweep_results; i++) {
+            output_benchmark_to_json(fid, &sweep_results[i], sweep_packages[i],
+                                     i+1 == num_sweep_results);
+        }
+        fprintf(fid,"  ]\n");
+        fprintf(fid,"}\n");
+
+        fclose(fid);
+        printf("results written to %s\n", filename_json);
+    }
+
+#ifdef __linux__
+    if (perf_fd >= 0)
+        close(perf_fd);
+#endif
+
+    // free sweep results
+    for (i=0; i<num_sweep_results; i++)
+        free((char*)sweep_results[i].name);
+    free(sweep_results);
+    free(sweep_packages);
+
     return 0;
 }
 
@@ -358,11 +567,156 @@ void set_num_trials_from_cpu_speed(void)
     printf("  setting number of base trials to %ld\n", num_base_trials);
 }
 
+// open cycle counter, trying the requested source first and falling
+// back to less precise ones; returns the source actually used
+int counter_open(int _source)
+{
+#ifdef __linux__
+    if (_source == COUNTER_PERF) {
+        // count user-space core cycles of this process on any cpu,
+        // including threads it creates (counts of a thread are added
+        // when it exits)
+        struct perf_event_attr attr;
+        memset(&attr, 0, sizeof(attr));
+        attr.size           = sizeof(attr);
+        attr.type           = PERF_TYPE_HARDWARE;
+        attr.config         = PERF_COUNT_HW_CPU_CYCLES;
+        attr.exclude_kernel = 1;
+        attr.exclude_hv     = 1;
+        attr.inherit        = 1;
+        perf_fd = syscall(__NR_perf_event_open, &attr, 0, -1, -1, 0);
+        if (perf_fd >= 0)
+            return COUNTER_PERF;
+    }
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+    if (_source >= COUNTER_TSC)
+        return COUNTER_TSC;
+#endif
+    return COUNTER_CLOCK;
+}
+
+// read cycle counter (zero for estimated clock)
+uint64_t counter_read(void)
+{
+    uint64_t v = 0;
+    switch (counter) {
+#ifdef __linux__
+    case COUNTER_PERF:
+        if (read(perf_fd, &v, sizeof(v)) != sizeof(v))
+            v = 0;
+        break;
+#endif
+#if defined(__x86_64__) || defined(__i386__)
+    case COUNTER_TSC:
+        v = __rdtsc();
+        break;
+#endif
+    default:;
+    }
+    return v;
+}
+
+// read clock in seconds
+double clock_seconds(clockid_t _id)
+{
+    struct timespec t;
+    clock_gettime(_id, &t);
+    return t.tv_sec + 1e-9*t.tv_nsec;
+}
+
+// pin process to a single cpu core so that repetitions do not migrate
+int pin_to_cpu(int _cpu)
+{
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    CPU_SET(_cpu, &set);
+    if (sched_setaffinity(0, sizeof(set), &set) != 0) {
+        fprintf(stderr,"error: could not pin process to cpu %d\n", _cpu);
+        return -1;
+    }
+    printf("  pinned to cpu %d\n", _cpu);
+    return 0;
+#else
+    fprintf(stderr,"warning: pinning to cpu not supported on this platform\n");
+    return 0;
+#endif
+}
+
+// run benchmark once with *_n trials (updated with the number actually
+// run), measuring the execution time of its timed loop and the cycles
+// spent in it
+void run_benchmark(benchmark_t *       _benchmark,
+                   unsigned long int * _n,
+                   double *            _extime,
+                   double *            _cycles)
+{
+    struct rusage start, finish;
+
+    // the benchmark times its own loop (excluding set-up) with getrusage
+    // or, if multi-threaded, wall-clock time; counters read around the
+    // call include set-up, so their count is prorated by the fraction of
+    // the call spent in the loop
+    double   cpu0 = clock_seconds(CLOCK_PROCESS_CPUTIME_ID);
+    double   t0   = clock_seconds(CLOCK_MONOTONIC);
+    uint64_t c0   = counter_read();
+    benchmark_current = _benchmark;
+    _benchmark->wall_time = 0;
+    _benchmark->api(&start, &finish, _n);
+    uint64_t c1   = counter_read();
+    double   t1   = clock_seconds(CLOCK_MONOTONIC);
+    double   cpu1 = clock_seconds(CLOCK_PROCESS_CPUTIME_ID);
+
+    *_extime = calculate_execution_time(start, finish);
+    switch (counter) {
+    case COUNTER_PERF:
+        // counts only while this process is running: prorate by cpu time,
+        // or by wall time if the loop was timed by wall clock
+        *_cycles = (double)(c1 - c0) *
+            fmin(1.0, *_extime / (_benchmark->wall_time ? t1 - t0 : cpu1 - cpu0));
+        break;
+    case COUNTER_TSC:
+        // counts wall-clock time: prorate by wall time
+        *_cycles = (double)(c1 - c0) * fmin(1.0, *_extime / (t1 - t0));
+        break;
+    default:
+        *_cycles = cpu_clock * (*_extime);
+    }
+}
+
+// set nominal sample rate of benchmark being executed
+void benchmark_set_sample_rate(float _fs)
+{
+    if (benchmark_current != NULL)
+        benchmark_current->sample_rate = _fs;
+}
+
+// store wall-clock time for multi-threaded benchmark being executed
+void benchmark_get_wall_time(struct rusage * _r)
+{
+    double t = clock_seconds(CLOCK_MONOTONIC);
+    memset(_r, 0, sizeof(struct rusage));
+    _r->ru_utime.tv_sec  = (time_t) t;
+    _r->ru_utime.tv_usec = (suseconds_t) ((t - (double)_r->ru_utime.tv_sec) * 1e6);
+    if (benchmark_current != NULL)
+        benchmark_current->wall_time = 1;
+}
+
+// compare function for sorting
+int compare_double(const void * _a, const void * _b)
+{
+    double a = *(const double*)_a;
+    double b = *(const double*)_b;
+    return a < b ? -1 : (a > b ? 1 : 0);
+}
+
 void execute_benchmark(benchmark_t* _benchmark, int _verbose)
 {
     unsigned long int n = num_base_trials;
-    struct rusage start, finish;
+    double extime, cycles;
 
+    // increase number of trials until minimum run time is reached
     unsigned int num_attempts = 0;
     unsigned long int num_trials;
     do {
@@ -371,11 +725,10 @@ void execute_benchmark(benchmark_t* _benchmark, int _verbose)
 
         // set number of trials and run benchmark
         num_trials = n;
-        _benchmark->api(&start, &finish, &num_trials);
-        _benchmark->extime = calculate_execution_time(start, finish);
+        run_benchmark(_benchmark, &num_trials, &extime, &cycles);
 
         // check exit criteria
-        if (_benchmark->extime >= runtime) {
+        if (extime >= runtime) {
             break;
         } else if (num_attempts == 30) {
             fprintf(stderr,"warning: benchmark could not execute over minimum run time\n");
@@ -386,14 +739,133 @@ void execute_benchmark(benchmark_t* _benchmark, int _verbose)
         }
     } while (1);
 
-    _benchmark->num_trials = num_trials;
-    _benchmark->rate = (float)(_benchmark->num_trials) / _benchmark->extime;
-    _benchmark->cycles_per_trial = cpu_clock / (_benchmark->rate);
+    // warm up (beyond the final calibration run, which already warms
+    // caches), then measure repetitions with the same number of trials
+    unsigned int i;
+    for (i=0; i<num_warmup; i++) {
+        num_trials = n;
+        run_benchmark(_benchmark, &num_trials, &extime, &cycles);
+    }
+    double * t = (double*) malloc(num_reps*sizeof(double)); // execution time per repetition
+    double * c = (double*) malloc(num_reps*sizeof(double)); // cycles per trial per repetition
+    double c_mean = 0.0;
+    for (i=0; i<num_reps; i++) {
+        num_trials = n;
+        run_benchmark(_benchmark, &num_trials, &t[i], &cycles);
+        c[i] = cycles / (double)num_trials;
+        c_mean += c[i];
+    }
+    c_mean /= (double)num_reps;
+    double c_var = 0.0;
+    for (i=0; i<num_reps; i++)
+        c_var += (c[i]-c_mean)*(c[i]-c_mean);
+    c_var = num_reps > 1 ? c_var / (double)(num_reps-1) : 0.0;
+
+    // order statistics (median uses the lower of the two middle values)
+    qsort(t, num_reps, sizeof(double), compare_double);
+    qsort(c, num_reps, sizeof(double), compare_double);
+    unsigned int i99 = (unsigned int) ceil(0.99*num_reps) - 1;
+
+    _benchmark->num_trials       = num_trials;
+    _benchmark->num_reps         = num_reps;
+    _benchmark->extime           = t[(num_reps-1)/2];
+    _benchmark->rate             = (float)(_benchmark->num_trials) / _benchmark->extime;
+    _benchmark->cycles_per_trial = c[(num_reps-1)/2];
+    _benchmark->cycles_p99       = c[i99];
+    _benchmark->cycles_stddev    = sqrt(c_var);
+    _benchmark->cycles_min       = c[0];
+    _benchmark->cycles_max       = c[num_reps-1];
+    free(t);
+    free(c);
 
     if (_verbose)
         print_benchmark_results(_benchmark);
 }
 
+// parse sweep range, 'start:stop[:step]' or 'start:stop:x<factor>'
+int parse_range(const char *   _s,
+                unsigned int * _start,
+                unsigned int * _stop,
+                unsigned int * _step,
+                int *          _geometric)
+{
+    char factor[2] = "";
+    *_step      = 1;
+    *_geometric = 0;
+    int n = sscanf(_s, "%u:%u:%1[x]%u", _start, _stop, factor, _step);
+    if (n == 4) {
+        *_geometric = 1;
+    } else if (sscanf(_s, "%u:%u:%u", _start, _stop, _step) < 2) {
+        return -1;
+    }
+
+    // validate range
+    if (*_start == 0 || *_stop < *_start || *_step < (*_geometric ? 2u : 1u))
+        return -1;
+    return 0;
+}
+
+// execute benchmark at current sweep point
+void sweep_api(struct rusage *     _start,
+               struct rusage *     _finish,
+               unsigned long int * _num_iterations)
+{
+    sweep_current->api(_start, _finish, _num_iterations, sweep_value);
+}
+
+// run sweep over parameter range, printing throughput curve
+void execute_sweep(sweep_t * _sweep, int _verbose)
+{
+    unsigned int start     = sweep_range_set ? sweep_start     : _sweep->start;
+    unsigned int stop      = sweep_range_set ? sweep_stop      : _sweep->stop;
+    unsigned int step      = sweep_range_set ? sweep_step      : _sweep->step;
+    int          geometric = sweep_range_set ? sweep_geometric : _sweep->geometric;
+
+    if (_verbose)
+        printf("sweep: %s (%s)\n", _sweep->name, _sweep->param);
+
+    unsigned int first = num_sweep_results;
+    unsigned int p;
+    sweep_current = _sweep;
+    for (p=start; p<=stop; p = geometric ? p*step : p+step) {
+        // name benchmark after sweep point, e.g. 'fft/nfft=64'
+        char name[128];
+        snprintf(name, sizeof(name), "%s/%s=%u", _sweep->name, _sweep->param, p);
+
+        benchmark_t b;
+        memset(&b, 0, sizeof(benchmark_t));
+        b.id   = NUM_AUTOSCRIPTS + num_sweep_results;
+        b.api  = sweep_api;
+        b.name = strdup(name);
+        sweep_value = p;
+        execute_benchmark(&b, _verbose);
+
+        // save result
+        num_sweep_results++;
+        sweep_results  = (benchmark_t*) realloc(sweep_results, num_sweep_results*sizeof(benchmark_t));
+        sweep_packages = (const char**) realloc(sweep_packages, num_sweep_results*sizeof(const char*));
+        sweep_results [num_sweep_results-1] = b;
+        sweep_packages[num_sweep_results-1] = _sweep->name;
+    }
+
+    // print throughput curve, normalizing cycles by cost model
+    const char * unit = _sweep->cost == SWEEP_COST_LINEAR ? "c/t/p" :
+                        _sweep->cost == SWEEP_COST_NLOGN  ? "c/t/(p*log2(p))" : "";
+    printf("  %10s %14s %14s %16s\n", _sweep->param, "rate [t/s]", "[cycles/t]", unit);
+    unsigned int i;
+    for (i=first; i<num_sweep_results; i++) {
+        benchmark_t * b = &sweep_results[i];
+        p = (unsigned int) atoi(strchr(b->name, '=') + 1);
+        float c = b->cycles_per_trial;
+        printf("  %10u %14.4e %14.2f", p, b->rate, c);
+        if (_sweep->cost == SWEEP_COST_LINEAR)
+            printf(" %16.4f", c / (float)p);
+        else if (_sweep->cost == SWEEP_COST_NLOGN && p > 1)
+            printf(" %16.4f", c / ((float)p * log2f((float)p)));
+        printf("\n");
+    }
+}
+
 void execute_package(package_t* _package, int _verbose)
 {
     if (_verbose)
@@ -441,12 +913,21 @@ void print_benchmark_results(benchmark_t* _b)
     float cycles_format = _b->cycles_per_trial;
     char cycles_units = convert_units(&cycles_format);
 
-    printf("  %-3u: %-30s: %6.2f %c trials / %6.2f %cs (%6.2f %c t/s, %6.2f %c c/t)\n",
+    printf("  %-3u: %-30s: %6.2f %c trials / %6.2f %cs (%6.2f %c t/s, %6.2f %c c/t",
         _b->id, _b->name,
         trials_format, trials_units,
         extime_format, extime_units,
         rate_format, rate_units,
         cycles_format, cycles_units);
+
+    // relative spread over repetitions
+    if (_b->num_reps > 1)
+        printf(" +/- %4.1f%%", 100.0f * _b->cycles_stddev / _b->cycles_per_trial);
+
+    // real-time factor
+    if (_b->sample_rate > 0)
+        printf(", %6.2f x real time", _b->rate / _b->sample_rate);
+    printf(")\n");
 }
 
 void print_package_results(package_t* _package)
@@ -478,3 +959,39 @@ void output_benchmark_to_file(FILE * _fid, benchmark_t * _benchmark)
                  _benchmark->cycles_per_trial);
 }
 
+void output_benchmark_to_json(FILE *        _fid,
+                              benchmark_t * _benchmark,
+                              const char *  _package,
+                              int           _last)
+{
+    // real-time factor, for benchmarks with a nominal sample rate
+    char realtime[80] = "";
+    if (_benchmark->sample_rate > 0) {
+        snprintf(realtime, sizeof(realtime), ", \"sample_rate\": %e, \"realtime_factor\": %e",
+                 _benchmark->sample_rate, _benchmark->rate / _benchmark->sample_rate);
+    }
+
+    // 99th percentile, only when there are enough repetitions for it to
+    // differ from the maximum
+    char p99[40] = "";
+    if (_benchmark->num_reps >= BENCH_P99_MIN_REPS)
+        snprintf(p99, sizeof(p99), ", \"p99\": %e", _benchmark->cycles_p99);
+
+    fprintf(_fid,"    {\"id\": %u, \"name\": \"%s\", \"package\": \"%s\", "
+                 "\"num_trials\": %u, \"extime\": %e, \"rate\": %e, "
+                 "\"cycles_per_trial\": {\"median\": %e%s, \"stddev\": %e, "
+                 "\"min\": %e, \"max\": %e}%s}%s\n",
+                 _benchmark->id,
+                 _benchmark->name,
+                 _package,
+                 _benchmark->num_trials,
+                 _benchmark->extime,
+                 _benchmark->rate,
+                 _benchmark->cycles_per_trial,
+                 p99,
+                 _benchmark->cycles_stddev,
+                 _benchmark->cycles_min,
+                 _benchmark->cycles_max,
+                 realtime,
+                 _last ? "" : ",");
+}
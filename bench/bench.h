@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// bench.h : interface from benchmarks back to the benchmark program
+//
+
+#ifndef __LIQUID_BENCH_BENCH_H__
+#define __LIQUID_BENCH_BENCH_H__
+
+#include <sys/resource.h>
+
+// Set nominal sample rate of the benchmark being executed, for chains
+// where one trial is one input sample; the program then reports the
+// real-time factor (trials per second relative to this rate).
+//  _fs     :   nominal sample rate [samples/s]
+void benchmark_set_sample_rate(float _fs);
+
+// Store wall-clock time in _r, in place of getrusage(RUSAGE_SELF, _r),
+// for benchmarks that run work on several threads: processor time adds
+// up over all threads and so cannot show a speed-up. The rate of such a
+// benchmark is per wall-clock second, while cycle counts (perf) cover
+// all of its threads.
+//  _r      :   time stamp (ru_utime holds wall-clock time)
+void benchmark_get_wall_time(struct rusage * _r);
+
+#endif // __LIQUID_BENCH_BENCH_H__
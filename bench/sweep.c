@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// sweep.c : parameter-sweep benchmarks
+//
+// Each sweep runs a benchmark kernel over a range of one parameter (e.g.
+// filter length, transform size, modulation order, thread count) so that
+// throughput curves can be compared. Kernels reuse the helpers of the
+// fixed-size benchmarks in src/*/bench.
+//
+// The SIMD extensions used by the library's dot products are selected
+// when configuring the build; the portable C reference kernel here gives
+// a baseline within one build, and builds configured differently (e.g.
+// with --enable-simdoverride) may be compared with benchmark_compare.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+#include "liquid.h"
+#include "bench/sweep.h"
+#include "src/fft/bench/fft_runbench.h"
+
+// helpers defined with the fixed-size benchmarks
+void dotprod_rrrf_bench(struct rusage *_start, struct rusage *_finish,
+                        unsigned long int *_num_iterations, unsigned int _n);
+void dotprod_crcf_bench(struct rusage *_start, struct rusage *_finish,
+                        unsigned long int *_num_iterations, unsigned int _n);
+void dotprod_cccf_bench(struct rusage *_start, struct rusage *_finish,
+                        unsigned long int *_num_iterations, unsigned int _n);
+void dotprod_q15_bench(struct rusage *_start, struct rusage *_finish,
+                       unsigned long int *_num_iterations, unsigned int _n,
+                       unsigned int _type, int _peak);
+void firfilt_crcf_block_bench(struct rusage *_start, struct rusage *_finish,
+                              unsigned long int *_num_iterations, unsigned int _n,
+                              int _symmetric);
+void firfilt_q15_block_bench(struct rusage *_start, struct rusage *_finish,
+                             unsigned long int *_num_iterations, unsigned int _n,
+                             int _q15);
+void firdecim_crcf_block_bench(struct rusage *_start, struct rusage *_finish,
+                               unsigned long int *_num_iterations, unsigned int _M,
+                               unsigned int _h_len, int _symmetric, unsigned int _n);
+void modem_demodulate_bench(struct rusage *_start, struct rusage *_finish,
+                            unsigned long int *_num_iterations, modulation_scheme _ms);
+void msourcecf_bench(struct rusage *_start, struct rusage *_finish,
+                     unsigned long int *_num_iterations, unsigned int _num_sources,
+                     int _mixed, unsigned int _num_threads);
+
+// result of portable dot product, kept so it is not optimized away
+volatile float sweep_dotprod_result;
+
+// portable C dot product as a baseline for the library kernels
+void sweep_dotprod_rrrf_portable(struct rusage *     _start,
+                                 struct rusage *     _finish,
+                                 unsigned long int * _num_iterations,
+                                 unsigned int        _n)
+{
+    // normalize number of iterations
+    *_num_iterations *= 128;
+    *_num_iterations /= _n;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    float h[_n], x[_n];
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        h[i] = randnf();
+        x[i] = randnf();
+    }
+
+    // start trials; feed each output back into the input so the compiler
+    // cannot hoist the dot product out of the loop
+    unsigned long int t;
+    float v = 0.0f;
+    getrusage(RUSAGE_SELF, _start);
+    for (t=0; t<(*_num_iterations); t++) {
+        x[0] = 1e-3f*v;
+        v = 0.0f;
+        for (i=0; i<_n; i++)
+            v += h[i] * x[i];
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    sweep_dotprod_result = v;
+}
+
+void sweep_dotprod_rrrf(struct rusage *_start, struct rusage *_finish, unsigned long int *_num_iterations, unsigned int _p)
+{ dotprod_rrrf_bench(_start, _finish, _num_iterations, _p); }
+
+void sweep_dotprod_crcf(struct rusage *_start, struct rusage *_finish, unsigned long int *_num_iterations, unsigned int _p)
+{ dotprod_crcf_bench(_start, _finish, _num_iterations, _p); }
+
+void sweep_dotprod_cccf(struct rusage *_start, struct rusage *_finish, unsigned long int *_num_iterations, unsigned int _p)
+{ dotprod_cccf_bench(_start, _finish, _num_iterations, _p); }
+
+// fixed-point coefficients scaled so 32-bit accumulation remains exact
+void sweep_dotprod_rrrq15(struct rusage *_start, struct rusage *_finish, unsigned long int *_num_iterations, unsigned int _p)
+{ dotprod_q15_bench(_start, _finish, _num_iterations, _p, 0, _p < 15000 ? 30000/_p : 1); }
+
+void sweep_dotprod_cccq15(struct rusage *_start, struct rusage *_finish, unsigned long int *_num_iterations, unsigned int _p)
+{ dotprod_q15_bench(_start, _finish, _num_iterations, _p, 2, _p < 15000 ? 30000/_p : 1); }
+
+void sweep_fft(struct rusage *_start, struct rusage *_finish, unsigned long int *_num_iterations, unsigned int _p)
+{ fft_runbench(_start, _finish, _num_iterations, _p, LIQUID_FFT_FORWARD); }
+
+void sweep_firfilt_crcf(struct rusage *_start, struct rusage *_finish, unsigned long int *_num_iterations, unsigned int _p)
+{ firfilt_crcf_block_bench(_start, _finish, _num_iterations, _p, 0); }
+
+void sweep_firfilt_crcq15(struct rusage *_start, struct rusage *_finish, unsigned long int *_num_iterations, unsigned int _p)
+{ firfilt_q15_block_bench(_start, _finish, _num_iterations, _p, 1); }
+
+// decimation factor; linear-phase filter with 8 taps per output phase
+void sweep_firdecim_crcf(struct rusage *_start, struct rusage *_finish, unsigned long int *_num_iterations, unsigned int _p)
+{ firdecim_crcf_block_bench(_start, _finish, _num_iterations, _p, 16*_p+1, 1, 256); }
+
+// modulation order (QAM, or BPSK for order 2)
+void sweep_modem_demodulate(struct rusage *_start, struct rusage *_finish, unsigned long int *_num_iterations, unsigned int _p)
+{
+    modulation_scheme ms = LIQUID_MODEM_UNKNOWN;
+    switch (_p) {
+    case   2: ms = LIQUID_MODEM_BPSK;   break;
+    case   4: ms = LIQUID_MODEM_QAM4;   break;
+    case   8: ms = LIQUID_MODEM_QAM8;   break;
+    case  16: ms = LIQUID_MODEM_QAM16;  break;
+    case  32: ms = LIQUID_MODEM_QAM32;  break;
+    case  64: ms = LIQUID_MODEM_QAM64;  break;
+    case 128: ms = LIQUID_MODEM_QAM128; break;
+    case 256: ms = LIQUID_MODEM_QAM256; break;
+    default:
+        fprintf(stderr,"error: sweep_modem_demodulate(), unsupported modulation order %u\n", _p);
+        exit(1);
+    }
+    modem_demodulate_bench(_start, _finish, _num_iterations, ms);
+}
+
+// thread count, generating a mix of 12 sources
+void sweep_msourcecf(struct rusage *_start, struct rusage *_finish, unsigned long int *_num_iterations, unsigned int _p)
+{ msourcecf_bench(_start, _finish, _num_iterations, 12, 1, _p); }
+
+// available sweeps
+sweep_t sweeps[] = {
+    {"dotprod_rrrf",          "n",       sweep_dotprod_rrrf,          4, 1024,  2, 1, SWEEP_COST_LINEAR},
+    {"dotprod_rrrf_portable", "n",       sweep_dotprod_rrrf_portable, 4, 1024,  2, 1, SWEEP_COST_LINEAR},
+    {"dotprod_crcf",          "n",       sweep_dotprod_crcf,          4, 1024,  2, 1, SWEEP_COST_LINEAR},
+    {"dotprod_cccf",          "n",       sweep_dotprod_cccf,          4, 1024,  2, 1, SWEEP_COST_LINEAR},
+    {"dotprod_rrrq15",        "n",       sweep_dotprod_rrrq15,        4, 1024,  2, 1, SWEEP_COST_LINEAR},
+    {"dotprod_cccq15",        "n",       sweep_dotprod_cccq15,        4, 1024,  2, 1, SWEEP_COST_LINEAR},
+    {"fft",                   "nfft",    sweep_fft,                  16, 4096,  2, 1, SWEEP_COST_NLOGN },
+    {"firfilt_crcf",          "h_len",   sweep_firfilt_crcf,          8,  512,  2, 1, SWEEP_COST_LINEAR},
+    {"firfilt_crcq15",        "h_len",   sweep_firfilt_crcq15,        8,  512,  2, 1, SWEEP_COST_LINEAR},
+    {"firdecim_crcf",         "M",       sweep_firdecim_crcf,         2,   32,  2, 1, SWEEP_COST_LINEAR},
+    {"modem_demodulate",      "order",   sweep_modem_demodulate,      2,  256,  2, 1, SWEEP_COST_NONE  },
+    {"msourcecf",             "threads", sweep_msourcecf,             1,    8,  1, 0, SWEEP_COST_NONE  },
+};
+unsigned int num_sweeps = sizeof(sweeps) / sizeof(sweep_t);
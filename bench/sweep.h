@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// sweep.h : parameter-sweep benchmarks
+//
+
+#ifndef __LIQUID_BENCH_SWEEP_H__
+#define __LIQUID_BENCH_SWEEP_H__
+
+#include <sys/resource.h>
+
+// sweep function: benchmark kernel with a single integer parameter
+typedef void(sweep_function_t) (
+    struct rusage *     _start,
+    struct rusage *     _finish,
+    unsigned long int * _num_iterations,
+    unsigned int        _p);
+
+// cost model used to normalize cycles per trial over a sweep
+typedef enum {
+    SWEEP_COST_NONE=0,  // report cycles per trial only
+    SWEEP_COST_LINEAR,  // cycles per trial per unit of parameter
+    SWEEP_COST_NLOGN,   // cycles per trial per p*log2(p)
+} sweep_cost_t;
+
+// define sweep_t
+typedef struct {
+    const char *       name;        // kernel name
+    const char *       param;       // swept parameter name
+    sweep_function_t * api;         // benchmark kernel
+    unsigned int       start;       // default parameter range: first value
+    unsigned int       stop;        // default parameter range: last value
+    unsigned int       step;        // default parameter range: increment/factor
+    int                geometric;   // multiply (rather than add) by step?
+    sweep_cost_t       cost;        // cost model
+} sweep_t;
+
+// available sweeps
+extern sweep_t      sweeps[];
+extern unsigned int num_sweeps;
+
+#endif // __LIQUID_BENCH_SWEEP_H__
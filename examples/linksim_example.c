@@ -0,0 +1,126 @@
+//
+// linksim_example.c
+//
+// Link-level performance simulation: packet and bit error rates over a
+// range of signal-to-noise ratios for a modulation and coding combination,
+// either with ideal synchronization (qpacketmodem) or including frame
+// detection and synchronization (flexframe). Trials are spread across all
+// processors and each point stops early once its packet error rate is
+// known to the requested precision.
+// SEE ALSO: qpacketmodem_performance_example.c
+//           framesync64_performance_example.c
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <getopt.h>
+
+#include "liquid.h"
+
+#define OUTPUT_FILENAME "linksim_example.m"
+
+void usage()
+{
+    printf("linksim_example [options]\n");
+    printf("  h     : print usage\n");
+    printf("  f     : simulate flexframe (detection, synchronization)\n");
+    printf("  p     : payload length [bytes], default: 400\n");
+    printf("  m     : modulation scheme (qpsk default)\n");
+    liquid_print_modulation_schemes();
+    printf("  v     : data integrity check: crc32 default\n");
+    liquid_print_crc_schemes();
+    printf("  c     : coding scheme (inner): g2412 default\n");
+    printf("  k     : coding scheme (outer): none default\n");
+    liquid_print_fec_schemes();
+    printf("  s     : SNR start [dB], default: -5\n");
+    printf("  x     : SNR max [dB], default: 10\n");
+    printf("  n     : number of SNR steps, default: 31\n");
+    printf("  t     : minimum number of trials, default: 100\n");
+    printf("  T     : maximum number of trials, default: 20000\n");
+    printf("  e     : relative precision of PER, default: 0.1\n");
+    printf("  j     : number of threads, default: 0 (one per processor)\n");
+    printf("  r     : seed, default: 1\n");
+}
+
+int main(int argc, char *argv[])
+{
+    // options
+    int               flexframe   = 0;                      // simulate flexframe?
+    modulation_scheme ms          = LIQUID_MODEM_QPSK;      // mod. scheme
+    crc_scheme        check       = LIQUID_CRC_32;          // data validity check
+    fec_scheme        fec0        = LIQUID_FEC_GOLAY2412;   // fec (inner)
+    fec_scheme        fec1        = LIQUID_FEC_NONE;        // fec (outer)
+    unsigned int      payload_len = 400;                    // payload length
+    float             SNRdB_min   = -5.0f;                  // signal-to-noise ratio (minimum)
+    float             SNRdB_max   = 10.0f;                  // signal-to-noise ratio (maximum)
+    unsigned int      num_snr     = 31;                     // number of SNR steps
+    unsigned long int min_trials  = 100;                    // minimum number of trials
+    unsigned long int max_trials  = 20000;                  // maximum number of trials
+    float             precision   = 0.1f;                   // relative precision
+    unsigned int      num_threads = 0;                      // number of threads
+    unsigned long int seed        = 1;                      // seed
+
+    // get options
+    int dopt;
+    while((dopt = getopt(argc,argv,"hfp:m:v:c:k:s:x:n:t:T:e:j:r:")) != EOF){
+        switch (dopt) {
+        case 'h': usage();                                     return 0;
+        case 'f': flexframe   = 1;                             break;
+        case 'p': payload_len = atol(optarg);                  break;
+        case 'm': ms          = liquid_getopt_str2mod(optarg); break;
+        case 'v': check       = liquid_getopt_str2crc(optarg); break;
+        case 'c': fec0        = liquid_getopt_str2fec(optarg); break;
+        case 'k': fec1        = liquid_getopt_str2fec(optarg); break;
+        case 's': SNRdB_min   = atof(optarg);                  break;
+        case 'x': SNRdB_max   = atof(optarg);                  break;
+        case 'n': num_snr     = atoi(optarg);                  break;
+        case 't': min_trials  = atol(optarg);                  break;
+        case 'T': max_trials  = atol(optarg);                  break;
+        case 'e': precision   = atof(optarg);                  break;
+        case 'j': num_threads = atoi(optarg);                  break;
+        case 'r': seed        = atol(optarg);                  break;
+        default:
+            exit(-1);
+        }
+    }
+
+    // create and configure simulation
+    linksim q = flexframe ?
+        linksim_create_flexframe   (payload_len, check, fec0, fec1, ms) :
+        linksim_create_qpacketmodem(payload_len, check, fec0, fec1, ms);
+    linksim_set_num_threads(q, num_threads);
+    linksim_set_num_trials (q, min_trials, max_trials);
+    linksim_set_precision  (q, precision);
+    linksim_set_seed       (q, seed);
+    linksim_print(q);
+
+    // run simulation, printing each point
+    linksimstats_s stats[num_snr];
+    unsigned int n = linksim_run_sweep(q, SNRdB_min, SNRdB_max, num_snr, stats);
+    unsigned int i;
+    for (i=0; i<n; i++)
+        linksimstats_print(&stats[i]);
+    linksim_destroy(q);
+
+    // export results
+    FILE * fid = fopen(OUTPUT_FILENAME,"w");
+    fprintf(fid,"%% %s : auto-generated file\n", OUTPUT_FILENAME);
+    fprintf(fid,"clear all\n");
+    fprintf(fid,"close all\n");
+    fprintf(fid,"SNR = zeros(1,%u); BER = zeros(1,%u); PER = zeros(1,%u);\n", n, n, n);
+    for (i=0; i<n; i++) {
+        fprintf(fid,"SNR(%3u) = %12.4e; BER(%3u) = %12.4e; PER(%3u) = %12.4e;\n",
+                i+1, stats[i].SNRdB, i+1, stats[i].BER, i+1, stats[i].PER);
+    }
+    fprintf(fid,"figure;\n");
+    fprintf(fid,"semilogy(SNR, BER+1e-12, '-x', SNR, PER+1e-12, '-x');\n");
+    fprintf(fid,"axis([SNR(1) SNR(end) 1e-6 1]);\n");
+    fprintf(fid,"xlabel('SNR [dB]');\n");
+    fprintf(fid,"ylabel('Error Rate');\n");
+    fprintf(fid,"legend('BER','PER');\n");
+    fprintf(fid,"grid on;\n");
+    fclose(fid);
+    printf("results written to %s\n", OUTPUT_FILENAME);
+    return 0;
+}
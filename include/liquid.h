@@ -90,6 +90,97 @@ int liquid_libversion_number(void);
 LIQUID_DEFINE_COMPLEX(float,  liquid_float_complex);
 LIQUID_DEFINE_COMPLEX(double, liquid_double_complex);
 
+/*
+ * Fixed-point data types: Q15 values are 16-bit two's complement numbers
+ * with 15 fractional bits, representing [-1, 1). Complex values store the
+ * real and imaginary components interleaved, so an array of _n complex
+ * samples may be handled as an array of 2*_n real samples.
+ */
+typedef int16_t liquid_q15;
+typedef struct {liquid_q15 real; liquid_q15 imag;} liquid_cq15;
+
+/*
+ * Half-precision storage types: float16 is IEEE-754 binary16 (5-bit
+ * exponent, 10-bit mantissa, range +/-65504); bfloat16 keeps the 8-bit
+ * exponent of single precision with a 7-bit mantissa. Both are used only
+ * to store large buffers compactly; arithmetic is performed in float.
+ */
+typedef uint16_t liquid_float16;
+typedef uint16_t liquid_bfloat16;
+
+// storage format for large internal buffers
+typedef enum {
+    LIQUID_STORAGE_FLOAT32=0,   // single precision (default)
+    LIQUID_STORAGE_FLOAT16,     // IEEE-754 half precision
+    LIQUID_STORAGE_BFLOAT16,    // brain floating-point
+} liquid_storage_type;
+
+//
+// profile : per-object counters for internal processing stages; the
+// counters are only updated when configured with --enable-profile
+//
+
+#define LIQUID_PROFILE_MAX_STAGES (8)
+
+// profile stage : counters for a single processing stage
+typedef struct {
+    const char *       name;        // stage name
+    unsigned long int  num_calls;   // number of invocations
+    unsigned long int  num_samples; // number of samples processed
+    unsigned long long num_cycles;  // elapsed time (cycles)
+} liquid_profile_stage_s;
+
+// profile : collection of stage counters for a single object
+typedef struct {
+    const char *           name;        // object type, e.g. "flexframesync"
+    unsigned int           num_stages;  // number of stages in use
+    liquid_profile_stage_s stages[LIQUID_PROFILE_MAX_STAGES];
+} liquid_profile_s;
+
+// is instrumentation compiled into the library? (0:no, 1:yes)
+int liquid_profile_is_enabled();
+
+// reset profile counters
+void liquid_profile_reset(liquid_profile_s * _p);
+
+// print profile to stdout
+void liquid_profile_print(liquid_profile_s * _p);
+
+// print profiles of all live instrumented objects to stdout
+void liquid_profile_registry_print();
+
+// reset profiles of all live instrumented objects
+void liquid_profile_registry_reset();
+
+//
+// memory accounting : objects report the bytes they have allocated
+// with *_get_memory_usage(); every block these objects allocate
+// themselves, including temporary buffers used while they are being
+// created, is also reported to an optional global hook. Allocations
+// made by sub-objects without accounting (e.g. filters, oscillators,
+// modems, FFT plans) are not reported.
+//
+
+// allocation hook, invoked after each allocation and before each
+// release; a re-allocation is reported as release of the old block
+// followed by allocation of the new one
+//  _name       :   object type making the allocation, e.g. "flexframesync"
+//  _ptr        :   address of memory block (NULL if allocation failed)
+//  _size       :   size of block [bytes], 0 when released
+//  _userdata   :   user-defined data pointer
+typedef void (*liquid_alloc_hook)(const char *      _name,
+                                  void *            _ptr,
+                                  unsigned long int _size,
+                                  void *            _userdata);
+
+// set global allocation hook (NULL to disable); the hook and its user
+// data are replaced together. The hook may be called concurrently from
+// several threads, including the library's own worker threads (e.g.
+// linksim), and so must be thread-safe. A call already in progress
+// when the hook is replaced completes with the old hook.
+void liquid_set_alloc_hook(liquid_alloc_hook _hook,
+                           void *            _userdata);
+
 // 
 // MODULE : agc (automatic gain control)
 //
@@ -433,6 +524,9 @@ void WINDOW(_print)(WINDOW() _q);                                           \
 /* Print window object to stdout (with extra information)               */  \
 void WINDOW(_debug_print)(WINDOW() _q);                                     \
                                                                             \
+/* Get number of bytes allocated by object                              */  \
+unsigned long int WINDOW(_get_memory_usage)(WINDOW() _q);                   \
+                                                                            \
 /* Reset window object (initialize to zeros)                            */  \
 void WINDOW(_reset)(WINDOW() _q);                                           \
                                                                             \
@@ -566,6 +660,14 @@ void CHANNEL(_destroy)(CHANNEL() _q);                                       \
 /* Print channel object internals to standard output                    */  \
 void CHANNEL(_print)(CHANNEL() _q);                                         \
                                                                             \
+/* Set seed of internal noise generators. Channels are seeded from      */  \
+/* rand() when created; objects with the same seed and configuration    */  \
+/* produce identical outputs, independently of one another.             */  \
+/*  _q          : channel object                                        */  \
+/*  _seed       : generator seed                                        */  \
+void CHANNEL(_set_seed)(CHANNEL()         _q,                               \
+                        unsigned long int _seed);                           \
+                                                                            \
 /* Include additive white Gausss noise impairment                       */  \
 /*  _q          : channel object                                        */  \
 /*  _N0dB       : noise floor power spectral density [dB]               */  \
@@ -658,6 +760,21 @@ void TVMPCH(_reset)(TVMPCH() _q);                                           \
 /* Print channel object internals to standard output                    */  \
 void TVMPCH(_print)(TVMPCH() _q);                                           \
                                                                             \
+/* Set seed of tap process generator. Emulators are seeded from rand()  */  \
+/* when created.                                                        */  \
+/*  _q      : channel object                                            */  \
+/*  _seed   : generator seed                                            */  \
+void TVMPCH(_set_seed)(TVMPCH()          _q,                                \
+                      unsigned long int _seed);                             \
+                                                                            \
+/* Set number of samples over which taps are held constant (block       */  \
+/* fading); taps are stepped across each sub-block at once, keeping     */  \
+/* their statistics at sub-block boundaries exact. Default: 1           */  \
+/*  _q          : channel object                                        */  \
+/*  _block_len  : sub-block length, _block_len > 0                      */  \
+void TVMPCH(_set_block_len)(TVMPCH()     _q,                                \
+                            unsigned int _block_len);                       \
+                                                                            \
 /* Push sample into emulator                                            */  \
 /*  _q      : channel object                                            */  \
 /*  _x      : input sample                                              */  \
@@ -693,6 +810,9 @@ LIQUID_TVMPCH_DEFINE_API(LIQUID_TVMPCH_MANGLE_CCCF,
 #define LIQUID_DOTPROD_MANGLE_RRRF(name) LIQUID_CONCAT(dotprod_rrrf,name)
 #define LIQUID_DOTPROD_MANGLE_CCCF(name) LIQUID_CONCAT(dotprod_cccf,name)
 #define LIQUID_DOTPROD_MANGLE_CRCF(name) LIQUID_CONCAT(dotprod_crcf,name)
+#define LIQUID_DOTPROD_MANGLE_RRRQ15(name) LIQUID_CONCAT(dotprod_rrrq15,name)
+#define LIQUID_DOTPROD_MANGLE_CRCQ15(name) LIQUID_CONCAT(dotprod_crcq15,name)
+#define LIQUID_DOTPROD_MANGLE_CCCQ15(name) LIQUID_CONCAT(dotprod_cccq15,name)
 
 // large macro
 //   DOTPROD    : name-mangling macro
@@ -776,6 +896,25 @@ LIQUID_DOTPROD_DEFINE_API(LIQUID_DOTPROD_MANGLE_CRCF,
                           float,
                           liquid_float_complex)
 
+// Fixed-point (Q15) dot products: products are accumulated exactly and the
+// result is rounded to Q15, saturating to [-32768, 32767]. Coefficients of
+// -32768 are clipped to -32767 by every entry point (_run, _run4 and
+// _execute), so all give the same result for the same taps.
+LIQUID_DOTPROD_DEFINE_API(LIQUID_DOTPROD_MANGLE_RRRQ15,
+                          liquid_q15,
+                          liquid_q15,
+                          liquid_q15)
+
+LIQUID_DOTPROD_DEFINE_API(LIQUID_DOTPROD_MANGLE_CRCQ15,
+                          liquid_cq15,
+                          liquid_q15,
+                          liquid_cq15)
+
+LIQUID_DOTPROD_DEFINE_API(LIQUID_DOTPROD_MANGLE_CCCQ15,
+                          liquid_cq15,
+                          liquid_cq15,
+                          liquid_cq15)
+
 // 
 // sum squared methods
 //
@@ -1167,6 +1306,10 @@ void fec_destroy(fec _q);
 // print fec object internals
 void fec_print(fec _q);
 
+// get number of bytes allocated by object, excluding the internal
+// state of external (libfec) decoders
+unsigned long int fec_get_memory_usage(fec _q);
+
 // encode a block of data using a fec scheme
 //  _q              :   fec object
 //  _dec_msg_len    :   decoded message length
@@ -1255,6 +1398,9 @@ void packetizer_destroy(packetizer _p);
 // print packetizer object internals
 void packetizer_print(packetizer _p);
 
+// get number of bytes allocated by object, including fec objects
+unsigned long int packetizer_get_memory_usage(packetizer _p);
+
 // access methods
 unsigned int packetizer_get_dec_msg_len(packetizer _p);
 unsigned int packetizer_get_enc_msg_len(packetizer _p);
@@ -1308,6 +1454,9 @@ void interleaver_destroy(interleaver _q);
 // print interleaver object internals
 void interleaver_print(interleaver _q);
 
+// get number of bytes allocated by object
+unsigned long int interleaver_get_memory_usage(interleaver _q);
+
 // set depth (number of internal iterations)
 //  _q      :   interleaver object
 //  _depth  :   depth
@@ -1753,6 +1902,10 @@ void SPWATERFALL(_reset)(SPWATERFALL() _q);                                 \
 /* Print internal state of the object to stdout                         */  \
 void SPWATERFALL(_print)(SPWATERFALL() _q);                                 \
                                                                             \
+/* Get number of bytes allocated by object for its time/frequency       */  \
+/* history and output buffers (the internal spgram is not included)     */  \
+unsigned long int SPWATERFALL(_get_memory_usage)(SPWATERFALL() _q);         \
+                                                                            \
 /* Get number of samples processed since object was created             */  \
 uint64_t SPWATERFALL(_get_num_samples_total)(SPWATERFALL() _q);             \
                                                                             \
@@ -1765,6 +1918,17 @@ unsigned int SPWATERFALL(_get_num_time)(SPWATERFALL() _q);                  \
 /* Get power spectral density (PSD), size: nfft x time                  */  \
 const T * SPWATERFALL(_get_psd)(SPWATERFALL() _q);                          \
                                                                             \
+/* Set storage format of the internal time/frequency buffer, e.g.       */  \
+/* LIQUID_STORAGE_FLOAT16 to halve its memory footprint. Values are     */  \
+/* stored in dB; with float16, levels up to 64 dB in magnitude stay     */  \
+/* within about 0.05 dB. This resets the object. With reduced-precision */  \
+/* storage, get_psd() unpacks the buffer into a separate                */  \
+/* single-precision output array.                                       */  \
+/*  _q       : spectral periodogram waterfall object                    */  \
+/*  _storage : storage format, e.g. LIQUID_STORAGE_FLOAT16              */  \
+int SPWATERFALL(_set_storage)(SPWATERFALL()       _q,                       \
+                              liquid_storage_type _storage);                \
+                                                                            \
 /* Set the center frequency of the received signal.                     */  \
 /* This is for display purposes only when generating the output image.  */  \
 /*  _q      : spectral periodogram waterfall object                     */  \
@@ -2000,6 +2164,68 @@ void firdespm_print(firdespm _q);
 // execute filter design, storing result in _h
 void firdespm_execute(firdespm _q, float * _h);
 
+// filter design cache for run-time reconfiguration: designs are keyed on
+// their parameters with least-recently-used eviction, and firdespm
+// designs which miss the cache are warm-started from the nearest cached
+// design of the same structure
+typedef struct firdescache_s * firdescache;
+
+// create filter design cache
+//  _capacity   :   maximum number of designs held, _capacity > 0
+firdescache firdescache_create(unsigned int _capacity);
+
+// destroy filter design cache, freeing all internal memory
+void firdescache_destroy(firdescache _q);
+
+// print filter design cache
+void firdescache_print(firdescache _q);
+
+// clear all designs and statistics
+void firdescache_reset(firdescache _q);
+
+// get number of designs found in cache
+unsigned long int firdescache_get_num_hits(firdescache _q);
+
+// get number of designs computed (not found in cache)
+unsigned long int firdescache_get_num_misses(firdescache _q);
+
+// get number of computed firdespm designs warm-started from cache
+unsigned long int firdescache_get_num_seeded(firdescache _q);
+
+// design Kaiser-windowed filter (see liquid_firdes_kaiser) using cache
+//  _q      : filter design cache
+//  _n      : filter length, _n > 0
+//  _fc     : cutoff frequency, 0 < _fc < 0.5
+//  _As     : stop-band attenuation [dB], _As > 0
+//  _mu     : fractional sample offset, -0.5 < _mu < 0.5
+//  _h      : output coefficient buffer, [size: _n x 1]
+void firdescache_kaiser(firdescache  _q,
+                        unsigned int _n,
+                        float        _fc,
+                        float        _As,
+                        float        _mu,
+                        float *      _h);
+
+// design Parks-McClellan filter (see firdespm_run) using cache
+//  _q          :   filter design cache
+//  _h_len      :   length of filter (number of taps)
+//  _num_bands  :   number of frequency bands
+//  _bands      :   band edges, f in [0,0.5], [size: _num_bands x 2]
+//  _des        :   desired response [size: _num_bands x 1]
+//  _weights    :   response weighting [size: _num_bands x 1]
+//  _wtype      :   weight types (e.g. LIQUID_FIRDESPM_FLATWEIGHT) [size: _num_bands x 1]
+//  _btype      :   band type (e.g. LIQUID_FIRDESPM_BANDPASS)
+//  _h          :   output coefficients array [size: _h_len x 1]
+void firdescache_firdespm(firdescache             _q,
+                          unsigned int            _h_len,
+                          unsigned int            _num_bands,
+                          float *                 _bands,
+                          float *                 _des,
+                          float *                 _weights,
+                          liquid_firdespm_wtype * _wtype,
+                          liquid_firdespm_btype   _btype,
+                          float *                 _h);
+
 
 // Design FIR using kaiser window
 //  _n      : filter length, _n > 0
@@ -2626,6 +2852,194 @@ LIQUID_FIRFILT_DEFINE_API(LIQUID_FIRFILT_MANGLE_CCCF,
                           liquid_float_complex,
                           liquid_float_complex)
 
+//
+// Fixed-point (Q15) finite impulse response filter
+//
+
+#define LIQUID_FIRFILT_MANGLE_RRRQ15(name) LIQUID_CONCAT(firfilt_rrrq15,name)
+#define LIQUID_FIRFILT_MANGLE_CRCQ15(name) LIQUID_CONCAT(firfilt_crcq15,name)
+#define LIQUID_FIRFILT_MANGLE_CCCQ15(name) LIQUID_CONCAT(firfilt_cccq15,name)
+
+// Macro:
+//   FIRFILT    : name-mangling macro
+//   TO         : output data type
+//   TC         : coefficients data type
+//   TI         : input data type
+#define LIQUID_FIRFILT_Q15_DEFINE_API(FIRFILT,TO,TC,TI)                     \
+                                                                            \
+/* Fixed-point (Q15) finite impulse response filter; outputs are        */  \
+/* rounded and saturated to [-32768, 32767]                             */  \
+typedef struct FIRFILT(_s) * FIRFILT();                                     \
+                                                                            \
+/* Create fixed-point filter object from Q15 coefficients               */  \
+/*  _h      : filter coefficients [size: _n x 1]                        */  \
+/*  _n      : number of filter coefficients, _n > 0                     */  \
+FIRFILT() FIRFILT(_create)(TC *         _h,                                 \
+                           unsigned int _n);                                \
+                                                                            \
+/* Create object using Kaiser-Bessel windowed sinc method, quantizing   */  \
+/* the coefficients to Q15                                              */  \
+/*  _n      : filter length, _n > 0                                     */  \
+/*  _fc     : filter normalized cut-off frequency, 0 < _fc < 0.5        */  \
+/*  _As     : filter stop-band attenuation [dB], _As > 0                */  \
+/*  _mu     : fractional sample offset, -0.5 < _mu < 0.5                */  \
+FIRFILT() FIRFILT(_create_kaiser)(unsigned int _n,                          \
+                                  float        _fc,                         \
+                                  float        _As,                         \
+                                  float        _mu);                        \
+                                                                            \
+/* Destroy filter object and free all internal memory                   */  \
+void FIRFILT(_destroy)(FIRFILT() _q);                                       \
+                                                                            \
+/* Reset filter object's internal buffer                                */  \
+void FIRFILT(_reset)(FIRFILT() _q);                                         \
+                                                                            \
+/* Print filter object information to stdout                            */  \
+void FIRFILT(_print)(FIRFILT() _q);                                         \
+                                                                            \
+/* Push sample into filter object's internal buffer                     */  \
+/*  _q      : filter object                                             */  \
+/*  _x      : single input sample                                       */  \
+void FIRFILT(_push)(FIRFILT() _q,                                           \
+                    TI        _x);                                          \
+                                                                            \
+/* Write block of samples into filter object's internal buffer          */  \
+/*  _q      : filter object                                             */  \
+/*  _x      : buffer of input samples, [size: _n x 1]                   */  \
+/*  _n      : number of input samples                                   */  \
+void FIRFILT(_write)(FIRFILT()    _q,                                       \
+                     TI *         _x,                                       \
+                     unsigned int _n);                                      \
+                                                                            \
+/* Execute vector dot product on the filter's internal buffer and       */  \
+/* coefficients                                                         */  \
+/*  _q      : filter object                                             */  \
+/*  _y      : pointer to single output sample                           */  \
+void FIRFILT(_execute)(FIRFILT() _q,                                        \
+                       TO *      _y);                                       \
+                                                                            \
+/* Execute the filter on a block of input samples; in-place operation   */  \
+/* is permitted (_x and _y may point to the same place in memory)       */  \
+/*  _q      : filter object                                             */  \
+/*  _x      : pointer to input array, [size: _n x 1]                    */  \
+/*  _n      : number of input, output samples                           */  \
+/*  _y      : pointer to output array, [size: _n x 1]                   */  \
+void FIRFILT(_execute_block)(FIRFILT()    _q,                               \
+                             TI *         _x,                               \
+                             unsigned int _n,                               \
+                             TO *         _y);                              \
+                                                                            \
+/* Get length of filter object (number of internal coefficients)        */  \
+unsigned int FIRFILT(_get_length)(FIRFILT() _q);                            \
+
+LIQUID_FIRFILT_Q15_DEFINE_API(LIQUID_FIRFILT_MANGLE_RRRQ15,
+                              liquid_q15,
+                              liquid_q15,
+                              liquid_q15)
+
+LIQUID_FIRFILT_Q15_DEFINE_API(LIQUID_FIRFILT_MANGLE_CRCQ15,
+                              liquid_cq15,
+                              liquid_q15,
+                              liquid_cq15)
+
+LIQUID_FIRFILT_Q15_DEFINE_API(LIQUID_FIRFILT_MANGLE_CCCQ15,
+                              liquid_cq15,
+                              liquid_cq15,
+                              liquid_cq15)
+
+//
+// Multi-channel finite impulse response filter
+//
+
+#define LIQUID_FIRFILTMC_MANGLE_RRRF(name) LIQUID_CONCAT(firfiltmc_rrrf,name)
+#define LIQUID_FIRFILTMC_MANGLE_CRCF(name) LIQUID_CONCAT(firfiltmc_crcf,name)
+#define LIQUID_FIRFILTMC_MANGLE_CCCF(name) LIQUID_CONCAT(firfiltmc_cccf,name)
+
+// Macro:
+//   FIRFILTMC  : name-mangling macro
+//   TO         : output data type
+//   TC         : coefficients data type
+//   TI         : input data type
+#define LIQUID_FIRFILTMC_DEFINE_API(FIRFILTMC,TO,TC,TI)                     \
+                                                                            \
+/* Multi-channel finite impulse response (FIR) filter, running the same */  \
+/* coefficients on several phase-coherent channels at once. Samples are */  \
+/* interleaved by channel and each coefficient is broadcast across all  */  \
+/* channels in a single pass.                                           */  \
+typedef struct FIRFILTMC(_s) * FIRFILTMC();                                 \
+                                                                            \
+/* Create multi-channel firfilt object from external coefficients       */  \
+/*  _h              : filter coefficients, [size: _n x 1]               */  \
+/*  _n              : filter length, _n > 0                             */  \
+/*  _num_channels   : number of channels, _num_channels > 0             */  \
+FIRFILTMC() FIRFILTMC(_create)(TC *         _h,                             \
+                               unsigned int _n,                             \
+                               unsigned int _num_channels);                 \
+                                                                            \
+/* Create multi-channel firfilt object using Kaiser-Bessel windowed     */  \
+/* sinc method                                                          */  \
+/*  _n              : filter length, _n > 0                             */  \
+/*  _fc             : normalized cut-off frequency, 0 < _fc < 0.5       */  \
+/*  _As             : filter stop-band attenuation [dB], _As > 0        */  \
+/*  _mu             : fractional sample offset, -0.5 < _mu < 0.5        */  \
+/*  _num_channels   : number of channels, _num_channels > 0             */  \
+FIRFILTMC() FIRFILTMC(_create_kaiser)(unsigned int _n,                      \
+                                      float        _fc,                     \
+                                      float        _As,                     \
+                                      float        _mu,                     \
+                                      unsigned int _num_channels);          \
+                                                                            \
+/* Destroy firfiltmc object, freeing all internal memory                */  \
+void FIRFILTMC(_destroy)(FIRFILTMC() _q);                                   \
+                                                                            \
+/* Print firfiltmc object properties to stdout                          */  \
+void FIRFILTMC(_print)(FIRFILTMC() _q);                                     \
+                                                                            \
+/* Reset firfiltmc object internal state for all channels               */  \
+void FIRFILTMC(_reset)(FIRFILTMC() _q);                                     \
+                                                                            \
+/* Set output scaling for filter                                        */  \
+void FIRFILTMC(_set_scale)(FIRFILTMC() _q,                                  \
+                           TC          _scale);                             \
+                                                                            \
+/* Get number of channels                                               */  \
+unsigned int FIRFILTMC(_get_num_channels)(FIRFILTMC() _q);                  \
+                                                                            \
+/* Compute filter output for one sample on each channel                 */  \
+/*  _q      : firfiltmc object                                          */  \
+/*  _x      : input samples, one per channel [size: _num_channels x 1]  */  \
+/*  _y      : output samples, one per channel [size: _num_channels x 1] */  \
+void FIRFILTMC(_execute)(FIRFILTMC() _q,                                    \
+                         TI *        _x,                                    \
+                         TO *        _y);                                   \
+                                                                            \
+/* Execute the filter on a block of channel-interleaved samples, i.e.   */  \
+/* _x[i*num_channels + c] is sample i of channel c; in-place operation  */  \
+/* is permitted (the input and output buffers may be the same)          */  \
+/*  _q      : firfiltmc object                                          */  \
+/*  _x      : input array, [size: _n*_num_channels x 1]                 */  \
+/*  _n      : number of samples per channel                             */  \
+/*  _y      : output array, [size: _n*_num_channels x 1]                */  \
+void FIRFILTMC(_execute_block)(FIRFILTMC()  _q,                             \
+                               TI *         _x,                             \
+                               unsigned int _n,                             \
+                               TO *         _y);                            \
+
+LIQUID_FIRFILTMC_DEFINE_API(LIQUID_FIRFILTMC_MANGLE_RRRF,
+                            float,
+                            float,
+                            float)
+
+LIQUID_FIRFILTMC_DEFINE_API(LIQUID_FIRFILTMC_MANGLE_CRCF,
+                            liquid_float_complex,
+                            float,
+                            liquid_float_complex)
+
+LIQUID_FIRFILTMC_DEFINE_API(LIQUID_FIRFILTMC_MANGLE_CCCF,
+                            liquid_float_complex,
+                            liquid_float_complex,
+                            liquid_float_complex)
+
 //
 // FIR Hilbert transform
 //  2:1 real-to-complex decimator
@@ -3046,6 +3460,105 @@ LIQUID_IIRFILT_DEFINE_API(LIQUID_IIRFILT_MANGLE_CCCF,
                           liquid_float_complex,
                           liquid_float_complex)
 
+//
+// Multi-channel infinite impulse response filter
+//
+
+#define LIQUID_IIRFILTMC_MANGLE_RRRF(name) LIQUID_CONCAT(iirfiltmc_rrrf,name)
+#define LIQUID_IIRFILTMC_MANGLE_CRCF(name) LIQUID_CONCAT(iirfiltmc_crcf,name)
+#define LIQUID_IIRFILTMC_MANGLE_CCCF(name) LIQUID_CONCAT(iirfiltmc_cccf,name)
+
+// Macro:
+//   IIRFILTMC  : name-mangling macro
+//   TO         : output data type
+//   TC         : coefficients data type
+//   TI         : input data type
+#define LIQUID_IIRFILTMC_DEFINE_API(IIRFILTMC,TO,TC,TI)                     \
+                                                                            \
+/* Multi-channel infinite impulse response (IIR) filter, running the    */  \
+/* same cascade of second-order sections on several independent         */  \
+/* channels at once. Samples are interleaved by channel so that each    */  \
+/* coefficient is applied to all channels in a single pass.             */  \
+typedef struct IIRFILTMC(_s) * IIRFILTMC();                                 \
+                                                                            \
+/* Create multi-channel IIR filter using 2nd-order sections from        */  \
+/* external coefficients.                                               */  \
+/*  _B              : feed-forward coefficients [size: _nsos x 3]       */  \
+/*  _A              : feed-back coefficients    [size: _nsos x 3]       */  \
+/*  _nsos           : number of second-order sections, _nsos > 0        */  \
+/*  _num_channels   : number of channels, _num_channels > 0             */  \
+IIRFILTMC() IIRFILTMC(_create_sos)(TC *         _B,                         \
+                                   TC *         _A,                         \
+                                   unsigned int _nsos,                      \
+                                   unsigned int _num_channels);             \
+                                                                            \
+/* Create multi-channel IIR filter from design template using           */  \
+/* second-order sections                                                */  \
+/*  _ftype          : filter type (e.g. LIQUID_IIRDES_BUTTER)           */  \
+/*  _btype          : band type (e.g. LIQUID_IIRDES_BANDPASS)           */  \
+/*  _order          : filter order, _order > 0                          */  \
+/*  _fc             : low-pass prototype cut-off frequency              */  \
+/*  _f0             : center frequency (band-pass, band-stop)           */  \
+/*  _Ap             : pass-band ripple in dB, _Ap > 0                   */  \
+/*  _As             : stop-band ripple in dB, _As > 0                   */  \
+/*  _num_channels   : number of channels, _num_channels > 0             */  \
+IIRFILTMC() IIRFILTMC(_create_prototype)(                                   \
+            liquid_iirdes_filtertype _ftype,                                \
+            liquid_iirdes_bandtype   _btype,                                \
+            unsigned int             _order,                                \
+            float                    _fc,                                   \
+            float                    _f0,                                   \
+            float                    _Ap,                                   \
+            float                    _As,                                   \
+            unsigned int             _num_channels);                        \
+                                                                            \
+/* Destroy iirfiltmc object, freeing all internal memory                */  \
+void IIRFILTMC(_destroy)(IIRFILTMC() _q);                                   \
+                                                                            \
+/* Print iirfiltmc object properties to stdout                          */  \
+void IIRFILTMC(_print)(IIRFILTMC() _q);                                     \
+                                                                            \
+/* Reset iirfiltmc object internals for all channels                    */  \
+void IIRFILTMC(_reset)(IIRFILTMC() _q);                                     \
+                                                                            \
+/* Get number of channels                                               */  \
+unsigned int IIRFILTMC(_get_num_channels)(IIRFILTMC() _q);                  \
+                                                                            \
+/* Compute filter output for one sample on each channel                 */  \
+/*  _q      : iirfiltmc object                                          */  \
+/*  _x      : input samples, one per channel [size: _num_channels x 1]  */  \
+/*  _y      : output samples, one per channel [size: _num_channels x 1] */  \
+void IIRFILTMC(_execute)(IIRFILTMC() _q,                                    \
+                         TI *        _x,                                    \
+                         TO *        _y);                                   \
+                                                                            \
+/* Execute the filter on a block of channel-interleaved samples, i.e.   */  \
+/* _x[i*num_channels + c] is sample i of channel c; in-place operation  */  \
+/* is permitted (the input and output buffers may be the same)          */  \
+/*  _q      : iirfiltmc object                                          */  \
+/*  _x      : input array, [size: _n*_num_channels x 1]                 */  \
+/*  _n      : number of samples per channel                             */  \
+/*  _y      : output array, [size: _n*_num_channels x 1]                */  \
+void IIRFILTMC(_execute_block)(IIRFILTMC()  _q,                             \
+                               TI *         _x,                             \
+                               unsigned int _n,                             \
+                               TO *         _y);                            \
+
+LIQUID_IIRFILTMC_DEFINE_API(LIQUID_IIRFILTMC_MANGLE_RRRF,
+                            float,
+                            float,
+                            float)
+
+LIQUID_IIRFILTMC_DEFINE_API(LIQUID_IIRFILTMC_MANGLE_CRCF,
+                            liquid_float_complex,
+                            float,
+                            liquid_float_complex)
+
+LIQUID_IIRFILTMC_DEFINE_API(LIQUID_IIRFILTMC_MANGLE_CCCF,
+                            liquid_float_complex,
+                            liquid_float_complex,
+                            liquid_float_complex)
+
 
 //
 // FIR Polyphase filter bank
@@ -3502,6 +4015,191 @@ LIQUID_FIRDECIM_DEFINE_API(LIQUID_FIRDECIM_MANGLE_CCCF,
                            liquid_float_complex,
                            liquid_float_complex)
 
+// Decimators with complex input may also ingest interleaved integer I/Q
+// samples (as delivered by SDR front-ends) directly, converting them as
+// they are buffered rather than in a separate pass
+#define LIQUID_FIRDECIM_CI_DEFINE_API(FIRDECIM,TO)                          \
+/* Execute decimator on block of _n*_M interleaved int16 I/Q samples;   */  \
+/* full scale (32768) corresponds to an amplitude of 1                  */  \
+/*  _q      : decimator object                                          */  \
+/*  _x      : input array, [size: 2*_n*_M x 1]                          */  \
+/*  _n      : number of _output_ samples                                */  \
+/*  _y      : output array, [_size: _n x 1]                             */  \
+void FIRDECIM(_execute_block_ci16)(FIRDECIM()   _q,                         \
+                                   int16_t *    _x,                         \
+                                   unsigned int _n,                         \
+                                   TO *         _y);                        \
+                                                                            \
+/* Execute decimator on block of _n*_M interleaved int8 I/Q samples;    */  \
+/* full scale (128) corresponds to an amplitude of 1                    */  \
+/*  _q      : decimator object                                          */  \
+/*  _x      : input array, [size: 2*_n*_M x 1]                          */  \
+/*  _n      : number of _output_ samples                                */  \
+/*  _y      : output array, [_size: _n x 1]                             */  \
+void FIRDECIM(_execute_block_ci8)(FIRDECIM()   _q,                          \
+                                  int8_t *     _x,                          \
+                                  unsigned int _n,                          \
+                                  TO *         _y);                         \
+
+LIQUID_FIRDECIM_CI_DEFINE_API(LIQUID_FIRDECIM_MANGLE_CRCF, liquid_float_complex)
+LIQUID_FIRDECIM_CI_DEFINE_API(LIQUID_FIRDECIM_MANGLE_CCCF, liquid_float_complex)
+
+// firdecim (Q15) : fixed-point finite impulse response decimator
+#define LIQUID_FIRDECIM_MANGLE_RRRQ15(name) LIQUID_CONCAT(firdecim_rrrq15,name)
+#define LIQUID_FIRDECIM_MANGLE_CRCQ15(name) LIQUID_CONCAT(firdecim_crcq15,name)
+#define LIQUID_FIRDECIM_MANGLE_CCCQ15(name) LIQUID_CONCAT(firdecim_cccq15,name)
+
+#define LIQUID_FIRDECIM_Q15_DEFINE_API(FIRDECIM,TO,TC,TI)                   \
+                                                                            \
+/* Fixed-point (Q15) finite impulse response (FIR) decimator; outputs   */  \
+/* are rounded and saturated to [-32768, 32767]                         */  \
+typedef struct FIRDECIM(_s) * FIRDECIM();                                   \
+                                                                            \
+/* Create decimator from Q15 coefficients                               */  \
+/*  _M      : decimation factor, _M >= 2                                */  \
+/*  _h      : filter coefficients, [size: _h_len x 1]                   */  \
+/*  _h_len  : filter length, _h_len >= _M                               */  \
+FIRDECIM() FIRDECIM(_create)(unsigned int _M,                               \
+                             TC *         _h,                               \
+                             unsigned int _h_len);                          \
+                                                                            \
+/* Create decimator from filter prototype (Kaiser-Bessel windowed-sinc  */  \
+/* function), quantizing the coefficients to Q15                        */  \
+/*  _M      : decimation factor, _M >= 2                                */  \
+/*  _m      : filter delay [symbols], _m >= 1                           */  \
+/*  _As     : stop-band attenuation [dB], _As >= 0                      */  \
+FIRDECIM() FIRDECIM(_create_kaiser)(unsigned int _M,                        \
+                                    unsigned int _m,                        \
+                                    float        _As);                      \
+                                                                            \
+/* Destroy decimator object, freeing all internal memory                */  \
+void FIRDECIM(_destroy)(FIRDECIM() _q);                                     \
+                                                                            \
+/* Print decimator object properties to stdout                          */  \
+void FIRDECIM(_print)(FIRDECIM() _q);                                       \
+                                                                            \
+/* Reset decimator object internal state                                */  \
+void FIRDECIM(_reset)(FIRDECIM() _q);                                       \
+                                                                            \
+/* Execute decimator on _M input samples                                */  \
+/*  _q      : decimator object                                          */  \
+/*  _x      : input samples, [size: _M x 1]                             */  \
+/*  _y      : output sample pointer                                     */  \
+void FIRDECIM(_execute)(FIRDECIM() _q,                                      \
+                        TI *       _x,                                      \
+                        TO *       _y);                                     \
+                                                                            \
+/* Execute decimator on block of _n*_M input samples                    */  \
+/*  _q      : decimator object                                          */  \
+/*  _x      : input array, [size: _n*_M x 1]                            */  \
+/*  _n      : number of _output_ samples                                */  \
+/*  _y      : output array, [_size: _n x 1]                             */  \
+void FIRDECIM(_execute_block)(FIRDECIM()   _q,                              \
+                              TI *         _x,                              \
+                              unsigned int _n,                              \
+                              TO *         _y);                             \
+
+LIQUID_FIRDECIM_Q15_DEFINE_API(LIQUID_FIRDECIM_MANGLE_RRRQ15,
+                               liquid_q15,
+                               liquid_q15,
+                               liquid_q15)
+
+LIQUID_FIRDECIM_Q15_DEFINE_API(LIQUID_FIRDECIM_MANGLE_CRCQ15,
+                               liquid_cq15,
+                               liquid_q15,
+                               liquid_cq15)
+
+LIQUID_FIRDECIM_Q15_DEFINE_API(LIQUID_FIRDECIM_MANGLE_CCCQ15,
+                               liquid_cq15,
+                               liquid_cq15,
+                               liquid_cq15)
+
+//
+// Multi-channel decimator
+//
+
+#define LIQUID_FIRDECIMMC_MANGLE_RRRF(name) LIQUID_CONCAT(firdecimmc_rrrf,name)
+#define LIQUID_FIRDECIMMC_MANGLE_CRCF(name) LIQUID_CONCAT(firdecimmc_crcf,name)
+#define LIQUID_FIRDECIMMC_MANGLE_CCCF(name) LIQUID_CONCAT(firdecimmc_cccf,name)
+
+#define LIQUID_FIRDECIMMC_DEFINE_API(FIRDECIMMC,TO,TC,TI)                   \
+                                                                            \
+/* Multi-channel finite impulse response (FIR) decimator, running the   */  \
+/* same coefficients on several phase-coherent channels at once with    */  \
+/* channel-interleaved samples                                          */  \
+typedef struct FIRDECIMMC(_s) * FIRDECIMMC();                               \
+                                                                            \
+/* Create multi-channel decimator from external coefficients            */  \
+/*  _M              : decimation factor, _M >= 2                        */  \
+/*  _h              : filter coefficients, [size: _h_len x 1]           */  \
+/*  _h_len          : filter length, _h_len >= _M                       */  \
+/*  _num_channels   : number of channels, _num_channels > 0             */  \
+FIRDECIMMC() FIRDECIMMC(_create)(unsigned int _M,                           \
+                                 TC *         _h,                           \
+                                 unsigned int _h_len,                       \
+                                 unsigned int _num_channels);               \
+                                                                            \
+/* Create multi-channel decimator using Kaiser-Bessel windowed sinc     */  \
+/*  _M              : decimation factor, _M >= 2                        */  \
+/*  _m              : filter delay (symbols), _m > 0                    */  \
+/*  _As             : stop-band attenuation [dB], _As > 0               */  \
+/*  _num_channels   : number of channels, _num_channels > 0             */  \
+FIRDECIMMC() FIRDECIMMC(_create_kaiser)(unsigned int _M,                    \
+                                        unsigned int _m,                    \
+                                        float        _As,                   \
+                                        unsigned int _num_channels);        \
+                                                                            \
+/* Destroy firdecimmc object, freeing all internal memory               */  \
+void FIRDECIMMC(_destroy)(FIRDECIMMC() _q);                                 \
+                                                                            \
+/* Print firdecimmc object properties to stdout                         */  \
+void FIRDECIMMC(_print)(FIRDECIMMC() _q);                                   \
+                                                                            \
+/* Reset firdecimmc object internal state for all channels              */  \
+void FIRDECIMMC(_reset)(FIRDECIMMC() _q);                                   \
+                                                                            \
+/* Set output scaling for decimator                                     */  \
+void FIRDECIMMC(_set_scale)(FIRDECIMMC() _q,                                \
+                            TC           _scale);                           \
+                                                                            \
+/* Get number of channels                                               */  \
+unsigned int FIRDECIMMC(_get_num_channels)(FIRDECIMMC() _q);                \
+                                                                            \
+/* Execute decimator on _M channel-interleaved input samples per        */  \
+/* channel, producing one output sample per channel                     */  \
+/*  _q      : firdecimmc object                                         */  \
+/*  _x      : input array, [size: _M*_num_channels x 1]                 */  \
+/*  _y      : output samples, one per channel [size: _num_channels x 1] */  \
+void FIRDECIMMC(_execute)(FIRDECIMMC() _q,                                  \
+                          TI *         _x,                                  \
+                          TO *         _y);                                 \
+                                                                            \
+/* Execute decimator on a block of _n*_M channel-interleaved input      */  \
+/* samples per channel                                                  */  \
+/*  _q      : firdecimmc object                                         */  \
+/*  _x      : input array, [size: _n*_M*_num_channels x 1]              */  \
+/*  _n      : number of _output_ samples per channel                    */  \
+/*  _y      : output array, [size: _n*_num_channels x 1]                */  \
+void FIRDECIMMC(_execute_block)(FIRDECIMMC() _q,                            \
+                                TI *         _x,                            \
+                                unsigned int _n,                            \
+                                TO *         _y);                           \
+
+LIQUID_FIRDECIMMC_DEFINE_API(LIQUID_FIRDECIMMC_MANGLE_RRRF,
+                             float,
+                             float,
+                             float)
+
+LIQUID_FIRDECIMMC_DEFINE_API(LIQUID_FIRDECIMMC_MANGLE_CRCF,
+                             liquid_float_complex,
+                             float,
+                             liquid_float_complex)
+
+LIQUID_FIRDECIMMC_DEFINE_API(LIQUID_FIRDECIMMC_MANGLE_CCCF,
+                             liquid_float_complex,
+                             liquid_float_complex,
+                             liquid_float_complex)
+
 
 // iirdecim : infinite impulse response decimator
 #define LIQUID_IIRDECIM_MANGLE_RRRF(name) LIQUID_CONCAT(iirdecim_rrrf,name)
@@ -3703,6 +4401,26 @@ void RESAMP2(_decim_execute)(RESAMP2() _q,                                  \
 void RESAMP2(_interp_execute)(RESAMP2() _q,                                 \
                               TI        _x,                                 \
                               TO *      _y);                                \
+                                                                            \
+/* Execute resampler as half-band decimator on a block of samples       */  \
+/*  _q  : resampler object                                              */  \
+/*  _x  : input array  [size: 2*_n x 1]                                 */  \
+/*  _n  : number of output samples                                      */  \
+/*  _y  : output array [size: _n x 1]                                   */  \
+void RESAMP2(_decim_execute_block)(RESAMP2()    _q,                         \
+                                   TI *         _x,                         \
+                                   unsigned int _n,                         \
+                                   TO *         _y);                        \
+                                                                            \
+/* Execute resampler as half-band interpolator on a block of samples    */  \
+/*  _q  : resampler object                                              */  \
+/*  _x  : input array  [size: _n x 1]                                   */  \
+/*  _n  : number of input samples                                       */  \
+/*  _y  : output array [size: 2*_n x 1]                                 */  \
+void RESAMP2(_interp_execute_block)(RESAMP2()    _q,                        \
+                                    TI *         _x,                        \
+                                    unsigned int _n,                        \
+                                    TO *         _y);                       \
 
 LIQUID_RESAMP2_DEFINE_API(LIQUID_RESAMP2_MANGLE_RRRF,
                           float,
@@ -4051,6 +4769,19 @@ float MSRESAMP2(_get_delay)(MSRESAMP2() _q);                                \
 void MSRESAMP2(_execute)(MSRESAMP2() _q,                                    \
                          TI *        _x,                                    \
                          TO *        _y);                                   \
+                                                                            \
+/* Execute multi-stage resampler on a block of samples, running each    */  \
+/* half-band stage over the whole block before the next                 */  \
+/*  LIQUID_RESAMP_INTERP:   input: _n,    output: _n*M                  */  \
+/*  LIQUID_RESAMP_DECIM:    input: _n*M,  output: _n                    */  \
+/*  _q      : msresamp object                                           */  \
+/*  _x      : input sample array                                        */  \
+/*  _n      : number of calls to _execute() equivalent to this block    */  \
+/*  _y      : output sample array                                       */  \
+void MSRESAMP2(_execute_block)(MSRESAMP2()  _q,                             \
+                               TI *         _x,                             \
+                               unsigned int _n,                             \
+                               TO *         _y);                            \
 
 LIQUID_MSRESAMP2_DEFINE_API(LIQUID_MSRESAMP2_MANGLE_RRRF,
                             float,
@@ -4220,6 +4951,20 @@ void SYMSYNC(_execute)(SYMSYNC()      _q,                                   \
                        unsigned int   _nx,                                  \
                        TO *           _y,                                   \
                        unsigned int * _ny);                                 \
+                                                                            \
+/* Execute synchronizer on block of input samples, buffering input      */  \
+/* linearly so both matched and derivative filterbanks read the same    */  \
+/* memory; equivalent to _execute() for any partitioning of the input   */  \
+/*  _q      : synchronizer object                                       */  \
+/*  _x      : input data array, [size: _nx x 1]                         */  \
+/*  _nx     : number of input samples                                   */  \
+/*  _y      : output data array                                         */  \
+/*  _ny     : number of samples written to output buffer                */  \
+void SYMSYNC(_execute_block)(SYMSYNC()      _q,                             \
+                             TI *           _x,                             \
+                             unsigned int   _nx,                            \
+                             TO *           _y,                             \
+                             unsigned int * _ny);                           \
 
 LIQUID_SYMSYNC_DEFINE_API(LIQUID_SYMSYNC_MANGLE_RRRF,
                           float,
@@ -4299,6 +5044,22 @@ void FIRFARROW(_execute_block)(FIRFARROW()  _q,                             \
                                unsigned int _n,                             \
                                TO *         _y);                            \
                                                                             \
+/* Execute firfarrow filter on block of samples, each with its own      */  \
+/* fractional delay. Equivalent to calling _push(), _set_delay() and    */  \
+/* _execute() per sample, but evaluates one dot product per polynomial  */  \
+/* branch and combines them by Horner's rule rather than recomputing    */  \
+/* the filter taps. In-place operation is permitted.                    */  \
+/*  _q      : firfarrow object                                          */  \
+/*  _x      : input array, [size: _n x 1]                               */  \
+/*  _mu     : fractional sample delay array, [size: _n x 1]             */  \
+/*  _n      : input, output array size                                  */  \
+/*  _y      : output array, [size: _n x 1]                              */  \
+void FIRFARROW(_execute_block_delay)(FIRFARROW()  _q,                       \
+                                     TI *         _x,                       \
+                                     float *      _mu,                      \
+                                     unsigned int _n,                       \
+                                     TO *         _y);                      \
+                                                                            \
 /* Get length of firfarrow object (number of filter taps)               */  \
 unsigned int FIRFARROW(_get_length)(FIRFARROW() _q);                        \
                                                                             \
@@ -4488,6 +5249,10 @@ void         qpacketmodem_destroy(qpacketmodem _q);
 void         qpacketmodem_reset  (qpacketmodem _q);
 void         qpacketmodem_print  (qpacketmodem _q);
 
+// get number of bytes allocated by object, including packetizer (the
+// modem is not included)
+unsigned long int qpacketmodem_get_memory_usage(qpacketmodem _q);
+
 int qpacketmodem_configure(qpacketmodem _q,
                            unsigned int _payload_len,
                            crc_scheme   _check,
@@ -4789,6 +5554,15 @@ void flexframesync_destroy(flexframesync _q);
 // print frame synchronizer internal properties
 void flexframesync_print(flexframesync _q);
 
+// get number of bytes allocated by object: frame buffers, detector
+// and header/payload decoders. This is a lower bound; the following
+// sub-objects are not included: carrier mixer and pll (nco_crcf),
+// matched filter bank (firpfb_crcf), equalizer (eqlms_cccf, when
+// compiled in), header pilot synchronizer (qpilotsync), payload
+// phase-recovery modem, the modems and libfec decoder state inside
+// the header/payload decoders, and the detector's FFT plans.
+unsigned long int flexframesync_get_memory_usage(flexframesync _q);
+
 // reset frame synchronizer internal state
 void flexframesync_reset(flexframesync _q);
 
@@ -4823,6 +5597,11 @@ void flexframesync_execute(flexframesync          _q,
 void             flexframesync_reset_framedatastats(flexframesync _q);
 framedatastats_s flexframesync_get_framedatastats  (flexframesync _q);
 
+// per-stage profile (detect, mf, eq, demod, decode); counters are
+// only updated when configured with --enable-profile
+void             flexframesync_reset_profile(flexframesync _q);
+liquid_profile_s flexframesync_get_profile  (flexframesync _q);
+
 // enable/disable debugging
 void flexframesync_debug_enable(flexframesync _q);
 void flexframesync_debug_disable(flexframesync _q);
@@ -5405,6 +6184,9 @@ void qdetector_cccf_destroy(qdetector_cccf _q);
 void qdetector_cccf_print  (qdetector_cccf _q);
 void qdetector_cccf_reset  (qdetector_cccf _q);
 
+// get number of bytes allocated by object (excluding FFT plans)
+unsigned long int qdetector_cccf_get_memory_usage(qdetector_cccf _q);
+
 // run detector, looking for sequence; return pointer to aligned, buffered samples
 void * qdetector_cccf_execute(qdetector_cccf       _q,
                               liquid_float_complex _x);
@@ -5691,6 +6473,19 @@ int MSOURCE(_get_frequency)(MSOURCE() _q,                                   \
                             int       _id,                                  \
                             float *   _dphi);                               \
                                                                             \
+/* Set number of threads used to generate sources, 0 for one per        */  \
+/* online processor (default: 1). Each source is generated into its     */  \
+/* own buffer and sources are combined in order, so the output does     */  \
+/* not depend on the number of threads; user callbacks may be invoked   */  \
+/* from worker threads. Always 1 when built without thread support.     */  \
+/*  _q          : msource object                                        */  \
+/*  _num_threads: number of threads, including calling thread           */  \
+void MSOURCE(_set_num_threads)(MSOURCE()    _q,                             \
+                               unsigned int _num_threads);                  \
+                                                                            \
+/* Get number of threads used to generate sources                       */  \
+unsigned int MSOURCE(_get_num_threads)(MSOURCE() _q);                       \
+                                                                            \
 /* Write block of samples to output buffer                              */  \
 /*  _q      : synchronizer object                                       */  \
 /*  _buf    : output buffer, [size: _buf_len x 1]                       */  \
@@ -5804,6 +6599,113 @@ LIQUID_SYMTRACK_DEFINE_API(LIQUID_SYMTRACK_MANGLE_CCCF,
                            liquid_float_complex)
 
 
+//
+// Monte-Carlo link simulation: bit and packet error rates, with trials
+// sharded across threads
+//
+
+// link simulation results at one signal-to-noise ratio
+typedef struct {
+    float             SNRdB;                // signal-to-noise ratio [dB]
+    unsigned long int num_trials;           // number of trials (packets)
+    unsigned long int num_packet_errors;    // number of packets in error
+    unsigned long int num_bits;             // number of payload bits
+    unsigned long int num_bit_errors;       // number of payload bits in error
+    float             BER;                  // bit error rate
+    float             PER;                  // packet error rate
+    float             PER_lo;               // PER 95% confidence interval, lower
+    float             PER_hi;               // PER 95% confidence interval, upper
+} linksimstats_s;
+
+// print link simulation results
+void linksimstats_print(linksimstats_s * _stats);
+
+// Link simulation trial callback, running one trial (e.g. packet). All
+// random processes must be seeded from _seed (e.g. with
+// channel_cccf_set_seed()) so that results do not depend on which thread
+// runs the trial. Invoked concurrently, each thread with its own context.
+//  _context        :   per-thread context
+//  _SNRdB          :   signal-to-noise ratio [dB]
+//  _seed           :   trial seed
+//  _num_bits       :   number of payload bits in trial (output)
+//  _num_bit_errors :   number of payload bits in error (output)
+//  returns 1 if the packet is in error, 0 otherwise
+typedef int (*linksim_trial_callback)(void *            _context,
+                                      float             _SNRdB,
+                                      unsigned long int _seed,
+                                      unsigned int *    _num_bits,
+                                      unsigned int *    _num_bit_errors);
+
+// create/destroy per-thread trial context from user data
+typedef void * (*linksim_context_create_callback) (void * _userdata);
+typedef void   (*linksim_context_destroy_callback)(void * _context);
+
+typedef struct linksim_s * linksim;
+
+// create link simulation from user-defined trial
+//  _trial      :   trial callback
+//  _create     :   per-thread context constructor (NULL: share _userdata)
+//  _destroy    :   per-thread context destructor (may be NULL)
+//  _userdata   :   user data passed to context constructor
+linksim linksim_create(linksim_trial_callback           _trial,
+                       linksim_context_create_callback  _create,
+                       linksim_context_destroy_callback _destroy,
+                       void *                           _userdata);
+
+// create link simulation of packet modem: modulation and forward error
+// correction with ideal timing and carrier recovery; SNR is Es/N0
+linksim linksim_create_qpacketmodem(unsigned int      _payload_len,
+                                    crc_scheme        _check,
+                                    fec_scheme        _fec0,
+                                    fec_scheme        _fec1,
+                                    int               _ms);
+
+// create link simulation of flexible frame: modulation and forward error
+// correction including frame detection and synchronization; SNR is per
+// sample, missed frames count half the payload bits in error
+linksim linksim_create_flexframe(unsigned int      _payload_len,
+                                 crc_scheme        _check,
+                                 fec_scheme        _fec0,
+                                 fec_scheme        _fec1,
+                                 int               _ms);
+
+void linksim_destroy(linksim _q);
+void linksim_print  (linksim _q);
+
+// set number of worker threads, 0 for one per online processor (default);
+// always 1 when built without thread support
+void         linksim_set_num_threads(linksim _q, unsigned int _num_threads);
+unsigned int linksim_get_num_threads(linksim _q);
+
+// set simulation seed (default: 1)
+void linksim_set_seed(linksim _q, unsigned long int _seed);
+
+// set fewest and most trials per signal-to-noise ratio (default: 100, 10000)
+void linksim_set_num_trials(linksim           _q,
+                            unsigned long int _min_trials,
+                            unsigned long int _max_trials);
+
+// set early stopping: trials at each signal-to-noise ratio stop once the
+// 95% confidence interval half-width on PER is within _precision*PER
+// (default: 0.2, 0 disables)
+void linksim_set_precision(linksim _q, float _precision);
+
+// run simulation at one signal-to-noise ratio
+void linksim_run(linksim          _q,
+                 float            _SNRdB,
+                 linksimstats_s * _stats);
+
+// run simulation over _num_steps signal-to-noise ratios from _SNRdB_min
+// to _SNRdB_max, stopping after the first with no packet errors; returns
+// the number of results written
+//  _stats      :   results [size: _num_steps x 1]
+unsigned int linksim_run_sweep(linksim          _q,
+                               float            _SNRdB_min,
+                               float            _SNRdB_max,
+                               unsigned int     _num_steps,
+                               linksimstats_s * _stats);
+
+
 
 //
 // MODULE : math
@@ -6933,6 +7835,20 @@ void MODEM(_demodulate_soft)(MODEM()         _q,                            \
                              unsigned int  * _s,                            \
                              unsigned char * _soft_bits);                   \
                                                                             \
+/* Demodulate fixed-point (Q15) input sample and provide (approximate)  */  \
+/* log-likelihood ratio (soft bits) as an output. The input is taken    */  \
+/* at half scale (full-scale Q15 corresponds to an amplitude of 2) to   */  \
+/* leave headroom for constellation peaks and noise; distance metrics   */  \
+/* are computed in integer arithmetic.                                  */  \
+/*  _q          : modem object                                          */  \
+/*  _x          : input sample, scaled by 1/2                           */  \
+/*  _s          : output hard symbol, 0 <= _s <= M-1                    */  \
+/*  _soft_bits  : output soft bits, [size: log2(M) x 1]                 */  \
+void MODEM(_demodulate_soft_q15)(MODEM()         _q,                        \
+                                 liquid_cq15     _x,                        \
+                                 unsigned int  * _s,                        \
+                                 unsigned char * _soft_bits);               \
+                                                                            \
 /* Get demodulator's estimated transmit sample                          */  \
 void MODEM(_get_demodulator_sample)(MODEM() _q,                             \
                                     TC *    _x_hat);                        \
@@ -6983,6 +7899,14 @@ void gmskdem_destroy(gmskdem _q);
 void gmskdem_print(gmskdem _q);
 void gmskdem_reset(gmskdem _q);
 void gmskdem_set_eq_bw(gmskdem _q, float _bw);
+
+// set discriminator accuracy; default 0 computes the full-precision
+// phase difference, a positive value uses a faster polynomial
+// approximation within _tol radians
+//  _q      :   demodulator object
+//  _tol    :   maximum absolute phase error [radians], _tol >= 0
+void gmskdem_set_tolerance(gmskdem _q, float _tol);
+
 void gmskdem_demodulate(gmskdem _q,
                         liquid_float_complex * _y,
                         unsigned int * _sym);
@@ -7071,6 +7995,13 @@ void cpfskdem_reset(cpfskdem _q);
 // get receive delay [symbols]
 unsigned int cpfskdem_get_delay(cpfskdem _q);
 
+// set discriminator accuracy; default 0 computes the full-precision
+// phase difference, a positive value uses a faster polynomial
+// approximation within _tol radians
+//  _q      :   demodulator object
+//  _tol    :   maximum absolute phase error [radians], _tol >= 0
+void cpfskdem_set_tolerance(cpfskdem _q, float _tol);
+
 #if 0
 // demodulate array of samples
 //  _q      :   continuous-phase frequency demodulator object
@@ -7237,6 +8168,15 @@ void FREQDEM(_print)(FREQDEM() _q);                             \
 /* reset state                                              */  \
 void FREQDEM(_reset)(FREQDEM() _q);                             \
                                                                 \
+/* set accuracy of discriminator, approximating arg{*} to   */  \
+/* within _tol radians; the default (_tol = 0) computes     */  \
+/* arg{*} in full precision. A non-zero tolerance changes   */  \
+/* the output of both _demodulate() and _demodulate_block() */  \
+/*  _q      :   frequency demodulator object                */  \
+/*  _tol    :   maximum absolute phase error [radians]      */  \
+void FREQDEM(_set_tolerance)(FREQDEM() _q,                      \
+                             float     _tol);                   \
+                                                                \
 /* demodulate sample                                        */  \
 /*  _q      :   frequency modulator object                  */  \
 /*  _r      :   received signal r(t)                        */  \
@@ -7453,6 +8393,21 @@ void FIRPFBCH2(_reset)(FIRPFBCH2() _q);                         \
 /* print firpfbch2 object internals                         */  \
 void FIRPFBCH2(_print)(FIRPFBCH2() _q);                         \
                                                                 \
+/* get number of bytes allocated by object for its window   */  \
+/* buffers and IFFT arrays (dot products and FFT plan are   */  \
+/* not included)                                            */  \
+unsigned long int                                               \
+FIRPFBCH2(_get_memory_usage)(FIRPFBCH2() _q);                   \
+                                                                \
+/* set storage format of window buffers, e.g.               */  \
+/* LIQUID_STORAGE_FLOAT16, halving their memory footprint;  */  \
+/* samples are converted as they are pushed and read for    */  \
+/* each dot product. This resets the object.                */  \
+/*  _q          : filterbank object                         */  \
+/*  _storage    : storage format                            */  \
+int FIRPFBCH2(_set_storage)(FIRPFBCH2()         _q,             \
+                            liquid_storage_type _storage);      \
+                                                                \
 /* execute filterbank channelizer                           */  \
 /* LIQUID_ANALYZER:     input: M/2, output: M               */  \
 /* LIQUID_SYNTHESIZER:  input: M,   output: M/2             */  \
@@ -7809,6 +8764,53 @@ void NCO(_mix_block_down)(NCO()        _q,                                  \
                           TC *         _x,                                  \
                           TC *         _y,                                  \
                           unsigned int _n);                                 \
+                                                                            \
+/* Rotate interleaved int16 I/Q input vector down by NCO angle          */  \
+/* (stepping), converting to floating-point; full scale (32768)         */  \
+/* corresponds to an amplitude of 1                                     */  \
+/*  _q      : nco object                                                */  \
+/*  _x      : array of input samples,  [size: 2*_n x 1]                 */  \
+/*  _y      : array of output samples, [size: _n x 1]                   */  \
+/*  _n      : number of input (and output) samples                      */  \
+void NCO(_mix_block_down_ci16)(NCO()        _q,                             \
+                               int16_t *    _x,                             \
+                               TC *         _y,                             \
+                               unsigned int _n);                            \
+                                                                            \
+/* Rotate interleaved int8 I/Q input vector down by NCO angle           */  \
+/* (stepping), converting to floating-point; full scale (128)           */  \
+/* corresponds to an amplitude of 1                                     */  \
+/*  _q      : nco object                                                */  \
+/*  _x      : array of input samples,  [size: 2*_n x 1]                 */  \
+/*  _y      : array of output samples, [size: _n x 1]                   */  \
+/*  _n      : number of input (and output) samples                      */  \
+void NCO(_mix_block_down_ci8)(NCO()        _q,                              \
+                              int8_t *     _x,                              \
+                              TC *         _y,                              \
+                              unsigned int _n);                             \
+                                                                            \
+/* Rotate fixed-point (Q15) input vector up by NCO angle (stepping),    */  \
+/* rounding and saturating outputs to [-32768, 32767]. The phase steps  */  \
+/* identically to mix_block_up().                                       */  \
+/*  _q      : nco object                                                */  \
+/*  _x      : array of input samples,  [size: _n x 1]                   */  \
+/*  _y      : array of output samples, [size: _n x 1]                   */  \
+/*  _n      : number of input (and output) samples                      */  \
+void NCO(_mix_block_up_q15)(NCO()         _q,                               \
+                            liquid_cq15 * _x,                               \
+                            liquid_cq15 * _y,                               \
+                            unsigned int  _n);                              \
+                                                                            \
+/* Rotate fixed-point (Q15) input vector down by NCO angle (stepping),  */  \
+/* rounding and saturating outputs to [-32768, 32767]                   */  \
+/*  _q      : nco object                                                */  \
+/*  _x      : array of input samples,  [size: _n x 1]                   */  \
+/*  _y      : array of output samples, [size: _n x 1]                   */  \
+/*  _n      : number of input (and output) samples                      */  \
+void NCO(_mix_block_down_q15)(NCO()         _q,                             \
+                              liquid_cq15 * _x,                             \
+                              liquid_cq15 * _y,                             \
+                              unsigned int  _n);                            \
 
 // Define nco APIs
 LIQUID_NCO_DEFINE_API(LIQUID_NCO_MANGLE_FLOAT, float, liquid_float_complex)
@@ -8151,6 +9153,49 @@ void expand_cf_mulaw(liquid_float_complex _y, float _mu, liquid_float_complex *
 unsigned int quantize_adc(float _x, unsigned int _num_bits);
 float quantize_dac(unsigned int _s, unsigned int _num_bits);
 
+// Q15 fixed-point conversion; values are rounded to the nearest level
+// and saturated to [-32768, 32767] (i.e. [-1, 1-2^-15])
+liquid_q15 liquid_float_to_q15(float _x);
+float liquid_q15_to_float(liquid_q15 _x);
+
+// convert block of samples to/from Q15; complex arrays may be converted
+// by casting and doubling the length
+//  _x      : input array [size: _n x 1]
+//  _n      : number of samples
+//  _y      : output array [size: _n x 1]
+void liquid_float_to_q15_block(float *      _x,
+                               unsigned int _n,
+                               liquid_q15 * _y);
+void liquid_q15_to_float_block(liquid_q15 * _x,
+                               unsigned int _n,
+                               float *      _y);
+
+// half-precision conversion; values are rounded to the nearest even
+// representable value, and float16 values beyond +/-65504 become
+// infinite. Converting back to float is exact.
+liquid_float16  liquid_float_to_float16(float _x);
+float           liquid_float16_to_float(liquid_float16 _x);
+liquid_bfloat16 liquid_float_to_bfloat16(float _x);
+float           liquid_bfloat16_to_float(liquid_bfloat16 _x);
+
+// convert block of samples to/from half precision (using F16C
+// instructions where the compiler enables them)
+//  _x      : input array [size: _n x 1]
+//  _n      : number of samples
+//  _y      : output array [size: _n x 1]
+void liquid_float_to_float16_block(float *          _x,
+                                   unsigned int     _n,
+                                   liquid_float16 * _y);
+void liquid_float16_to_float_block(liquid_float16 * _x,
+                                   unsigned int     _n,
+                                   float *          _y);
+void liquid_float_to_bfloat16_block(float *           _x,
+                                    unsigned int      _n,
+                                    liquid_bfloat16 * _y);
+void liquid_bfloat16_to_float_block(liquid_bfloat16 * _x,
+                                    unsigned int      _n,
+                                    float *           _y);
+
 // structured quantizer
 
 typedef enum {
@@ -8653,6 +9698,14 @@ void VECTOR(_carg)(T *          _x,                                         \
                    unsigned int _n,                                         \
                    TP *         _theta);                                    \
                                                                             \
+/* Compute phase difference of consecutive elements (discriminator):    */  \
+/*   y[i] = arg{ conj(x[i]) x[i+1] } for _n outputs from _n+1 inputs,   */  \
+/*   approximating arg{*} to within _tol radians (0: full precision)    */  \
+void VECTOR(_cargdiff)(T *          _x,                                     \
+                       unsigned int _n,                                     \
+                       TP           _tol,                                   \
+                       TP *         _y);                                    \
+                                                                            \
 /* Compute absolute value of each element: y[i] = |x[i]|                */  \
 void VECTOR(_abs)(T *          _x,                                          \
                   unsigned int _n,                                          \
@@ -73,6 +73,50 @@
 // MODULE : dotprod
 //
 
+// saturate integer value to Q15 range, [-32768, 32767]
+#define LIQUID_Q15_SATURATE(v)  ((v) > 32767 ? 32767 : ((v) < -32768 ? -32768 : (v)))
+
+// round Q30 product (or sum of products) to Q15 and saturate
+#define LIQUID_Q15_ROUND(v)     LIQUID_Q15_SATURATE(((v) + (1<<14)) >> 15)
+
+// Determine whether coefficients require 64-bit accumulation, i.e. if
+// the sum of |_h[i]| over the taps feeding any one 32-bit accumulator
+// lane could reach 2^16
+//  _h      : coefficients [size: _n x 1]
+//  _n      : length
+int liquid_q15_dotprod_wide(int16_t *    _h,
+                            unsigned int _n);
+
+// Q15 dot product kernels, returning the exact sum of products as Q30;
+// coefficients _h must not contain -32768. The kernels accumulate in
+// 32-bit lanes (_wide=0) when liquid_q15_dotprod_wide() reports that no
+// lane can overflow, and in 64 bits otherwise (_wide=1).
+//  _h      : coefficients [size: _n x 1]
+//  _x      : input [size: _n x 1]
+//  _n      : length
+//  _wide   : accumulate in 64 bits?
+int64_t liquid_q15_dotprod(int16_t *    _h,
+                           int16_t *    _x,
+                           unsigned int _n,
+                           int          _wide);
+
+// Two Q15 dot products over the same input, e.g. the real and imaginary
+// components of a complex dot product on interleaved samples
+//  _h0     : first coefficients [size: _n x 1]
+//  _h1     : second coefficients [size: _n x 1]
+//  _x      : input [size: _n x 1]
+//  _n      : length
+//  _wide   : accumulate in 64 bits?
+//  _y0     : first output (Q30)
+//  _y1     : second output (Q30)
+void liquid_q15_dotprod2(int16_t *    _h0,
+                         int16_t *    _h1,
+                         int16_t *    _x,
+                         unsigned int _n,
+                         int          _wide,
+                         int64_t *    _y0,
+                         int64_t *    _y1);
+
 
 //
 // MODULE : fec (forward error-correction)
@@ -813,6 +857,121 @@ LIQUID_FIRFARROW_DEFINE_INTERNAL_API(LIQUID_FIRFARROW_MANGLE_CRCF,
                                      float,
                                      liquid_float_complex)
 
+// fir filter
+#define LIQUID_FIRFILT_DEFINE_INTERNAL_API(FIRFILT,TO,TC,TI)            \
+                                                                        \
+/* fold filter coefficients, returning 1 if they are symmetric      */  \
+/*  _h      : filter coefficients [size: _h_len x 1]                */  \
+/*  _h_len  : filter length                                         */  \
+/*  _hs     : folded coefficients [size: (_h_len+1)/2 x 1]          */  \
+int FIRFILT(_fold)(TC *         _h,                                     \
+                   unsigned int _h_len,                                 \
+                   TC *         _hs);                                   \
+                                                                        \
+/* folded (linear-phase) dot product on a block of outputs; the     */  \
+/* input is stored as _M de-interleaved phases so that sample t is  */  \
+/* _x[t % _M][t / _M], and output k covers samples k*_M through     */  \
+/* k*_M+_h_len-1                                                    */  \
+/*  _hs     : folded coefficients [size: (_h_len+1)/2 x 1]          */  \
+/*  _h_len  : filter length                                         */  \
+/*  _x      : phase buffers, each padded by 3 samples               */  \
+/*  _M      : number of phases (decimation rate)                    */  \
+/*  _n      : number of outputs                                     */  \
+/*  _y      : output array [size: _n x 1]                           */  \
+void FIRFILT(_dotprod_sym)(TC *         _hs,                            \
+                           unsigned int _h_len,                         \
+                           TI **        _x,                             \
+                           unsigned int _M,                             \
+                           unsigned int _n,                             \
+                           TO *         _y);
+
+LIQUID_FIRFILT_DEFINE_INTERNAL_API(LIQUID_FIRFILT_MANGLE_RRRF,
+                                   float,
+                                   float,
+                                   float)
+
+LIQUID_FIRFILT_DEFINE_INTERNAL_API(LIQUID_FIRFILT_MANGLE_CRCF,
+                                   liquid_float_complex,
+                                   float,
+                                   liquid_float_complex)
+
+LIQUID_FIRFILT_DEFINE_INTERNAL_API(LIQUID_FIRFILT_MANGLE_CCCF,
+                                   liquid_float_complex,
+                                   liquid_float_complex,
+                                   liquid_float_complex)
+
+// fir polyphase filterbank
+#define LIQUID_FIRPFB_DEFINE_INTERNAL_API(FIRPFB,TO,TC,TI)              \
+                                                                        \
+/* execute filter _i on external buffer rather than internal window */  \
+/*  _q      : firpfb object                                         */  \
+/*  _i      : index of filter to use                                */  \
+/*  _x      : input buffer, oldest sample first [size: h_sub_len]   */  \
+/*  _y      : pointer to output sample                              */  \
+void FIRPFB(_run)(FIRPFB()     _q,                                      \
+                  unsigned int _i,                                      \
+                  TI *         _x,                                      \
+                  TO *         _y);                                     \
+                                                                        \
+/* push block of samples, executing every filter after each         */  \
+/*  _q      : firpfb object                                         */  \
+/*  _x      : input array [size: _n x 1]                            */  \
+/*  _n      : number of input samples                               */  \
+/*  _y      : output array [size: num_filters*_n x 1]               */  \
+void FIRPFB(_execute_bank_block)(FIRPFB()     _q,                       \
+                                 TI *         _x,                       \
+                                 unsigned int _n,                       \
+                                 TO *         _y);
+
+LIQUID_FIRPFB_DEFINE_INTERNAL_API(LIQUID_FIRPFB_MANGLE_RRRF,
+                                  float,
+                                  float,
+                                  float)
+
+LIQUID_FIRPFB_DEFINE_INTERNAL_API(LIQUID_FIRPFB_MANGLE_CRCF,
+                                  liquid_float_complex,
+                                  float,
+                                  liquid_float_complex)
+
+LIQUID_FIRPFB_DEFINE_INTERNAL_API(LIQUID_FIRPFB_MANGLE_CCCF,
+                                  liquid_float_complex,
+                                  liquid_float_complex,
+                                  liquid_float_complex)
+
+// multi-channel fir filter
+#define LIQUID_FIRFILTMC_DEFINE_INTERNAL_API(FIRFILTMC,TO,TC,TI)        \
+                                                                        \
+/* multi-channel dot product on channel-interleaved input,          */  \
+/* y[c] = scale * sum_k h[k] x[k*num_channels + c], with each       */  \
+/* coefficient broadcast across channels in lanes                   */  \
+/*  _h              : coefficients [size: _h_len x 1]               */  \
+/*  _h_len          : number of coefficients                        */  \
+/*  _x              : input [size: _h_len*_num_channels x 1]        */  \
+/*  _num_channels   : number of channels                            */  \
+/*  _scale          : output scaling factor                         */  \
+/*  _y              : output [size: _num_channels x 1]              */  \
+void FIRFILTMC(_dotprod)(TC *         _h,                               \
+                         unsigned int _h_len,                           \
+                         TI *         _x,                               \
+                         unsigned int _num_channels,                    \
+                         TC           _scale,                           \
+                         TO *         _y);
+
+LIQUID_FIRFILTMC_DEFINE_INTERNAL_API(LIQUID_FIRFILTMC_MANGLE_RRRF,
+                                     float,
+                                     float,
+                                     float)
+
+LIQUID_FIRFILTMC_DEFINE_INTERNAL_API(LIQUID_FIRFILTMC_MANGLE_CRCF,
+                                     liquid_float_complex,
+                                     float,
+                                     liquid_float_complex)
+
+LIQUID_FIRFILTMC_DEFINE_INTERNAL_API(LIQUID_FIRFILTMC_MANGLE_CCCF,
+                                     liquid_float_complex,
+                                     liquid_float_complex,
+                                     liquid_float_complex)
+
 
 
 // 
@@ -951,6 +1110,27 @@ float liquid_firdes_rkaiser_internal_isi(unsigned int _k,
                                          float _rho,
                                          float * _h);
 
+// firdespm : warm start from the extremal frequencies of a similar
+// design, as used by firdescache
+
+// get number of extremal frequencies in design
+unsigned int firdespm_get_num_extremals(firdespm _q);
+
+// get extremal frequencies of most recent design
+//  _q      :   firdespm object
+//  _fext   :   extremal frequencies [size: num_extremals x 1]
+void firdespm_get_extremal_frequencies(firdespm _q,
+                                       float *  _fext);
+
+// execute filter design with Remez exchange seeded from extremal
+// frequencies rather than evenly spaced on the grid
+//  _q      :   firdespm object
+//  _fext   :   initial extremal frequencies [size: num_extremals x 1]
+//  _h      :   output coefficients array [size: h_len x 1]
+void firdespm_execute_seeded(firdespm _q,
+                             float *  _fext,
+                             float *  _h);
+
 // Design flipped Nyquist/root-Nyquist filters
 void liquid_firdes_fnyquist(liquid_firfilt_type _type,
                             int                 _root,
@@ -1229,6 +1409,24 @@ float QSOURCE(_get_frequency)(QSOURCE() _q);                                \
 void QSOURCE(_generate)(QSOURCE() _q,                                       \
                         TO *      _v);                                      \
                                                                             \
+/* Generate block of samples                                            */  \
+/*  _q      : qsource object                                            */  \
+/*  _v      : output samples [size: _n x 1]                             */  \
+/*  _n      : number of samples to generate                             */  \
+void QSOURCE(_generate_block)(QSOURCE()    _q,                              \
+                              TO *         _v,                              \
+                              unsigned int _n);                             \
+                                                                            \
+/* Generate block of samples and run analysis channelizer, storing      */  \
+/* result internally; independent of other sources, so may be run       */  \
+/* concurrently with them                                               */  \
+void QSOURCE(_generate_channels)(QSOURCE() _q);                             \
+                                                                            \
+/* Add result of last _generate_channels() into parent channelizer      */  \
+/* buffer at appropriate frequency location, applying gain              */  \
+void QSOURCE(_add_channels)(QSOURCE() _q,                                   \
+                            TO *      _buf);                                \
+                                                                            \
 void QSOURCE(_generate_into)(QSOURCE() _q,                                  \
                              TO *      _buf);                               \
     
@@ -1459,6 +1657,10 @@ void MODEM(_demodulate_soft_table)(MODEM()         _q,          \
                                    unsigned int *  _sym_out,    \
                                    unsigned char * _soft_bits); \
                                                                 \
+/* initialize half-scale Q15 symbol map for fixed-point soft */ \
+/* demodulation                                              */ \
+void MODEM(_init_map_q15)(MODEM() _q);                          \
+                                                                \
 /* Demodulate a linear symbol constellation using dynamic   */  \
 /* threshold calculation                                    */  \
 /*  _v      :   input value             */                      \
@@ -1529,6 +1731,17 @@ extern const float complex modem_arb64opt[64];
 extern const float complex modem_arb128opt[128];
 extern const float complex modem_arb256opt[256];
 
+// fskdem tone detection methods
+typedef enum {
+    LIQUID_FSKDEM_FFT=0,        // full K-point transform
+    LIQUID_FSKDEM_GOERTZEL,     // bank of M Goertzel resonators
+    LIQUID_FSKDEM_CORRELATOR,   // bank of M reference-tone dot products
+} liquid_fskdem_method;
+
+// set/get fskdem tone detection method (selected by cost at creation)
+void fskdem_set_method(fskdem _q, int _method);
+int  fskdem_get_method(fskdem _q);
+
 
 //
 // MODULE : multichannel
@@ -1811,6 +2024,34 @@ void optim_sort(float *_v,
                 int _descending);
 
 
+//
+// MODULE : quantization
+//
+
+// number of bytes used to store each value in a given format
+unsigned int liquid_storage_size(liquid_storage_type _type);
+
+// pack block of floating-point values into storage format
+//  _type   : storage format
+//  _x      : input array [size: _n x 1]
+//  _n      : number of values
+//  _y      : packed output, _n values of type _type
+void liquid_storage_pack(liquid_storage_type _type,
+                         float *             _x,
+                         unsigned int        _n,
+                         void *              _y);
+
+// unpack block of values from storage format into floating-point
+//  _type   : storage format
+//  _x      : packed input, _n values of type _type
+//  _n      : number of values
+//  _y      : output array [size: _n x 1]
+void liquid_storage_unpack(liquid_storage_type _type,
+                           void *              _x,
+                           unsigned int        _n,
+                           float *             _y);
+
+
 //
 // MODULE : random
 //
@@ -1822,6 +2063,27 @@ float complex icrandnf();
 // generate x ~ Gamma(delta,1)
 float randgammaf_delta(float _delta);
 
+// re-entrant generator state (xoshiro128**) held by objects which need
+// their own reproducible noise stream, independent of rand()
+typedef struct {
+    uint32_t s[4];
+} liquid_rng;
+
+// seed generator state
+void liquid_rng_seed(liquid_rng * _q, unsigned long int _seed);
+
+// generate next 32-bit output
+uint32_t liquid_rng_next(liquid_rng * _q);
+
+// uniform random number in (0,1)
+float liquid_rng_randf(liquid_rng * _q);
+
+// Gauss random number, N(0,1), by the ziggurat method
+float liquid_rng_randnf(liquid_rng * _q);
+
+// generate block of Gauss random numbers, N(0,1)
+void liquid_rng_randnf_block(liquid_rng * _q, float * _y, unsigned int _n);
+
 // data scrambler masks
 #define LIQUID_SCRAMBLE_MASK0   (0xb4)
 #define LIQUID_SCRAMBLE_MASK1   (0x6a)
@@ -1923,5 +2185,47 @@ extern unsigned int liquid_c_leading_zeros[256];
 
 // byte reversal and manipulation
 extern const unsigned char liquid_reverse_byte_gentab[256];
+
+// initialize profile with object name and stage names
+//  _p          :   profile
+//  _name       :   object name
+//  _stages     :   stage names [size: _num_stages x 1]
+//  _num_stages :   number of stages (at most LIQUID_PROFILE_MAX_STAGES)
+void liquid_profile_init(liquid_profile_s * _p,
+                         const char *       _name,
+                         const char **      _stages,
+                         unsigned int       _num_stages);
+
+// add/remove profile to/from global registry (no-op unless profiling
+// is enabled)
+void liquid_profile_register  (liquid_profile_s * _p);
+void liquid_profile_unregister(liquid_profile_s * _p);
+
+// read cycle counter
+unsigned long long liquid_profile_clock();
+
+// allocation wrappers for objects with memory accounting; these
+// forward to malloc/realloc/free and notify the global allocation hook
+//  _name   :   object type making the allocation
+void * liquid_malloc (unsigned long int _size, const char * _name);
+void * liquid_realloc(void * _ptr, unsigned long int _size, const char * _name);
+void   liquid_free   (void * _ptr, const char * _name);
+
+// instrument a stage: LIQUID_PROFILE_BEGIN(t) declares start time t;
+// LIQUID_PROFILE_END(p,i,t,n) adds one call of n samples to stage i of
+// profile p; both expand to nothing unless LIQUID_PROFILE is defined
+#if LIQUID_PROFILE
+#  define LIQUID_PROFILE_BEGIN(T)                                       \
+    unsigned long long T = liquid_profile_clock()
+#  define LIQUID_PROFILE_END(P,I,T,N)                                   \
+    do {                                                                \
+        (P)->stages[I].num_calls   ++;                                  \
+        (P)->stages[I].num_samples += (N);                              \
+        (P)->stages[I].num_cycles  += liquid_profile_clock() - (T);     \
+    } while (0)
+#else
+#  define LIQUID_PROFILE_BEGIN(T)
+#  define LIQUID_PROFILE_END(P,I,T,N)
+#endif
 #endif // __LIQUID_INTERNAL_H__
 
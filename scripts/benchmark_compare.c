@@ -30,11 +30,15 @@
 #include <stdlib.h>
 #include <string.h>
 #include <math.h>
+#include <getopt.h>
 
 // print usage/help message
 void usage()
 {
-    printf("benchmark_compare [old_benchmark] [new_benchmark]\n");
+    printf("benchmark_compare [-t <percent>] [old_benchmark] [new_benchmark]\n");
+    printf("  benchmark files are either text (benchmark -o) or JSON (benchmark -j)\n");
+    printf("  -t <percent> : exit with status 1 if any benchmark slows down by more\n");
+    printf("                 than this and by more than three standard deviations\n");
 }
 
 // define benchmark_t
@@ -46,6 +50,7 @@ struct benchmark_t {
     //float extime;
     //float rate;
     float cycles_per_trial;
+    float cycles_stddev;    // spread over repetitions (JSON only, else zero)
 
     // link to other benchmark
     struct benchmark_t * link;
@@ -64,15 +69,26 @@ void benchlist_destroy(benchlist _q);
 void benchlist_print(benchlist _q);
 void benchlist_append(benchlist _q,
                       char * _name,
-                      float _cycles_per_trial);
+                      float _cycles_per_trial,
+                      float _cycles_stddev);
 
 void benchlist_link(benchlist _q0,
                     benchlist _q1);
 
+// list significant regressions, returning the number found
+//  _q          :   old benchmarks, linked to new ones
+//  _threshold  :   minimum relative slow-down
+unsigned int benchlist_regressions(benchlist _q,
+                                   float     _threshold);
+
 // is line a comment?
 int parse_file(const char * _filename,
                benchlist _benchmarks);
 
+// parse JSON output of benchmark program
+int parse_file_json(FILE *    _fid,
+                    benchlist _benchmarks);
+
 // read line from file
 //  _fid    :   input file
 //  _buffer :   output buffer
@@ -86,31 +102,47 @@ int line_is_comment(char * _buffer);
 
 int main(int argc, char*argv[])
 {
-    if (argc != 3) {
+    float threshold = -1.0f;    // regression threshold (disabled)
+    int d;
+    while ((d = getopt(argc,argv,"ht:")) != EOF) {
+        switch (d) {
+        case 'h': usage(); return 0;
+        case 't': threshold = atof(optarg) / 100.0f; break;
+        default:
+            usage();
+            exit(1);
+        }
+    }
+    if (argc - optind != 2) {
         usage();
         exit(1);
     }
 
     // parse old benchmarks
     benchlist benchmarks_old = benchlist_create();
-    parse_file(argv[1], benchmarks_old);
+    parse_file(argv[optind], benchmarks_old);
     //benchlist_print(benchmarks_old);
 
     // parse new benchmarks
     benchlist benchmarks_new = benchlist_create();
-    parse_file(argv[2], benchmarks_new);
+    parse_file(argv[optind+1], benchmarks_new);
     //benchlist_print(benchmarks_new);
 
     // link benchmarks and print results
     benchlist_link(benchmarks_old, benchmarks_new);
     benchlist_print(benchmarks_old);
 
+    // check for regressions
+    unsigned int num_regressions = 0;
+    if (threshold >= 0.0f)
+        num_regressions = benchlist_regressions(benchmarks_old, threshold);
+
     // destroy benchmark lists
     benchlist_destroy(benchmarks_old);
     benchlist_destroy(benchmarks_new);
 
     printf("done.\n");
-    return 0;
+    return num_regressions > 0 ? 1 : 0;
 }
 
 // 
@@ -199,7 +231,8 @@ void benchlist_print(benchlist _q)
 
 void benchlist_append(benchlist _q,
                       char * _name,
-                      float _cycles_per_trial)
+                      float _cycles_per_trial,
+                      float _cycles_stddev)
 {
     // TODO : check for uniqueness
     unsigned int i;
@@ -225,6 +258,7 @@ void benchlist_append(benchlist _q,
 
     // copy properties
     _q->benchmarks[_q->num_benchmarks-1].cycles_per_trial = _cycles_per_trial;
+    _q->benchmarks[_q->num_benchmarks-1].cycles_stddev    = _cycles_stddev;
 
     // set link to NULL
     _q->benchmarks[_q->num_benchmarks-1].link = NULL;
@@ -248,6 +282,36 @@ void benchlist_link(benchlist _q0,
 }
 
 
+// list significant regressions, returning the number found
+//  _q          :   old benchmarks, linked to new ones
+//  _threshold  :   minimum relative slow-down
+unsigned int benchlist_regressions(benchlist _q,
+                                   float     _threshold)
+{
+    unsigned int i;
+    unsigned int n = 0;
+    for (i=0; i<_q->num_benchmarks; i++) {
+        if (_q->benchmarks[i].link == NULL)
+            continue;
+
+        // slow-down must exceed both the threshold and the measurement noise
+        float cycles_old = _q->benchmarks[i].cycles_per_trial;
+        float cycles_new = _q->benchmarks[i].link->cycles_per_trial;
+        float s_old      = _q->benchmarks[i].cycles_stddev;
+        float s_new      = _q->benchmarks[i].link->cycles_stddev;
+        float noise      = 3.0f * sqrtf(s_old*s_old + s_new*s_new);
+        if (cycles_new - cycles_old > fmaxf(_threshold*cycles_old, noise)) {
+            if (n == 0)
+                printf("regressions (> %.1f %%):\n", 100.0f*_threshold);
+            printf("  - %-28s %12.3f -> %12.3f cycles/trial (%+7.2f %%)\n",
+                    _q->benchmarks[i].name, cycles_old, cycles_new,
+                    100.0f*(cycles_new - cycles_old)/cycles_old);
+            n++;
+        }
+    }
+    return n;
+}
+
 // is line a comment?
 int parse_file(const char * _filename,
                benchlist _benchmarks)
@@ -260,6 +324,18 @@ int parse_file(const char * _filename,
     }
 
     printf("parsing '%s'...\n", _filename);
+
+    // JSON files start with an opening brace
+    int c;
+    do {
+        c = fgetc(fid);
+    } while (c == ' ' || c == '\t' || c == '\n' || c == '\r');
+    rewind(fid);
+    if (c == '{') {
+        parse_file_json(fid, _benchmarks);
+        fclose(fid);
+        return 0;
+    }
     char buffer[256];   // line buffer
 
     int id;
@@ -291,7 +367,7 @@ int parse_file(const char * _filename,
         }
 
         // append...
-        benchlist_append(_benchmarks, name, cycles_per_trial);
+        benchlist_append(_benchmarks, name, cycles_per_trial, 0.0f);
 
     } while (!feof(fid));
 
@@ -303,6 +379,41 @@ int parse_file(const char * _filename,
 }
 
 
+// parse JSON output of benchmark program; each benchmark is written on a
+// single line holding its name and cycles-per-trial statistics
+int parse_file_json(FILE *    _fid,
+                    benchlist _benchmarks)
+{
+    char buffer[1024];  // line buffer
+    char name[64];
+    float median;
+    float stddev;
+
+    do {
+        // read line into buffer
+        readline(_fid, buffer, 1024);
+
+        // find benchmark name and statistics
+        char * p_name   = strstr(buffer, "\"name\":");
+        char * p_median = strstr(buffer, "\"median\":");
+        char * p_stddev = strstr(buffer, "\"stddev\":");
+        if (p_name == NULL || p_median == NULL || p_stddev == NULL)
+            continue;
+        if (sscanf(p_name,   "\"name\": \"%63[^\"]\"", name) != 1 ||
+            sscanf(p_median, "\"median\": %f", &median)   != 1 ||
+            sscanf(p_stddev, "\"stddev\": %f", &stddev)   != 1)
+        {
+            continue;
+        }
+
+        // append...
+        benchlist_append(_benchmarks, name, median, stddev);
+
+    } while (!feof(_fid));
+
+    return 0;
+}
+
 // read line from file
 //  _fid    :   input file
 //  _buffer :   output buffer
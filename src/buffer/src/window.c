@@ -52,7 +52,7 @@ WINDOW() WINDOW(_create)(unsigned int _n)
     }
 
     // create initial object
-    WINDOW() q = (WINDOW()) malloc(sizeof(struct WINDOW(_s)));
+    WINDOW() q = (WINDOW()) liquid_malloc(sizeof(struct WINDOW(_s)), "window" EXTENSION);
 
     // set internal parameters
     q->len  = _n;                   // nominal window size
@@ -64,7 +64,7 @@ WINDOW() WINDOW(_create)(unsigned int _n)
     q->num_allocated = q->n + q->len - 1;
 
     // allocte memory
-    q->v = (T*) malloc((q->num_allocated)*sizeof(T));
+    q->v = (T*) liquid_malloc((q->num_allocated)*sizeof(T), "window" EXTENSION);
     q->read_index = 0;
 
     // reset window
@@ -114,10 +114,10 @@ WINDOW() WINDOW(_recreate)(WINDOW() _q, unsigned int _n)
 void WINDOW(_destroy)(WINDOW() _q)
 {
     // free internal memory array
-    free(_q->v);
+    liquid_free(_q->v, "window" EXTENSION);
 
     // free main object memory
-    free(_q);
+    liquid_free(_q, "window" EXTENSION);
 }
 
 // print window object to stdout
@@ -157,6 +157,12 @@ void WINDOW(_debug_print)(WINDOW() _q)
     }
 }
 
+// get number of bytes allocated by object
+unsigned long int WINDOW(_get_memory_usage)(WINDOW() _q)
+{
+    return sizeof(struct WINDOW(_s)) + _q->num_allocated*sizeof(T);
+}
+
 // reset window object (initialize to zeros)
 void WINDOW(_reset)(WINDOW() _q)
 {
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <sys/resource.h>
+#include "liquid.h"
+
+// Helper function to keep code base small; a trial is one sample
+//  _flags  : bit 0: AWGN, 1: carrier, 2: multipath, 3: shadowing
+//  _h_len  : multipath filter length
+//  _block  : use block method?
+void channel_cccf_bench(struct rusage *     _start,
+                        struct rusage *     _finish,
+                        unsigned long int * _num_iterations,
+                        unsigned int        _flags,
+                        unsigned int        _h_len,
+                        int                 _block)
+{
+    // scale number of iterations: cycles/trial ~ 40 + 2*_h_len
+    unsigned int n = 4096;  // samples per block
+    *_num_iterations *= 100;
+    *_num_iterations /= 40 + 2*_h_len;
+
+    // create channel object
+    channel_cccf q = channel_cccf_create();
+    if (_flags & 1) channel_cccf_add_awgn(q, -30.0f, 20.0f);
+    if (_flags & 2) channel_cccf_add_carrier_offset(q, 0.02f, 0.0f);
+    if (_flags & 4) channel_cccf_add_multipath(q, NULL, _h_len);
+    if (_flags & 8) channel_cccf_add_shadowing(q, 1.0f, 0.1f);
+
+    // initialize input/output
+    unsigned int i;
+    float complex * x = (float complex*) malloc(n*sizeof(float complex));
+    float complex * y = (float complex*) malloc(n*sizeof(float complex));
+    for (i=0; i<n; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // start trials
+    unsigned long int t;
+    unsigned long int num_blocks = *_num_iterations / n + 1;
+    getrusage(RUSAGE_SELF, _start);
+    for (t=0; t<num_blocks; t++) {
+        if (_block) {
+            channel_cccf_execute_block(q, x, n, y);
+        } else {
+            for (i=0; i<n; i++)
+                channel_cccf_execute(q, x[i], &y[i]);
+        }
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations = num_blocks * n;
+
+    // destroy channel object
+    channel_cccf_destroy(q);
+    free(x);
+    free(y);
+}
+
+#define CHANNEL_CCCF_BENCHMARK_API(F,H,B)   \
+(   struct rusage *_start,                  \
+    struct rusage *_finish,                 \
+    unsigned long int *_num_iterations)     \
+{ channel_cccf_bench(_start, _finish, _num_iterations, F, H, B); }
+
+// AWGN only
+void benchmark_channel_cccf_awgn                 CHANNEL_CCCF_BENCHMARK_API( 1,   1, 0)
+void benchmark_channel_cccf_awgn_block           CHANNEL_CCCF_BENCHMARK_API( 1,   1, 1)
+
+// all impairments, short multipath profile
+void benchmark_channel_cccf_all_h8               CHANNEL_CCCF_BENCHMARK_API(15,   8, 0)
+void benchmark_channel_cccf_all_h8_block         CHANNEL_CCCF_BENCHMARK_API(15,   8, 1)
+
+// AWGN with long multipath profile (fast convolution in block method)
+void benchmark_channel_cccf_awgn_h600            CHANNEL_CCCF_BENCHMARK_API( 5, 600, 0)
+void benchmark_channel_cccf_awgn_h600_block      CHANNEL_CCCF_BENCHMARK_API( 5, 600, 1)
@@ -0,0 +1,94 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <sys/resource.h>
+#include "liquid.h"
+
+// Helper function to keep code base small; a trial is one sample
+//  _h_len      : number of taps
+//  _block_len  : sub-block length (0: sample-by-sample with sub-block 1)
+void tvmpch_cccf_bench(struct rusage *     _start,
+                       struct rusage *     _finish,
+                       unsigned long int * _num_iterations,
+                       unsigned int        _h_len,
+                       unsigned int        _block_len)
+{
+    // scale number of iterations: cycles/trial ~ 20 + 10*_h_len
+    unsigned int n = 1024;  // samples per block
+    *_num_iterations *= 100;
+    *_num_iterations /= 20 + 10*_h_len;
+
+    // create emulator object
+    tvmpch_cccf q = tvmpch_cccf_create(_h_len, 0.2f, 0.01f);
+    tvmpch_cccf_set_block_len(q, _block_len == 0 ? 1 : _block_len);
+
+    // initialize input/output
+    unsigned int i;
+    float complex * x = (float complex*) malloc(n*sizeof(float complex));
+    float complex * y = (float complex*) malloc(n*sizeof(float complex));
+    for (i=0; i<n; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // start trials
+    unsigned long int t;
+    unsigned long int num_blocks = *_num_iterations / n + 1;
+    getrusage(RUSAGE_SELF, _start);
+    for (t=0; t<num_blocks; t++) {
+        if (_block_len > 0) {
+            tvmpch_cccf_execute_block(q, x, n, y);
+        } else {
+            for (i=0; i<n; i++) {
+                tvmpch_cccf_push   (q, x[i]);
+                tvmpch_cccf_execute(q, &y[i]);
+            }
+        }
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations = num_blocks * n;
+
+    // destroy emulator object
+    tvmpch_cccf_destroy(q);
+    free(x);
+    free(y);
+}
+
+#define TVMPCH_CCCF_BENCHMARK_API(H,B)      \
+(   struct rusage *_start,                  \
+    struct rusage *_finish,                 \
+    unsigned long int *_num_iterations)     \
+{ tvmpch_cccf_bench(_start, _finish, _num_iterations, H, B); }
+
+// sample-by-sample (taps updated every sample)
+void benchmark_tvmpch_cccf_h4              TVMPCH_CCCF_BENCHMARK_API( 4,  0)
+void benchmark_tvmpch_cccf_h16             TVMPCH_CCCF_BENCHMARK_API(16,  0)
+void benchmark_tvmpch_cccf_h64             TVMPCH_CCCF_BENCHMARK_API(64,  0)
+
+// block method, taps updated every sample
+void benchmark_tvmpch_cccf_h4_block_b1     TVMPCH_CCCF_BENCHMARK_API( 4,  1)
+void benchmark_tvmpch_cccf_h16_block_b1    TVMPCH_CCCF_BENCHMARK_API(16,  1)
+void benchmark_tvmpch_cccf_h64_block_b1    TVMPCH_CCCF_BENCHMARK_API(64,  1)
+
+// block method, taps held over sub-blocks of 32 samples
+void benchmark_tvmpch_cccf_h4_block_b32    TVMPCH_CCCF_BENCHMARK_API( 4, 32)
+void benchmark_tvmpch_cccf_h16_block_b32   TVMPCH_CCCF_BENCHMARK_API(16, 32)
+void benchmark_tvmpch_cccf_h64_block_b32   TVMPCH_CCCF_BENCHMARK_API(64, 32)
@@ -29,6 +29,13 @@
 #include <stdio.h>
 #include <math.h>
 
+// number of samples processed per pass of the block method
+#define CHANNEL_BLOCK_LEN   (256)
+
+// apply multi-path filter on single sample in place
+void CHANNEL(_execute_multipath)(CHANNEL() _q,
+                                 TO *      _v);
+
 // portable structured channel object
 struct CHANNEL(_s) {
     // additive white Gauss noise
@@ -46,7 +53,7 @@ struct CHANNEL(_s) {
 
     // multi-path channel
     int             enabled_multipath;  // enable multi-path channel filter?
-    FIRFILT()       channel_filter;     // multi-path channel filter object
+    FIRDECIM()      channel_filter;     // multi-path channel filter object (M=1)
     TC *            h;                  // multi-path channel filter coefficients
     unsigned int    h_len;              // multi-path channel filter length
 
@@ -55,6 +62,13 @@ struct CHANNEL(_s) {
     IIRFILT()       shadowing_filter;   // shadowing filter object
     float           shadowing_std;      // shadowing standard deviation
     float           shadowing_fd;       // shadowing Doppler frequency
+    float           shadowing_gain;     // filter output to natural-log gain
+
+    // noise generators, one per impairment so that the sample-by-sample
+    // and block methods draw identical streams
+    liquid_rng      rng_awgn;           // AWGN generator state
+    liquid_rng      rng_shadowing;      // shadowing generator state
+    float *         buf;                // Gauss samples [size: 2*CHANNEL_BLOCK_LEN x 1]
 };
 
 // create structured channel object with default parameters
@@ -73,8 +87,12 @@ CHANNEL() CHANNEL(_create)(void)
     q->h_len            = 1;
     q->h                = (TC*) malloc(q->h_len*sizeof(TC));
     q->h[0]             = 1.0f;
-    q->channel_filter   = FIRFILT(_create)(q->h, q->h_len);
+    q->channel_filter   = FIRDECIM(_create)(1, q->h, q->h_len);
     q->shadowing_filter = NULL;
+    q->buf              = (float*) malloc(2*CHANNEL_BLOCK_LEN*sizeof(float));
+
+    // seed noise generators from global state
+    CHANNEL(_set_seed)(q, (unsigned long int)rand());
 
     // return object
     return q;
@@ -85,10 +103,11 @@ void CHANNEL(_destroy)(CHANNEL() _q)
 {
     // destroy internal objects
     NCO(_destroy)(_q->nco);
-    FIRFILT(_destroy)(_q->channel_filter);
+    FIRDECIM(_destroy)(_q->channel_filter);
     if (_q->shadowing_filter != NULL)
         IIRFILT(_destroy)(_q->shadowing_filter);
     free(_q->h);
+    free(_q->buf);
 
     // free main object memory
     free(_q);
@@ -104,6 +123,17 @@ void CHANNEL(_print)(CHANNEL() _q)
     if (_q->enabled_shadowing)  printf("  shadowing: std=%.3fdB, fd=%.3f\n", _q->shadowing_std, _q->shadowing_fd);
 }
 
+// set seed of internal noise generators; objects with the same seed and
+// configuration produce identical outputs
+//  _q      : channel object
+//  _seed   : generator seed
+void CHANNEL(_set_seed)(CHANNEL()         _q,
+                        unsigned long int _seed)
+{
+    liquid_rng_seed(&_q->rng_awgn,      _seed);
+    liquid_rng_seed(&_q->rng_shadowing, _seed ^ 0x5bd1e995UL);
+}
+
 // apply additive white Gausss noise impairment
 //  _q              : channel object
 //  _noise_floor_dB : noise floor power spectral density
@@ -189,8 +219,10 @@ void CHANNEL(_add_multipath)(CHANNEL()    _q,
         memmove(_q->h, _h, _q->h_len*sizeof(TC));
     }
 
-    // re-create channel filter
-    _q->channel_filter = FIRFILT(_recreate)(_q->channel_filter, _q->h, _q->h_len);
+    // re-create channel filter; long profiles are executed in the
+    // frequency domain by the block method
+    FIRDECIM(_destroy)(_q->channel_filter);
+    _q->channel_filter = FIRDECIM(_create)(1, _q->h, _q->h_len);
 }
 
 // apply slowly-varying shadowing impairment
@@ -219,6 +251,9 @@ void CHANNEL(_add_shadowing)(CHANNEL() _q,
     _q->shadowing_std = _sigma;
     _q->shadowing_fd  = _fd;
 
+    // gain is 10^(g/20) for normalized filter output g
+    _q->shadowing_gain = (float)M_LN10 / (20.0f * _q->shadowing_fd * 6.9f);
+
     // re-create channel filter
     // TODO: adjust gain
     //_q->shadowing_filter = IIRFILT(_create_lowpass)(11, _q->shadowing_fd);
@@ -228,6 +263,15 @@ void CHANNEL(_add_shadowing)(CHANNEL() _q,
     _q->shadowing_filter = IIRFILT(_create)(b,2,a,2);
 }
 
+// apply multi-path filter on single sample in place, kept out of line so
+// that the input sample need not be stored to memory otherwise
+void CHANNEL(_execute_multipath)(CHANNEL() _q,
+                                 TO *      _v)
+{
+    TI x = *_v;
+    FIRDECIM(_execute)(_q->channel_filter, &x, _v);
+}
+
 // apply channel impairments on single input sample
 //  _q      : channel object
 //  _x      : input sample
@@ -236,23 +280,18 @@ void CHANNEL(_execute)(CHANNEL() _q,
                        TI        _x,
                        TO *      _y)
 {
-    float complex r;
+    float complex r = _x;
     // apply filter
-    if (_q->enabled_multipath) {
-        FIRFILT(_push)(   _q->channel_filter, _x);
-        FIRFILT(_execute)(_q->channel_filter, &r);
-    } else {
-        r = _x;
-    }
+    if (_q->enabled_multipath)
+        CHANNEL(_execute_multipath)(_q, &r);
 
     // apply shadowing if enabled
     if (_q->enabled_shadowing) {
         // TODO: use type-specific value other than float
         float g = 0;
-        IIRFILT(_execute)(_q->shadowing_filter, randnf()*_q->shadowing_std, &g);
-        g /= _q->shadowing_fd * 6.9f;
-        g = powf(10.0f, g/20.0f);
-        r *= g;
+        float v = liquid_rng_randnf(&_q->rng_shadowing) * _q->shadowing_std;
+        IIRFILT(_execute)(_q->shadowing_filter, v, &g);
+        r *= expf(g * _q->shadowing_gain);
     }
 
     // apply carrier if enabled
@@ -263,15 +302,20 @@ void CHANNEL(_execute)(CHANNEL() _q,
 
     // apply AWGN if enabled
     if (_q->enabled_awgn) {
+        float vi = liquid_rng_randnf(&_q->rng_awgn);
+        float vq = liquid_rng_randnf(&_q->rng_awgn);
         r *= _q->gamma;
-        r += _q->nstd * ( randnf() + _Complex_I*randnf() ) * M_SQRT1_2;
+        r += _q->nstd * M_SQRT1_2 * (vi + _Complex_I*vq);
     }
 
     // set output value
     *_y = r;
 }
 
-// apply channel impairments on single input sample
+// apply channel impairments on block of samples; the multi-path filter
+// runs over the whole block (allowing fast convolution for long
+// profiles), the remaining impairments over CHANNEL_BLOCK_LEN samples
+// at a time
 //  _q      : channel object
 //  _x      : input array [size: _n x 1]
 //  _n      : input array length
@@ -281,10 +325,42 @@ void CHANNEL(_execute_block)(CHANNEL()    _q,
                              unsigned int _n,
                              TO *         _y)
 {
-    // apply channel effects on each input sample
-    // TODO: apply in blocks
+    // apply filter
+    if (_q->enabled_multipath)
+        FIRDECIM(_execute_block)(_q->channel_filter, _x, _n, _y);
+    else if (_x != _y)
+        memmove(_y, _x, _n*sizeof(TO));
+
     unsigned int i;
-    for (i=0; i<_n; i++)
-        CHANNEL(_execute)(_q, _x[i], &_y[i]);
-}
+    while (_n > 0) {
+        unsigned int n = _n < CHANNEL_BLOCK_LEN ? _n : CHANNEL_BLOCK_LEN;
+
+        // apply shadowing if enabled
+        if (_q->enabled_shadowing) {
+            liquid_rng_randnf_block(&_q->rng_shadowing, _q->buf, n);
+            for (i=0; i<n; i++)
+                _q->buf[i] *= _q->shadowing_std;
+            IIRFILT(_execute_block)(_q->shadowing_filter, _q->buf, n, _q->buf);
+            for (i=0; i<n; i++)
+                _y[i] *= expf(_q->buf[i] * _q->shadowing_gain);
+        }
+
+        // apply carrier if enabled
+        if (_q->enabled_carrier)
+            NCO(_mix_block_up)(_q->nco, _y, _y, n);
+
+        // apply AWGN if enabled, operating on interleaved real/imaginary
+        // components of the output
+        if (_q->enabled_awgn) {
+            liquid_rng_randnf_block(&_q->rng_awgn, _q->buf, 2*n);
+            float   g = _q->gamma;
+            float   s = _q->nstd * M_SQRT1_2;
+            float * y = (float*)_y;
+            for (i=0; i<2*n; i++)
+                y[i] = g*y[i] + s*_q->buf[i];
+        }
 
+        _y += n;
+        _n -= n;
+    }
+}
@@ -27,6 +27,17 @@
 #include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
+#include <math.h>
+
+// most samples convolved per pass of the block method
+#define TVMPCH_BLOCK_LEN    (256)
+
+// fewest multiplies (taps times samples) with constant taps for which
+// re-creating the dot product object pays off
+#define TVMPCH_DOTPROD_MIN  (256)
+
+// step time-varying taps across one sub-block
+void TVMPCH(_update_taps)(TVMPCH() _q);
 
 // tvmpch object structure
 struct TVMPCH(_s) {
@@ -36,10 +47,22 @@ struct TVMPCH(_s) {
     // use window object for internal buffer
     WINDOW() w;
 
-    //
+    // each tap (but the first) is a complex Gauss first-order
+    // auto-regressive process, h <- alpha*h + beta*std*w, held constant
+    // over sub-blocks of block_len samples; the process is stepped across
+    // a sub-block at once by its exact block_len-step transition
     float std;
     float alpha;
     float beta;
+    unsigned int block_len; // samples per sub-block
+    unsigned int counter;   // samples into current sub-block
+    float        a;         // tap decay over sub-block, alpha^block_len
+    float        s;         // innovation std. over sub-block, per component
+    liquid_rng   rng;       // tap process generator state
+    float *      g;         // Gauss samples [size: 2*(h_len-1) x 1]
+    TI *         buf;       // block convolution buffer [size: h_len-1+TVMPCH_BLOCK_LEN x 1]
+    DOTPROD()    dp;        // dot product with taps of current sub-block
+    int          dp_stale;  // taps updated since dot product was created?
 };
 
 // create time-varying multi-path channel emulator object
@@ -79,6 +102,14 @@ TVMPCH() TVMPCH(_create)(unsigned int _n,
     // create window (internal buffer)
     q->w = WINDOW(_create)(q->h_len);
 
+    // tap process, updated every sample by default
+    q->g   = (float *) malloc(2*(q->h_len-1)*sizeof(float));
+    q->buf = (TI *)    malloc((q->h_len-1 + TVMPCH_BLOCK_LEN)*sizeof(TI));
+    q->dp  = DOTPROD(_create)(q->h, q->h_len);
+    q->dp_stale = 0;
+    TVMPCH(_set_block_len)(q, 1);
+    TVMPCH(_set_seed)(q, (unsigned long int)rand());
+
     // reset filter state (clear buffer)
     TVMPCH(_reset)(q);
 
@@ -91,6 +122,9 @@ void TVMPCH(_destroy)(TVMPCH() _q)
 {
     WINDOW(_destroy)(_q->w);
     free(_q->h);
+    free(_q->g);
+    free(_q->buf);
+    DOTPROD(_destroy)(_q->dp);
     free(_q);
 }
 
@@ -98,6 +132,37 @@ void TVMPCH(_destroy)(TVMPCH() _q)
 void TVMPCH(_reset)(TVMPCH() _q)
 {
     WINDOW(_reset)(_q->w);
+    _q->counter = 0;
+}
+
+// set seed of tap process generator
+//  _q      :   filter object
+//  _seed   :   generator seed
+void TVMPCH(_set_seed)(TVMPCH()          _q,
+                       unsigned long int _seed)
+{
+    liquid_rng_seed(&_q->rng, _seed);
+}
+
+// set number of samples over which taps are held constant
+//  _q          :   filter object
+//  _block_len  :   sub-block length, _block_len > 0
+void TVMPCH(_set_block_len)(TVMPCH()     _q,
+                            unsigned int _block_len)
+{
+    if (_block_len == 0) {
+        fprintf(stderr,"error: tvmpch_%s_set_block_len(), block length must be greater than zero\n", EXTENSION_FULL);
+        exit(1);
+    }
+    _q->block_len = _block_len;
+    _q->counter   = 0;
+
+    // variance of sum of _block_len innovations, each decayed by alpha
+    float a2 = _q->alpha * _q->alpha;
+    float v  = a2 == 1.0f ? (float)_block_len :
+               (1.0f - powf(a2, (float)_block_len)) / (1.0f - a2);
+    _q->a = powf(_q->alpha, (float)_block_len);
+    _q->s = _q->beta * _q->std * M_SQRT1_2 * sqrtf(v);
 }
 
 // print filter object internals (taps, buffer)
@@ -120,10 +185,10 @@ void TVMPCH(_print)(TVMPCH() _q)
 void TVMPCH(_push)(TVMPCH() _q,
                    TI       _x)
 {
-    // update coefficients
-    unsigned int i;
-    for (i=0; i<_q->h_len-1; i++)
-        _q->h[i] = _q->alpha*_q->h[i] + _q->beta*(randnf() + _Complex_I*randnf()) * _q->std * M_SQRT1_2;
+    // update coefficients at start of each sub-block
+    if (_q->counter == 0)
+        TVMPCH(_update_taps)(_q);
+    _q->counter = (_q->counter + 1) % _q->block_len;
 
     // push sample into window buffer
     WINDOW(_push)(_q->w, _x);
@@ -156,15 +221,67 @@ void TVMPCH(_execute_block)(TVMPCH()     _q,
                             TO *         _y)
 {
     unsigned int i;
-    for (i=0; i<_n; i++) {
-        // push sample into filter
-        TVMPCH(_push)(_q, _x[i]);
+    unsigned int p = _q->h_len - 1;     // history length
+    TI * r;
+    while (_n > 0) {
+        // run to end of sub-block
+        if (_q->counter == 0)
+            TVMPCH(_update_taps)(_q);
+        unsigned int n = _q->block_len - _q->counter;
+        n = n < _n               ? n : _n;
+        n = n < TVMPCH_BLOCK_LEN ? n : TVMPCH_BLOCK_LEN;
+
+        if (4*n < _q->h_len) {
+            // short runs: push through window
+            for (i=0; i<n; i++) {
+                WINDOW(_push)(_q->w, _x[i]);
+                WINDOW(_read)(_q->w, &r);
+                DOTPROD(_run4)(r, _q->h, _q->h_len, &_y[i]);
+            }
+        } else {
+            // copy history and input to linear buffer
+            WINDOW(_read)(_q->w, &r);
+            memmove(_q->buf,   r+1, p*sizeof(TI));
+            memmove(_q->buf+p, _x,  n*sizeof(TI));
+
+            // update internal buffer before (possibly) overwriting input
+            unsigned int k = n < _q->h_len ? n : _q->h_len;
+            WINDOW(_write)(_q->w, _x + n - k, k);
 
-        // compute output sample
-        TVMPCH(_execute)(_q, &_y[i]);
+            // slide dot product with constant taps
+            if (n*_q->h_len < TVMPCH_DOTPROD_MIN && _q->dp_stale) {
+                for (i=0; i<n; i++)
+                    DOTPROD(_run4)(_q->buf + i, _q->h, _q->h_len, &_y[i]);
+            } else {
+                if (_q->dp_stale) {
+                    _q->dp = DOTPROD(_recreate)(_q->dp, _q->h, _q->h_len);
+                    _q->dp_stale = 0;
+                }
+                for (i=0; i<n; i++)
+                    DOTPROD(_execute)(_q->dp, _q->buf + i, &_y[i]);
+            }
+        }
+
+        _q->counter = (_q->counter + n) % _q->block_len;
+        _x += n;
+        _y += n;
+        _n -= n;
     }
 }
 
+// step time-varying taps across one sub-block, drawing all innovations
+// at once and updating interleaved real/imaginary components
+void TVMPCH(_update_taps)(TVMPCH() _q)
+{
+    unsigned int i;
+    unsigned int n = 2*(_q->h_len-1);
+    liquid_rng_randnf_block(&_q->rng, _q->g, n);
+    float * h = (float*) _q->h;
+    for (i=0; i<n; i++)
+        h[i] = _q->a*h[i] + _q->s*_q->g[i];
+    _q->dp_stale = 1;
+}
+
 #if 0
 // get filter length
 unsigned int TVMPCH(_get_length)(TVMPCH() _q)
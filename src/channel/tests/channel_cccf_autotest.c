@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// helper: create channel with impairments enabled by _flags, seeded with
+// _seed; bit 0: AWGN, 1: carrier, 2: multipath, 3: shadowing
+channel_cccf channel_cccf_autotest_create(unsigned int      _flags,
+                                          unsigned int      _h_len,
+                                          unsigned long int _seed)
+{
+    channel_cccf q = channel_cccf_create();
+    if (_flags & 1) channel_cccf_add_awgn(q, -30.0f, 20.0f);
+    if (_flags & 2) channel_cccf_add_carrier_offset(q, 0.02f, 0.7f);
+    if (_flags & 4) channel_cccf_add_multipath(q, NULL, _h_len);
+    if (_flags & 8) channel_cccf_add_shadowing(q, 1.0f, 0.1f);
+    channel_cccf_set_seed(q, _seed);
+    return q;
+}
+
+// sample-by-sample and block methods must produce the same output, and
+// objects with the same seed must be identical
+void channel_cccf_test_block(unsigned int _flags,
+                             unsigned int _h_len)
+{
+    unsigned int n = 1200;  // not a multiple of internal block size
+    float tol = 1e-4f;
+    float complex x [n];
+    float complex y0[n];
+    float complex y1[n];
+    float complex y2[n];
+    unsigned int i;
+    for (i=0; i<n; i++)
+        x[i] = cexpf(_Complex_I*0.1f*i*i) + 0.1f*i/(float)n;
+
+    channel_cccf q0 = channel_cccf_autotest_create(_flags, _h_len, 12345);
+    channel_cccf q1 = channel_cccf_autotest_create(_flags, _h_len, 12345);
+    channel_cccf q2 = channel_cccf_autotest_create(_flags, _h_len, 12345);
+
+    // sample-by-sample
+    for (i=0; i<n; i++)
+        channel_cccf_execute(q0, x[i], &y0[i]);
+
+    // blocks of irregular length, with one sample mixed in
+    channel_cccf_execute_block(q1, x,      300,     y1);
+    channel_cccf_execute      (q1, x[300],          &y1[300]);
+    channel_cccf_execute_block(q1, x+301,  n-301,   y1+301);
+
+    // one block, in place
+    memmove(y2, x, n*sizeof(float complex));
+    channel_cccf_execute_block(q2, y2, n, y2);
+
+    for (i=0; i<n; i++) {
+        CONTEND_DELTA(crealf(y0[i]), crealf(y1[i]), tol);
+        CONTEND_DELTA(cimagf(y0[i]), cimagf(y1[i]), tol);
+        CONTEND_DELTA(crealf(y0[i]), crealf(y2[i]), tol);
+        CONTEND_DELTA(cimagf(y0[i]), cimagf(y2[i]), tol);
+    }
+
+    channel_cccf_destroy(q0);
+    channel_cccf_destroy(q1);
+    channel_cccf_destroy(q2);
+}
+
+void autotest_channel_cccf_block_awgn()       { channel_cccf_test_block( 1,   1); }
+void autotest_channel_cccf_block_carrier()    { channel_cccf_test_block( 2,   1); }
+void autotest_channel_cccf_block_multipath()  { channel_cccf_test_block( 4,   7); }
+void autotest_channel_cccf_block_long()       { channel_cccf_test_block( 4, 400); }
+void autotest_channel_cccf_block_shadowing()  { channel_cccf_test_block( 8,   1); }
+void autotest_channel_cccf_block_all()        { channel_cccf_test_block(15,  51); }
+
+// different seeds must produce different noise
+void autotest_channel_cccf_seed()
+{
+    unsigned int n = 64;
+    float complex x[n];
+    float complex y0[n];
+    float complex y1[n];
+    unsigned int i;
+    for (i=0; i<n; i++)
+        x[i] = 0.0f;
+
+    channel_cccf q0 = channel_cccf_autotest_create(9, 1, 1);
+    channel_cccf q1 = channel_cccf_autotest_create(9, 1, 2);
+    channel_cccf_execute_block(q0, x, n, y0);
+    channel_cccf_execute_block(q1, x, n, y1);
+
+    unsigned int num_equal = 0;
+    for (i=0; i<n; i++)
+        num_equal += y0[i] == y1[i];
+    CONTEND_EQUALITY(num_equal, 0);
+
+    channel_cccf_destroy(q0);
+    channel_cccf_destroy(q1);
+}
+
+// noise must be circular Gauss with the configured variance
+void autotest_channel_cccf_awgn()
+{
+    unsigned int n = 64000;
+    float noise_floor = -20.0f;
+    float SNRdB       =  10.0f;
+    float complex * y = (float complex*) malloc(n*sizeof(float complex));
+    unsigned int i;
+    for (i=0; i<n; i++)
+        y[i] = 1.0f;
+
+    channel_cccf q = channel_cccf_create();
+    channel_cccf_add_awgn(q, noise_floor, SNRdB);
+    channel_cccf_set_seed(q, 7);
+    channel_cccf_execute_block(q, y, n, y);
+
+    // signal gain and noise
+    float gamma = powf(10.0f, (noise_floor + SNRdB)/20.0f);
+    float nstd  = powf(10.0f, noise_floor/20.0f);
+    float complex m1 = 0.0f;
+    float m2 = 0.0f;
+    float complex m2c = 0.0f;
+    for (i=0; i<n; i++) {
+        float complex v = y[i] - gamma;
+        m1  += v;
+        m2  += crealf(v*conjf(v));
+        m2c += v*v;
+    }
+    m1  /= (float)n;
+    m2  /= (float)n;
+    m2c /= (float)n;
+
+    CONTEND_DELTA(crealf(m1), 0.0f, 0.02f*nstd);
+    CONTEND_DELTA(cimagf(m1), 0.0f, 0.02f*nstd);
+    CONTEND_DELTA(m2, nstd*nstd, 0.02f*nstd*nstd);
+    CONTEND_DELTA(cabsf(m2c), 0.0f, 0.02f*nstd*nstd);
+
+    channel_cccf_destroy(q);
+    free(y);
+}
+
+// multi-path filter response, short and long (fast-convolution) profiles
+void channel_cccf_test_multipath(unsigned int _h_len)
+{
+    unsigned int n = _h_len + 300;
+    float complex h[_h_len];
+    float complex * y = (float complex*) malloc(n*sizeof(float complex));
+    unsigned int i;
+    for (i=0; i<_h_len; i++)
+        h[i] = cexpf(_Complex_I*0.3f*i) * expf(-0.01f*i);
+
+    channel_cccf q = channel_cccf_create();
+    channel_cccf_add_multipath(q, h, _h_len);
+
+    // impulse response
+    for (i=0; i<n; i++)
+        y[i] = i==0 ? 1.0f : 0.0f;
+    channel_cccf_execute_block(q, y, n, y);
+    for (i=0; i<n; i++) {
+        float complex v = i < _h_len ? h[i] : 0.0f;
+        CONTEND_DELTA(crealf(y[i]), crealf(v), 1e-4f);
+        CONTEND_DELTA(cimagf(y[i]), cimagf(v), 1e-4f);
+    }
+
+    channel_cccf_destroy(q);
+    free(y);
+}
+
+void autotest_channel_cccf_multipath_short() { channel_cccf_test_multipath(  5); }
+void autotest_channel_cccf_multipath_long()  { channel_cccf_test_multipath(600); }
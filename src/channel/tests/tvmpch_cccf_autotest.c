@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// sample-by-sample and block methods must produce the same output
+void tvmpch_cccf_test_block(unsigned int _h_len,
+                            unsigned int _block_len)
+{
+    unsigned int n = 1500;
+    float tol = 1e-5f;
+    float complex x [n];
+    float complex y0[n];
+    float complex y1[n];
+    unsigned int i;
+    for (i=0; i<n; i++)
+        x[i] = cexpf(_Complex_I*0.07f*i*i);
+
+    tvmpch_cccf q0 = tvmpch_cccf_create(_h_len, 0.2f, 0.05f);
+    tvmpch_cccf q1 = tvmpch_cccf_create(_h_len, 0.2f, 0.05f);
+    tvmpch_cccf_set_block_len(q0, _block_len);
+    tvmpch_cccf_set_block_len(q1, _block_len);
+    tvmpch_cccf_set_seed(q0, 11);
+    tvmpch_cccf_set_seed(q1, 11);
+
+    for (i=0; i<n; i++) {
+        tvmpch_cccf_push   (q0, x[i]);
+        tvmpch_cccf_execute(q0, &y0[i]);
+    }
+
+    // irregular blocks mixed with single samples, in place
+    memmove(y1, x, n*sizeof(float complex));
+    unsigned int k, b;
+    for (k=0, b=1; k < n; k += b, b = (b * 7 + 5) % 301) {
+        b = k + b > n ? n - k : b;
+        if (b == 1) {
+            tvmpch_cccf_push   (q1, y1[k]);
+            tvmpch_cccf_execute(q1, &y1[k]);
+        } else {
+            tvmpch_cccf_execute_block(q1, &y1[k], b, &y1[k]);
+        }
+    }
+
+    for (i=0; i<n; i++) {
+        CONTEND_DELTA(crealf(y0[i]), crealf(y1[i]), tol);
+        CONTEND_DELTA(cimagf(y0[i]), cimagf(y1[i]), tol);
+    }
+
+    tvmpch_cccf_destroy(q0);
+    tvmpch_cccf_destroy(q1);
+}
+
+void autotest_tvmpch_cccf_block_h1_b1()    { tvmpch_cccf_test_block( 1,  1); }
+void autotest_tvmpch_cccf_block_h8_b1()    { tvmpch_cccf_test_block( 8,  1); }
+void autotest_tvmpch_cccf_block_h8_b32()   { tvmpch_cccf_test_block( 8, 32); }
+void autotest_tvmpch_cccf_block_h40_b7()   { tvmpch_cccf_test_block(40,  7); }
+void autotest_tvmpch_cccf_block_h40_b500() { tvmpch_cccf_test_block(40,500); }
+
+// output power must not depend on sub-block length: for unit-power white
+// input it is 1 + (h_len-1)*E|h|^2 with E|h|^2 = 4 std^2 / (2-tau)
+void tvmpch_cccf_test_power(unsigned int _block_len)
+{
+    unsigned int h_len = 8;
+    float std = 0.2f;
+    float tau = 0.1f;
+    unsigned int n = 4096;
+    unsigned int num_blocks = 50;
+    float complex * x = (float complex*) malloc(n*sizeof(float complex));
+    float complex * y = (float complex*) malloc(n*sizeof(float complex));
+
+    tvmpch_cccf q = tvmpch_cccf_create(h_len, std, tau);
+    tvmpch_cccf_set_block_len(q, _block_len);
+    tvmpch_cccf_set_seed(q, 3);
+
+    unsigned int i, t;
+    float power = 0.0f;
+    for (t=0; t<num_blocks+1; t++) {
+        for (i=0; i<n; i++)
+            x[i] = randnf() + _Complex_I*randnf();
+        tvmpch_cccf_execute_block(q, x, n, y);
+        // first block discarded (transient)
+        for (i=0; i<n && t>0; i++)
+            power += crealf(y[i]*conjf(y[i]));
+    }
+    power /= (float)(n*num_blocks);
+    float power_ref = 2.0f*(1.0f + (h_len-1)*4.0f*std*std/(2.0f-tau));
+    if (liquid_autotest_verbose)
+        printf("block_len %3u : power %8.4f (expected %8.4f)\n", _block_len, power, power_ref);
+    CONTEND_DELTA(power, power_ref, 0.05f*power_ref);
+
+    tvmpch_cccf_destroy(q);
+    free(x);
+    free(y);
+}
+
+void autotest_tvmpch_cccf_power_b1()  { tvmpch_cccf_test_power( 1); }
+void autotest_tvmpch_cccf_power_b64() { tvmpch_cccf_test_power(64); }
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <sys/resource.h>
+#include "liquid.h"
+
+// Helper function to keep code base small
+//  _n      : dot product length
+//  _type   : 0 (rrrq15), 1 (crcq15), 2 (cccq15)
+//  _peak   : peak coefficient amplitude (large values select 64-bit path)
+void dotprod_q15_bench(struct rusage *     _start,
+                       struct rusage *     _finish,
+                       unsigned long int * _num_iterations,
+                       unsigned int        _n,
+                       unsigned int        _type,
+                       int                 _peak)
+{
+    // normalize number of iterations
+    *_num_iterations *= 100;
+    *_num_iterations /= _n;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // random coefficients and input; complex types use both halves
+    liquid_q15 h[2*_n];
+    liquid_q15 x[2*_n];
+    liquid_q15 y[2*8];
+    unsigned long int i;
+    for (i=0; i<2*_n; i++) {
+        h[i] = (liquid_q15)( (rand() % (2*_peak+1)) - _peak );
+        x[i] = (liquid_q15)( (rand() % 65535) - 32767 );
+    }
+
+    dotprod_rrrq15 q0 = dotprod_rrrq15_create(h, _n);
+    dotprod_crcq15 q1 = dotprod_crcq15_create(h, _n);
+    dotprod_cccq15 q2 = dotprod_cccq15_create((liquid_cq15*)h, _n);
+    liquid_cq15 * xc = (liquid_cq15*)x;
+    liquid_cq15 * yc = (liquid_cq15*)y;
+
+    // start trials
+    unsigned int k;
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        switch (_type) {
+        case 0: for (k=0; k<8; k++) dotprod_rrrq15_execute(q0, x,  &y[k]);  break;
+        case 1: for (k=0; k<8; k++) dotprod_crcq15_execute(q1, xc, &yc[k]); break;
+        default:for (k=0; k<8; k++) dotprod_cccq15_execute(q2, xc, &yc[k]);
+        }
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= 8;
+
+    // clean up objects
+    dotprod_rrrq15_destroy(q0);
+    dotprod_crcq15_destroy(q1);
+    dotprod_cccq15_destroy(q2);
+}
+
+#define DOTPROD_Q15_BENCHMARK_API(N,T,P)    \
+(   struct rusage *_start,                  \
+    struct rusage *_finish,                 \
+    unsigned long int *_num_iterations)     \
+{ dotprod_q15_bench(_start, _finish, _num_iterations, N, T, P); }
+
+// 32-bit accumulation (small coefficients, e.g. normalized filters)
+void benchmark_dotprod_rrrq15_16       DOTPROD_Q15_BENCHMARK_API(16,  0,  2000)
+void benchmark_dotprod_rrrq15_64       DOTPROD_Q15_BENCHMARK_API(64,  0,   500)
+void benchmark_dotprod_rrrq15_256      DOTPROD_Q15_BENCHMARK_API(256, 0,   120)
+void benchmark_dotprod_crcq15_16       DOTPROD_Q15_BENCHMARK_API(16,  1,  2000)
+void benchmark_dotprod_crcq15_64       DOTPROD_Q15_BENCHMARK_API(64,  1,   500)
+void benchmark_dotprod_crcq15_256      DOTPROD_Q15_BENCHMARK_API(256, 1,   120)
+void benchmark_dotprod_cccq15_16       DOTPROD_Q15_BENCHMARK_API(16,  2,  1000)
+void benchmark_dotprod_cccq15_64       DOTPROD_Q15_BENCHMARK_API(64,  2,   250)
+void benchmark_dotprod_cccq15_256      DOTPROD_Q15_BENCHMARK_API(256, 2,    60)
+
+// 64-bit accumulation (full-scale coefficients)
+void benchmark_dotprod_rrrq15_256_wide DOTPROD_Q15_BENCHMARK_API(256, 0, 32767)
+void benchmark_dotprod_crcq15_256_wide DOTPROD_Q15_BENCHMARK_API(256, 1, 32767)
+void benchmark_dotprod_cccq15_256_wide DOTPROD_Q15_BENCHMARK_API(256, 2, 32767)
+
@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Generic fixed-point (Q15) dot product
+//
+
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+
+// defined:
+//  DOTPROD()       name-mangling macro
+//  TO              output type
+//  TC              coefficients type
+//  TI              input type
+//  TC_COMPLEX      coefficients are complex?
+//  TI_COMPLEX      input is complex?
+
+// fixed-point dot product object; complex inputs are processed as
+// interleaved real samples against two expanded coefficient arrays, one
+// for each component of the output
+struct DOTPROD(_s) {
+    TC *            h;      // coefficients array [size: n x 1]
+    unsigned int    n;      // length
+    int16_t *       h0;     // kernel coefficients, real output
+    int16_t *       h1;     // kernel coefficients, imaginary output
+    int             wide;   // accumulate in 64 bits?
+};
+
+// expand coefficients for the kernels and select accumulator width
+void DOTPROD(_set_coefficients)(DOTPROD() _q,
+                                TC *      _h);
+
+// clip coefficient of -32768 to -32767 so that kernel pair sums cannot
+// overflow 32 bits and coefficients can be negated safely; applied by
+// every entry point so that all give the same result for the same taps
+#define DOTPROD_Q15_CLIP(h) ((h) < -32767 ? -32767 : (h))
+
+// basic dot product
+//  _h      :   coefficients array [size: 1 x _n]
+//  _x      :   input array [size: 1 x _n]
+//  _n      :   input lengths
+//  _y      :   output dot product
+void DOTPROD(_run)(TC *         _h,
+                   TI *         _x,
+                   unsigned int _n,
+                   TO *         _y)
+{
+    // accumulate exactly in 64 bits
+    unsigned int i;
+#if TI_COMPLEX
+    int64_t yr = 0;
+    int64_t yi = 0;
+    for (i=0; i<_n; i++) {
+#  if TC_COMPLEX
+        int64_t hr = DOTPROD_Q15_CLIP(_h[i].real);
+        int64_t hi = DOTPROD_Q15_CLIP(_h[i].imag);
+        yr += hr*_x[i].real - hi*_x[i].imag;
+        yi += hr*_x[i].imag + hi*_x[i].real;
+#  else
+        int64_t h = DOTPROD_Q15_CLIP(_h[i]);
+        yr += h*_x[i].real;
+        yi += h*_x[i].imag;
+#  endif
+    }
+    _y->real = LIQUID_Q15_ROUND(yr);
+    _y->imag = LIQUID_Q15_ROUND(yi);
+#else
+    int64_t r = 0;
+    for (i=0; i<_n; i++)
+        r += (int64_t)DOTPROD_Q15_CLIP(_h[i])*_x[i];
+    *_y = LIQUID_Q15_ROUND(r);
+#endif
+}
+
+// basic dot product (same as above; kept for interface consistency)
+//  _h      :   coefficients array [size: 1 x _n]
+//  _x      :   input array [size: 1 x _n]
+//  _n      :   input lengths
+//  _y      :   output dot product
+void DOTPROD(_run4)(TC *         _h,
+                    TI *         _x,
+                    unsigned int _n,
+                    TO *         _y)
+{
+    DOTPROD(_run)(_h, _x, _n, _y);
+}
+
+//
+// structured dot product
+//
+
+// create structured dot product object
+//  _h      :   coefficients array [size: 1 x _n]
+//  _n      :   dot product length
+DOTPROD() DOTPROD(_create)(TC *         _h,
+                           unsigned int _n)
+{
+    DOTPROD() q = (DOTPROD()) malloc(sizeof(struct DOTPROD(_s)));
+    q->n = _n;
+
+    // allocate memory for coefficients
+    q->h  = (TC*)      malloc((q->n)*sizeof(TC));
+    q->h0 = (int16_t*) malloc((q->n)*(1+TI_COMPLEX)*sizeof(int16_t));
+    q->h1 = TI_COMPLEX ? (int16_t*) malloc(2*(q->n)*sizeof(int16_t)) : NULL;
+
+    // set coefficients
+    DOTPROD(_set_coefficients)(q, _h);
+
+    // return object
+    return q;
+}
+
+// re-create dot product object
+//  _q      :   old dot dot product object
+//  _h      :   new coefficients [size: 1 x _n]
+//  _n      :   new dot product size
+DOTPROD() DOTPROD(_recreate)(DOTPROD()    _q,
+                             TC *         _h,
+                             unsigned int _n)
+{
+    // check to see if length has changed
+    if (_q->n != _n) {
+        // set new length
+        _q->n = _n;
+
+        // re-allocate memory
+        _q->h  = (TC*)      realloc(_q->h,  (_q->n)*sizeof(TC));
+        _q->h0 = (int16_t*) realloc(_q->h0, (_q->n)*(1+TI_COMPLEX)*sizeof(int16_t));
+        if (TI_COMPLEX)
+            _q->h1 = (int16_t*) realloc(_q->h1, 2*(_q->n)*sizeof(int16_t));
+    }
+
+    // set new coefficients
+    DOTPROD(_set_coefficients)(_q, _h);
+
+    // return re-structured object
+    return _q;
+}
+
+// destroy dot product object
+void DOTPROD(_destroy)(DOTPROD() _q)
+{
+    free(_q->h);    // free coefficients memory
+    free(_q->h0);
+    free(_q->h1);
+    free(_q);       // free main object memory
+}
+
+// print dot product object
+void DOTPROD(_print)(DOTPROD() _q)
+{
+    printf("dotprod [Q15, %u coefficients, %s accumulator]:\n",
+            _q->n, _q->wide ? "64-bit" : "32-bit");
+    unsigned int i;
+    for (i=0; i<_q->n; i++) {
+#if TC_COMPLEX
+        printf("  %4u: %12.8f + j*%12.8f\n", i,
+                                             liquid_q15_to_float(_q->h[i].real),
+                                             liquid_q15_to_float(_q->h[i].imag));
+#else
+        printf("  %4u: %12.8f\n", i, liquid_q15_to_float(_q->h[i]));
+#endif
+    }
+}
+
+// execute structured dot product
+//  _q      :   dot product object
+//  _x      :   input array [size: 1 x _n]
+//  _y      :   output dot product
+void DOTPROD(_execute)(DOTPROD() _q,
+                       TI *      _x,
+                       TO *      _y)
+{
+#if TI_COMPLEX
+    int64_t yr, yi;
+    liquid_q15_dotprod2(_q->h0, _q->h1, (int16_t*)_x, 2*_q->n, _q->wide, &yr, &yi);
+    _y->real = LIQUID_Q15_ROUND(yr);
+    _y->imag = LIQUID_Q15_ROUND(yi);
+#else
+    int64_t r = liquid_q15_dotprod(_q->h0, (int16_t*)_x, _q->n, _q->wide);
+    *_y = LIQUID_Q15_ROUND(r);
+#endif
+}
+
+// expand coefficients for the kernels and select accumulator width
+void DOTPROD(_set_coefficients)(DOTPROD() _q,
+                                TC *      _h)
+{
+    memmove(_q->h, _h, (_q->n)*sizeof(TC));
+
+    // clip -32768 (see DOTPROD_Q15_CLIP)
+    unsigned int i;
+    for (i=0; i<_q->n; i++) {
+#if TC_COMPLEX
+        int16_t hr = DOTPROD_Q15_CLIP(_h[i].real);
+        int16_t hi = DOTPROD_Q15_CLIP(_h[i].imag);
+        // real: xr*hr - xi*hi, imag: xr*hi + xi*hr
+        _q->h0[2*i+0] =  hr;
+        _q->h0[2*i+1] = -hi;
+        _q->h1[2*i+0] =  hi;
+        _q->h1[2*i+1] =  hr;
+#else
+        int16_t h = DOTPROD_Q15_CLIP(_h[i]);
+#  if TI_COMPLEX
+        // real: xr*h, imag: xi*h
+        _q->h0[2*i+0] = h;
+        _q->h0[2*i+1] = 0;
+        _q->h1[2*i+0] = 0;
+        _q->h1[2*i+1] = h;
+#  else
+        _q->h0[i] = h;
+#  endif
+#endif
+    }
+
+    // select accumulator width for the expanded kernels
+    unsigned int n = (1+TI_COMPLEX)*_q->n;
+    _q->wide = liquid_q15_dotprod_wide(_q->h0, n);
+#if TI_COMPLEX
+    _q->wide |= liquid_q15_dotprod_wide(_q->h1, n);
+#endif
+}
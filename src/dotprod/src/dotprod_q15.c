@@ -0,0 +1,219 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Q15 fixed-point dot product kernels
+//
+
+#include <stdlib.h>
+#include "liquid.internal.h"
+
+#if HAVE_SSE2 && HAVE_EMMINTRIN_H
+#include <emmintrin.h>  // SSE2
+#endif
+
+// determine whether coefficients require 64-bit accumulation
+//  _h      : coefficients [size: _n x 1]
+//  _n      : length
+int liquid_q15_dotprod_wide(int16_t *    _h,
+                            unsigned int _n)
+{
+    // sum of absolute values of the taps feeding each 32-bit lane; with
+    // |x| <= 2^15 a lane cannot overflow while its sum is below 2^16
+    int64_t sum[4] = {0, 0, 0, 0};
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+#if HAVE_SSE2 && HAVE_EMMINTRIN_H
+        // multiply-add pairs land in lane (i mod 8)/2 of an accumulator
+        sum[(i & 7) >> 1] += abs(_h[i]);
+#else
+        // single scalar accumulator
+        sum[0] += abs(_h[i]);
+#endif
+    }
+    for (i=0; i<4; i++) {
+        if (sum[i] >= 65536)
+            return 1;
+    }
+    return 0;
+}
+
+// Q15 dot product, returning the exact sum of products as Q30
+//  _h      : coefficients [size: _n x 1]
+//  _x      : input [size: _n x 1]
+//  _n      : length
+//  _wide   : accumulate in 64 bits?
+int64_t liquid_q15_dotprod(int16_t *    _h,
+                           int16_t *    _x,
+                           unsigned int _n,
+                           int          _wide)
+{
+    int64_t r = 0;
+    unsigned int i = 0;
+#if HAVE_SSE2 && HAVE_EMMINTRIN_H
+    // each multiply-add yields the sum of two adjacent products, which
+    // fits in 32 bits as coefficients exclude -32768
+    unsigned int t = _n & ~7u;
+    if (_wide) {
+        // sign-extend pair sums to 64 bits before accumulating
+        __m128i acc = _mm_setzero_si128();
+        for (; i<t; i+=8) {
+            __m128i h = _mm_loadu_si128((__m128i*)(_h+i));
+            __m128i x = _mm_loadu_si128((__m128i*)(_x+i));
+            __m128i p = _mm_madd_epi16(h, x);
+            __m128i s = _mm_srai_epi32(p, 31);
+            acc = _mm_add_epi64(acc, _mm_unpacklo_epi32(p, s));
+            acc = _mm_add_epi64(acc, _mm_unpackhi_epi32(p, s));
+        }
+        int64_t v[2];
+        _mm_storeu_si128((__m128i*)v, acc);
+        r = v[0] + v[1];
+    } else {
+        // partial sums are bounded by the coefficients' absolute sum
+        __m128i acc0 = _mm_setzero_si128();
+        __m128i acc1 = _mm_setzero_si128();
+        for (; i+16<=_n; i+=16) {
+            __m128i h0 = _mm_loadu_si128((__m128i*)(_h+i));
+            __m128i x0 = _mm_loadu_si128((__m128i*)(_x+i));
+            __m128i h1 = _mm_loadu_si128((__m128i*)(_h+i+8));
+            __m128i x1 = _mm_loadu_si128((__m128i*)(_x+i+8));
+            acc0 = _mm_add_epi32(acc0, _mm_madd_epi16(h0, x0));
+            acc1 = _mm_add_epi32(acc1, _mm_madd_epi16(h1, x1));
+        }
+        for (; i<t; i+=8) {
+            __m128i h0 = _mm_loadu_si128((__m128i*)(_h+i));
+            __m128i x0 = _mm_loadu_si128((__m128i*)(_x+i));
+            acc0 = _mm_add_epi32(acc0, _mm_madd_epi16(h0, x0));
+        }
+        int32_t v[8];
+        _mm_storeu_si128((__m128i*)(v+0), acc0);
+        _mm_storeu_si128((__m128i*)(v+4), acc1);
+        unsigned int k;
+        for (k=0; k<8; k++)
+            r += v[k];
+    }
+#else
+    if (!_wide) {
+        int32_t r32 = 0;
+        for (; i<_n; i++)
+            r32 += (int32_t)_h[i] * (int32_t)_x[i];
+        r = r32;
+    }
+#endif
+
+    // clean up remaining
+    for (; i<_n; i++)
+        r += (int32_t)_h[i] * (int32_t)_x[i];
+    return r;
+}
+
+// Two Q15 dot products over the same input
+//  _h0     : first coefficients [size: _n x 1]
+//  _h1     : second coefficients [size: _n x 1]
+//  _x      : input [size: _n x 1]
+//  _n      : length
+//  _wide   : accumulate in 64 bits?
+//  _y0     : first output (Q30)
+//  _y1     : second output (Q30)
+void liquid_q15_dotprod2(int16_t *    _h0,
+                         int16_t *    _h1,
+                         int16_t *    _x,
+                         unsigned int _n,
+                         int          _wide,
+                         int64_t *    _y0,
+                         int64_t *    _y1)
+{
+    int64_t r0 = 0;
+    int64_t r1 = 0;
+    unsigned int i = 0;
+#if HAVE_SSE2 && HAVE_EMMINTRIN_H
+    unsigned int t = _n & ~7u;
+    if (_wide) {
+        __m128i acc0 = _mm_setzero_si128();
+        __m128i acc1 = _mm_setzero_si128();
+        for (; i<t; i+=8) {
+            __m128i x  = _mm_loadu_si128((__m128i*)(_x+i));
+            __m128i p0 = _mm_madd_epi16(_mm_loadu_si128((__m128i*)(_h0+i)), x);
+            __m128i p1 = _mm_madd_epi16(_mm_loadu_si128((__m128i*)(_h1+i)), x);
+            __m128i s0 = _mm_srai_epi32(p0, 31);
+            __m128i s1 = _mm_srai_epi32(p1, 31);
+            acc0 = _mm_add_epi64(acc0, _mm_unpacklo_epi32(p0, s0));
+            acc0 = _mm_add_epi64(acc0, _mm_unpackhi_epi32(p0, s0));
+            acc1 = _mm_add_epi64(acc1, _mm_unpacklo_epi32(p1, s1));
+            acc1 = _mm_add_epi64(acc1, _mm_unpackhi_epi32(p1, s1));
+        }
+        int64_t v[4];
+        _mm_storeu_si128((__m128i*)(v+0), acc0);
+        _mm_storeu_si128((__m128i*)(v+2), acc1);
+        r0 = v[0] + v[1];
+        r1 = v[2] + v[3];
+    } else {
+        // two accumulators per output to hide multiply-add latency
+        __m128i acc0 = _mm_setzero_si128();
+        __m128i acc1 = _mm_setzero_si128();
+        __m128i acc2 = _mm_setzero_si128();
+        __m128i acc3 = _mm_setzero_si128();
+        for (; i+16<=_n; i+=16) {
+            __m128i x0 = _mm_loadu_si128((__m128i*)(_x+i));
+            __m128i x1 = _mm_loadu_si128((__m128i*)(_x+i+8));
+            acc0 = _mm_add_epi32(acc0, _mm_madd_epi16(_mm_loadu_si128((__m128i*)(_h0+i  )), x0));
+            acc1 = _mm_add_epi32(acc1, _mm_madd_epi16(_mm_loadu_si128((__m128i*)(_h1+i  )), x0));
+            acc2 = _mm_add_epi32(acc2, _mm_madd_epi16(_mm_loadu_si128((__m128i*)(_h0+i+8)), x1));
+            acc3 = _mm_add_epi32(acc3, _mm_madd_epi16(_mm_loadu_si128((__m128i*)(_h1+i+8)), x1));
+        }
+        for (; i<t; i+=8) {
+            __m128i x  = _mm_loadu_si128((__m128i*)(_x+i));
+            acc0 = _mm_add_epi32(acc0, _mm_madd_epi16(_mm_loadu_si128((__m128i*)(_h0+i)), x));
+            acc1 = _mm_add_epi32(acc1, _mm_madd_epi16(_mm_loadu_si128((__m128i*)(_h1+i)), x));
+        }
+        int32_t v[16];
+        _mm_storeu_si128((__m128i*)(v+ 0), acc0);
+        _mm_storeu_si128((__m128i*)(v+ 4), acc1);
+        _mm_storeu_si128((__m128i*)(v+ 8), acc2);
+        _mm_storeu_si128((__m128i*)(v+12), acc3);
+        unsigned int k;
+        for (k=0; k<4; k++) {
+            r0 += (int64_t)v[k+0] + v[k+ 8];
+            r1 += (int64_t)v[k+4] + v[k+12];
+        }
+    }
+#else
+    if (!_wide) {
+        int32_t a0 = 0;
+        int32_t a1 = 0;
+        for (; i<_n; i++) {
+            a0 += (int32_t)_h0[i] * (int32_t)_x[i];
+            a1 += (int32_t)_h1[i] * (int32_t)_x[i];
+        }
+        r0 = a0;
+        r1 = a1;
+    }
+#endif
+
+    // clean up remaining
+    for (; i<_n; i++) {
+        r0 += (int32_t)_h0[i] * (int32_t)_x[i];
+        r1 += (int32_t)_h1[i] * (int32_t)_x[i];
+    }
+    *_y0 = r0;
+    *_y1 = r1;
+}
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include "autotest/autotest.h"
+#include "liquid.internal.h"
+
+// random Q15 value with amplitude up to _peak (excluding -32768)
+liquid_q15 dotprod_q15_autotest_rand(int _peak)
+{
+    return (liquid_q15)( (rand() % (2*_peak+1)) - _peak );
+}
+
+// test structured Q15 dot products against exact reference for lengths
+// covering the vector kernels and their tails
+//  _peak   : peak coefficient amplitude (large values force 64-bit path)
+void dotprod_q15_test_rand(int _peak)
+{
+    unsigned int n;
+    unsigned int i;
+    for (n=1; n<=70; n++) {
+        liquid_q15  hr[n], xr[n];
+        liquid_cq15 hc[n], xc[n];
+        for (i=0; i<n; i++) {
+            hr[i] = dotprod_q15_autotest_rand(_peak);
+            xr[i] = dotprod_q15_autotest_rand(32767);
+            hc[i].real = dotprod_q15_autotest_rand(_peak);
+            hc[i].imag = dotprod_q15_autotest_rand(_peak);
+            xc[i].real = dotprod_q15_autotest_rand(32767);
+            xc[i].imag = dotprod_q15_autotest_rand(32767);
+        }
+
+        // real
+        liquid_q15 y0, y1;
+        dotprod_rrrq15 q0 = dotprod_rrrq15_create(hr, n);
+        dotprod_rrrq15_run(hr, xr, n, &y0);
+        dotprod_rrrq15_execute(q0, xr, &y1);
+        CONTEND_EQUALITY(y0, y1);
+        dotprod_rrrq15_destroy(q0);
+
+        // complex input, real coefficients
+        liquid_cq15 z0, z1;
+        dotprod_crcq15 q1 = dotprod_crcq15_create(hr, n);
+        dotprod_crcq15_run(hr, xc, n, &z0);
+        dotprod_crcq15_execute(q1, xc, &z1);
+        CONTEND_EQUALITY(z0.real, z1.real);
+        CONTEND_EQUALITY(z0.imag, z1.imag);
+        dotprod_crcq15_destroy(q1);
+
+        // complex input, complex coefficients
+        dotprod_cccq15 q2 = dotprod_cccq15_create(hc, n);
+        dotprod_cccq15_run(hc, xc, n, &z0);
+        dotprod_cccq15_execute(q2, xc, &z1);
+        CONTEND_EQUALITY(z0.real, z1.real);
+        CONTEND_EQUALITY(z0.imag, z1.imag);
+        dotprod_cccq15_destroy(q2);
+    }
+}
+
+void autotest_dotprod_q15_rand_narrow() { dotprod_q15_test_rand(  400); }
+void autotest_dotprod_q15_rand_wide()   { dotprod_q15_test_rand(32767); }
+
+// compare Q15 dot product against floating-point version
+void autotest_dotprod_q15_float()
+{
+    unsigned int n = 32;
+    unsigned int i;
+    float         hf[n];
+    float complex xf[n];
+    liquid_q15    hq[n];
+    liquid_cq15   xq[n];
+    for (i=0; i<n; i++) {
+        hf[i] = 0.04f*randnf();
+        xf[i] = 0.3f*(randnf() + _Complex_I*randnf());
+        hq[i] = liquid_float_to_q15(hf[i]);
+        xq[i].real = liquid_float_to_q15(crealf(xf[i]));
+        xq[i].imag = liquid_float_to_q15(cimagf(xf[i]));
+        // use quantized values as reference input
+        hf[i] = liquid_q15_to_float(hq[i]);
+        xf[i] = liquid_q15_to_float(xq[i].real) +
+                liquid_q15_to_float(xq[i].imag)*_Complex_I;
+    }
+
+    float complex yf;
+    liquid_cq15   yq;
+    dotprod_crcf   q0 = dotprod_crcf_create(hf, n);
+    dotprod_crcq15 q1 = dotprod_crcq15_create(hq, n);
+    dotprod_crcf_execute  (q0, xf, &yf);
+    dotprod_crcq15_execute(q1, xq, &yq);
+    dotprod_crcf_destroy(q0);
+    dotprod_crcq15_destroy(q1);
+
+    // output is rounded to nearest Q15 level
+    float tol = 1.0f / 32768.0f;
+    CONTEND_DELTA(liquid_q15_to_float(yq.real), crealf(yf), tol);
+    CONTEND_DELTA(liquid_q15_to_float(yq.imag), cimagf(yf), tol);
+}
+
+// test output saturation and coefficient clipping
+void autotest_dotprod_q15_saturate()
+{
+    liquid_q15 h[8] = { 32767,  32767,  32767,  32767,
+                       -32768, -32768, -32768, -32768};
+    liquid_q15 x[8] = { 32767,  32767,  32767,  32767,
+                        32767,  32767,  32767,  32767};
+    liquid_q15 y;
+
+    // positive overflow
+    dotprod_rrrq15 q = dotprod_rrrq15_create(h, 4);
+    dotprod_rrrq15_execute(q, x, &y);
+    CONTEND_EQUALITY(y, 32767);
+
+    // negative overflow, -32768 clipped to -32767 internally
+    q = dotprod_rrrq15_recreate(q, h+4, 4);
+    dotprod_rrrq15_execute(q, x, &y);
+    CONTEND_EQUALITY(y, -32768);
+
+    // single tap: -32767*32767 rounds to -32766
+    q = dotprod_rrrq15_recreate(q, h+4, 1);
+    dotprod_rrrq15_execute(q, x, &y);
+    CONTEND_EQUALITY(y, -32766);
+    dotprod_rrrq15_destroy(q);
+
+    // unstructured methods clip coefficients the same way
+    dotprod_rrrq15_run (h+4, x, 1, &y);
+    CONTEND_EQUALITY(y, -32766);
+    dotprod_rrrq15_run4(h+4, x, 1, &y);
+    CONTEND_EQUALITY(y, -32766);
+    liquid_cq15 xs[1] = {{32767, 32767}};
+    liquid_cq15 ys;
+    dotprod_crcq15_run(h+4, xs, 1, &ys);
+    CONTEND_EQUALITY(ys.real, -32766);
+    CONTEND_EQUALITY(ys.imag, -32766);
+
+    // complex: (32767 + j32767)^2 saturates real to 0 and imag to max
+    liquid_cq15 hc[1] = {{32767, 32767}};
+    liquid_cq15 xc[1] = {{32767, 32767}};
+    liquid_cq15 yc;
+    dotprod_cccq15 qc = dotprod_cccq15_create(hc, 1);
+    dotprod_cccq15_execute(qc, xc, &yc);
+    CONTEND_EQUALITY(yc.real, 0);
+    CONTEND_EQUALITY(yc.imag, 32767);
+    dotprod_cccq15_destroy(qc);
+}
+
@@ -696,6 +696,27 @@ void fec_print(fec _q)
         _q->rate);
 }
 
+// get number of bytes allocated by object, excluding the internal
+// state of external (libfec) decoders
+unsigned long int fec_get_memory_usage(fec _q)
+{
+    unsigned long int n = sizeof(struct fec_s);
+
+    if (fec_scheme_is_punctured(_q->scheme)) {
+        // encoded bits, expanded to full (unpunctured) length
+        if (_q->enc_bits != NULL)
+            n += (8*_q->num_dec_bytes + _q->K - 1) * _q->R;
+    } else if (fec_scheme_is_convolutional(_q->scheme)) {
+        // encoded bits
+        if (_q->enc_bits != NULL)
+            n += 8*_q->num_enc_bytes;
+    } else if (fec_scheme_is_reedsolomon(_q->scheme)) {
+        // decoder input block and error locations
+        n += _q->nn * (sizeof(unsigned char) + 2*sizeof(int));
+    }
+    return n;
+}
+
 // encode a block of data using a fec scheme
 //  _q              :   fec object
 //  _dec_msg_len    :   decoded message length
@@ -37,7 +37,7 @@
 
 fec fec_conv_create(fec_scheme _fs)
 {
-    fec q = (fec) malloc(sizeof(struct fec_s));
+    fec q = (fec) liquid_malloc(sizeof(struct fec_s), "fec");
 
     q->scheme = _fs;
     q->rate = fec_get_rate(q->scheme);
@@ -71,9 +71,9 @@ void fec_conv_destroy(fec _q)
         _q->delete_viterbi(_q->vp);
 
     if (_q->enc_bits != NULL)
-        free(_q->enc_bits);
+        liquid_free(_q->enc_bits, "fec");
 
-    free(_q);
+    liquid_free(_q, "fec");
 }
 
 void fec_conv_encode(fec _q,
@@ -226,8 +226,8 @@ void fec_conv_setlength(fec _q, unsigned int _dec_msg_len)
 
     // re-create / re-allocate memory buffers
     _q->vp = _q->create_viterbi(8*_q->num_dec_bytes);
-    _q->enc_bits = (unsigned char*) realloc(_q->enc_bits,
-                                            _q->num_enc_bytes*8*sizeof(unsigned char));
+    _q->enc_bits = (unsigned char*) liquid_realloc(_q->enc_bits,
+                                                   _q->num_enc_bytes*8*sizeof(unsigned char), "fec");
 }
 
 // 
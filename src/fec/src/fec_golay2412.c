@@ -237,7 +237,7 @@ unsigned int fec_golay2412_decode_symbol(unsigned int _sym_enc)
 // create Golay(24,12) codec object
 fec fec_golay2412_create(void * _opts)
 {
-    fec q = (fec) malloc(sizeof(struct fec_s));
+    fec q = (fec) liquid_malloc(sizeof(struct fec_s), "fec");
 
     // set scheme
     q->scheme = LIQUID_FEC_GOLAY2412;
@@ -254,7 +254,7 @@ fec fec_golay2412_create(void * _opts)
 // destroy Golay(24,12) object
 void fec_golay2412_destroy(fec _q)
 {
-    free(_q);
+    liquid_free(_q, "fec");
 }
 
 // encode block of data using Golay(24,12) encoder
@@ -143,7 +143,7 @@ unsigned int fec_hamming128_decode_symbol(unsigned int _sym_enc)
 // create Hamming(12,8) codec object
 fec fec_hamming128_create(void * _opts)
 {
-    fec q = (fec) malloc(sizeof(struct fec_s));
+    fec q = (fec) liquid_malloc(sizeof(struct fec_s), "fec");
 
     // set scheme
     q->scheme = LIQUID_FEC_HAMMING128;
@@ -160,7 +160,7 @@ fec fec_hamming128_create(void * _opts)
 // destroy Hamming(12,8) object
 void fec_hamming128_destroy(fec _q)
 {
-    free(_q);
+    liquid_free(_q, "fec");
 }
 
 // encode block of data using Hamming(12,8) encoder
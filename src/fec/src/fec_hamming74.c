@@ -57,7 +57,7 @@ unsigned char hamming74_dec_gentab[128] = {
 // create Hamming(7,4) codec object
 fec fec_hamming74_create(void * _opts)
 {
-    fec q = (fec) malloc(sizeof(struct fec_s));
+    fec q = (fec) liquid_malloc(sizeof(struct fec_s), "fec");
 
     // set scheme
     q->scheme = LIQUID_FEC_HAMMING74;
@@ -74,7 +74,7 @@ fec fec_hamming74_create(void * _opts)
 // destroy Hamming(7,4) object
 void fec_hamming74_destroy(fec _q)
 {
-    free(_q);
+    liquid_free(_q, "fec");
 }
 
 // encode block of data using Hamming(7,4) encoder
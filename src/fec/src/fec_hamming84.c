@@ -73,7 +73,7 @@ unsigned char hamming84_dec_gentab[256] = {
 // create Hamming(8,4) codec object
 fec fec_hamming84_create(void * _opts)
 {
-    fec q = (fec) malloc(sizeof(struct fec_s));
+    fec q = (fec) liquid_malloc(sizeof(struct fec_s), "fec");
 
     // set scheme
     q->scheme = LIQUID_FEC_HAMMING84;
@@ -90,7 +90,7 @@ fec fec_hamming84_create(void * _opts)
 // destroy Hamming(8,4) object
 void fec_hamming84_destroy(fec _q)
 {
-    free(_q);
+    liquid_free(_q, "fec");
 }
 
 // encode block of data using Hamming(8,4) encoder
@@ -32,7 +32,7 @@
 // create rep5 codec object
 fec fec_rep5_create(void * _opts)
 {
-    fec q = (fec) malloc(sizeof(struct fec_s));
+    fec q = (fec) liquid_malloc(sizeof(struct fec_s), "fec");
 
     q->scheme = LIQUID_FEC_REP5;
     q->rate = fec_get_rate(q->scheme);
@@ -47,7 +47,7 @@ fec fec_rep5_create(void * _opts)
 // destroy rep5 object
 void fec_rep5_destroy(fec _q)
 {
-    free(_q);
+    liquid_free(_q, "fec");
 }
 
 // print rep5 object
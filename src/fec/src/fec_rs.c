@@ -38,7 +38,7 @@
 
 fec fec_rs_create(fec_scheme _fs)
 {
-    fec q = (fec) malloc(sizeof(struct fec_s));
+    fec q = (fec) liquid_malloc(sizeof(struct fec_s), "fec");
 
     q->scheme = _fs;
     q->rate = fec_get_rate(q->scheme);
@@ -63,9 +63,9 @@ fec fec_rs_create(fec_scheme _fs)
     q->rs = NULL;
 
     // allocate memory for arrays
-    q->tblock   = (unsigned char*) malloc(q->nn*sizeof(unsigned char));
-    q->errlocs  = (int *) malloc(q->nn*sizeof(int));
-    q->derrlocs = (int *) malloc(q->nn*sizeof(int));
+    q->tblock   = (unsigned char*) liquid_malloc(q->nn*sizeof(unsigned char), "fec");
+    q->errlocs  = (int *) liquid_malloc(q->nn*sizeof(int), "fec");
+    q->derrlocs = (int *) liquid_malloc(q->nn*sizeof(int), "fec");
 
     return q;
 }
@@ -78,12 +78,12 @@ void fec_rs_destroy(fec _q)
     }
 
     // delete internal memory arrays
-    free(_q->tblock);
-    free(_q->errlocs);
-    free(_q->derrlocs);
+    liquid_free(_q->tblock, "fec");
+    liquid_free(_q->errlocs, "fec");
+    liquid_free(_q->derrlocs, "fec");
 
     // delete fec object
-    free(_q);
+    liquid_free(_q, "fec");
 }
 
 void fec_rs_encode(fec _q,
@@ -197,7 +197,7 @@ int fec_secded2216_estimate_ehat(unsigned char * _sym_enc,
 // create SEC-DED (22,16) codec object
 fec fec_secded2216_create(void * _opts)
 {
-    fec q = (fec) malloc(sizeof(struct fec_s));
+    fec q = (fec) liquid_malloc(sizeof(struct fec_s), "fec");
 
     // set scheme
     q->scheme = LIQUID_FEC_SECDED2216;
@@ -214,7 +214,7 @@ fec fec_secded2216_create(void * _opts)
 // destroy SEC-DEC (22,16) object
 void fec_secded2216_destroy(fec _q)
 {
-    free(_q);
+    liquid_free(_q, "fec");
 }
 
 // encode block of data using SEC-DEC (22,16) encoder
@@ -213,7 +213,7 @@ int fec_secded3932_estimate_ehat(unsigned char * _sym_enc,
 // create SEC-DED (39,32) codec object
 fec fec_secded3932_create(void * _opts)
 {
-    fec q = (fec) malloc(sizeof(struct fec_s));
+    fec q = (fec) liquid_malloc(sizeof(struct fec_s), "fec");
 
     // set scheme
     q->scheme = LIQUID_FEC_SECDED3932;
@@ -230,7 +230,7 @@ fec fec_secded3932_create(void * _opts)
 // destroy SEC-DEC (39,32) object
 void fec_secded3932_destroy(fec _q)
 {
-    free(_q);
+    liquid_free(_q, "fec");
 }
 
 // encode block of data using SEC-DEC (39,32) encoder
@@ -216,7 +216,7 @@ int fec_secded7264_estimate_ehat(unsigned char * _sym_enc,
 // create SEC-DED (72,64) codec object
 fec fec_secded7264_create(void * _opts)
 {
-    fec q = (fec) malloc(sizeof(struct fec_s));
+    fec q = (fec) liquid_malloc(sizeof(struct fec_s), "fec");
 
     // set scheme
     q->scheme = LIQUID_FEC_SECDED7264;
@@ -233,7 +233,7 @@ fec fec_secded7264_create(void * _opts)
 // destroy SEC-DEC (72,64) object
 void fec_secded7264_destroy(fec _q)
 {
-    free(_q);
+    liquid_free(_q, "fec");
 }
 
 // encode block of data using SEC-DEC (72,64) encoder
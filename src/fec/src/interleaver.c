@@ -78,7 +78,7 @@ struct interleaver_s {
 // create interleaver of length _n input/output bytes
 interleaver interleaver_create(unsigned int _n)
 {
-    interleaver q = (interleaver) malloc(sizeof(struct interleaver_s));
+    interleaver q = (interleaver) liquid_malloc(sizeof(struct interleaver_s), "interleaver");
     q->n = _n;
 
     // set internal properties
@@ -97,7 +97,7 @@ interleaver interleaver_create(unsigned int _n)
 void interleaver_destroy(interleaver _q)
 {
     // free main object memory
-    free(_q);
+    liquid_free(_q, "interleaver");
 }
 
 // print interleaver internals
@@ -109,6 +109,12 @@ void interleaver_print(interleaver _q)
     printf("    depth   :   %u\n", _q->depth);
 }
 
+// get number of bytes allocated by object
+unsigned long int interleaver_get_memory_usage(interleaver _q)
+{
+    return sizeof(struct interleaver_s);
+}
+
 // set depth (number of internal iterations)
 void interleaver_set_depth(interleaver  _q,
                            unsigned int _depth)
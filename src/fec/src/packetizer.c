@@ -95,7 +95,7 @@ packetizer packetizer_create(unsigned int _n,
                              int _fec0,
                              int _fec1)
 {
-    packetizer p = (packetizer) malloc(sizeof(struct packetizer_s));
+    packetizer p = (packetizer) liquid_malloc(sizeof(struct packetizer_s), "packetizer");
 
     p->msg_len      = _n;
     p->packet_len   = packetizer_compute_enc_msg_len(_n, _crc, _fec0, _fec1);
@@ -104,12 +104,12 @@ packetizer packetizer_create(unsigned int _n,
 
     // allocate memory for buffers (scale by 8 for soft decoding)
     p->buffer_len = p->packet_len;
-    p->buffer_0 = (unsigned char*) malloc(8*p->buffer_len);
-    p->buffer_1 = (unsigned char*) malloc(8*p->buffer_len);
+    p->buffer_0 = (unsigned char*) liquid_malloc(8*p->buffer_len, "packetizer");
+    p->buffer_1 = (unsigned char*) liquid_malloc(8*p->buffer_len, "packetizer");
 
     // create plan
     p->plan_len = 2;
-    p->plan = (struct fecintlv_plan*) malloc((p->plan_len)*sizeof(struct fecintlv_plan));
+    p->plan = (struct fecintlv_plan*) liquid_malloc((p->plan_len)*sizeof(struct fecintlv_plan), "packetizer");
 
     // set schemes
     unsigned int i;
@@ -188,14 +188,14 @@ void packetizer_destroy(packetizer _p)
     };
 
     // free plan
-    free(_p->plan);
+    liquid_free(_p->plan, "packetizer");
 
     // free buffers
-    free(_p->buffer_0);
-    free(_p->buffer_1);
+    liquid_free(_p->buffer_0, "packetizer");
+    liquid_free(_p->buffer_1, "packetizer");
 
     // free packetizer object
-    free(_p);
+    liquid_free(_p, "packetizer");
 }
 
 // print packetizer object internals
@@ -216,6 +216,23 @@ void packetizer_print(packetizer _p)
     }
 }
 
+// get number of bytes allocated by object, including fec objects
+unsigned long int packetizer_get_memory_usage(packetizer _p)
+{
+    // object, plan and ping-pong buffers (scaled by 8 for soft decoding)
+    unsigned long int n = sizeof(struct packetizer_s) +
+                          _p->plan_len*sizeof(struct fecintlv_plan) +
+                          2*8*_p->buffer_len;
+
+    // fec, interleaver objects
+    unsigned int i;
+    for (i=0; i<_p->plan_len; i++) {
+        n += fec_get_memory_usage(_p->plan[i].f);
+        n += interleaver_get_memory_usage(_p->plan[i].q);
+    }
+    return n;
+}
+
 // get decoded message length
 unsigned int packetizer_get_dec_msg_len(packetizer _p)
 {
@@ -420,7 +437,7 @@ void packetizer_set_scheme(packetizer _p, int _fec0, int _fec1)
 void packetizer_realloc_buffers(packetizer _p, unsigned int _len)
 {
     _p->buffer_len = _len;
-    _p->buffer_0 = (unsigned char*) realloc(_p->buffer_0, _p->buffer_len);
-    _p->buffer_1 = (unsigned char*) realloc(_p->buffer_1, _p->buffer_len);
+    _p->buffer_0 = (unsigned char*) liquid_realloc(_p->buffer_0, _p->buffer_len, "packetizer");
+    _p->buffer_1 = (unsigned char*) liquid_realloc(_p->buffer_1, _p->buffer_len, "packetizer");
 }
 
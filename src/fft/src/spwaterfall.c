@@ -40,7 +40,10 @@ struct SPWATERFALL(_s) {
     SPGRAM()        periodogram;    // spectral periodogram object
 
     // buffers
-    T *             psd;            // time/frequency buffer [nfft x 2*time]
+    liquid_storage_type storage;    // storage format of time/frequency buffer
+    void *          psd;            // time/frequency buffer [nfft x 2*time]
+    T *             row;            // unpacked rows for reduced-precision storage [nfft x 2]
+    T *             psd_out;        // unpacked output buffer (reduced-precision storage only)
     unsigned int    index_time;     // time index for writing to buffer
     unsigned int    rollover;       // number of FFTs to take before writing to output
 
@@ -62,6 +65,9 @@ void SPWATERFALL(_step)(SPWATERFALL() _q);
 // consolidate buffer by taking log-average of two separate spectral estimates in time
 void SPWATERFALL(_consolidate_buffer)(SPWATERFALL() _q);
 
+// get pointer to row (time index) of time/frequency buffer
+void * SPWATERFALL(_get_row)(SPWATERFALL() _q, unsigned int _index);
+
 // export files
 int SPWATERFALL(_export_bin)(SPWATERFALL() _q, const char * _base);
 int SPWATERFALL(_export_gnu)(SPWATERFALL() _q, const char * _base);
@@ -99,7 +105,7 @@ SPWATERFALL() SPWATERFALL(_create)(unsigned int _nfft,
     }
 
     // allocate memory for main object
-    SPWATERFALL() q = (SPWATERFALL()) malloc(sizeof(struct SPWATERFALL(_s)));
+    SPWATERFALL() q = (SPWATERFALL()) liquid_malloc(sizeof(struct SPWATERFALL(_s)), "spwaterfall" EXTENSION);
 
     // set input parameters
     q->nfft         = _nfft;
@@ -114,7 +120,10 @@ SPWATERFALL() SPWATERFALL(_create)(unsigned int _nfft,
     // NOTE: the buffer is two-dimensional time/frequency grid that is two times
     //       'nfft' and 'time' to account for log-average consolidation each time
     //       the buffer gets filled
-    q->psd = (T*) malloc( 2 * q->nfft * q->time * sizeof(T));
+    q->storage = LIQUID_STORAGE_FLOAT32;
+    q->psd     = liquid_malloc( 2 * q->nfft * q->time * sizeof(T), "spwaterfall" EXTENSION);
+    q->row     = (T*) liquid_malloc( 2 * q->nfft * sizeof(T), "spwaterfall" EXTENSION);
+    q->psd_out = NULL;
 
     // create spectral periodogram object
     q->periodogram = SPGRAM(_create)(_nfft, _wtype, _window_len, _delay);
@@ -146,14 +155,16 @@ SPWATERFALL() SPWATERFALL(_create_default)(unsigned int _nfft,
 void SPWATERFALL(_destroy)(SPWATERFALL() _q)
 {
     // free allocated memory
-    free(_q->psd);
-    free(_q->commands);
+    liquid_free(_q->psd, "spwaterfall" EXTENSION);
+    liquid_free(_q->row, "spwaterfall" EXTENSION);
+    liquid_free(_q->psd_out, "spwaterfall" EXTENSION);
+    liquid_free(_q->commands, "spwaterfall" EXTENSION);
 
     // destroy internal spectral periodogram object
     SPGRAM(_destroy)(_q->periodogram);
 
     // free main object
-    free(_q);
+    liquid_free(_q, "spwaterfall" EXTENSION);
 }
 
 // clears the internal state of the spwaterfall object, but not
@@ -161,7 +172,7 @@ void SPWATERFALL(_destroy)(SPWATERFALL() _q)
 void SPWATERFALL(_clear)(SPWATERFALL() _q)
 {
     SPGRAM(_clear)(_q->periodogram);
-    memset(_q->psd, 0x00, 2*_q->nfft*_q->time*sizeof(T));
+    memset(_q->psd, 0x00, 2*_q->nfft*_q->time*liquid_storage_size(_q->storage));
     _q->index_time = 0;
 }
 
@@ -179,6 +190,20 @@ void SPWATERFALL(_print)(SPWATERFALL() _q)
     printf("spwaterfall%s: nfft=%u, time=%u\n", EXTENSION, _q->nfft, _q->time);
 }
 
+// get number of bytes allocated by object for its time/frequency
+// history and output buffers (the internal spgram is not included)
+unsigned long int SPWATERFALL(_get_memory_usage)(SPWATERFALL() _q)
+{
+    unsigned long int n = sizeof(struct SPWATERFALL(_s)) +
+                          2*_q->nfft*_q->time*liquid_storage_size(_q->storage) +
+                          2*_q->nfft*sizeof(T);
+    if (_q->psd_out != NULL)
+        n += 2*_q->nfft*_q->time*sizeof(T);
+    if (_q->commands != NULL)
+        n += strlen(_q->commands) + 1;
+    return n;
+}
+
 // Get number of samples processed since object was created
 uint64_t SPWATERFALL(_get_num_samples_total)(SPWATERFALL() _q)
 {
@@ -200,7 +225,38 @@ unsigned int SPWATERFALL(_get_num_time)(SPWATERFALL() _q)
 // Get power spectral density (PSD), size: nfft x time
 const float * SPWATERFALL(_get_psd)(SPWATERFALL() _q)
 {
-    return (const T *) _q->psd;
+    if (_q->storage == LIQUID_STORAGE_FLOAT32)
+        return (const T *) _q->psd;
+
+    // unpack reduced-precision buffer into separate output buffer
+    if (_q->psd_out == NULL)
+        _q->psd_out = (T*) liquid_malloc( 2 * _q->nfft * _q->time * sizeof(T), "spwaterfall" EXTENSION);
+    liquid_storage_unpack(_q->storage, _q->psd, _q->nfft*_q->index_time, _q->psd_out);
+    return (const T *) _q->psd_out;
+}
+
+// Set storage format of internal time/frequency buffer, e.g.
+// LIQUID_STORAGE_FLOAT16; this resets the object
+int SPWATERFALL(_set_storage)(SPWATERFALL()       _q,
+                              liquid_storage_type _storage)
+{
+    // validate input
+    if (_storage != LIQUID_STORAGE_FLOAT32 &&
+        _storage != LIQUID_STORAGE_FLOAT16 &&
+        _storage != LIQUID_STORAGE_BFLOAT16)
+    {
+        fprintf(stderr,"error: spwaterfall%s_set_storage(), invalid storage type %d\n", EXTENSION, _storage);
+        return -1;
+    }
+    _q->storage = _storage;
+    _q->psd = liquid_realloc(_q->psd, 2*_q->nfft*_q->time*liquid_storage_size(_q->storage), "spwaterfall" EXTENSION);
+
+    // release unpacked output buffer
+    liquid_free(_q->psd_out, "spwaterfall" EXTENSION);
+    _q->psd_out = NULL;
+
+    SPWATERFALL(_reset)(_q);
+    return 0;
 }
 
 // set center freuqncy
@@ -240,7 +296,7 @@ int SPWATERFALL(_set_commands)(SPWATERFALL() _q,
 {
     // clear memory with NULL pointer
     if (_commands == NULL) {
-        free(_q->commands);
+        liquid_free(_q->commands, "spwaterfall" EXTENSION);
         _q->commands = NULL;
         return 0;
     }
@@ -254,7 +310,7 @@ int SPWATERFALL(_set_commands)(SPWATERFALL() _q,
     }
 
     // reallocate memory, copy input, and return
-    _q->commands = (char*) realloc(_q->commands, n+1);
+    _q->commands = (char*) liquid_realloc(_q->commands, n+1, "spwaterfall" EXTENSION);
     memmove(_q->commands, _commands, n);
     _q->commands[n] = '\0';
     return 0;
@@ -304,7 +360,13 @@ void SPWATERFALL(_step)(SPWATERFALL() _q)
         //printf("index : %u\n", _q->index_time);
         // get PSD estimate from periodogram object, placing result in
         // proper location in internal buffer
-        SPGRAM(_get_psd)(_q->periodogram, _q->psd + _q->nfft*_q->index_time);
+        if (_q->storage == LIQUID_STORAGE_FLOAT32) {
+            SPGRAM(_get_psd)(_q->periodogram, (T*)_q->psd + _q->nfft*_q->index_time);
+        } else {
+            SPGRAM(_get_psd)(_q->periodogram, _q->row);
+            liquid_storage_pack(_q->storage, _q->row, _q->nfft,
+                                SPWATERFALL(_get_row)(_q, _q->index_time));
+        }
 
         // soft reset of internal state, counters
         SPGRAM(_clear)(_q->periodogram);
@@ -328,14 +390,30 @@ void SPWATERFALL(_consolidate_buffer)(SPWATERFALL() _q)
     unsigned int i; // time index
     unsigned int k; // freq index
     for (i=0; i<_q->time; i++) {
+        // rows to average, unpacking reduced-precision storage
+        T * r0 = _q->row;
+        T * r1 = _q->row + _q->nfft;
+        if (_q->storage == LIQUID_STORAGE_FLOAT32) {
+            r0 = (T*)_q->psd + (2*i + 0)*_q->nfft;
+            r1 = (T*)_q->psd + (2*i + 1)*_q->nfft;
+        } else {
+            liquid_storage_unpack(_q->storage, SPWATERFALL(_get_row)(_q, 2*i+0), _q->nfft, r0);
+            liquid_storage_unpack(_q->storage, SPWATERFALL(_get_row)(_q, 2*i+1), _q->nfft, r1);
+        }
+
+        // result overwrites row i directly, or is packed into it below
+        T * r = _q->storage == LIQUID_STORAGE_FLOAT32 ? (T*)_q->psd + i*_q->nfft : r0;
         for (k=0; k<_q->nfft; k++) {
             // convert to linear, compute average, convert back to log
-            T v0 = powf(10.0f, _q->psd[ (2*i + 0)*_q->nfft + k ]*0.1f);
-            T v1 = powf(10.0f, _q->psd[ (2*i + 1)*_q->nfft + k ]*0.1f);
+            T v0 = powf(10.0f, r0[k]*0.1f);
+            T v1 = powf(10.0f, r1[k]*0.1f);
 
             // save result
-            _q->psd[ i*_q->nfft + k ] = 10.0f*log10f(0.5f*(v0+v1));
+            r[k] = 10.0f*log10f(0.5f*(v0+v1));
         }
+
+        if (_q->storage != LIQUID_STORAGE_FLOAT32)
+            liquid_storage_pack(_q->storage, r, _q->nfft, SPWATERFALL(_get_row)(_q, i));
     }
 
     // update time index
@@ -345,6 +423,15 @@ void SPWATERFALL(_consolidate_buffer)(SPWATERFALL() _q)
     _q->rollover *= 2;
 }
 
+// get pointer to row (time index) of time/frequency buffer
+//  _q      : spwaterfall object
+//  _index  : time index, _index < 2*time
+void * SPWATERFALL(_get_row)(SPWATERFALL() _q,
+                             unsigned int  _index)
+{
+    return (char*)_q->psd + _index*_q->nfft*liquid_storage_size(_q->storage);
+}
+
 // export gnuplot file
 //  _q        : spwaterfall object
 //  _filename : input buffer [size: _n x 1]
@@ -380,7 +467,8 @@ int SPWATERFALL(_export_bin)(SPWATERFALL() _q,
     for (i=0; i<_q->index_time; i++) {
         float n = (float)i / (float)(_q->index_time) * (float)total_samples;
         fwrite(&n, sizeof(float), 1, fid);
-        fwrite(&_q->psd[i*_q->nfft], sizeof(float), _q->nfft, fid);
+        liquid_storage_unpack(_q->storage, SPWATERFALL(_get_row)(_q, i), _q->nfft, _q->row);
+        fwrite(_q->row, sizeof(float), _q->nfft, fid);
     }
 
     // close it up
@@ -20,6 +20,7 @@
  * THE SOFTWARE.
  */
 
+#include <stdlib.h>
 #include <sys/resource.h>
 #include "liquid.h"
 
@@ -74,3 +75,137 @@ void benchmark_firdecim_crcf_m8_h32    FIRDECIM_CRCF_BENCHMARK_API(8, 32)
 void benchmark_firdecim_crcf_m16_h64   FIRDECIM_CRCF_BENCHMARK_API(16,64)
 void benchmark_firdecim_cccf_m32_h128  FIRDECIM_CRCF_BENCHMARK_API(32,128)
 
+// Helper function for block execution with general (random) or
+// linear-phase (symmetric) coefficients and _n output samples per block;
+// a trial is one output sample
+void firdecim_crcf_block_bench(struct rusage *     _start,
+                               struct rusage *     _finish,
+                               unsigned long int * _num_iterations,
+                               unsigned int        _M,
+                               unsigned int        _h_len,
+                               int                 _symmetric,
+                               unsigned int        _n)
+{
+    // normalize number of iterations
+    *_num_iterations /= _h_len;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    float h[_h_len];
+    unsigned int i;
+    if (_symmetric) {
+        liquid_firdes_kaiser(_h_len, 0.5f/(float)_M, 60.0f, 0.0f, h);
+    } else {
+        for (i=0; i<_h_len; i++)
+            h[i] = randnf();
+    }
+    firdecim_crcf q = firdecim_crcf_create(_M,h,_h_len);
+
+    // initialize input
+    unsigned int n = _n;
+    float complex * x = (float complex*) malloc(n*_M*sizeof(float complex));
+    float complex * y = (float complex*) malloc(n*sizeof(float complex));
+    for (i=0; i<n*_M; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // start trials
+    unsigned long int t;
+    unsigned long int num_blocks = *_num_iterations / n + 1;
+    getrusage(RUSAGE_SELF, _start);
+    for (t=0; t<num_blocks; t++)
+        firdecim_crcf_execute_block(q, x, n, y);
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations = num_blocks * n;
+
+    firdecim_crcf_destroy(q);
+    free(x);
+    free(y);
+}
+
+#define FIRDECIM_CRCF_BLOCK_BENCHMARK_API(M,H_LEN,S)    \
+(   struct rusage *_start,                              \
+    struct rusage *_finish,                             \
+    unsigned long int *_num_iterations)                 \
+{ firdecim_crcf_block_bench(_start, _finish, _num_iterations, M, H_LEN, S, 256); }
+
+// block execution, general vs. linear-phase coefficients
+void benchmark_firdecim_crcf_block_m2_h21       FIRDECIM_CRCF_BLOCK_BENCHMARK_API(2, 21, 0)
+void benchmark_firdecim_crcf_block_m2_h21_sym   FIRDECIM_CRCF_BLOCK_BENCHMARK_API(2, 21, 1)
+void benchmark_firdecim_crcf_block_m4_h65       FIRDECIM_CRCF_BLOCK_BENCHMARK_API(4, 65, 0)
+void benchmark_firdecim_crcf_block_m4_h65_sym   FIRDECIM_CRCF_BLOCK_BENCHMARK_API(4, 65, 1)
+void benchmark_firdecim_crcf_block_m8_h129      FIRDECIM_CRCF_BLOCK_BENCHMARK_API(8,129, 0)
+void benchmark_firdecim_crcf_block_m8_h129_sym  FIRDECIM_CRCF_BLOCK_BENCHMARK_API(8,129, 1)
+
+
+#define FIRDECIM_CRCF_LONG_BENCHMARK_API(M,H_LEN)       \
+(   struct rusage *_start,                              \
+    struct rusage *_finish,                             \
+    unsigned long int *_num_iterations)                 \
+{ firdecim_crcf_block_bench(_start, _finish, _num_iterations, M, H_LEN, 1, 16384); }
+
+// long filters, large blocks: fast convolution where cheaper
+void benchmark_firdecim_crcf_block_m2_h2049     FIRDECIM_CRCF_LONG_BENCHMARK_API(2, 2049)
+void benchmark_firdecim_crcf_block_m4_h4097     FIRDECIM_CRCF_LONG_BENCHMARK_API(4, 4097)
+void benchmark_firdecim_crcf_block_m8_h4097     FIRDECIM_CRCF_LONG_BENCHMARK_API(8, 4097)
+void benchmark_firdecim_crcf_block_m16_h2049    FIRDECIM_CRCF_LONG_BENCHMARK_API(16,2049)
+
+
+// Helper function for block execution on interleaved 16-bit I/Q input,
+// either converted while buffering (_fused) or converted to floating
+// point ahead of execute_block; a trial is one output sample
+void firdecim_crcf_ci16_bench(struct rusage *     _start,
+                              struct rusage *     _finish,
+                              unsigned long int * _num_iterations,
+                              unsigned int        _M,
+                              unsigned int        _h_len,
+                              int                 _fused)
+{
+    // normalize number of iterations
+    *_num_iterations /= _h_len;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    float h[_h_len];
+    liquid_firdes_kaiser(_h_len, 0.5f/(float)_M, 60.0f, 0.0f, h);
+    firdecim_crcf q = firdecim_crcf_create(_M,h,_h_len);
+
+    // initialize input
+    unsigned int n = 256;
+    unsigned int i;
+    int16_t *       x16 = (int16_t*)       malloc(2*n*_M*sizeof(int16_t));
+    float complex * x   = (float complex*) malloc(n*_M*sizeof(float complex));
+    float complex * y   = (float complex*) malloc(n*sizeof(float complex));
+    for (i=0; i<2*n*_M; i++)
+        x16[i] = (int16_t)(rand() % 65536 - 32768);
+
+    // start trials
+    unsigned long int t;
+    unsigned long int num_blocks = *_num_iterations / n + 1;
+    getrusage(RUSAGE_SELF, _start);
+    for (t=0; t<num_blocks; t++) {
+        if (_fused) {
+            firdecim_crcf_execute_block_ci16(q, x16, n, y);
+        } else {
+            for (i=0; i<n*_M; i++)
+                x[i] = (x16[2*i] + _Complex_I*x16[2*i+1]) * (1.0f/32768.0f);
+            firdecim_crcf_execute_block(q, x, n, y);
+        }
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations = num_blocks * n;
+
+    firdecim_crcf_destroy(q);
+    free(x16);
+    free(x);
+    free(y);
+}
+
+#define FIRDECIM_CRCF_CI16_BENCHMARK_API(M,H_LEN,F)     \
+(   struct rusage *_start,                              \
+    struct rusage *_finish,                             \
+    unsigned long int *_num_iterations)                 \
+{ firdecim_crcf_ci16_bench(_start, _finish, _num_iterations, M, H_LEN, F); }
+
+// interleaved 16-bit input, fused vs. separate conversion
+void benchmark_firdecim_crcf_ci16_m4_h65        FIRDECIM_CRCF_CI16_BENCHMARK_API(4, 65, 1)
+void benchmark_firdecim_crcf_ci16_m4_h65_cvt    FIRDECIM_CRCF_CI16_BENCHMARK_API(4, 65, 0)
+void benchmark_firdecim_crcf_ci16_m8_h33        FIRDECIM_CRCF_CI16_BENCHMARK_API(8, 33, 1)
+void benchmark_firdecim_crcf_ci16_m8_h33_cvt    FIRDECIM_CRCF_CI16_BENCHMARK_API(8, 33, 0)
@@ -0,0 +1,88 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <sys/resource.h>
+#include "liquid.h"
+
+// Helper function to keep code base small; a trial is one re-design of
+// a band-pass filter of length _n as its center frequency is retuned
+//  _mode   :   0: design from scratch (firdespm_run)
+//              1: design found in cache
+//              2: new design warm-started from previous design in cache
+void firdescache_bench(struct rusage *     _start,
+                       struct rusage *     _finish,
+                       unsigned long int * _num_iterations,
+                       unsigned int        _n,
+                       unsigned int        _mode)
+{
+    // normalize number of iterations: designs are expensive
+    *_num_iterations /= (_mode == 1) ? 4 : 20*_n;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // retune over a set of center frequencies
+    unsigned int num_fc = 16;
+    float des[3] = {0.0f, 1.0f, 0.0f};
+    float w[3]   = {1.0f, 1.0f, 1.0f};
+    float bands[6];
+    float h[_n];
+
+    // cache holds all center frequencies (hits) or only the last design
+    firdescache q = firdescache_create(_mode == 1 ? num_fc : 1);
+
+    // start trials
+    unsigned long int i;
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        // step through center frequencies; a slowly drifting sweep
+        // ensures every warm-started design is new
+        float fc = 0.20f + 0.01f*(i % num_fc);
+        if (_mode == 2)
+            fc += 1e-5f*(float)(i / num_fc);
+        bands[0] = 0.0f;
+        bands[1] = fc - 0.10f;
+        bands[2] = fc - 0.06f;
+        bands[3] = fc + 0.06f;
+        bands[4] = fc + 0.10f;
+        bands[5] = 0.5f;
+        if (_mode == 0)
+            firdespm_run(_n, 3, bands, des, w, NULL, LIQUID_FIRDESPM_BANDPASS, h);
+        else
+            firdescache_firdespm(q, _n, 3, bands, des, w, NULL, LIQUID_FIRDESPM_BANDPASS, h);
+    }
+    getrusage(RUSAGE_SELF, _finish);
+
+    firdescache_destroy(q);
+}
+
+#define FIRDESCACHE_BENCHMARK_API(N,MODE)   \
+(   struct rusage *_start,                  \
+    struct rusage *_finish,                 \
+    unsigned long int *_num_iterations)     \
+{ firdescache_bench(_start, _finish, _num_iterations, N, MODE); }
+
+void benchmark_firdescache_n31_cold     FIRDESCACHE_BENCHMARK_API(31,  0)
+void benchmark_firdescache_n31_hit      FIRDESCACHE_BENCHMARK_API(31,  1)
+void benchmark_firdescache_n31_seeded   FIRDESCACHE_BENCHMARK_API(31,  2)
+void benchmark_firdescache_n101_cold    FIRDESCACHE_BENCHMARK_API(101, 0)
+void benchmark_firdescache_n101_hit     FIRDESCACHE_BENCHMARK_API(101, 1)
+void benchmark_firdescache_n101_seeded  FIRDESCACHE_BENCHMARK_API(101, 2)
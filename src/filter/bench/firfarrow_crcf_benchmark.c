@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <math.h>
+#include <sys/resource.h>
+#include "liquid.h"
+
+// Helper function to keep code base small; the fractional delay changes
+// every sample, as when tracking continuous timing drift
+void firfarrow_crcf_bench(struct rusage *     _start,
+                          struct rusage *     _finish,
+                          unsigned long int * _num_iterations,
+                          unsigned int        _h_len,
+                          unsigned int        _p,
+                          int                 _block)
+{
+    // normalize number of iterations
+    *_num_iterations *= 10;
+    *_num_iterations /= _h_len*_p;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    firfarrow_crcf q = firfarrow_crcf_create(_h_len, _p, 0.45f, 60.0f);
+
+    // initialize input, delay
+    unsigned int n = 256;
+    float complex x[n];
+    float complex y[n];
+    float         mu[n];
+    unsigned int i;
+    for (i=0; i<n; i++) {
+        x[i]  = randnf() + _Complex_I*randnf();
+        mu[i] = 0.4f*sinf(2*M_PI*i/(float)n);
+    }
+
+    // start trials
+    unsigned long int t;
+    unsigned long int num_blocks = *_num_iterations / n + 1;
+    getrusage(RUSAGE_SELF, _start);
+    for (t=0; t<num_blocks; t++) {
+        if (_block) {
+            firfarrow_crcf_execute_block_delay(q, x, mu, n, y);
+        } else {
+            for (i=0; i<n; i++) {
+                firfarrow_crcf_push     (q, x[i]);
+                firfarrow_crcf_set_delay(q, mu[i]);
+                firfarrow_crcf_execute  (q, &y[i]);
+            }
+        }
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations = num_blocks * n;
+
+    firfarrow_crcf_destroy(q);
+}
+
+#define FIRFARROW_CRCF_BENCHMARK_API(H_LEN,P,B) \
+(   struct rusage *_start,                      \
+    struct rusage *_finish,                     \
+    unsigned long int *_num_iterations)         \
+{ firfarrow_crcf_bench(_start, _finish, _num_iterations, H_LEN, P, B); }
+
+// per-sample delay update
+void benchmark_firfarrow_crcf_h19_p4        FIRFARROW_CRCF_BENCHMARK_API(19, 4, 0)
+void benchmark_firfarrow_crcf_h31_p5        FIRFARROW_CRCF_BENCHMARK_API(31, 5, 0)
+void benchmark_firfarrow_crcf_h63_p5        FIRFARROW_CRCF_BENCHMARK_API(63, 5, 0)
+
+// variable-delay block method
+void benchmark_firfarrow_crcf_block_h19_p4  FIRFARROW_CRCF_BENCHMARK_API(19, 4, 1)
+void benchmark_firfarrow_crcf_block_h31_p5  FIRFARROW_CRCF_BENCHMARK_API(31, 5, 1)
+void benchmark_firfarrow_crcf_block_h63_p5  FIRFARROW_CRCF_BENCHMARK_API(63, 5, 1)
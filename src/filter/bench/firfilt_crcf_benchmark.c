@@ -20,6 +20,7 @@
  * THE SOFTWARE.
  */
 
+#include <stdlib.h>
 #include <sys/resource.h>
 #include "liquid.h"
 
@@ -77,3 +78,133 @@ void benchmark_firfilt_crcf_16   FIRFILT_CRCF_BENCHMARK_API(16)
 void benchmark_firfilt_crcf_32   FIRFILT_CRCF_BENCHMARK_API(32)
 void benchmark_firfilt_crcf_64   FIRFILT_CRCF_BENCHMARK_API(64)
 
+
+// Helper function comparing independent per-channel filters against the
+// multi-channel filter; a trial is one output sample on one channel
+void firfiltmc_crcf_bench(struct rusage *     _start,
+                          struct rusage *     _finish,
+                          unsigned long int * _num_iterations,
+                          unsigned int        _n,
+                          unsigned int        _num_channels,
+                          int                 _multichannel)
+{
+    // adjust number of iterations: cycles/trial ~ 2*_n
+    *_num_iterations *= 500;
+    *_num_iterations /= _n;
+
+    // generate coefficients
+    float h[_n];
+    unsigned long int i;
+    for (i=0; i<_n; i++)
+        h[i] = randnf();
+
+    // create filter objects
+    unsigned int c;
+    firfiltmc_crcf q = firfiltmc_crcf_create(h,_n,_num_channels);
+    firfilt_crcf   f[_num_channels];
+    for (c=0; c<_num_channels; c++)
+        f[c] = firfilt_crcf_create(h,_n);
+
+    // generate channel-interleaved input
+    unsigned int nx = 64;
+    float complex * x = (float complex*) malloc(nx*_num_channels*sizeof(float complex));
+    float complex * y = (float complex*) malloc(nx*_num_channels*sizeof(float complex));
+    for (i=0; i<nx*_num_channels; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // start trials
+    unsigned long int num_blocks = *_num_iterations / (nx*_num_channels) + 1;
+    unsigned long int t;
+    getrusage(RUSAGE_SELF, _start);
+    for (t=0; t<num_blocks; t++) {
+        if (_multichannel) {
+            firfiltmc_crcf_execute_block(q, x, nx, y);
+        } else {
+            for (i=0; i<nx; i++) {
+                for (c=0; c<_num_channels; c++) {
+                    firfilt_crcf_push(f[c], x[i*_num_channels+c]);
+                    firfilt_crcf_execute(f[c], &y[i*_num_channels+c]);
+                }
+            }
+        }
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations = num_blocks * nx * _num_channels;
+
+    firfiltmc_crcf_destroy(q);
+    for (c=0; c<_num_channels; c++)
+        firfilt_crcf_destroy(f[c]);
+    free(x);
+    free(y);
+}
+
+#define FIRFILTMC_CRCF_BENCHMARK_API(N,C,MC)    \
+(   struct rusage *_start,                      \
+    struct rusage *_finish,                     \
+    unsigned long int *_num_iterations)         \
+{ firfiltmc_crcf_bench(_start, _finish, _num_iterations, N, C, MC); }
+
+// independent filters per channel vs. multi-channel filter
+void benchmark_firfilt_crcf_h32_c8      FIRFILTMC_CRCF_BENCHMARK_API(32,  8, 0)
+void benchmark_firfiltmc_crcf_h32_c8    FIRFILTMC_CRCF_BENCHMARK_API(32,  8, 1)
+void benchmark_firfilt_crcf_h32_c64     FIRFILTMC_CRCF_BENCHMARK_API(32, 64, 0)
+void benchmark_firfiltmc_crcf_h32_c64   FIRFILTMC_CRCF_BENCHMARK_API(32, 64, 1)
+void benchmark_firfilt_crcf_h128_c16    FIRFILTMC_CRCF_BENCHMARK_API(128,16, 0)
+void benchmark_firfiltmc_crcf_h128_c16  FIRFILTMC_CRCF_BENCHMARK_API(128,16, 1)
+
+// Helper function for block execution with general (random) or
+// linear-phase (symmetric) coefficients; a trial is one output sample
+void firfilt_crcf_block_bench(struct rusage *     _start,
+                              struct rusage *     _finish,
+                              unsigned long int * _num_iterations,
+                              unsigned int        _n,
+                              int                 _symmetric)
+{
+    // adjust number of iterations: cycles/trial ~ 20 + 2*_n
+    *_num_iterations *= 1000;
+    *_num_iterations /= (unsigned int)(20+2*_n);
+
+    // generate coefficients
+    float h[_n];
+    unsigned int i;
+    if (_symmetric) {
+        liquid_firdes_kaiser(_n, 0.2f, 60.0f, 0.0f, h);
+    } else {
+        for (i=0; i<_n; i++)
+            h[i] = randnf();
+    }
+    firfilt_crcf q = firfilt_crcf_create(h,_n);
+
+    // generate input vector
+    float complex buf[1024];
+    for (i=0; i<1024; i++)
+        buf[i] = randnf() + _Complex_I*randnf();
+
+    // start trials
+    unsigned long int t;
+    unsigned long int num_blocks = *_num_iterations / 1024 + 1;
+    getrusage(RUSAGE_SELF, _start);
+    for (t=0; t<num_blocks; t++)
+        firfilt_crcf_execute_block(q, buf, 1024, buf);
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations = num_blocks * 1024;
+
+    firfilt_crcf_destroy(q);
+}
+
+#define FIRFILT_CRCF_BLOCK_BENCHMARK_API(N,S)   \
+(   struct rusage *_start,                      \
+    struct rusage *_finish,                     \
+    unsigned long int *_num_iterations)         \
+{ firfilt_crcf_block_bench(_start, _finish, _num_iterations, N, S); }
+
+// block execution, general vs. linear-phase coefficients
+void benchmark_firfilt_crcf_block_h21       FIRFILT_CRCF_BLOCK_BENCHMARK_API( 21, 0)
+void benchmark_firfilt_crcf_block_h21_sym   FIRFILT_CRCF_BLOCK_BENCHMARK_API( 21, 1)
+void benchmark_firfilt_crcf_block_h64       FIRFILT_CRCF_BLOCK_BENCHMARK_API( 64, 0)
+void benchmark_firfilt_crcf_block_h64_sym   FIRFILT_CRCF_BLOCK_BENCHMARK_API( 64, 1)
+void benchmark_firfilt_crcf_block_h129      FIRFILT_CRCF_BLOCK_BENCHMARK_API(129, 0)
+void benchmark_firfilt_crcf_block_h129_sym  FIRFILT_CRCF_BLOCK_BENCHMARK_API(129, 1)
+void benchmark_firfilt_crcf_block_h255      FIRFILT_CRCF_BLOCK_BENCHMARK_API(255, 0)
+void benchmark_firfilt_crcf_block_h255_sym  FIRFILT_CRCF_BLOCK_BENCHMARK_API(255, 1)
+
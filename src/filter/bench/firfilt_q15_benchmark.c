@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <sys/resource.h>
+#include "liquid.h"
+
+// Helper function for fixed-point block filtering, with the equivalent
+// floating-point filter for comparison; coefficients are random (not
+// linear phase) so both execute a full dot product per output. A trial
+// is one output sample.
+//  _n      : filter length
+//  _q15    : use fixed-point filter?
+void firfilt_q15_block_bench(struct rusage *     _start,
+                             struct rusage *     _finish,
+                             unsigned long int * _num_iterations,
+                             unsigned int        _n,
+                             int                 _q15)
+{
+    // adjust number of iterations: cycles/trial ~ 20 + 2*_n
+    *_num_iterations *= 1000;
+    *_num_iterations /= (unsigned int)(20+2*_n);
+
+    // create filter objects from same quantized coefficients
+    liquid_q15 hq[_n];
+    float      hf[_n];
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        hq[i] = liquid_float_to_q15(randnf() / (float)_n);
+        hf[i] = liquid_q15_to_float(hq[i]);
+    }
+    firfilt_crcq15 q0 = firfilt_crcq15_create(hq, _n);
+    firfilt_crcf   q1 = firfilt_crcf_create  (hf, _n);
+
+    // generate input vectors
+    liquid_cq15   bq[1024], yq[1024];
+    float complex bf[1024], yf[1024];
+    for (i=0; i<1024; i++) {
+        bf[i] = 0.2f*(randnf() + _Complex_I*randnf());
+        bq[i].real = liquid_float_to_q15(crealf(bf[i]));
+        bq[i].imag = liquid_float_to_q15(cimagf(bf[i]));
+    }
+
+    // start trials
+    unsigned long int t;
+    unsigned long int num_blocks = *_num_iterations / 1024 + 1;
+    getrusage(RUSAGE_SELF, _start);
+    for (t=0; t<num_blocks; t++) {
+        if (_q15) firfilt_crcq15_execute_block(q0, bq, 1024, yq);
+        else      firfilt_crcf_execute_block  (q1, bf, 1024, yf);
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations = num_blocks * 1024;
+
+    firfilt_crcq15_destroy(q0);
+    firfilt_crcf_destroy(q1);
+}
+
+#define FIRFILT_Q15_BLOCK_BENCHMARK_API(N,Q)    \
+(   struct rusage *_start,                      \
+    struct rusage *_finish,                     \
+    unsigned long int *_num_iterations)         \
+{ firfilt_q15_block_bench(_start, _finish, _num_iterations, N, Q); }
+
+void benchmark_firfilt_q15_crcq15_h16      FIRFILT_Q15_BLOCK_BENCHMARK_API(16,  1)
+void benchmark_firfilt_q15_crcf_h16        FIRFILT_Q15_BLOCK_BENCHMARK_API(16,  0)
+void benchmark_firfilt_q15_crcq15_h64      FIRFILT_Q15_BLOCK_BENCHMARK_API(64,  1)
+void benchmark_firfilt_q15_crcf_h64        FIRFILT_Q15_BLOCK_BENCHMARK_API(64,  0)
+void benchmark_firfilt_q15_crcq15_h256     FIRFILT_Q15_BLOCK_BENCHMARK_API(256, 1)
+void benchmark_firfilt_q15_crcf_h256       FIRFILT_Q15_BLOCK_BENCHMARK_API(256, 0)
+
+// Helper function for fixed-point decimation against floating-point
+// decimation with the same random quantized coefficients; a trial is one
+// output sample
+//  _M      : decimation factor
+//  _m      : filter semi-length (symbols)
+//  _q15    : use fixed-point decimator?
+void firdecim_q15_bench(struct rusage *     _start,
+                        struct rusage *     _finish,
+                        unsigned long int * _num_iterations,
+                        unsigned int        _M,
+                        unsigned int        _m,
+                        int                 _q15)
+{
+    // adjust number of iterations: cycles/trial ~ 20 + 4*_M*_m
+    *_num_iterations *= 1000;
+    *_num_iterations /= (unsigned int)(20+4*_M*_m);
+
+    // create decimator objects
+    unsigned int h_len = 2*_M*_m;
+    liquid_q15 hq[h_len];
+    float      hf[h_len];
+    unsigned int i;
+    for (i=0; i<h_len; i++) {
+        hq[i] = liquid_float_to_q15(randnf() / (float)h_len);
+        hf[i] = liquid_q15_to_float(hq[i]);
+    }
+    firdecim_crcq15 q0 = firdecim_crcq15_create(_M, hq, h_len);
+    firdecim_crcf   q1 = firdecim_crcf_create  (_M, hf, h_len);
+
+    // generate input vectors
+    unsigned int n = 256;   // outputs per block
+    liquid_cq15   * xq = (liquid_cq15*)   malloc(n*_M*sizeof(liquid_cq15));
+    float complex * xf = (float complex*) malloc(n*_M*sizeof(float complex));
+    liquid_cq15     yq[n];
+    float complex   yf[n];
+    for (i=0; i<n*_M; i++) {
+        xf[i] = 0.2f*(randnf() + _Complex_I*randnf());
+        xq[i].real = liquid_float_to_q15(crealf(xf[i]));
+        xq[i].imag = liquid_float_to_q15(cimagf(xf[i]));
+    }
+
+    // start trials
+    unsigned long int t;
+    unsigned long int num_blocks = *_num_iterations / n + 1;
+    getrusage(RUSAGE_SELF, _start);
+    for (t=0; t<num_blocks; t++) {
+        if (_q15) firdecim_crcq15_execute_block(q0, xq, n, yq);
+        else      firdecim_crcf_execute_block  (q1, xf, n, yf);
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations = num_blocks * n;
+
+    firdecim_crcq15_destroy(q0);
+    firdecim_crcf_destroy(q1);
+    free(xq);
+    free(xf);
+}
+
+#define FIRDECIM_Q15_BENCHMARK_API(M,m,Q)   \
+(   struct rusage *_start,                  \
+    struct rusage *_finish,                 \
+    unsigned long int *_num_iterations)     \
+{ firdecim_q15_bench(_start, _finish, _num_iterations, M, m, Q); }
+
+void benchmark_firdecim_q15_crcq15_M4_m8   FIRDECIM_Q15_BENCHMARK_API(4, 8, 1)
+void benchmark_firdecim_q15_crcf_M4_m8     FIRDECIM_Q15_BENCHMARK_API(4, 8, 0)
+void benchmark_firdecim_q15_crcq15_M8_m12  FIRDECIM_Q15_BENCHMARK_API(8,12, 1)
+void benchmark_firdecim_q15_crcf_M8_m12    FIRDECIM_Q15_BENCHMARK_API(8,12, 0)
+
@@ -20,6 +20,7 @@
  * THE SOFTWARE.
  */
 
+#include <stdlib.h>
 #include <sys/resource.h>
 #include "liquid.h"
 
@@ -69,3 +70,54 @@ void benchmark_firinterp_crcf_m8_h32   FIRINTERP_CRCF_BENCHMARK_API(8, 32)
 void benchmark_firinterp_crcf_m16_h64  FIRINTERP_CRCF_BENCHMARK_API(16,64)
 void benchmark_firinterp_crcf_m32_h128 FIRINTERP_CRCF_BENCHMARK_API(32,128)
 
+
+// Helper function for block execution of long filters with _n input
+// samples per block; a trial is one output sample
+void firinterp_crcf_block_bench(struct rusage *     _start,
+                                struct rusage *     _finish,
+                                unsigned long int * _num_iterations,
+                                unsigned int        _M,
+                                unsigned int        _h_len,
+                                unsigned int        _n)
+{
+    // normalize number of iterations
+    *_num_iterations *= _M;
+    *_num_iterations /= _h_len;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    float h[_h_len];
+    liquid_firdes_kaiser(_h_len, 0.5f/(float)_M, 60.0f, 0.0f, h);
+    firinterp_crcf q = firinterp_crcf_create(_M,h,_h_len);
+
+    // initialize input
+    unsigned int i;
+    float complex * x = (float complex*) malloc(_n*sizeof(float complex));
+    float complex * y = (float complex*) malloc(_n*_M*sizeof(float complex));
+    for (i=0; i<_n; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // start trials
+    unsigned long int t;
+    unsigned long int num_blocks = *_num_iterations / (_n*_M) + 1;
+    getrusage(RUSAGE_SELF, _start);
+    for (t=0; t<num_blocks; t++)
+        firinterp_crcf_execute_block(q, x, _n, y);
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations = num_blocks * _n * _M;
+
+    firinterp_crcf_destroy(q);
+    free(x);
+    free(y);
+}
+
+#define FIRINTERP_CRCF_BLOCK_BENCHMARK_API(M,H_LEN,N)   \
+(   struct rusage *_start,                              \
+    struct rusage *_finish,                             \
+    unsigned long int *_num_iterations)                 \
+{ firinterp_crcf_block_bench(_start, _finish, _num_iterations, M, H_LEN, N); }
+
+// block execution: short and long filters; fast convolution where cheaper
+void benchmark_firinterp_crcf_block_m4_h64      FIRINTERP_CRCF_BLOCK_BENCHMARK_API(4,  64,  256)
+void benchmark_firinterp_crcf_block_m2_h2048    FIRINTERP_CRCF_BLOCK_BENCHMARK_API(2, 2048, 8192)
+void benchmark_firinterp_crcf_block_m4_h4096    FIRINTERP_CRCF_BLOCK_BENCHMARK_API(4, 4096, 8192)
+void benchmark_firinterp_crcf_block_m16_h4096   FIRINTERP_CRCF_BLOCK_BENCHMARK_API(16,4096, 8192)
@@ -20,6 +20,7 @@
  * THE SOFTWARE.
  */
 
+#include <stdlib.h>
 #include <sys/resource.h>
 #include "liquid.h"
 
@@ -125,3 +126,68 @@ void benchmark_irfilt_crcf_dcblock(struct rusage *     _start,
     iirfilt_crcf_destroy(q);
 }
 
+
+// Helper function for block and multi-channel second-order sections;
+// a trial is one output sample on one channel
+void iirfiltmc_crcf_bench(struct rusage *     _start,
+                          struct rusage *     _finish,
+                          unsigned long int * _num_iterations,
+                          unsigned int        _order,
+                          unsigned int        _num_channels)
+{
+    // scale number of iterations: cycles/trial ~ 10*_order
+    unsigned int n = 256;   // samples per channel per block
+    *_num_iterations *= 1000;
+    *_num_iterations /= 10*_order;
+
+    // create filter object (single-channel uses iirfilt block method)
+    iirfilt_crcf   q0 = NULL;
+    iirfiltmc_crcf q1 = NULL;
+    if (_num_channels == 0) {
+        q0 = iirfilt_crcf_create_prototype(LIQUID_IIRDES_ELLIP, LIQUID_IIRDES_LOWPASS,
+                LIQUID_IIRDES_SOS, _order, 0.2f, 0.0f, 0.1f, 60.0f);
+        _num_channels = 1;
+    } else {
+        q1 = iirfiltmc_crcf_create_prototype(LIQUID_IIRDES_ELLIP, LIQUID_IIRDES_LOWPASS,
+                _order, 0.2f, 0.0f, 0.1f, 60.0f, _num_channels);
+    }
+
+    // initialize input/output
+    unsigned int i;
+    float complex * buf = (float complex*) malloc(n*_num_channels*sizeof(float complex));
+    for (i=0; i<n*_num_channels; i++)
+        buf[i] = randnf() + _Complex_I*randnf();
+
+    // start trials
+    unsigned long int t;
+    unsigned long int num_blocks = *_num_iterations / (n*_num_channels) + 1;
+    getrusage(RUSAGE_SELF, _start);
+    for (t=0; t<num_blocks; t++) {
+        if (q0 != NULL) iirfilt_crcf_execute_block  (q0, buf, n, buf);
+        else            iirfiltmc_crcf_execute_block(q1, buf, n, buf);
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations = num_blocks * n * _num_channels;
+
+    // destroy filter object
+    if (q0 != NULL) iirfilt_crcf_destroy(q0);
+    if (q1 != NULL) iirfiltmc_crcf_destroy(q1);
+    free(buf);
+}
+
+#define IIRFILTMC_CRCF_BENCHMARK_API(N,C)   \
+(   struct rusage *_start,                  \
+    struct rusage *_finish,                 \
+    unsigned long int *_num_iterations)     \
+{ iirfiltmc_crcf_bench(_start, _finish, _num_iterations, N, C); }
+
+// benchmark second-order sections block method (single channel)
+void benchmark_iirfilt_crcf_sos_block_8  IIRFILTMC_CRCF_BENCHMARK_API(8,  0)
+void benchmark_iirfilt_crcf_sos_block_16 IIRFILTMC_CRCF_BENCHMARK_API(16, 0)
+
+// benchmark multi-channel second-order sections; rate is per channel-sample
+void benchmark_iirfiltmc_crcf_8_c1       IIRFILTMC_CRCF_BENCHMARK_API(8,  1)
+void benchmark_iirfiltmc_crcf_8_c8       IIRFILTMC_CRCF_BENCHMARK_API(8,  8)
+void benchmark_iirfiltmc_crcf_8_c32      IIRFILTMC_CRCF_BENCHMARK_API(8, 32)
+void benchmark_iirfiltmc_crcf_16_c8      IIRFILTMC_CRCF_BENCHMARK_API(16, 8)
+void benchmark_iirfiltmc_crcf_16_c32     IIRFILTMC_CRCF_BENCHMARK_API(16,32)
@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2007 - 2018 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <sys/resource.h>
+#include "liquid.h"
+
+// Helper function to keep code base small; a trial is one high-rate
+// sample (decimator input or interpolator output)
+void msresamp2_crcf_bench(struct rusage *     _start,
+                          struct rusage *     _finish,
+                          unsigned long int * _num_iterations,
+                          int                 _type,
+                          unsigned int        _num_stages,
+                          int                 _block)
+{
+    // scale number of iterations: cycles/trial ~ 40
+    *_num_iterations *= 8;
+
+    unsigned int M = 1 << _num_stages;
+    msresamp2_crcf q = msresamp2_crcf_create(_type, _num_stages, 0.4f, 0.0f, 60.0f);
+
+    // buffers for 4096 high-rate samples
+    unsigned int n = 4096 / M;  // number of calls to execute() per block
+    unsigned int nx = _type == LIQUID_RESAMP_INTERP ? 1 : M;
+    unsigned int ny = _type == LIQUID_RESAMP_INTERP ? M : 1;
+    float complex * x = (float complex*) malloc(4096*sizeof(float complex));
+    float complex * y = (float complex*) malloc(4096*sizeof(float complex));
+    unsigned long int i;
+    unsigned int j;
+    for (i=0; i<4096; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // start trials
+    unsigned long int num_blocks = *_num_iterations / 4096 + 1;
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<num_blocks; i++) {
+        if (_block) {
+            msresamp2_crcf_execute_block(q, x, n, y);
+        } else {
+            for (j=0; j<n; j++)
+                msresamp2_crcf_execute(q, &x[j*nx], &y[j*ny]);
+        }
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations = num_blocks * 4096;
+
+    msresamp2_crcf_destroy(q);
+    free(x);
+    free(y);
+}
+
+#define MSRESAMP2_CRCF_BENCHMARK_API(TYPE,S,B)  \
+(   struct rusage *_start,                      \
+    struct rusage *_finish,                     \
+    unsigned long int *_num_iterations)         \
+{ msresamp2_crcf_bench(_start, _finish, _num_iterations, TYPE, S, B); }
+
+// decimators
+void benchmark_msresamp2_crcf_decim_s2         MSRESAMP2_CRCF_BENCHMARK_API(LIQUID_RESAMP_DECIM,  2, 0)
+void benchmark_msresamp2_crcf_decim_s2_block   MSRESAMP2_CRCF_BENCHMARK_API(LIQUID_RESAMP_DECIM,  2, 1)
+void benchmark_msresamp2_crcf_decim_s6         MSRESAMP2_CRCF_BENCHMARK_API(LIQUID_RESAMP_DECIM,  6, 0)
+void benchmark_msresamp2_crcf_decim_s6_block   MSRESAMP2_CRCF_BENCHMARK_API(LIQUID_RESAMP_DECIM,  6, 1)
+
+// interpolators
+void benchmark_msresamp2_crcf_interp_s2        MSRESAMP2_CRCF_BENCHMARK_API(LIQUID_RESAMP_INTERP, 2, 0)
+void benchmark_msresamp2_crcf_interp_s2_block  MSRESAMP2_CRCF_BENCHMARK_API(LIQUID_RESAMP_INTERP, 2, 1)
+void benchmark_msresamp2_crcf_interp_s6        MSRESAMP2_CRCF_BENCHMARK_API(LIQUID_RESAMP_INTERP, 6, 0)
+void benchmark_msresamp2_crcf_interp_s6_block  MSRESAMP2_CRCF_BENCHMARK_API(LIQUID_RESAMP_INTERP, 6, 1)
+
@@ -0,0 +1,76 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <sys/resource.h>
+#include "liquid.h"
+
+// Helper function to keep code base small; a trial is one output sample
+// of a median filter of semi-length _m
+void ordfilt_rrrf_bench(struct rusage *     _start,
+                        struct rusage *     _finish,
+                        unsigned long int * _num_iterations,
+                        unsigned int        _m)
+{
+    // normalize number of iterations: cycles/trial ~ 50*log2(2*_m+1)
+    unsigned int log2n = 1;
+    while ((1U << log2n) < 2*_m+1)
+        log2n++;
+    *_num_iterations *= 4;
+    *_num_iterations /= log2n;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    ordfilt_rrrf q = ordfilt_rrrf_create_medfilt(_m);
+
+    // initialize input
+    unsigned int n = 256;
+    float x[n];
+    float y[n];
+    unsigned int i;
+    for (i=0; i<n; i++)
+        x[i] = randnf();
+
+    // start trials
+    unsigned long int t;
+    unsigned long int num_blocks = *_num_iterations / n + 1;
+    getrusage(RUSAGE_SELF, _start);
+    for (t=0; t<num_blocks; t++)
+        ordfilt_rrrf_execute_block(q, x, n, y);
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations = num_blocks * n;
+
+    ordfilt_rrrf_destroy(q);
+}
+
+#define ORDFILT_RRRF_BENCHMARK_API(M)   \
+(   struct rusage *_start,              \
+    struct rusage *_finish,             \
+    unsigned long int *_num_iterations) \
+{ ordfilt_rrrf_bench(_start, _finish, _num_iterations, M); }
+
+// median filter, scaling window size (2*m+1)
+void benchmark_ordfilt_rrrf_m2      ORDFILT_RRRF_BENCHMARK_API(2)
+void benchmark_ordfilt_rrrf_m7      ORDFILT_RRRF_BENCHMARK_API(7)
+void benchmark_ordfilt_rrrf_m25     ORDFILT_RRRF_BENCHMARK_API(25)
+void benchmark_ordfilt_rrrf_m100    ORDFILT_RRRF_BENCHMARK_API(100)
+void benchmark_ordfilt_rrrf_m250    ORDFILT_RRRF_BENCHMARK_API(250)
+void benchmark_ordfilt_rrrf_m1000   ORDFILT_RRRF_BENCHMARK_API(1000)
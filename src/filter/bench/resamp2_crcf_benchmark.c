@@ -25,7 +25,9 @@
 
 typedef enum {
     RESAMP2_DECIM,
-    RESAMP2_INTERP
+    RESAMP2_INTERP,
+    RESAMP2_DECIM_BLOCK,
+    RESAMP2_INTERP_BLOCK
 } resamp2_type;
 
 // Helper function to keep code base small
@@ -48,6 +50,12 @@ void resamp2_crcf_bench(struct rusage *_start,
     float complex x[] = {1.0f, -1.0f};
     float complex y[] = {1.0f, -1.0f};
 
+    // block buffers: 64 calls' worth of samples
+    float complex xb[128];
+    float complex yb[128];
+    for (i=0; i<128; i++)
+        xb[i] = randnf() + _Complex_I*randnf();
+
     // start trials
     getrusage(RUSAGE_SELF, _start);
     if (_type == RESAMP2_DECIM) {
@@ -59,7 +67,7 @@ void resamp2_crcf_bench(struct rusage *_start,
             resamp2_crcf_decim_execute(q,x,y);
             resamp2_crcf_decim_execute(q,x,y);
         }
-    } else {
+    } else if (_type == RESAMP2_INTERP) {
 
         // run interpolator
         for (i=0; i<(*_num_iterations); i++) {
@@ -68,6 +76,16 @@ void resamp2_crcf_bench(struct rusage *_start,
             resamp2_crcf_interp_execute(q,x[0],y);
             resamp2_crcf_interp_execute(q,x[0],y);
         }
+    } else if (_type == RESAMP2_DECIM_BLOCK) {
+
+        // run decimator on blocks of 64 outputs
+        for (i=0; i<(*_num_iterations); i+=16)
+            resamp2_crcf_decim_execute_block(q,xb,64,yb);
+    } else {
+
+        // run interpolator on blocks of 64 inputs
+        for (i=0; i<(*_num_iterations); i+=16)
+            resamp2_crcf_interp_execute_block(q,xb,64,yb);
     }
     getrusage(RUSAGE_SELF, _finish);
     *_num_iterations *= 4;
@@ -105,3 +123,13 @@ void benchmark_resamp2_crcf_interp_m64  RESAMP2_CRCF_BENCHMARK_API( 64,RESAMP2_I
 void benchmark_resamp2_crcf_interp_m128 RESAMP2_CRCF_BENCHMARK_API(128,RESAMP2_INTERP)
 void benchmark_resamp2_crcf_interp_m256 RESAMP2_CRCF_BENCHMARK_API(256,RESAMP2_INTERP)
 
+//
+// Block decimators/interpolators
+//
+void benchmark_resamp2_crcf_decim_block_m4    RESAMP2_CRCF_BENCHMARK_API(  4,RESAMP2_DECIM_BLOCK)
+void benchmark_resamp2_crcf_decim_block_m16   RESAMP2_CRCF_BENCHMARK_API( 16,RESAMP2_DECIM_BLOCK)
+void benchmark_resamp2_crcf_decim_block_m64   RESAMP2_CRCF_BENCHMARK_API( 64,RESAMP2_DECIM_BLOCK)
+void benchmark_resamp2_crcf_interp_block_m4   RESAMP2_CRCF_BENCHMARK_API(  4,RESAMP2_INTERP_BLOCK)
+void benchmark_resamp2_crcf_interp_block_m16  RESAMP2_CRCF_BENCHMARK_API( 16,RESAMP2_INTERP_BLOCK)
+void benchmark_resamp2_crcf_interp_block_m64  RESAMP2_CRCF_BENCHMARK_API( 64,RESAMP2_INTERP_BLOCK)
+
@@ -85,3 +85,69 @@ void benchmark_resamp_crcf_P17_Q64  RESAMP_CRCF_BENCHMARK_API(17,  64)
 void benchmark_resamp_crcf_P17_Q128 RESAMP_CRCF_BENCHMARK_API(17, 128)
 void benchmark_resamp_crcf_P17_Q256 RESAMP_CRCF_BENCHMARK_API(17, 256)
 
+
+// Helper function comparing per-sample and block execution at a
+// particular resampling rate
+void resamp_crcf_bench_rate(struct rusage *     _start,
+                            struct rusage *     _finish,
+                            unsigned long int * _num_iterations,
+                            float               _rate,
+                            int                 _block)
+{
+    // adjust number of iterations: cycles/trial ~ 250 per output sample
+    unsigned int nx = 256;
+    *_num_iterations /= 250*nx;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // create resampling object
+    resamp_crcf q = resamp_crcf_create(_rate,12,0.45f,60.0f,256);
+
+    // buffering
+    float complex buf_0[nx];
+    float complex buf_1[(unsigned int)ceilf(2*_rate*nx) + 4];
+    unsigned int num_written;
+
+    unsigned long int i;
+    unsigned int j, n;
+    for (j=0; j<nx; j++)
+        buf_0[j] = j % 7 ? 1 : -1;
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    if (_block) {
+        for (i=0; i<(*_num_iterations); i++)
+            resamp_crcf_execute_block(q, buf_0, nx, buf_1, &num_written);
+    } else {
+        for (i=0; i<(*_num_iterations); i++) {
+            for (j=0, n=0; j<nx; j++) {
+                resamp_crcf_execute(q, buf_0[j], &buf_1[n], &num_written);
+                n += num_written;
+            }
+        }
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= nx;
+
+    // destroy object
+    resamp_crcf_destroy(q);
+}
+
+#define RESAMP_CRCF_RATE_BENCHMARK_API(R,B) \
+(   struct rusage *_start,                  \
+    struct rusage *_finish,                 \
+    unsigned long int *_num_iterations)     \
+{ resamp_crcf_bench_rate(_start, _finish, _num_iterations, R, B); }
+
+//
+// Resampler benchmark prototypes near unity rate; compare per-sample
+// and block execution
+//
+void benchmark_resamp_crcf_r0p9_sample  RESAMP_CRCF_RATE_BENCHMARK_API(0.9f,   0)
+void benchmark_resamp_crcf_r0p9_block   RESAMP_CRCF_RATE_BENCHMARK_API(0.9f,   1)
+void benchmark_resamp_crcf_r0p99_sample RESAMP_CRCF_RATE_BENCHMARK_API(0.99f,  0)
+void benchmark_resamp_crcf_r0p99_block  RESAMP_CRCF_RATE_BENCHMARK_API(0.99f,  1)
+void benchmark_resamp_crcf_r1p01_sample RESAMP_CRCF_RATE_BENCHMARK_API(1.01f,  0)
+void benchmark_resamp_crcf_r1p01_block  RESAMP_CRCF_RATE_BENCHMARK_API(1.01f,  1)
+void benchmark_resamp_crcf_r1p1_sample  RESAMP_CRCF_RATE_BENCHMARK_API(1.1f,   0)
+void benchmark_resamp_crcf_r1p1_block   RESAMP_CRCF_RATE_BENCHMARK_API(1.1f,   1)
+
@@ -28,7 +28,8 @@ void symsync_crcf_bench(struct rusage *     _start,
                         struct rusage *     _finish,
                         unsigned long int * _num_iterations,
                         unsigned int        _k,
-                        unsigned int        _m)
+                        unsigned int        _m,
+                        int                 _block)
 {
     unsigned long int i;
     unsigned int npfb = 16;     // number of filters in bank
@@ -40,8 +41,8 @@ void symsync_crcf_bench(struct rusage *     _start,
     symsync_crcf q = symsync_crcf_create_rnyquist(LIQUID_FIRFILT_RRC,
                                                   k, m, beta, npfb);
 
-    //
-    unsigned int num_samples = 64;
+    // block method buffers up to 256 samples at a time
+    unsigned int num_samples = _block ? 256 : 64;
     *_num_iterations /= num_samples;
 
     unsigned int num_written;
@@ -56,11 +57,20 @@ void symsync_crcf_bench(struct rusage *     _start,
 
     // start trials
     getrusage(RUSAGE_SELF, _start);
-    for (i=0; i<(*_num_iterations); i++) {
-        symsync_crcf_execute(q, x, num_samples, y, &num_written);
-        symsync_crcf_execute(q, x, num_samples, y, &num_written);
-        symsync_crcf_execute(q, x, num_samples, y, &num_written);
-        symsync_crcf_execute(q, x, num_samples, y, &num_written);
+    if (_block) {
+        for (i=0; i<(*_num_iterations); i++) {
+            symsync_crcf_execute_block(q, x, num_samples, y, &num_written);
+            symsync_crcf_execute_block(q, x, num_samples, y, &num_written);
+            symsync_crcf_execute_block(q, x, num_samples, y, &num_written);
+            symsync_crcf_execute_block(q, x, num_samples, y, &num_written);
+        }
+    } else {
+        for (i=0; i<(*_num_iterations); i++) {
+            symsync_crcf_execute(q, x, num_samples, y, &num_written);
+            symsync_crcf_execute(q, x, num_samples, y, &num_written);
+            symsync_crcf_execute(q, x, num_samples, y, &num_written);
+            symsync_crcf_execute(q, x, num_samples, y, &num_written);
+        }
     }
     getrusage(RUSAGE_SELF, _finish);
     *_num_iterations *= 4 * num_samples;
@@ -68,17 +78,22 @@ void symsync_crcf_bench(struct rusage *     _start,
     symsync_crcf_destroy(q);
 }
 
-#define SYMSYNC_CRCF_BENCHMARK_API(K,M)     \
+#define SYMSYNC_CRCF_BENCHMARK_API(K,M,B)   \
 (   struct rusage *_start,                  \
     struct rusage *_finish,                 \
     unsigned long int *_num_iterations)     \
-{ symsync_crcf_bench(_start, _finish, _num_iterations, K, M); }
+{ symsync_crcf_bench(_start, _finish, _num_iterations, K, M, B); }
 
 // 
 // BENCHMARKS
 //
-void benchmark_symsync_crcf_k2_m2   SYMSYNC_CRCF_BENCHMARK_API(2, 2)
-void benchmark_symsync_crcf_k2_m4   SYMSYNC_CRCF_BENCHMARK_API(2, 4)
-void benchmark_symsync_crcf_k2_m8   SYMSYNC_CRCF_BENCHMARK_API(2, 8)
-void benchmark_symsync_crcf_k2_m16  SYMSYNC_CRCF_BENCHMARK_API(2, 16)
+void benchmark_symsync_crcf_k2_m2   SYMSYNC_CRCF_BENCHMARK_API(2, 2, 0)
+void benchmark_symsync_crcf_k2_m4   SYMSYNC_CRCF_BENCHMARK_API(2, 4, 0)
+void benchmark_symsync_crcf_k2_m8   SYMSYNC_CRCF_BENCHMARK_API(2, 8, 0)
+void benchmark_symsync_crcf_k2_m16  SYMSYNC_CRCF_BENCHMARK_API(2, 16, 0)
 
+// block method
+void benchmark_symsync_crcf_block_k2_m2  SYMSYNC_CRCF_BENCHMARK_API(2, 2, 1)
+void benchmark_symsync_crcf_block_k2_m4  SYMSYNC_CRCF_BENCHMARK_API(2, 4, 1)
+void benchmark_symsync_crcf_block_k2_m8  SYMSYNC_CRCF_BENCHMARK_API(2, 8, 1)
+void benchmark_symsync_crcf_block_k2_m16 SYMSYNC_CRCF_BENCHMARK_API(2,16, 1)
@@ -34,12 +34,15 @@
 #define AUTOCORR(name)      LIQUID_CONCAT(autocorr_cccf,name)
 #define FFTFILT(name)       LIQUID_CONCAT(fftfilt_cccf,name)
 #define FIRDECIM(name)      LIQUID_CONCAT(firdecim_cccf,name)
+#define FIRDECIMMC(name)    LIQUID_CONCAT(firdecimmc_cccf,name)
 #define FIRFILT(name)       LIQUID_CONCAT(firfilt_cccf,name)
+#define FIRFILTMC(name)     LIQUID_CONCAT(firfiltmc_cccf,name)
 #define FIRINTERP(name)     LIQUID_CONCAT(firinterp_cccf,name)
 #define FIRPFB(name)        LIQUID_CONCAT(firpfb_cccf,name)
 #define IIRDECIM(name)      LIQUID_CONCAT(iirdecim_cccf,name)
 #define IIRFILT(name)       LIQUID_CONCAT(iirfilt_cccf,name)
 #define IIRFILTSOS(name)    LIQUID_CONCAT(iirfiltsos_cccf,name)
+#define IIRFILTMC(name)     LIQUID_CONCAT(iirfiltmc_cccf,name)
 #define IIRINTERP(name)     LIQUID_CONCAT(iirinterp_cccf,name)
 #define NCO(name)           LIQUID_CONCAT(nco_crcf,name)
 #define MSRESAMP(name)      LIQUID_CONCAT(msresamp_cccf,name)
@@ -70,12 +73,15 @@
 #include "autocorr.c"
 #include "fftfilt.c"
 #include "firdecim.c"
+#include "firdecimmc.c"
 #include "firfilt.c"
+#include "firfiltmc.c"
 #include "firinterp.c"
 #include "firpfb.c"
 #include "iirdecim.c"
 #include "iirfilt.c"
 #include "iirfiltsos.c"
+#include "iirfiltmc.c"
 #include "iirinterp.c"
 //#include "qmfb.c"
 // ordfilt
@@ -0,0 +1,46 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Filter API: complex fixed-point (Q15), complex coefficients
+//
+
+#include "liquid.internal.h"
+
+// naming extensions (useful for print statements)
+#define EXTENSION_SHORT     "q15"
+#define EXTENSION_FULL      "cccq15"
+
+#define FIRDECIM(name)      LIQUID_CONCAT(firdecim_cccq15,name)
+#define FIRFILT(name)       LIQUID_CONCAT(firfilt_cccq15,name)
+
+#define TO                  liquid_cq15 // output
+#define TC                  liquid_cq15 // coefficients
+#define TI                  liquid_cq15 // input
+#define DOTPROD(name)       LIQUID_CONCAT(dotprod_cccq15,name)
+
+#define TC_COMPLEX          1
+#define TI_COMPLEX          1
+
+// source files
+#include "firdecim.q15.c"
+#include "firfilt.q15.c"
@@ -34,13 +34,16 @@
 #define AUTOCORR(name)      LIQUID_CONCAT(autocorr_crcf,name)
 #define FFTFILT(name)       LIQUID_CONCAT(fftfilt_crcf,name)
 #define FIRDECIM(name)      LIQUID_CONCAT(firdecim_crcf,name)
+#define FIRDECIMMC(name)    LIQUID_CONCAT(firdecimmc_crcf,name)
 #define FIRFARROW(name)     LIQUID_CONCAT(firfarrow_crcf,name)
 #define FIRFILT(name)       LIQUID_CONCAT(firfilt_crcf,name)
+#define FIRFILTMC(name)     LIQUID_CONCAT(firfiltmc_crcf,name)
 #define FIRINTERP(name)     LIQUID_CONCAT(firinterp_crcf,name)
 #define FIRPFB(name)        LIQUID_CONCAT(firpfb_crcf,name)
 #define IIRDECIM(name)      LIQUID_CONCAT(iirdecim_crcf,name)
 #define IIRFILT(name)       LIQUID_CONCAT(iirfilt_crcf,name)
 #define IIRFILTSOS(name)    LIQUID_CONCAT(iirfiltsos_crcf,name)
+#define IIRFILTMC(name)     LIQUID_CONCAT(iirfiltmc_crcf,name)
 #define IIRINTERP(name)     LIQUID_CONCAT(iirinterp_crcf,name)
 #define MSRESAMP(name)      LIQUID_CONCAT(msresamp_crcf,name)
 #define MSRESAMP2(name)     LIQUID_CONCAT(msresamp2_crcf,name)
@@ -70,13 +73,16 @@
 //#include "autocorr.c"
 #include "fftfilt.c"
 #include "firdecim.c"
+#include "firdecimmc.c"
 #include "firfarrow.c"
 #include "firfilt.c"
+#include "firfiltmc.c"
 #include "firinterp.c"
 #include "firpfb.c"
 #include "iirdecim.c"
 #include "iirfilt.c"
 #include "iirfiltsos.c"
+#include "iirfiltmc.c"
 #include "iirinterp.c"
 #include "msresamp.c"
 #include "msresamp2.c"
@@ -34,14 +34,17 @@
 #define AUTOCORR(name)      LIQUID_CONCAT(autocorr_rrrf,name)
 #define FFTFILT(name)       LIQUID_CONCAT(fftfilt_rrrf,name)
 #define FIRDECIM(name)      LIQUID_CONCAT(firdecim_rrrf,name)
+#define FIRDECIMMC(name)    LIQUID_CONCAT(firdecimmc_rrrf,name)
 #define FIRFARROW(name)     LIQUID_CONCAT(firfarrow_rrrf,name)
 #define FIRFILT(name)       LIQUID_CONCAT(firfilt_rrrf,name)
+#define FIRFILTMC(name)     LIQUID_CONCAT(firfiltmc_rrrf,name)
 #define FIRINTERP(name)     LIQUID_CONCAT(firinterp_rrrf,name)
 #define FIRHILB(name)       LIQUID_CONCAT(firhilbf,name)
 #define FIRPFB(name)        LIQUID_CONCAT(firpfb_rrrf,name)
 #define IIRDECIM(name)      LIQUID_CONCAT(iirdecim_rrrf,name)
 #define IIRFILT(name)       LIQUID_CONCAT(iirfilt_rrrf,name)
 #define IIRFILTSOS(name)    LIQUID_CONCAT(iirfiltsos_rrrf,name)
+#define IIRFILTMC(name)     LIQUID_CONCAT(iirfiltmc_rrrf,name)
 #define IIRHILB(name)       LIQUID_CONCAT(iirhilbf,name)
 #define IIRINTERP(name)     LIQUID_CONCAT(iirinterp_rrrf,name)
 #define MSRESAMP(name)      LIQUID_CONCAT(msresamp_rrrf,name)
@@ -72,14 +75,17 @@
 #include "autocorr.c"
 #include "fftfilt.c"
 #include "firdecim.c"
+#include "firdecimmc.c"
 #include "firfarrow.c"
 #include "firfilt.c"
+#include "firfiltmc.c"
 #include "firinterp.c"
 #include "firhilb.c"
 #include "firpfb.c"
 #include "iirdecim.c"
 #include "iirfilt.c"
 #include "iirfiltsos.c"
+#include "iirfiltmc.c"
 #include "iirhilb.c"
 #include "iirinterp.c"
 #include "msresamp.c"
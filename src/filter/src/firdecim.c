@@ -29,6 +29,54 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <math.h>
+
+// number of outputs computed per pass of the linear-phase block method
+#define FIRDECIM_BLOCK_LEN  (256)
+
+// cost model for selecting between direct-form and fast-convolution block
+// execution, in nanoseconds as measured on the benchmark suite
+#define FIRDECIM_COST_TAP       (0.27f) // per coefficient per output
+#define FIRDECIM_COST_TAP_SYM   (0.22f) // ...with linear-phase folding
+#define FIRDECIM_COST_INPUT     (2.5f)  // per input sample (buffering)
+#define FIRDECIM_COST_FFT       (2.9f)  // per n*log2(n) of each transform
+#define FIRDECIM_COST_BIN       (1.0f)  // per bin of spectral product
+#define FIRDECIM_NFFT_MAX       (1<<16) // largest transform considered
+
+// input sample formats for block execution; integer samples are
+// converted as they are copied into the internal buffers, and their
+// normalization is folded into the output scaling
+#define FIRDECIM_INPUT_NATIVE   (0)     // TI samples
+#define FIRDECIM_INPUT_CI16     (1)     // interleaved int16 I/Q, complex input only
+#define FIRDECIM_INPUT_CI8      (2)     // interleaved int8 I/Q, complex input only
+
+// select fast-convolution transform size, enabling it if cheaper
+void FIRDECIM(_fft_plan)(FIRDECIM() _q);
+
+// execute decimator on block of _n*_M input samples of given format
+void FIRDECIM(_execute_block_fmt)(FIRDECIM()   _q,
+                                  void *       _x,
+                                  int          _fmt,
+                                  unsigned int _n,
+                                  TO *         _y);
+
+// execute fast-convolution on _n outputs, _n <= _q->fft_max
+void FIRDECIM(_execute_block_fft)(FIRDECIM()   _q,
+                                  void *       _x,
+                                  int          _fmt,
+                                  unsigned int _offset,
+                                  unsigned int _n,
+                                  TC           _scale,
+                                  TO *         _y);
+
+// copy input samples _x[_offset + k*_stride], k < _n, to _dst, converting
+// from the given format
+void FIRDECIM(_load)(TI *         _dst,
+                     void *       _x,
+                     int          _fmt,
+                     unsigned int _offset,
+                     unsigned int _stride,
+                     unsigned int _n);
 
 // decimator structure
 struct FIRDECIM(_s) {
@@ -39,6 +87,39 @@ struct FIRDECIM(_s) {
     WINDOW()        w;      // buffer
     DOTPROD()       dp;     // vector dot product
     TC              scale;  // output scaling factor
+
+    // direct-form block processing: h_len-1 samples of history followed
+    // by up to FIRDECIM_BLOCK_LEN*M new samples are copied to a linear
+    // buffer over which the dot product slides. When coefficients are
+    // symmetric the input stream is instead de-interleaved into M phases,
+    // each holding its share of the same samples
+    int             symmetric;  // coefficients are symmetric?
+    TC *            hs;         // folded coefficients [size: (h_len+1)/2 x 1]
+    TI *            buf;        // linear or phase buffers [size: M*phase_len x 1]
+    TI **           phase;      // pointers to each phase buffer [size: M x 1]
+    unsigned int    phase_len;  // (h_len-1)/M + 1 + FIRDECIM_BLOCK_LEN
+    TO *            acc;        // block outputs [size: FIRDECIM_BLOCK_LEN x 1]
+
+    // fast-convolution (overlap-save) block processing, enabled when the
+    // cost model favors it for long filters: each transform of nfft=M*L
+    // input samples is multiplied by the filter response, aliased down to
+    // L bins, and inverse transformed to yield decimated outputs directly
+    unsigned int    nfft;       // forward transform size (0: disabled)
+    unsigned int    L;          // inverse transform size, nfft/M
+    unsigned int    fft_min;    // fewest outputs for which transform pays off
+    unsigned int    fft_max;    // most outputs per transform
+    float complex * time_buf;   // time buffer [size: nfft x 1]
+    float complex * freq_buf;   // freq buffer [size: nfft x 1]
+    float complex * H;          // FFT of filter coefficients / nfft [size: nfft x 1]
+    float complex * zfreq_buf;  // aliased freq buffer [size: L x 1]
+    float complex * ztime_buf;  // decimated time buffer [size: L x 1]
+#ifdef LIQUID_FFTOVERRIDE
+    fftplan         fft;        // FFT object (forward, size nfft)
+    fftplan         ifft;       // FFT object (inverse, size L)
+#else
+    FFT_PLAN        fft;        // FFT object (forward, size nfft)
+    FFT_PLAN        ifft;       // FFT object (inverse, size L)
+#endif
 };
 
 // create decimator object
@@ -76,6 +157,24 @@ FIRDECIM() FIRDECIM(_create)(unsigned int _M,
     // create dot product object
     q->dp = DOTPROD(_create)(q->h, q->h_len);
 
+    // fold coefficients; allocate block buffers (phases only if symmetric)
+    q->hs        = (TC *) malloc(((q->h_len+1)/2)*sizeof(TC));
+    q->symmetric = FIRFILT(_fold)(q->h, q->h_len, q->hs);
+    q->phase_len = (q->h_len-1)/q->M + 1 + FIRDECIM_BLOCK_LEN;
+    q->buf       = (TI *) malloc(q->M*q->phase_len*sizeof(TI));
+    q->phase     = NULL;
+    q->acc       = NULL;
+    if (q->symmetric) {
+        q->phase = (TI **) malloc(q->M*sizeof(TI*));
+        q->acc   = (TO *)  malloc(FIRDECIM_BLOCK_LEN*sizeof(TO));
+        memset(q->buf, 0x00, q->M*q->phase_len*sizeof(TI));
+        for (i=0; i<q->M; i++)
+            q->phase[i] = q->buf + i*q->phase_len;
+    }
+
+    // set up fast-convolution if cheaper than direct form
+    FIRDECIM(_fft_plan)(q);
+
     // set default scaling
     q->scale = 1;
 
@@ -169,6 +268,24 @@ void FIRDECIM(_destroy)(FIRDECIM() _q)
     WINDOW(_destroy)(_q->w);
     DOTPROD(_destroy)(_q->dp);
     free(_q->h);
+    free(_q->hs);
+    free(_q->buf);
+    free(_q->phase);
+    free(_q->acc);
+    if (_q->nfft > 0) {
+#ifdef LIQUID_FFTOVERRIDE
+        fft_destroy_plan(_q->fft);
+        fft_destroy_plan(_q->ifft);
+#else
+        FFT_DESTROY_PLAN(_q->fft);
+        FFT_DESTROY_PLAN(_q->ifft);
+#endif
+        free(_q->time_buf);
+        free(_q->freq_buf);
+        free(_q->H);
+        free(_q->zfreq_buf);
+        free(_q->ztime_buf);
+    }
     free(_q);
 }
 
@@ -182,6 +299,8 @@ void FIRDECIM(_print)(FIRDECIM() _q)
     printf("  scale = ");
     PRINTVAL_TC(_q->scale,%12.8f);
     printf("\n");
+    if (_q->nfft > 0)
+        printf("  fast convolution: nfft = %u\n", _q->nfft);
 }
 
 // reset decimator object
@@ -243,11 +362,316 @@ void FIRDECIM(_execute_block)(FIRDECIM()   _q,
                               TI *         _x,
                               unsigned int _n,
                               TO *         _y)
+{
+    FIRDECIM(_execute_block_fmt)(_q, _x, FIRDECIM_INPUT_NATIVE, _n, _y);
+}
+
+#if TI_COMPLEX
+// execute decimator on block of _n*_M interleaved int16 I/Q samples
+//  _q      : decimator object
+//  _x      : input array [size: 2*_n*_M x 1]
+//  _n      : number of _output_ samples
+//  _y      : output array [_size: _n x 1]
+void FIRDECIM(_execute_block_ci16)(FIRDECIM()   _q,
+                                   int16_t *    _x,
+                                   unsigned int _n,
+                                   TO *         _y)
+{
+    FIRDECIM(_execute_block_fmt)(_q, _x, FIRDECIM_INPUT_CI16, _n, _y);
+}
+
+// execute decimator on block of _n*_M interleaved int8 I/Q samples
+//  _q      : decimator object
+//  _x      : input array [size: 2*_n*_M x 1]
+//  _n      : number of _output_ samples
+//  _y      : output array [_size: _n x 1]
+void FIRDECIM(_execute_block_ci8)(FIRDECIM()   _q,
+                                  int8_t *     _x,
+                                  unsigned int _n,
+                                  TO *         _y)
+{
+    FIRDECIM(_execute_block_fmt)(_q, _x, FIRDECIM_INPUT_CI8, _n, _y);
+}
+#endif
+
+// execute decimator on block of _n*_M input samples of given format
+//  _q      : decimator object
+//  _x      : input array [size: _n*_M samples]
+//  _fmt    : input format, FIRDECIM_INPUT_*
+//  _n      : number of _output_ samples
+//  _y      : output array [_size: _n x 1]
+void FIRDECIM(_execute_block_fmt)(FIRDECIM()   _q,
+                                  void *       _x,
+                                  int          _fmt,
+                                  unsigned int _n,
+                                  TO *         _y)
+{
+    unsigned int i;
+    unsigned int j;
+    unsigned int M = _q->M;
+    unsigned int p = _q->h_len - 1;     // history length
+    unsigned int x_index = 0;           // input sample index
+    TI * r;
+
+    TC scale = _q->scale;
+
+    while (_n > 0) {
+        unsigned int n;
+        if (_q->nfft > 0 && _n >= _q->fft_min) {
+            // long filters: fast convolution in the frequency domain
+            n = _n < _q->fft_max ? _n : _q->fft_max;
+            FIRDECIM(_execute_block_fft)(_q, _x, _fmt, x_index, n, scale, _y);
+        } else if (_q->symmetric) {
+            // linear-phase filters: fold mirrored samples, halving the multiplies
+            n = _n < FIRDECIM_BLOCK_LEN ? _n : FIRDECIM_BLOCK_LEN;
+
+            // de-interleave history (most recent h_len-1 samples)...
+            WINDOW(_read)(_q->w, &r);
+            unsigned int ph  = 0;   // phase of current sample
+            unsigned int idx = 0;   // index within phase
+            for (i=0; i<p; i++) {
+                _q->phase[ph][idx] = r[i+1];
+                if (++ph == M) {
+                    ph = 0;
+                    idx++;
+                }
+            }
+
+            // ...and input, each phase taking every M-th sample
+            for (j=0; j<M; j++) {
+                unsigned int k = (j + M - ph) % M;  // first input sample in phase j
+                FIRDECIM(_load)(_q->phase[j] + idx + (ph+k)/M, _x, _fmt, x_index + k, M, n);
+            }
+            FIRFILT(_dotprod_sym)(_q->hs, _q->h_len, _q->phase, M, n, _q->acc);
+
+            // update internal buffer before (possibly) overwriting input
+            unsigned int k = n*M < _q->h_len ? n*M : _q->h_len;
+            if (_fmt == FIRDECIM_INPUT_NATIVE) {
+                WINDOW(_write)(_q->w, (TI*)_x + x_index + n*M - k, k);
+            } else {
+                // most recent samples are the last entries of each phase
+                for (i=n*M-k; i<n*M; i++) {
+                    unsigned int v = p + i;
+                    WINDOW(_push)(_q->w, _q->phase[v % M][v / M]);
+                }
+            }
+
+            for (i=0; i<n; i++)
+                _y[i] = _q->acc[i] * scale;
+        } else if (_n > 1) {
+            // direct form: slide dot product along history and input
+            n = _n < FIRDECIM_BLOCK_LEN ? _n : FIRDECIM_BLOCK_LEN;
+            WINDOW(_read)(_q->w, &r);
+            memmove(_q->buf, r+1, p*sizeof(TI));
+            FIRDECIM(_load)(_q->buf + p, _x, _fmt, x_index, 1, n*M);
+
+            // update internal buffer from (converted) copy of input
+            unsigned int k = n*M < _q->h_len ? n*M : _q->h_len;
+            WINDOW(_write)(_q->w, _q->buf + p + n*M - k, k);
+
+            for (i=0; i<n; i++) {
+                DOTPROD(_execute)(_q->dp, _q->buf + i*M, &_y[i]);
+                _y[i] *= scale;
+            }
+        } else {
+            // execute _M input samples computing just one output
+            n = 1;
+            TI v[M];
+            FIRDECIM(_load)(v, _x, _fmt, x_index, 1, M);
+            for (i=0; i<M; i++) {
+                WINDOW(_push)(_q->w, v[i]);
+                if (i==0) {
+                    WINDOW(_read)(_q->w, &r);
+                    DOTPROD(_execute)(_q->dp, r, _y);
+                    *_y *= scale;
+                }
+            }
+        }
+
+        x_index += n*M;
+        _y      += n;
+        _n      -= n;
+    }
+}
+
+// copy input samples _x[_offset + k*_stride], k < _n, to _dst, converting
+// from the given format
+//  _dst    : destination [size: _n x 1]
+//  _x      : input array
+//  _fmt    : input format, FIRDECIM_INPUT_*
+//  _offset : index of first sample
+//  _stride : input sample stride
+//  _n      : number of samples to copy
+void FIRDECIM(_load)(TI *         _dst,
+                     void *       _x,
+                     int          _fmt,
+                     unsigned int _offset,
+                     unsigned int _stride,
+                     unsigned int _n)
+{
+    unsigned int k;
+#if TI_COMPLEX
+    // write components directly, avoiding complex arithmetic, and
+    // normalize integer samples to full scale so that the history holds
+    // the same values regardless of input format
+    float * d = (float*) _dst;
+    if (_fmt == FIRDECIM_INPUT_CI16) {
+        int16_t * x = (int16_t*)_x + 2*_offset;
+        float     g = 1.0f / 32768.0f;
+        for (k=0; k<_n; k++) {
+            d[2*k+0] = g * (float) x[2*k*_stride+0];
+            d[2*k+1] = g * (float) x[2*k*_stride+1];
+        }
+        return;
+    } else if (_fmt == FIRDECIM_INPUT_CI8) {
+        int8_t * x = (int8_t*)_x + 2*_offset;
+        float    g = 1.0f / 128.0f;
+        for (k=0; k<_n; k++) {
+            d[2*k+0] = g * (float) x[2*k*_stride+0];
+            d[2*k+1] = g * (float) x[2*k*_stride+1];
+        }
+        return;
+    }
+#endif
+    TI * x = (TI*)_x + _offset;
+    if (_stride == 1) {
+        memmove(_dst, x, _n*sizeof(TI));
+    } else {
+        for (k=0; k<_n; k++)
+            _dst[k] = x[k*_stride];
+    }
+}
+
+// select fast-convolution transform size, enabling it if cheaper
+void FIRDECIM(_fft_plan)(FIRDECIM() _q)
+{
+    _q->nfft = 0;
+
+    // direct-form cost per output sample
+    float cost_direct = (_q->symmetric ? FIRDECIM_COST_TAP_SYM : FIRDECIM_COST_TAP) * _q->h_len +
+                        FIRDECIM_COST_INPUT * _q->M;
+
+    // search transform sizes nfft = M*L, L a power of two, for the lowest
+    // cost per output; each transform yields (nfft-h_len+1)/M outputs
+    float cost_best = cost_direct;
+    float cost_block = 0.0f;
+    unsigned int L;
+    for (L=2; L*_q->M <= FIRDECIM_NFFT_MAX; L*=2) {
+        unsigned int nfft = L*_q->M;
+        if (nfft < _q->h_len - 1 + _q->M)
+            continue;
+        float c = FIRDECIM_COST_FFT * (nfft*log2f((float)nfft) + L*log2f((float)L)) +
+                  FIRDECIM_COST_BIN * nfft;
+        unsigned int num_outputs = (nfft - _q->h_len + 1) / _q->M;
+        if (c / (float)num_outputs < cost_best) {
+            cost_best  = c / (float)num_outputs;
+            cost_block = c;
+            _q->nfft   = nfft;
+        }
+    }
+    if (_q->nfft == 0)
+        return;
+
+    _q->L       = _q->nfft / _q->M;
+    _q->fft_max = (_q->nfft - _q->h_len + 1) / _q->M;
+    _q->fft_min = (unsigned int) ceilf(cost_block / cost_direct);
+
+    // allocate internal memory arrays
+    _q->time_buf  = (float complex *) malloc(_q->nfft*sizeof(float complex));
+    _q->freq_buf  = (float complex *) malloc(_q->nfft*sizeof(float complex));
+    _q->H         = (float complex *) malloc(_q->nfft*sizeof(float complex));
+    _q->zfreq_buf = (float complex *) malloc(_q->L   *sizeof(float complex));
+    _q->ztime_buf = (float complex *) malloc(_q->L   *sizeof(float complex));
+
+    // create internal FFT objects
+#ifdef LIQUID_FFTOVERRIDE
+    _q->fft  = fft_create_plan(_q->nfft, _q->time_buf,  _q->freq_buf,  LIQUID_FFT_FORWARD,  0);
+    _q->ifft = fft_create_plan(_q->L,    _q->zfreq_buf, _q->ztime_buf, LIQUID_FFT_BACKWARD, 0);
+#else
+    _q->fft  = FFT_CREATE_PLAN(_q->nfft, _q->time_buf,  _q->freq_buf,  FFT_DIR_FORWARD,  FFT_METHOD);
+    _q->ifft = FFT_CREATE_PLAN(_q->L,    _q->zfreq_buf, _q->ztime_buf, FFT_DIR_BACKWARD, FFT_METHOD);
+#endif
+
+    // compute FFT of filter coefficients (stored in reverse order),
+    // absorbing inverse transform normalization
+    unsigned int i;
+    for (i=0; i<_q->nfft; i++)
+        _q->time_buf[i] = (i < _q->h_len) ? _q->h[_q->h_len-i-1] : 0;
+#ifdef LIQUID_FFTOVERRIDE
+    fft_execute(_q->fft);
+#else
+    FFT_EXECUTE(_q->fft);
+#endif
+    for (i=0; i<_q->nfft; i++)
+        _q->H[i] = _q->freq_buf[i] / (float)(_q->nfft);
+}
+
+// execute fast-convolution on _n outputs, _n <= _q->fft_max
+void FIRDECIM(_execute_block_fft)(FIRDECIM()   _q,
+                                  void *       _x,
+                                  int          _fmt,
+                                  unsigned int _offset,
+                                  unsigned int _n,
+                                  TC           _scale,
+                                  TO *         _y)
 {
     unsigned int i;
+    unsigned int j;
+    unsigned int p = _q->h_len - 1;             // history length
+    unsigned int s = _q->nfft - _n*_q->M - p;   // leading zeros
+
+    // fill time buffer: zeros, history, input
+    TI * r;
+    WINDOW(_read)(_q->w, &r);
+    for (i=0; i<s; i++) _q->time_buf[i]     = 0;
+    for (i=0; i<p; i++) _q->time_buf[s+i]   = r[i+1];
+#if TI_COMPLEX
+    FIRDECIM(_load)(_q->time_buf + s + p, _x, _fmt, _offset, 1, _n*_q->M);
+#else
+    for (i=0; i<_n*_q->M; i++) _q->time_buf[s+p+i] = ((TI*)_x)[_offset+i];
+#endif
+
+    // update internal buffer before (possibly) overwriting input
+    unsigned int k = _n*_q->M < _q->h_len ? _n*_q->M : _q->h_len;
+#if TI_COMPLEX
+    WINDOW(_write)(_q->w, _q->time_buf + s + p + _n*_q->M - k, k);
+#else
+    WINDOW(_write)(_q->w, (TI*)_x + _offset + _n*_q->M - k, k);
+#endif
+
+    // time_buf > {FFT} > freq_buf
+#ifdef LIQUID_FFTOVERRIDE
+    fft_execute(_q->fft);
+#else
+    FFT_EXECUTE(_q->fft);
+#endif
+
+    // apply filter response and alias spectrum down to L bins; the
+    // inverse of which is the filtered output sampled every M samples
+    for (i=0; i<_q->L; i++)
+        _q->zfreq_buf[i] = 0;
+    for (j=0; j<_q->M; j++) {
+        float complex * X = _q->freq_buf + j*_q->L;
+        float complex * H = _q->H        + j*_q->L;
+        for (i=0; i<_q->L; i++)
+            _q->zfreq_buf[i] += X[i] * H[i];
+    }
+
+    // zfreq_buf > {IFFT} > ztime_buf
+#ifdef LIQUID_FFTOVERRIDE
+    fft_execute(_q->ifft);
+#else
+    FFT_EXECUTE(_q->ifft);
+#endif
+
+    // last _n samples are valid outputs
+    float complex * z = _q->ztime_buf + _q->L - _n;
     for (i=0; i<_n; i++) {
-        // execute _M input samples computing just one output each time
-        FIRDECIM(_execute)(_q, &_x[i*_q->M], &_y[i]);
+#if TO_COMPLEX
+        _y[i] = z[i] * _scale;
+#else
+        _y[i] = crealf(z[i]) * _scale;
+#endif
     }
 }
 
@@ -0,0 +1,195 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// firdecim (Q15) : fixed-point finite impulse response decimator
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+// defined:
+//  FIRDECIM()      name-mangling macro
+//  DOTPROD()       dotprod macro
+//  TO, TC, TI      output, coefficients, input types
+//  TC_COMPLEX      coefficients are complex?
+
+// number of outputs computed per pass over the linear buffer
+#define FIRDECIM_Q15_BLOCK_LEN  (64)
+
+// decimator structure
+struct FIRDECIM(_s) {
+    TC *            h;      // coefficients array, reversed
+    unsigned int    h_len;  // number of coefficients
+    unsigned int    M;      // decimation factor
+    DOTPROD()       dp;     // vector dot product
+
+    // linear buffer: h_len-1 samples of history followed by up to
+    // FIRDECIM_Q15_BLOCK_LEN*M new samples over which the dot product
+    // slides in steps of M
+    TI *            buf;    // [size: h_len-1+FIRDECIM_Q15_BLOCK_LEN*M x 1]
+};
+
+// create decimator object
+//  _M      :   decimation factor
+//  _h      :   filter coefficients [size: _h_len x 1]
+//  _h_len  :   filter coefficients length
+FIRDECIM() FIRDECIM(_create)(unsigned int _M,
+                             TC *         _h,
+                             unsigned int _h_len)
+{
+    // validate input
+    if (_h_len == 0) {
+        fprintf(stderr,"error: decim_%s_create(), filter length must be greater than zero\n", EXTENSION_FULL);
+        exit(1);
+    } else if (_M == 0) {
+        fprintf(stderr,"error: decim_%s_create(), decimation factor must be greater than zero\n", EXTENSION_FULL);
+        exit(1);
+    }
+
+    FIRDECIM() q = (FIRDECIM()) malloc(sizeof(struct FIRDECIM(_s)));
+    q->h_len = _h_len;
+    q->M     = _M;
+
+    // load filter in reverse order
+    q->h = (TC*) malloc((q->h_len)*sizeof(TC));
+    unsigned int i;
+    for (i=0; i<q->h_len; i++)
+        q->h[i] = _h[_h_len-i-1];
+
+    // create dot product object
+    q->dp = DOTPROD(_create)(q->h, q->h_len);
+
+    // allocate linear buffer
+    q->buf = (TI*) malloc((q->h_len-1 + FIRDECIM_Q15_BLOCK_LEN*q->M)*sizeof(TI));
+
+    // reset filter state (clear buffer)
+    FIRDECIM(_reset)(q);
+    return q;
+}
+
+// create decimator from Kaiser prototype, quantizing to Q15
+//  _M      :   decimation factor
+//  _m      :   filter delay (symbols)
+//  _As     :   stop-band attenuation [dB]
+FIRDECIM() FIRDECIM(_create_kaiser)(unsigned int _M,
+                                    unsigned int _m,
+                                    float        _As)
+{
+    // validate input
+    if (_M < 2) {
+        fprintf(stderr,"error: decim_%s_create_kaiser(), decim factor must be greater than 1\n", EXTENSION_FULL);
+        exit(1);
+    } else if (_m == 0) {
+        fprintf(stderr,"error: decim_%s_create_kaiser(), filter delay must be greater than 0\n", EXTENSION_FULL);
+        exit(1);
+    } else if (_As < 0.0f) {
+        fprintf(stderr,"error: decim_%s_create_kaiser(), stop-band attenuation must be positive\n", EXTENSION_FULL);
+        exit(1);
+    }
+
+    // compute filter coefficients (floating point precision)
+    unsigned int h_len = 2*_M*_m + 1;
+    float hf[h_len];
+    float fc = 0.5f / (float) (_M);
+    liquid_firdes_kaiser(h_len, fc, _As, 0.0f, hf);
+
+    // quantize coefficients to type-specific array
+    TC hc[h_len];
+    unsigned int i;
+    for (i=0; i<h_len; i++) {
+#if TC_COMPLEX
+        hc[i].real = liquid_float_to_q15(hf[i]);
+        hc[i].imag = 0;
+#else
+        hc[i] = liquid_float_to_q15(hf[i]);
+#endif
+    }
+
+    // return decimator object
+    return FIRDECIM(_create)(_M, hc, 2*_M*_m);
+}
+
+// destroy decimator object
+void FIRDECIM(_destroy)(FIRDECIM() _q)
+{
+    DOTPROD(_destroy)(_q->dp);
+    free(_q->h);
+    free(_q->buf);
+    free(_q);
+}
+
+// print decimator object internals
+void FIRDECIM(_print)(FIRDECIM() _q)
+{
+    printf("firdecim_%s [M=%u, h_len=%u]\n", EXTENSION_FULL, _q->M, _q->h_len);
+}
+
+// reset decimator object
+void FIRDECIM(_reset)(FIRDECIM() _q)
+{
+    memset(_q->buf, 0x00, (_q->h_len-1)*sizeof(TI));
+}
+
+// execute decimator
+//  _q      :   decimator object
+//  _x      :   input sample array [size: _M x 1]
+//  _y      :   output sample pointer
+void FIRDECIM(_execute)(FIRDECIM() _q,
+                        TI *       _x,
+                        TO *       _y)
+{
+    FIRDECIM(_execute_block)(_q, _x, 1, _y);
+}
+
+// execute decimator on block of _n*_M input samples; as with the
+// floating-point decimator, each output is computed on the first of its
+// _M input samples
+//  _q      : decimator object
+//  _x      : input array [size: _n*_M x 1]
+//  _n      : number of _output_ samples
+//  _y      : output array [_size: _n x 1]
+void FIRDECIM(_execute_block)(FIRDECIM()   _q,
+                              TI *         _x,
+                              unsigned int _n,
+                              TO *         _y)
+{
+    unsigned int i;
+    unsigned int M = _q->M;
+    unsigned int h = _q->h_len - 1;
+    while (_n > 0) {
+        unsigned int n = _n < FIRDECIM_Q15_BLOCK_LEN ? _n : FIRDECIM_Q15_BLOCK_LEN;
+
+        // append input after history, then slide dot product along it
+        memmove(_q->buf + h, _x, n*M*sizeof(TI));
+        for (i=0; i<n; i++)
+            DOTPROD(_execute)(_q->dp, _q->buf + i*M, &_y[i]);
+
+        // retain most recent h_len-1 samples as history
+        memmove(_q->buf, _q->buf + n*M, h*sizeof(TI));
+
+        _x += n*M;
+        _y += n;
+        _n -= n;
+    }
+}
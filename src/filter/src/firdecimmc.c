@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Multi-channel decimator
+//
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+// defined:
+//  FIRDECIMMC()    name-mangling macro
+//  TO              output type
+//  TC              coefficients type
+//  TI              input type
+//  PRINTVAL()      print macro(s)
+
+// number of output samples per channel buffered before shifting history
+#define FIRDECIMMC_BUFFER_LEN   (16)
+
+struct FIRDECIMMC(_s) {
+    TC * h;                     // filter coefficients (reversed) [size: h_len x 1]
+    unsigned int h_len;         // filter length
+    unsigned int M;             // decimation factor
+    unsigned int num_channels;  // number of channels
+    TC scale;                   // output scaling factor
+
+    // channel-interleaved linear buffer: h_len-1 rows of history followed
+    // by up to M*FIRDECIMMC_BUFFER_LEN new rows, each row holding one
+    // sample per channel
+    TI * buf;                   // [size: (h_len-1+M*FIRDECIMMC_BUFFER_LEN)*num_channels x 1]
+    unsigned int buf_len;       // maximum number of rows in buffer
+    unsigned int buf_index;     // number of rows currently in buffer
+};
+
+// create multi-channel decimator from external coefficients
+//  _M              : decimation factor
+//  _h              : filter coefficients [size: _h_len x 1]
+//  _h_len          : filter coefficients length
+//  _num_channels   : number of channels
+FIRDECIMMC() FIRDECIMMC(_create)(unsigned int _M,
+                                 TC *         _h,
+                                 unsigned int _h_len,
+                                 unsigned int _num_channels)
+{
+    // validate input
+    if (_h_len == 0) {
+        fprintf(stderr,"error: firdecimmc_%s_create(), filter length must be greater than zero\n", EXTENSION_FULL);
+        exit(1);
+    } else if (_M == 0) {
+        fprintf(stderr,"error: firdecimmc_%s_create(), decimation factor must be greater than zero\n", EXTENSION_FULL);
+        exit(1);
+    } else if (_num_channels == 0) {
+        fprintf(stderr,"error: firdecimmc_%s_create(), number of channels must be greater than zero\n", EXTENSION_FULL);
+        exit(1);
+    }
+
+    // create object and initialize
+    FIRDECIMMC() q = (FIRDECIMMC()) malloc(sizeof(struct FIRDECIMMC(_s)));
+    q->h_len        = _h_len;
+    q->M            = _M;
+    q->num_channels = _num_channels;
+    q->scale        = 1;
+
+    // load filter in reverse order
+    q->h = (TC *) malloc((q->h_len)*sizeof(TC));
+    unsigned int i;
+    for (i=0; i<q->h_len; i++)
+        q->h[i] = _h[q->h_len-i-1];
+
+    // allocate buffer
+    q->buf_len = q->h_len - 1 + q->M*FIRDECIMMC_BUFFER_LEN;
+    q->buf     = (TI *) malloc(q->buf_len*q->num_channels*sizeof(TI));
+
+    // reset decimator object
+    FIRDECIMMC(_reset)(q);
+    return q;
+}
+
+// create multi-channel decimator using Kaiser-Bessel windowed sinc
+//  _M              : decimation factor
+//  _m              : filter delay (symbols)
+//  _As             : stop-band attenuation [dB]
+//  _num_channels   : number of channels
+FIRDECIMMC() FIRDECIMMC(_create_kaiser)(unsigned int _M,
+                                        unsigned int _m,
+                                        float        _As,
+                                        unsigned int _num_channels)
+{
+    // validate input
+    if (_M < 2) {
+        fprintf(stderr,"error: firdecimmc_%s_create_kaiser(), decim factor must be greater than 1\n", EXTENSION_FULL);
+        exit(1);
+    } else if (_m == 0) {
+        fprintf(stderr,"error: firdecimmc_%s_create_kaiser(), filter delay must be greater than 0\n", EXTENSION_FULL);
+        exit(1);
+    } else if (_As < 0.0f) {
+        fprintf(stderr,"error: firdecimmc_%s_create_kaiser(), stop-band attenuation must be positive\n", EXTENSION_FULL);
+        exit(1);
+    }
+
+    // compute filter coefficients (floating point precision)
+    unsigned int h_len = 2*_M*_m + 1;
+    float hf[h_len];
+    float fc = 0.5f / (float) (_M);
+    liquid_firdes_kaiser(h_len, fc, _As, 0.0f, hf);
+
+    // copy coefficients to type-specific array (e.g. float complex)
+    TC hc[h_len];
+    unsigned int i;
+    for (i=0; i<h_len; i++)
+        hc[i] = hf[i];
+
+    // return decimator object
+    return FIRDECIMMC(_create)(_M, hc, 2*_M*_m, _num_channels);
+}
+
+// destroy firdecimmc object, freeing all internal memory
+void FIRDECIMMC(_destroy)(FIRDECIMMC() _q)
+{
+    free(_q->buf);
+    free(_q->h);
+    free(_q);
+}
+
+// print firdecimmc object properties to stdout
+void FIRDECIMMC(_print)(FIRDECIMMC() _q)
+{
+    printf("firdecimmc_%s: [%u taps, M=%u, %u channels]\n",
+            EXTENSION_FULL, _q->h_len, _q->M, _q->num_channels);
+    printf("  scale = ");
+    PRINTVAL_TC(_q->scale,%12.8f);
+    printf("\n");
+}
+
+// reset firdecimmc object internal state for all channels
+void FIRDECIMMC(_reset)(FIRDECIMMC() _q)
+{
+    _q->buf_index = _q->h_len - 1;
+    memset(_q->buf, 0x00, _q->buf_index*_q->num_channels*sizeof(TI));
+}
+
+// set output scaling for decimator
+void FIRDECIMMC(_set_scale)(FIRDECIMMC() _q,
+                            TC           _scale)
+{
+    _q->scale = _scale;
+}
+
+// get number of channels
+unsigned int FIRDECIMMC(_get_num_channels)(FIRDECIMMC() _q)
+{
+    return _q->num_channels;
+}
+
+// execute decimator on _M input samples per channel
+//  _q      : firdecimmc object
+//  _x      : input array [size: _M*num_channels x 1]
+//  _y      : output samples [size: num_channels x 1]
+void FIRDECIMMC(_execute)(FIRDECIMMC() _q,
+                          TI *         _x,
+                          TO *         _y)
+{
+    FIRDECIMMC(_execute_block)(_q, _x, 1, _y);
+}
+
+// execute decimator on a block of channel-interleaved samples; as with
+// firdecim, each output is computed once the first of its _M input
+// samples is in the buffer
+//  _q      : firdecimmc object
+//  _x      : input array [size: _n*_M*num_channels x 1]
+//  _n      : number of _output_ samples per channel
+//  _y      : output array [size: _n*num_channels x 1]
+void FIRDECIMMC(_execute_block)(FIRDECIMMC() _q,
+                                TI *         _x,
+                                unsigned int _n,
+                                TO *         _y)
+{
+    unsigned int C = _q->num_channels;
+    unsigned int M = _q->M;
+    unsigned int i;
+    while (_n > 0) {
+        // shift history to front of buffer if it is full
+        if (_q->buf_index == _q->buf_len) {
+            memmove(_q->buf, _q->buf + (_q->buf_len - _q->h_len + 1)*C, (_q->h_len-1)*C*sizeof(TI));
+            _q->buf_index = _q->h_len - 1;
+        }
+
+        // copy as many groups of M input rows as will fit into the buffer
+        unsigned int n = (_q->buf_len - _q->buf_index) / M;
+        n = n < _n ? n : _n;
+        memmove(_q->buf + _q->buf_index*C, _x, n*M*C*sizeof(TI));
+
+        // compute output rows
+        for (i=0; i<n; i++) {
+            TI * r = _q->buf + (_q->buf_index + i*M + 1 - _q->h_len)*C;
+            FIRFILTMC(_dotprod)(_q->h, _q->h_len, r, C, _q->scale, _y + i*C);
+        }
+
+        // update counters
+        _q->buf_index += n*M;
+        _x            += n*M*C;
+        _y            += n*C;
+        _n            -= n;
+    }
+}
@@ -0,0 +1,340 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// firdescache : cache of filter designs keyed on design parameters
+// with least-recently-used eviction; a firdespm design that misses the
+// cache is warm-started from the extremal frequencies of the nearest
+// cached design with the same structure (length, bands, and response)
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "liquid.internal.h"
+
+// design method of cache entry
+#define FIRDESCACHE_EMPTY   (0)
+#define FIRDESCACHE_KAISER  (1)
+#define FIRDESCACHE_PM      (2)
+
+// cache entry
+struct firdescache_entry_s {
+    int                 type;       // design method (empty if unused)
+    float *             key;        // design parameters
+    unsigned int        key_len;    // number of design parameters
+    float *             h;          // filter coefficients
+    unsigned int        h_len;      // filter length
+    float *             fext;       // extremal frequencies (firdespm only)
+    unsigned int        num_ext;    // number of extremal frequencies
+    unsigned long int   tick;       // time of last use
+};
+
+struct firdescache_s {
+    struct firdescache_entry_s * entries;
+    unsigned int        capacity;   // maximum number of entries
+    unsigned long int   tick;       // use counter
+    unsigned long int   num_hits;   // number of designs found in cache
+    unsigned long int   num_misses; // number of designs computed
+    unsigned long int   num_seeded; // number of warm-started designs
+    float *             key;        // scratch key for look-up
+    unsigned int        key_max;    // allocated length of scratch key
+};
+
+// find entry matching key, returning NULL if not found
+struct firdescache_entry_s * firdescache_find(firdescache  _q,
+                                              int          _type,
+                                              float *      _key,
+                                              unsigned int _key_len);
+
+// store design in cache, evicting least-recently-used entry if full
+struct firdescache_entry_s * firdescache_insert(firdescache  _q,
+                                                int          _type,
+                                                float *      _key,
+                                                unsigned int _key_len,
+                                                float *      _h,
+                                                unsigned int _h_len);
+
+// resize scratch key
+void firdescache_reserve_key(firdescache  _q,
+                             unsigned int _key_len);
+
+// create filter design cache
+//  _capacity   :   maximum number of designs held, _capacity > 0
+firdescache firdescache_create(unsigned int _capacity)
+{
+    if (_capacity == 0) {
+        fprintf(stderr,"error: firdescache_create(), capacity must be greater than zero\n");
+        exit(1);
+    }
+
+    firdescache q = (firdescache) malloc(sizeof(struct firdescache_s));
+    q->capacity = _capacity;
+    q->entries  = (struct firdescache_entry_s*) calloc(q->capacity, sizeof(struct firdescache_entry_s));
+    q->key_max  = 0;
+    q->key      = NULL;
+
+    firdescache_reset(q);
+    return q;
+}
+
+// destroy filter design cache, freeing all internal memory
+void firdescache_destroy(firdescache _q)
+{
+    firdescache_reset(_q);
+    free(_q->entries);
+    free(_q->key);
+    free(_q);
+}
+
+// print filter design cache object
+void firdescache_print(firdescache _q)
+{
+    unsigned int i, n = 0;
+    for (i=0; i<_q->capacity; i++)
+        n += _q->entries[i].type != FIRDESCACHE_EMPTY ? 1 : 0;
+    printf("firdescache [%u/%u entries, hits: %lu, misses: %lu, seeded: %lu]\n",
+            n, _q->capacity, _q->num_hits, _q->num_misses, _q->num_seeded);
+    for (i=0; i<_q->capacity; i++) {
+        struct firdescache_entry_s * e = &_q->entries[i];
+        if (e->type == FIRDESCACHE_EMPTY)
+            continue;
+        printf("  [%3u] %-8s h_len=%-5u last used: %lu\n", i,
+                e->type == FIRDESCACHE_KAISER ? "kaiser" : "firdespm",
+                e->h_len, e->tick);
+    }
+}
+
+// clear all designs and statistics
+void firdescache_reset(firdescache _q)
+{
+    unsigned int i;
+    for (i=0; i<_q->capacity; i++) {
+        struct firdescache_entry_s * e = &_q->entries[i];
+        free(e->key);
+        free(e->h);
+        free(e->fext);
+        memset(e, 0, sizeof(struct firdescache_entry_s));
+    }
+    _q->tick       = 0;
+    _q->num_hits   = 0;
+    _q->num_misses = 0;
+    _q->num_seeded = 0;
+}
+
+// get number of designs found in cache
+unsigned long int firdescache_get_num_hits(firdescache _q)
+{
+    return _q->num_hits;
+}
+
+// get number of designs computed (not found in cache)
+unsigned long int firdescache_get_num_misses(firdescache _q)
+{
+    return _q->num_misses;
+}
+
+// get number of computed firdespm designs warm-started from a cached design
+unsigned long int firdescache_get_num_seeded(firdescache _q)
+{
+    return _q->num_seeded;
+}
+
+// design Kaiser-windowed filter (see liquid_firdes_kaiser), using
+// cached result if available
+//  _q      : filter design cache
+//  _n      : filter length, _n > 0
+//  _fc     : cutoff frequency, 0 < _fc < 0.5
+//  _As     : stop-band attenuation [dB], _As > 0
+//  _mu     : fractional sample offset, -0.5 < _mu < 0.5
+//  _h      : output coefficient buffer, [size: _n x 1]
+void firdescache_kaiser(firdescache  _q,
+                        unsigned int _n,
+                        float        _fc,
+                        float        _As,
+                        float        _mu,
+                        float *      _h)
+{
+    float key[4] = {(float)_n, _fc, _As, _mu};
+    struct firdescache_entry_s * e = firdescache_find(_q, FIRDESCACHE_KAISER, key, 4);
+    if (e != NULL) {
+        memmove(_h, e->h, _n*sizeof(float));
+        return;
+    }
+
+    // design filter and store result
+    liquid_firdes_kaiser(_n, _fc, _As, _mu, _h);
+    firdescache_insert(_q, FIRDESCACHE_KAISER, key, 4, _h, _n);
+}
+
+// design filter using Parks-McClellan algorithm (see firdespm_run),
+// using cached result if available; otherwise the Remez exchange is
+// seeded from the nearest cached design with the same filter length,
+// band type, and desired response, differing only in band edges
+//  _q          :   filter design cache
+//  _h_len      :   length of filter (number of taps)
+//  _num_bands  :   number of frequency bands
+//  _bands      :   band edges, f in [0,0.5], [size: _num_bands x 2]
+//  _des        :   desired response [size: _num_bands x 1]
+//  _weights    :   response weighting [size: _num_bands x 1]
+//  _wtype      :   weight types (e.g. LIQUID_FIRDESPM_FLATWEIGHT) [size: _num_bands x 1]
+//  _btype      :   band type (e.g. LIQUID_FIRDESPM_BANDPASS)
+//  _h          :   output coefficients array [size: _h_len x 1]
+void firdescache_firdespm(firdescache             _q,
+                          unsigned int            _h_len,
+                          unsigned int            _num_bands,
+                          float *                 _bands,
+                          float *                 _des,
+                          float *                 _weights,
+                          liquid_firdespm_wtype * _wtype,
+                          liquid_firdespm_btype   _btype,
+                          float *                 _h)
+{
+    // key : [h_len, num_bands, btype, des, weights, wtype, bands] with
+    // band edges last so that designs of the same structure share a
+    // common prefix
+    unsigned int i;
+    unsigned int key_len    = 3 + 5*_num_bands;
+    unsigned int prefix_len = 3 + 3*_num_bands;
+    firdescache_reserve_key(_q, key_len);
+    float * key = _q->key;
+    key[0] = (float)_h_len;
+    key[1] = (float)_num_bands;
+    key[2] = (float)_btype;
+    for (i=0; i<_num_bands; i++) {
+        key[3              + i] = _des[i];
+        key[3+  _num_bands + i] = _weights == NULL ? 1.0f : _weights[i];
+        key[3+2*_num_bands + i] = _wtype   == NULL ? (float)LIQUID_FIRDESPM_FLATWEIGHT : (float)_wtype[i];
+    }
+    memmove(&key[prefix_len], _bands, 2*_num_bands*sizeof(float));
+
+    struct firdescache_entry_s * e = firdescache_find(_q, FIRDESCACHE_PM, key, key_len);
+    if (e != NULL) {
+        memmove(_h, e->h, _h_len*sizeof(float));
+        return;
+    }
+
+    // find nearest design of same structure: minimum total band-edge distance
+    struct firdescache_entry_s * seed = NULL;
+    float dmin = 0.0f;
+    for (i=0; i<_q->capacity; i++) {
+        struct firdescache_entry_s * c = &_q->entries[i];
+        if (c->type != FIRDESCACHE_PM || c->key_len != key_len ||
+            memcmp(c->key, key, prefix_len*sizeof(float)) != 0)
+        {
+            continue;
+        }
+        unsigned int j;
+        float d = 0.0f;
+        for (j=prefix_len; j<key_len; j++)
+            d += fabsf(c->key[j] - key[j]);
+        if (seed == NULL || d < dmin) {
+            seed = c;
+            dmin = d;
+        }
+    }
+
+    // design filter, seeding Remez exchange from nearest design
+    firdespm pm = firdespm_create(_h_len, _num_bands, _bands, _des, _weights, _wtype, _btype);
+    firdespm_execute_seeded(pm, seed == NULL ? NULL : seed->fext, _h);
+    _q->num_seeded += seed == NULL ? 0 : 1;
+
+    // store result along with its extremal frequencies
+    e = firdescache_insert(_q, FIRDESCACHE_PM, key, key_len, _h, _h_len);
+    e->num_ext = firdespm_get_num_extremals(pm);
+    e->fext    = (float*) malloc(e->num_ext*sizeof(float));
+    firdespm_get_extremal_frequencies(pm, e->fext);
+    firdespm_destroy(pm);
+}
+
+//
+// internal methods
+//
+
+// find entry matching key, returning NULL if not found
+struct firdescache_entry_s * firdescache_find(firdescache  _q,
+                                              int          _type,
+                                              float *      _key,
+                                              unsigned int _key_len)
+{
+    unsigned int i;
+    for (i=0; i<_q->capacity; i++) {
+        struct firdescache_entry_s * e = &_q->entries[i];
+        if (e->type == _type && e->key_len == _key_len &&
+            memcmp(e->key, _key, _key_len*sizeof(float)) == 0)
+        {
+            e->tick = ++_q->tick;
+            _q->num_hits++;
+            return e;
+        }
+    }
+    _q->num_misses++;
+    return NULL;
+}
+
+// store design in cache, evicting least-recently-used entry if full
+struct firdescache_entry_s * firdescache_insert(firdescache  _q,
+                                                int          _type,
+                                                float *      _key,
+                                                unsigned int _key_len,
+                                                float *      _h,
+                                                unsigned int _h_len)
+{
+    // choose empty entry or, failing that, the least recently used
+    unsigned int i;
+    struct firdescache_entry_s * e = &_q->entries[0];
+    for (i=0; i<_q->capacity; i++) {
+        struct firdescache_entry_s * c = &_q->entries[i];
+        if (c->type == FIRDESCACHE_EMPTY) {
+            e = c;
+            break;
+        }
+        if (c->tick < e->tick)
+            e = c;
+    }
+
+    // re-use memory where possible
+    if (e->key_len != _key_len) e->key = (float*) realloc(e->key, _key_len*sizeof(float));
+    if (e->h_len   != _h_len  ) e->h   = (float*) realloc(e->h,   _h_len  *sizeof(float));
+    free(e->fext);
+    e->type    = _type;
+    e->key_len = _key_len;
+    e->h_len   = _h_len;
+    e->fext    = NULL;
+    e->num_ext = 0;
+    e->tick    = ++_q->tick;
+    memmove(e->key, _key, _key_len*sizeof(float));
+    memmove(e->h,   _h,   _h_len  *sizeof(float));
+    return e;
+}
+
+// resize scratch key
+void firdescache_reserve_key(firdescache  _q,
+                             unsigned int _key_len)
+{
+    if (_key_len <= _q->key_max)
+        return;
+    _q->key_max = _key_len;
+    _q->key     = (float*) realloc(_q->key, _q->key_max*sizeof(float));
+}
@@ -458,17 +458,65 @@ void firdespm_print(firdespm _q)
 
 // execute filter design, storing result in _h
 void firdespm_execute(firdespm _q, float * _h)
+{
+    firdespm_execute_seeded(_q, NULL, _h);
+}
+
+// get number of extremal frequencies in design, r+1
+unsigned int firdespm_get_num_extremals(firdespm _q)
+{
+    return _q->r + 1;
+}
+
+// get extremal frequencies of most recent design
+//  _q      : firdespm object
+//  _fext   : extremal frequencies [size: r+1 x 1]
+void firdespm_get_extremal_frequencies(firdespm _q,
+                                       float *  _fext)
 {
     unsigned int i;
+    for (i=0; i<_q->r+1; i++)
+        _fext[i] = _q->F[_q->iext[i]];
+}
 
-    // initial guess of extremal frequencies evenly spaced on F
-    // TODO : guarantee at least one extremal frequency lies in each band
-    for (i=0; i<_q->r+1; i++) {
-        _q->iext[i] = (i * (_q->grid_size-1)) / _q->r;
+// execute filter design, storing result in _h, with the Remez exchange
+// seeded from the extremal frequencies of a similar design (e.g. with
+// slightly different band edges) rather than evenly spaced on the grid
+//  _q      : firdespm object
+//  _fext   : initial extremal frequencies [size: r+1 x 1], NULL for default
+//  _h      : output coefficients array [size: h_len x 1]
+void firdespm_execute_seeded(firdespm _q,
+                             float *  _fext,
+                             float *  _h)
+{
+    unsigned int i;
+
+    if (_fext == NULL) {
+        // initial guess of extremal frequencies evenly spaced on F
+        // TODO : guarantee at least one extremal frequency lies in each band
+        for (i=0; i<_q->r+1; i++)
+            _q->iext[i] = (i * (_q->grid_size-1)) / _q->r;
+    } else {
+        // snap each frequency to nearest grid point (F is increasing),
+        // keeping indices strictly increasing and within the grid
+        unsigned int j = 0;
+        for (i=0; i<_q->r+1; i++) {
+            while (j+1 < _q->grid_size && _q->F[j+1] <= _fext[i])
+                j++;
+            unsigned int k = (j+1 < _q->grid_size &&
+                              _q->F[j+1]-_fext[i] < _fext[i]-_q->F[j]) ? j+1 : j;
+            _q->iext[i] = (i > 0 && k <= _q->iext[i-1]) ? _q->iext[i-1]+1 : k;
+        }
+        for (i=_q->r+1; i>0; i--) {
+            unsigned int kmax = _q->grid_size - 1 - (_q->r + 1 - i);
+            if (_q->iext[i-1] > kmax)
+                _q->iext[i-1] = kmax;
+        }
+    }
 #if LIQUID_FIRDESPM_DEBUG_PRINT
+    for (i=0; i<_q->r+1; i++)
         printf("iext_guess[%3u] = %u\n", i, _q->iext[i]);
 #endif
-    }
 
     // iterate over the Remez exchange algorithm
     unsigned int p;
@@ -35,6 +35,9 @@
 
 #define FIRFARROW_DEBUG 0
 
+// number of samples buffered per pass of the variable-delay block method
+#define FIRFARROW_BLOCK_LEN (256)
+
 // defined:
 //  FIRFARROW()     name-mangling macro
 //  T               coefficients type
@@ -59,6 +62,13 @@ struct FIRFARROW(_s) {
     TI * v;
     unsigned int v_index;
 #endif
+
+    // variable-delay block method: one branch filter per polynomial
+    // coefficient, each run as a dot product over a linear buffer of
+    // history and input, with branch outputs combined by Horner's rule
+    DOTPROD() * dp;     // branch filters [size: Q x 1]
+    TO * v_branch;      // branch outputs [size: Q x 1]
+    TI * buf;           // linear buffer [size: h_len-1+FIRFARROW_BLOCK_LEN x 1]
 };
 
 // create firfarrow object
@@ -113,6 +123,19 @@ FIRFARROW() FIRFARROW(_create)(unsigned int _h_len,
     // generate polynomials
     FIRFARROW(_genpoly)(q);
 
+    // create branch filters from normalized polynomial coefficients,
+    // matching the terms evaluated by _set_delay()
+    q->dp = (DOTPROD()*) malloc((q->Q)*sizeof(DOTPROD()));
+    TC hb[q->h_len];
+    unsigned int i, j;
+    for (j=0; j<q->Q; j++) {
+        for (i=0; i<q->h_len; i++)
+            hb[i] = q->P[i*(q->Q+1) + j] * q->gamma;
+        q->dp[j] = DOTPROD(_create)(hb, q->h_len);
+    }
+    q->v_branch = (TO*) malloc((q->Q)*sizeof(TO));
+    q->buf      = (TI*) malloc((q->h_len-1+FIRFARROW_BLOCK_LEN)*sizeof(TI));
+
     // set nominal delay of 0
     FIRFARROW(_set_delay)(q,0.0f);
 
@@ -131,6 +154,14 @@ void FIRFARROW(_destroy)(FIRFARROW() _q)
     free(_q->h);    // free the filter coefficients array
     free(_q->P);    // free the polynomial matrix
 
+    // free branch filters and buffers
+    unsigned int i;
+    for (i=0; i<_q->Q; i++)
+        DOTPROD(_destroy)(_q->dp[i]);
+    free(_q->dp);
+    free(_q->v_branch);
+    free(_q->buf);
+
     // free main object
     free(_q);
 }
@@ -254,6 +285,73 @@ void FIRFARROW(_execute_block)(FIRFARROW()  _q,
     }
 }
 
+// compute firfarrow filter on block of samples with a separate
+// fractional delay for each; equivalent to pushing each input,
+// setting its delay and executing, but without recomputing the
+// filter taps for every sample. The input and output arrays may
+// have the same pointer.
+//  _q      : firfarrow object
+//  _x      : input array [size: _n x 1]
+//  _mu     : fractional sample delay array [size: _n x 1]
+//  _n      : input, output array size
+//  _y      : output array [size: _n x 1]
+void FIRFARROW(_execute_block_delay)(FIRFARROW()  _q,
+                                     TI *         _x,
+                                     float *      _mu,
+                                     unsigned int _n,
+                                     TO *         _y)
+{
+    if (_n == 0)
+        return;
+
+#if FIRFARROW_USE_DOTPROD
+    unsigned int i, j;
+    unsigned int p = _q->h_len - 1;     // history length
+    unsigned int Q = _q->Q;
+    TI * r;
+    while (_n > 0) {
+        unsigned int n = _n < FIRFARROW_BLOCK_LEN ? _n : FIRFARROW_BLOCK_LEN;
+
+        // fill buffer: most recent h_len-1 samples, then input
+        WINDOW(_read)(_q->w, &r);
+        memmove(_q->buf,   r+1, p*sizeof(TI));
+        memmove(_q->buf+p, _x,  n*sizeof(TI));
+
+        // update window before (possibly) overwriting input
+        unsigned int k = n < _q->h_len ? n : _q->h_len;
+        WINDOW(_write)(_q->w, _x + n - k, k);
+
+        for (i=0; i<n; i++) {
+            // branch filter outputs
+            for (j=0; j<Q; j++)
+                DOTPROD(_execute)(_q->dp[j], _q->buf + i, &_q->v_branch[j]);
+
+            // evaluate polynomial in -mu with Horner's rule
+            float u = -_mu[i];
+            TO y = _q->v_branch[Q-1];
+            for (j=Q-1; j>0; j--)
+                y = y*u + _q->v_branch[j-1];
+            _y[i] = y;
+        }
+
+        _x  += n;
+        _mu += n;
+        _y  += n;
+        _n  -= n;
+    }
+
+    // retain filter taps for final delay
+    FIRFARROW(_set_delay)(_q, _mu[-1]);
+#else
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        FIRFARROW(_push)(_q, _x[i]);
+        FIRFARROW(_set_delay)(_q, _mu[i]);
+        FIRFARROW(_execute)(_q, &_y[i]);
+    }
+#endif
+}
+
 // get length of firfarrow object (number of filter taps)
 unsigned int FIRFARROW(_get_length)(FIRFARROW() _q)
 {
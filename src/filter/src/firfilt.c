@@ -37,6 +37,9 @@
 
 #define LIQUID_FIRFILT_USE_WINDOW   (0)
 
+// number of outputs computed per pass of the linear-phase block method
+#define FIRFILT_BLOCK_LEN           (256)
+
 // firfilt object structure
 struct FIRFILT(_s) {
     TC * h;             // filter coefficients array [size; h_len x 1]
@@ -54,8 +57,20 @@ struct FIRFILT(_s) {
 #endif
     DOTPROD() dp;           // dot product object
     TC scale;               // output scaling factor
+
+    // linear-phase block processing, enabled when coefficients are
+    // symmetric: the buffer holds h_len-1 samples of history followed by
+    // up to FIRFILT_BLOCK_LEN new samples (plus padding for the kernel)
+    int symmetric;          // coefficients are symmetric?
+    TC * hs;                // folded coefficients [size: (h_len+1)/2 x 1]
+    TI * buf;               // linear buffer [size: h_len+FIRFILT_BLOCK_LEN+3 x 1]
+    TO * acc;               // block outputs [size: FIRFILT_BLOCK_LEN x 1]
 };
 
+// determine whether coefficients are symmetric and (de)allocate block
+// processing buffers accordingly
+void FIRFILT(_set_symmetric)(FIRFILT() _q);
+
 // create firfilt object
 //  _h      :   coefficients (filter taps) [size: _n x 1]
 //  _n      :   filter length
@@ -92,6 +107,12 @@ FIRFILT() FIRFILT(_create)(TC * _h,
     // create dot product object
     q->dp = DOTPROD(_create)(q->h, q->h_len);
 
+    // fold coefficients, allocating block buffers only if symmetric
+    q->hs  = (TC *) malloc(((q->h_len+1)/2)*sizeof(TC));
+    q->buf = NULL;
+    q->acc = NULL;
+    FIRFILT(_set_symmetric)(q);
+
     // set default scaling
     q->scale = 1;
 
@@ -337,6 +358,10 @@ FIRFILT() FIRFILT(_recreate)(FIRFILT() _q,
     // re-create internal dot product object
     _q->dp = DOTPROD(_recreate)(_q->dp, _q->h, _q->h_len);
 
+    // re-fold coefficients for block processing
+    _q->hs = (TC *) realloc(_q->hs, ((_q->h_len+1)/2)*sizeof(TC));
+    FIRFILT(_set_symmetric)(_q);
+
     return _q;
 }
 
@@ -350,6 +375,9 @@ void FIRFILT(_destroy)(FIRFILT() _q)
 #endif
     DOTPROD(_destroy)(_q->dp);
     free(_q->h);
+    free(_q->hs);
+    free(_q->buf);
+    free(_q->acc);
     free(_q);
 }
 
@@ -478,6 +506,37 @@ void FIRFILT(_execute_block)(FIRFILT()    _q,
                              TO *         _y)
 {
     unsigned int i;
+
+    // linear-phase filters: fold mirrored samples, halving the multiplies
+    if (_q->symmetric) {
+        TI * r;
+        while (_n > 0) {
+            unsigned int n = _n < FIRFILT_BLOCK_LEN ? _n : FIRFILT_BLOCK_LEN;
+
+            // restore history (most recent h_len-1 samples), append input
+#if LIQUID_FIRFILT_USE_WINDOW
+            WINDOW(_read)(_q->w, &r);
+#else
+            r = _q->w + _q->w_index;
+#endif
+            memmove(_q->buf, r+1, (_q->h_len-1)*sizeof(TI));
+            memmove(_q->buf + _q->h_len - 1, _x, n*sizeof(TI));
+            FIRFILT(_dotprod_sym)(_q->hs, _q->h_len, &_q->buf, 1, n, _q->acc);
+
+            // update internal buffer before (possibly) overwriting input
+            unsigned int k = n < _q->h_len ? n : _q->h_len;
+            FIRFILT(_write)(_q, _x + n - k, k);
+
+            for (i=0; i<n; i++)
+                _y[i] = _q->acc[i] * _q->scale;
+
+            _x += n;
+            _y += n;
+            _n -= n;
+        }
+        return;
+    }
+
     for (i=0; i<_n; i++) {
         // push sample into filter
         FIRFILT(_push)(_q, _x[i]);
@@ -532,3 +591,119 @@ float FIRFILT(_groupdelay)(FIRFILT() _q,
     return fir_group_delay(h, n, _fc);
 }
 
+// fold filter coefficients, returning 1 if they are symmetric
+//  _h      :   filter coefficients [size: _h_len x 1]
+//  _h_len  :   filter length
+//  _hs     :   folded coefficients [size: (_h_len+1)/2 x 1]
+int FIRFILT(_fold)(TC *         _h,
+                   unsigned int _h_len,
+                   TC *         _hs)
+{
+    unsigned int i;
+    for (i=0; i<_h_len/2; i++) {
+        if (_h[i] != _h[_h_len-i-1])
+            return 0;
+        _hs[i] = _h[i];
+    }
+
+    // middle tap (odd length)
+    if (_h_len % 2)
+        _hs[_h_len/2] = _h[_h_len/2];
+    return 1;
+}
+
+// folded (linear-phase) dot product on a block of outputs, where the
+// input stream is stored as _M de-interleaved phases such that sample t
+// is _x[t % _M][t / _M]; output k is computed over samples k*_M through
+// k*_M+_h_len-1.
+//  _hs     :   folded coefficients [size: (_h_len+1)/2 x 1]
+//  _h_len  :   filter length
+//  _x      :   array of phase buffers, each with 3 samples of padding
+//  _M      :   number of phases (decimation rate)
+//  _n      :   number of outputs
+//  _y      :   output array [size: _n x 1]
+void FIRFILT(_dotprod_sym)(TC *         _hs,
+                           unsigned int _h_len,
+                           TI **        _x,
+                           unsigned int _M,
+                           unsigned int _n,
+                           TO *         _y)
+{
+    unsigned int p = _h_len - 1;
+    unsigned int i;
+    unsigned int j;
+
+    // accumulate groups of outputs in a local array; for each folded tap
+    // both samples advance by one phase step per output, so the inner
+    // loop reads consecutive memory and maps directly onto vector
+    // registers
+    TO acc[64];
+    unsigned int i0;
+    for (i0=0; i0<_n; i0+=64) {
+        unsigned int n  = _n - i0 < 64 ? _n - i0 : 64;
+        unsigned int n4 = (n + 3) & ~3u;
+        for (i=0; i<n4; i++)
+            acc[i] = 0;
+
+        // two folded taps per pass over the accumulators
+        for (j=0; j+1<_h_len/2; j+=2) {
+            TC h0 = _hs[j];
+            TC h1 = _hs[j+1];
+            TI * ra0 = _x[ j      % _M] + i0 +  j      / _M;
+            TI * rb0 = _x[(p-j)   % _M] + i0 + (p-j)   / _M;
+            TI * ra1 = _x[(j+1)   % _M] + i0 + (j+1)   / _M;
+            TI * rb1 = _x[(p-j-1) % _M] + i0 + (p-j-1) / _M;
+            for (i=0; i<n4; i+=4) {
+                acc[i+0] += h0 * (ra0[i+0] + rb0[i+0]) + h1 * (ra1[i+0] + rb1[i+0]);
+                acc[i+1] += h0 * (ra0[i+1] + rb0[i+1]) + h1 * (ra1[i+1] + rb1[i+1]);
+                acc[i+2] += h0 * (ra0[i+2] + rb0[i+2]) + h1 * (ra1[i+2] + rb1[i+2]);
+                acc[i+3] += h0 * (ra0[i+3] + rb0[i+3]) + h1 * (ra1[i+3] + rb1[i+3]);
+            }
+        }
+        for ( ; j<_h_len/2; j++) {
+            TC h = _hs[j];
+            TI * ra = _x[ j    % _M] + i0 +  j    / _M;
+            TI * rb = _x[(p-j) % _M] + i0 + (p-j) / _M;
+            for (i=0; i<n4; i+=4) {
+                acc[i+0] += h * (ra[i+0] + rb[i+0]);
+                acc[i+1] += h * (ra[i+1] + rb[i+1]);
+                acc[i+2] += h * (ra[i+2] + rb[i+2]);
+                acc[i+3] += h * (ra[i+3] + rb[i+3]);
+            }
+        }
+
+        // middle tap (odd length)
+        if (_h_len % 2) {
+            j = _h_len/2;
+            TC h = _hs[j];
+            TI * ra = _x[j % _M] + i0 + j / _M;
+            for (i=0; i<n4; i++)
+                acc[i] += h * ra[i];
+        }
+
+        for (i=0; i<n; i++)
+            _y[i0+i] = acc[i];
+    }
+}
+
+//
+// internal methods
+//
+
+// determine whether coefficients are symmetric and (de)allocate block
+// processing buffers accordingly
+void FIRFILT(_set_symmetric)(FIRFILT() _q)
+{
+    _q->symmetric = FIRFILT(_fold)(_q->h, _q->h_len, _q->hs);
+
+    free(_q->buf);
+    free(_q->acc);
+    _q->buf = NULL;
+    _q->acc = NULL;
+    if (_q->symmetric) {
+        unsigned int buf_len = _q->h_len + FIRFILT_BLOCK_LEN + 3;
+        _q->buf = (TI *) malloc(buf_len*sizeof(TI));
+        _q->acc = (TO *) malloc(FIRFILT_BLOCK_LEN*sizeof(TO));
+        memset(_q->buf, 0x00, buf_len*sizeof(TI));
+    }
+}
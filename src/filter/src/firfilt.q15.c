@@ -0,0 +1,242 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// firfilt (Q15) : fixed-point finite impulse response (FIR) filter
+//
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+// defined:
+//  FIRFILT()       name-mangling macro
+//  DOTPROD()       dotprod macro
+//  TO, TC, TI      output, coefficients, input types
+//  TC_COMPLEX      coefficients are complex?
+
+// number of input samples buffered linearly before shifting history
+#define FIRFILT_Q15_BUFFER_LEN  (256)
+
+// firfilt object structure
+struct FIRFILT(_s) {
+    TC *            h;      // filter coefficients, reversed [size: h_len x 1]
+    unsigned int    h_len;  // filter length
+    DOTPROD()       dp;     // dot product object
+
+    // linear buffer: samples are appended until the end of the buffer is
+    // reached, at which point the most recent h_len samples are moved to
+    // the front; the dot product runs directly over the buffer
+    TI *            buf;    // [size: h_len+FIRFILT_Q15_BUFFER_LEN x 1]
+    unsigned int    buf_len;// total buffer length
+    unsigned int    index;  // index of next sample to be written
+};
+
+// create firfilt object
+//  _h      :   coefficients (filter taps) [size: _n x 1]
+//  _n      :   filter length
+FIRFILT() FIRFILT(_create)(TC *         _h,
+                           unsigned int _n)
+{
+    // validate input
+    if (_n == 0) {
+        fprintf(stderr,"error: firfilt_%s_create(), filter length must be greater than zero\n", EXTENSION_FULL);
+        exit(1);
+    }
+
+    // create filter object and initialize
+    FIRFILT() q = (FIRFILT()) malloc(sizeof(struct FIRFILT(_s)));
+    q->h_len = _n;
+    q->h     = (TC *) malloc((q->h_len)*sizeof(TC));
+
+    // load filter in reverse order
+    unsigned int i;
+    for (i=_n; i>0; i--)
+        q->h[i-1] = _h[_n-i];
+
+    // create dot product object
+    q->dp = DOTPROD(_create)(q->h, q->h_len);
+
+    // allocate linear buffer
+    q->buf_len = q->h_len + FIRFILT_Q15_BUFFER_LEN;
+    q->buf     = (TI *) malloc(q->buf_len*sizeof(TI));
+
+    // reset filter state (clear buffer)
+    FIRFILT(_reset)(q);
+    return q;
+}
+
+// create using Kaiser-Bessel windowed sinc method, quantizing to Q15
+//  _n      : filter length, _n > 0
+//  _fc     : filter cut-off frequency 0 < _fc < 0.5
+//  _As     : filter stop-band attenuation [dB], _As > 0
+//  _mu     : fractional sample offset, -0.5 < _mu < 0.5
+FIRFILT() FIRFILT(_create_kaiser)(unsigned int _n,
+                                  float        _fc,
+                                  float        _As,
+                                  float        _mu)
+{
+    // validate input
+    if (_n == 0) {
+        fprintf(stderr,"error: firfilt_%s_create_kaiser(), filter length must be greater than zero\n", EXTENSION_FULL);
+        exit(1);
+    }
+
+    // compute temporary array for holding coefficients
+    float hf[_n];
+    liquid_firdes_kaiser(_n, _fc, _As, _mu, hf);
+
+    // quantize coefficients to type-specific array
+    TC h[_n];
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+#if TC_COMPLEX
+        h[i].real = liquid_float_to_q15(hf[i]);
+        h[i].imag = 0;
+#else
+        h[i] = liquid_float_to_q15(hf[i]);
+#endif
+    }
+
+    return FIRFILT(_create)(h, _n);
+}
+
+// destroy firfilt object
+void FIRFILT(_destroy)(FIRFILT() _q)
+{
+    DOTPROD(_destroy)(_q->dp);
+    free(_q->h);
+    free(_q->buf);
+    free(_q);
+}
+
+// reset internal state of filter object
+void FIRFILT(_reset)(FIRFILT() _q)
+{
+    memset(_q->buf, 0x00, _q->buf_len*sizeof(TI));
+    _q->index = _q->h_len;
+}
+
+// print filter object internals (taps)
+void FIRFILT(_print)(FIRFILT() _q)
+{
+    printf("firfilt_%s:\n", EXTENSION_FULL);
+    unsigned int i;
+    unsigned int n = _q->h_len;
+    for (i=0; i<n; i++) {
+        printf("  h(%3u) = ", i+1);
+#if TC_COMPLEX
+        printf("%12.8f+j*%12.8f", liquid_q15_to_float(_q->h[n-i-1].real),
+                                  liquid_q15_to_float(_q->h[n-i-1].imag));
+#else
+        printf("%12.8f", liquid_q15_to_float(_q->h[n-i-1]));
+#endif
+        printf("\n");
+    }
+}
+
+// push sample into filter object's internal buffer
+//  _q      :   filter object
+//  _x      :   input sample
+void FIRFILT(_push)(FIRFILT() _q,
+                    TI        _x)
+{
+    // move history to front of buffer when full
+    if (_q->index == _q->buf_len) {
+        memmove(_q->buf, _q->buf + _q->buf_len - _q->h_len, _q->h_len*sizeof(TI));
+        _q->index = _q->h_len;
+    }
+    _q->buf[_q->index++] = _x;
+}
+
+// Write block of samples into filter object's internal buffer
+//  _q      : filter object
+//  _x      : buffer of input samples, [size: _n x 1]
+//  _n      : number of input samples
+void FIRFILT(_write)(FIRFILT()    _q,
+                     TI *         _x,
+                     unsigned int _n)
+{
+    while (_n > 0) {
+        // move history to front of buffer when full
+        if (_q->index == _q->buf_len) {
+            memmove(_q->buf, _q->buf + _q->buf_len - _q->h_len, _q->h_len*sizeof(TI));
+            _q->index = _q->h_len;
+        }
+        unsigned int n = _q->buf_len - _q->index;
+        n = _n < n ? _n : n;
+        memmove(_q->buf + _q->index, _x, n*sizeof(TI));
+        _q->index += n;
+        _x += n;
+        _n -= n;
+    }
+}
+
+// compute output sample (dot product between internal
+// filter coefficients and internal buffer)
+//  _q      :   filter object
+//  _y      :   output sample pointer
+void FIRFILT(_execute)(FIRFILT() _q,
+                       TO *      _y)
+{
+    DOTPROD(_execute)(_q->dp, _q->buf + _q->index - _q->h_len, _y);
+}
+
+// execute the filter on a block of input samples; the
+// input and output buffers may be the same
+//  _q      : filter object
+//  _x      : pointer to input array [size: _n x 1]
+//  _n      : number of input, output samples
+//  _y      : pointer to output array [size: _n x 1]
+void FIRFILT(_execute_block)(FIRFILT()    _q,
+                             TI *         _x,
+                             unsigned int _n,
+                             TO *         _y)
+{
+    while (_n > 0) {
+        // move history to front of buffer when full
+        if (_q->index == _q->buf_len) {
+            memmove(_q->buf, _q->buf + _q->buf_len - _q->h_len, _q->h_len*sizeof(TI));
+            _q->index = _q->h_len;
+        }
+
+        // append as many samples as fit, then slide dot product over them
+        unsigned int n = _q->buf_len - _q->index;
+        n = _n < n ? _n : n;
+        memmove(_q->buf + _q->index, _x, n*sizeof(TI));
+        TI * r = _q->buf + _q->index + 1 - _q->h_len;
+        unsigned int i;
+        for (i=0; i<n; i++)
+            DOTPROD(_execute)(_q->dp, r + i, &_y[i]);
+
+        _q->index += n;
+        _x += n;
+        _y += n;
+        _n -= n;
+    }
+}
+
+// get filter length
+unsigned int FIRFILT(_get_length)(FIRFILT() _q)
+{
+    return _q->h_len;
+}
@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Multi-channel finite impulse response filter
+//
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+// defined:
+//  FIRFILTMC()     name-mangling macro
+//  TO              output type
+//  TC              coefficients type
+//  TI              input type
+//  PRINTVAL()      print macro(s)
+
+// number of samples per channel buffered before shifting history
+#define FIRFILTMC_BUFFER_LEN    (64)
+
+struct FIRFILTMC(_s) {
+    TC * h;                     // filter coefficients (reversed) [size: h_len x 1]
+    unsigned int h_len;         // filter length
+    unsigned int num_channels;  // number of channels
+    TC scale;                   // output scaling factor
+
+    // channel-interleaved linear buffer: h_len-1 rows of history followed
+    // by up to FIRFILTMC_BUFFER_LEN new rows, each row holding one sample
+    // per channel
+    TI * buf;                   // [size: (h_len-1+FIRFILTMC_BUFFER_LEN)*num_channels x 1]
+    unsigned int buf_index;     // number of rows currently in buffer
+};
+
+// create multi-channel firfilt object
+//  _h              :   coefficients (filter taps) [size: _n x 1]
+//  _n              :   filter length
+//  _num_channels   :   number of channels
+FIRFILTMC() FIRFILTMC(_create)(TC *         _h,
+                               unsigned int _n,
+                               unsigned int _num_channels)
+{
+    // validate input
+    if (_n == 0) {
+        fprintf(stderr,"error: firfiltmc_%s_create(), filter length must be greater than zero\n", EXTENSION_FULL);
+        exit(1);
+    } else if (_num_channels == 0) {
+        fprintf(stderr,"error: firfiltmc_%s_create(), number of channels must be greater than zero\n", EXTENSION_FULL);
+        exit(1);
+    }
+
+    // create filter object and initialize
+    FIRFILTMC() q = (FIRFILTMC()) malloc(sizeof(struct FIRFILTMC(_s)));
+    q->h_len        = _n;
+    q->num_channels = _num_channels;
+    q->scale        = 1;
+
+    // load filter in reverse order
+    q->h = (TC *) malloc((q->h_len)*sizeof(TC));
+    unsigned int i;
+    for (i=0; i<q->h_len; i++)
+        q->h[i] = _h[q->h_len-i-1];
+
+    // allocate buffer
+    q->buf = (TI *) malloc((q->h_len-1+FIRFILTMC_BUFFER_LEN)*q->num_channels*sizeof(TI));
+
+    // reset filter state (clear buffer)
+    FIRFILTMC(_reset)(q);
+    return q;
+}
+
+// create multi-channel filter using Kaiser-Bessel windowed sinc method
+//  _n              : filter length, _n > 0
+//  _fc             : cutoff frequency, 0 < _fc < 0.5
+//  _As             : stop-band attenuation [dB], _As > 0
+//  _mu             : fractional sample offset, -0.5 < _mu < 0.5
+//  _num_channels   : number of channels
+FIRFILTMC() FIRFILTMC(_create_kaiser)(unsigned int _n,
+                                      float        _fc,
+                                      float        _As,
+                                      float        _mu,
+                                      unsigned int _num_channels)
+{
+    // compute temporary array for holding coefficients
+    float hf[_n];
+    liquid_firdes_kaiser(_n, _fc, _As, _mu, hf);
+
+    // copy coefficients to type-specific array
+    TC hc[_n];
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        hc[i] = hf[i];
+
+    return FIRFILTMC(_create)(hc, _n, _num_channels);
+}
+
+// destroy firfiltmc object, freeing all internal memory
+void FIRFILTMC(_destroy)(FIRFILTMC() _q)
+{
+    free(_q->buf);
+    free(_q->h);
+    free(_q);
+}
+
+// print firfiltmc object properties to stdout
+void FIRFILTMC(_print)(FIRFILTMC() _q)
+{
+    printf("firfiltmc_%s: %u channels\n", EXTENSION_FULL, _q->num_channels);
+    unsigned int i;
+    unsigned int n = _q->h_len;
+    for (i=0; i<n; i++) {
+        printf("  h(%3u) = ", i+1);
+        PRINTVAL_TC(_q->h[n-i-1],%12.8f);
+        printf(";\n");
+    }
+    printf("  scale = ");
+    PRINTVAL_TC(_q->scale,%12.8f);
+    printf("\n");
+}
+
+// reset firfiltmc object internal state for all channels
+void FIRFILTMC(_reset)(FIRFILTMC() _q)
+{
+    _q->buf_index = _q->h_len - 1;
+    memset(_q->buf, 0x00, _q->buf_index*_q->num_channels*sizeof(TI));
+}
+
+// set output scaling for filter
+void FIRFILTMC(_set_scale)(FIRFILTMC() _q,
+                           TC          _scale)
+{
+    _q->scale = _scale;
+}
+
+// get number of channels
+unsigned int FIRFILTMC(_get_num_channels)(FIRFILTMC() _q)
+{
+    return _q->num_channels;
+}
+
+// compute filter output for one sample on each channel
+//  _q      : firfiltmc object
+//  _x      : input samples [size: num_channels x 1]
+//  _y      : output samples [size: num_channels x 1]
+void FIRFILTMC(_execute)(FIRFILTMC() _q,
+                         TI *        _x,
+                         TO *        _y)
+{
+    FIRFILTMC(_execute_block)(_q, _x, 1, _y);
+}
+
+// execute filter on a block of channel-interleaved samples
+//  _q      : firfiltmc object
+//  _x      : input array [size: _n*num_channels x 1]
+//  _n      : number of samples per channel
+//  _y      : output array [size: _n*num_channels x 1]
+void FIRFILTMC(_execute_block)(FIRFILTMC()  _q,
+                               TI *         _x,
+                               unsigned int _n,
+                               TO *         _y)
+{
+    unsigned int C = _q->num_channels;
+    unsigned int i;
+    while (_n > 0) {
+        // shift history to front of buffer if it is full
+        if (_q->buf_index == _q->h_len - 1 + FIRFILTMC_BUFFER_LEN) {
+            memmove(_q->buf, _q->buf + FIRFILTMC_BUFFER_LEN*C, (_q->h_len-1)*C*sizeof(TI));
+            _q->buf_index = _q->h_len - 1;
+        }
+
+        // copy as many input rows as will fit into the buffer
+        unsigned int n = _q->h_len - 1 + FIRFILTMC_BUFFER_LEN - _q->buf_index;
+        n = n < _n ? n : _n;
+        memmove(_q->buf + _q->buf_index*C, _x, n*C*sizeof(TI));
+
+        // compute output rows
+        for (i=0; i<n; i++) {
+            TI * r = _q->buf + (_q->buf_index + i + 1 - _q->h_len)*C;
+            FIRFILTMC(_dotprod)(_q->h, _q->h_len, r, C, _q->scale, _y + i*C);
+        }
+
+        // update counters
+        _q->buf_index += n;
+        _x            += n*C;
+        _y            += n*C;
+        _n            -= n;
+    }
+}
+
+// multi-channel dot product on channel-interleaved input; channels are
+// processed eight at a time with independent accumulators held in
+// registers so that each coefficient is loaded once per group and
+// broadcast across lanes
+//  _h              : coefficients [size: _h_len x 1]
+//  _h_len          : number of coefficients
+//  _x              : input [size: _h_len*_num_channels x 1]
+//  _num_channels   : number of channels
+//  _scale          : output scaling factor
+//  _y              : output [size: _num_channels x 1]
+void FIRFILTMC(_dotprod)(TC *         _h,
+                         unsigned int _h_len,
+                         TI *         _x,
+                         unsigned int _num_channels,
+                         TC           _scale,
+                         TO *         _y)
+{
+    unsigned int C = _num_channels;
+    unsigned int c, k;
+
+    // groups of eight channels
+    for (c=0; c+8<=C; c+=8) {
+        TO y0=0, y1=0, y2=0, y3=0, y4=0, y5=0, y6=0, y7=0;
+        TI * v = _x + c;
+        for (k=0; k<_h_len; k++) {
+            TC h = _h[k];
+            y0 += h*v[0];   y1 += h*v[1];   y2 += h*v[2];   y3 += h*v[3];
+            y4 += h*v[4];   y5 += h*v[5];   y6 += h*v[6];   y7 += h*v[7];
+            v += C;
+        }
+        _y[c+0] = y0*_scale;    _y[c+1] = y1*_scale;
+        _y[c+2] = y2*_scale;    _y[c+3] = y3*_scale;
+        _y[c+4] = y4*_scale;    _y[c+5] = y5*_scale;
+        _y[c+6] = y6*_scale;    _y[c+7] = y7*_scale;
+    }
+
+    // remaining channels
+    for ( ; c<C; c++) {
+        TO y0 = 0;
+        for (k=0; k<_h_len; k++)
+            y0 += _h[k] * _x[k*C + c];
+        _y[c] = y0*_scale;
+    }
+}
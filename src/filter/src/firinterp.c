@@ -27,6 +27,24 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <math.h>
+
+// cost model for selecting between direct-form and fast-convolution block
+// execution, in nanoseconds as measured on the benchmark suite
+#define FIRINTERP_COST_TAP      (0.27f) // per sub-filter coefficient per output
+#define FIRINTERP_COST_OUTPUT   (6.0f)  // per output (filterbank overhead)
+#define FIRINTERP_COST_FFT      (2.9f)  // per n*log2(n) of each transform
+#define FIRINTERP_COST_BIN      (1.0f)  // per bin of spectral product
+#define FIRINTERP_NFFT_MAX      (1<<16) // largest transform considered
+
+// select fast-convolution transform size, enabling it if cheaper
+void FIRINTERP(_fft_plan)(FIRINTERP() _q);
+
+// execute fast-convolution on _n inputs, _n <= _q->fft_max
+void FIRINTERP(_execute_block_fft)(FIRINTERP()  _q,
+                                   TI *         _x,
+                                   unsigned int _n,
+                                   TO *         _y);
 
 struct FIRINTERP(_s) {
     TC *            h;          // prototype filter coefficients
@@ -34,6 +52,29 @@ struct FIRINTERP(_s) {
     unsigned int    h_sub_len;  // sub-filter length
     unsigned int    M;          // interpolation factor
     FIRPFB()        filterbank; // polyphase filterbank object
+
+    // fast-convolution (overlap-save) block processing, enabled when the
+    // cost model favors it for long filters: each transform of L input
+    // samples is replicated M times in frequency (upsampling by zero
+    // insertion), multiplied by the filter response and inverse
+    // transformed to yield nfft=M*L interpolated outputs
+    unsigned int    nfft;       // inverse transform size (0: disabled)
+    unsigned int    L;          // forward transform size, nfft/M
+    unsigned int    fft_min;    // fewest inputs for which transform pays off
+    unsigned int    fft_max;    // most inputs per transform
+    WINDOW()        w;          // input history [size: h_sub_len x 1]
+    float complex * xtime_buf;  // input time buffer [size: L x 1]
+    float complex * xfreq_buf;  // input freq buffer [size: L x 1]
+    float complex * freq_buf;   // freq buffer [size: nfft x 1]
+    float complex * time_buf;   // time buffer [size: nfft x 1]
+    float complex * H;          // FFT of filter coefficients / nfft [size: nfft x 1]
+#ifdef LIQUID_FFTOVERRIDE
+    fftplan         fft;        // FFT object (forward, size L)
+    fftplan         ifft;       // FFT object (inverse, size nfft)
+#else
+    FFT_PLAN        fft;        // FFT object (forward, size L)
+    FFT_PLAN        ifft;       // FFT object (inverse, size nfft)
+#endif
 };
 
 // create interpolator
@@ -75,6 +116,9 @@ FIRINTERP() FIRINTERP(_create)(unsigned int _M,
     // create polyphase filterbank
     q->filterbank = FIRPFB(_create)(q->M, q->h, q->h_len);
 
+    // set up fast-convolution if cheaper than direct form
+    FIRINTERP(_fft_plan)(q);
+
     // return interpolator object
     return q;
 }
@@ -209,6 +253,21 @@ void FIRINTERP(_destroy)(FIRINTERP() _q)
 {
     FIRPFB(_destroy)(_q->filterbank);
     free(_q->h);
+    if (_q->nfft > 0) {
+#ifdef LIQUID_FFTOVERRIDE
+        fft_destroy_plan(_q->fft);
+        fft_destroy_plan(_q->ifft);
+#else
+        FFT_DESTROY_PLAN(_q->fft);
+        FFT_DESTROY_PLAN(_q->ifft);
+#endif
+        WINDOW(_destroy)(_q->w);
+        free(_q->xtime_buf);
+        free(_q->xfreq_buf);
+        free(_q->freq_buf);
+        free(_q->time_buf);
+        free(_q->H);
+    }
     free(_q);
 }
 
@@ -218,6 +277,8 @@ void FIRINTERP(_print)(FIRINTERP() _q)
     printf("interp():\n");
     printf("    M       :   %u\n", _q->M);
     printf("    h_len   :   %u\n", _q->h_len);
+    if (_q->nfft > 0)
+        printf("    nfft    :   %u (fast convolution)\n", _q->nfft);
     FIRPFB(_print)(_q->filterbank);
 }
 
@@ -225,6 +286,8 @@ void FIRINTERP(_print)(FIRINTERP() _q)
 void FIRINTERP(_reset)(FIRINTERP() _q)
 {
     FIRPFB(_reset)(_q->filterbank);
+    if (_q->nfft > 0)
+        WINDOW(_reset)(_q->w);
 }
 
 // Set output scaling for interpolator
@@ -256,6 +319,10 @@ void FIRINTERP(_execute)(FIRINTERP() _q,
     // push sample into filterbank
     FIRPFB(_push)(_q->filterbank,  _x);
 
+    // keep fast-convolution history in sync
+    if (_q->nfft > 0)
+        WINDOW(_push)(_q->w, _x);
+
     // compute output for each filter in the bank
     unsigned int i;
     for (i=0; i<_q->M; i++)
@@ -273,9 +340,149 @@ void FIRINTERP(_execute_block)(FIRINTERP()  _q,
                                TO *         _y)
 {
     unsigned int i;
-    for (i=0; i<_n; i++) {
-        // execute one input at a time with an output stride _M
-        FIRINTERP(_execute)(_q, _x[i], &_y[i*_q->M]);
+
+    // long filters: fast convolution in the frequency domain
+    while (_q->nfft > 0 && _n >= _q->fft_min) {
+        unsigned int n = _n < _q->fft_max ? _n : _q->fft_max;
+        FIRINTERP(_execute_block_fft)(_q, _x, n, _y);
+        _x += n;
+        _y += n*_q->M;
+        _n -= n;
+    }
+
+    // direct form: run all sub-filters over block
+    if (_n == 0)
+        return;
+    FIRPFB(_execute_bank_block)(_q->filterbank, _x, _n, _y);
+
+    // keep fast-convolution history in sync
+    if (_q->nfft > 0) {
+        for (i=0; i<_n; i++)
+            WINDOW(_push)(_q->w, _x[i]);
+    }
+}
+
+// select fast-convolution transform size, enabling it if cheaper
+void FIRINTERP(_fft_plan)(FIRINTERP() _q)
+{
+    _q->nfft = 0;
+
+    // direct-form cost per input sample
+    float cost_direct = (FIRINTERP_COST_TAP * _q->h_sub_len + FIRINTERP_COST_OUTPUT) * _q->M;
+
+    // search transform sizes nfft = M*L, L a power of two, for the lowest
+    // cost per input; each transform consumes L-h_sub_len+1 inputs
+    float cost_best = cost_direct;
+    float cost_block = 0.0f;
+    unsigned int L;
+    for (L=2; L*_q->M <= FIRINTERP_NFFT_MAX; L*=2) {
+        if (L < _q->h_sub_len)
+            continue;
+        unsigned int nfft = L*_q->M;
+        float c = FIRINTERP_COST_FFT * (nfft*log2f((float)nfft) + L*log2f((float)L)) +
+                  FIRINTERP_COST_BIN * nfft;
+        unsigned int num_inputs = L - _q->h_sub_len + 1;
+        if (c / (float)num_inputs < cost_best) {
+            cost_best  = c / (float)num_inputs;
+            cost_block = c;
+            _q->nfft   = nfft;
+        }
+    }
+    if (_q->nfft == 0)
+        return;
+
+    _q->L       = _q->nfft / _q->M;
+    _q->fft_max = _q->L - _q->h_sub_len + 1;
+    _q->fft_min = (unsigned int) ceilf(cost_block / cost_direct);
+
+    // allocate internal memory arrays
+    _q->w         = WINDOW(_create)(_q->h_sub_len);
+    _q->xtime_buf = (float complex *) malloc(_q->L   *sizeof(float complex));
+    _q->xfreq_buf = (float complex *) malloc(_q->L   *sizeof(float complex));
+    _q->freq_buf  = (float complex *) malloc(_q->nfft*sizeof(float complex));
+    _q->time_buf  = (float complex *) malloc(_q->nfft*sizeof(float complex));
+    _q->H         = (float complex *) malloc(_q->nfft*sizeof(float complex));
+
+    // create internal FFT objects
+#ifdef LIQUID_FFTOVERRIDE
+    _q->fft  = fft_create_plan(_q->L,    _q->xtime_buf, _q->xfreq_buf, LIQUID_FFT_FORWARD,  0);
+    _q->ifft = fft_create_plan(_q->nfft, _q->freq_buf,  _q->time_buf,  LIQUID_FFT_BACKWARD, 0);
+#else
+    _q->fft  = FFT_CREATE_PLAN(_q->L,    _q->xtime_buf, _q->xfreq_buf, FFT_DIR_FORWARD,  FFT_METHOD);
+    _q->ifft = FFT_CREATE_PLAN(_q->nfft, _q->freq_buf,  _q->time_buf,  FFT_DIR_BACKWARD, FFT_METHOD);
+#endif
+
+    // compute FFT of filter coefficients, absorbing inverse transform
+    // normalization; the inverse plan is run in the forward direction by
+    // conjugating input and output
+    unsigned int i;
+    for (i=0; i<_q->nfft; i++)
+        _q->freq_buf[i] = (i < _q->h_len) ? conjf(_q->h[i]) : 0;
+#ifdef LIQUID_FFTOVERRIDE
+    fft_execute(_q->ifft);
+#else
+    FFT_EXECUTE(_q->ifft);
+#endif
+    for (i=0; i<_q->nfft; i++)
+        _q->H[i] = conjf(_q->time_buf[i]) / (float)(_q->nfft);
+}
+
+// execute fast-convolution on _n inputs, _n <= _q->fft_max
+void FIRINTERP(_execute_block_fft)(FIRINTERP()  _q,
+                                   TI *         _x,
+                                   unsigned int _n,
+                                   TO *         _y)
+{
+    unsigned int i;
+    unsigned int j;
+    unsigned int p = _q->h_sub_len - 1;     // history length
+    unsigned int s = _q->L - _n - p;        // leading zeros
+
+    // fill input time buffer: zeros, history, input
+    TI * r;
+    WINDOW(_read)(_q->w, &r);
+    for (i=0; i<s; i++)  _q->xtime_buf[i]     = 0;
+    for (i=0; i<p; i++)  _q->xtime_buf[s+i]   = r[i+1];
+    for (i=0; i<_n; i++) _q->xtime_buf[s+p+i] = _x[i];
+
+    // xtime_buf > {FFT} > xfreq_buf
+#ifdef LIQUID_FFTOVERRIDE
+    fft_execute(_q->fft);
+#else
+    FFT_EXECUTE(_q->fft);
+#endif
+
+    // zero insertion replicates the input spectrum M times; apply filter
+    for (j=0; j<_q->M; j++) {
+        float complex * Y = _q->freq_buf + j*_q->L;
+        float complex * H = _q->H        + j*_q->L;
+        for (i=0; i<_q->L; i++)
+            Y[i] = _q->xfreq_buf[i] * H[i];
+    }
+
+    // freq_buf > {IFFT} > time_buf
+#ifdef LIQUID_FFTOVERRIDE
+    fft_execute(_q->ifft);
+#else
+    FFT_EXECUTE(_q->ifft);
+#endif
+
+    // update history, and filterbank state, before (possibly) overwriting input
+    unsigned int k = _n < _q->h_sub_len ? _n : _q->h_sub_len;
+    WINDOW(_write)(_q->w, _x + _n - k, k);
+    for (i=_n-k; i<_n; i++)
+        FIRPFB(_push)(_q->filterbank, _x[i]);
+
+    // last _n*M samples are valid outputs
+    TC scale;
+    FIRPFB(_get_scale)(_q->filterbank, &scale);
+    float complex * z = _q->time_buf + _q->nfft - _n*_q->M;
+    for (i=0; i<_n*_q->M; i++) {
+#if TO_COMPLEX
+        _y[i] = z[i] * scale;
+#else
+        _y[i] = crealf(z[i]) * scale;
+#endif
     }
 }
 
@@ -28,6 +28,9 @@
 #include <string.h>
 #include <stdlib.h>
 
+// number of input samples per linear buffer in bank block execution
+#define FIRPFB_BLOCK_LEN (64)
+
 struct FIRPFB(_s) {
     TC * h;                     // filter coefficients array
     unsigned int h_len;         // total number of filter coefficients
@@ -37,6 +40,7 @@ struct FIRPFB(_s) {
     WINDOW() w;                 // window buffer
     DOTPROD() * dp;             // array of vector dot product objects
     TC scale;                   // output scaling factor
+    TI * buf;                   // linear buffer for bank block execution
 };
 
 // create firpfb from external coefficients
@@ -88,6 +92,7 @@ FIRPFB() FIRPFB(_create)(unsigned int _M,
 
     // create window buffer
     q->w = WINDOW(_create)(q->h_sub_len);
+    q->buf = (TI*) malloc((q->h_sub_len + FIRPFB_BLOCK_LEN)*sizeof(TI));
 
     // set default scaling
     q->scale = 1;
@@ -280,6 +285,7 @@ void FIRPFB(_destroy)(FIRPFB() _q)
         DOTPROD(_destroy)(_q->dp[i]);
     free(_q->dp);
     WINDOW(_destroy)(_q->w);
+    free(_q->buf);
     free(_q);
 }
 
@@ -351,6 +357,21 @@ void FIRPFB(_execute)(FIRPFB()     _q,
     *_y *= _q->scale;
 }
 
+// execute filter _i on external buffer rather than internal window
+//  _q      : firpfb object
+//  _i      : index of filter to use
+//  _x      : input buffer, oldest sample first [size: h_sub_len x 1]
+//  _y      : pointer to output sample
+void FIRPFB(_run)(FIRPFB()     _q,
+                  unsigned int _i,
+                  TI *         _x,
+                  TO *         _y)
+{
+    // execute dot product and apply scaling factor
+    DOTPROD(_execute)(_q->dp[_i], _x, _y);
+    *_y *= _q->scale;
+}
+
 // execute the filter on a block of input samples; the
 // input and output buffers may be the same
 //  _q      : firpfb object
@@ -374,3 +395,47 @@ void FIRPFB(_execute_block)(FIRPFB()     _q,
     }
 }
 
+// push block of samples, executing every filter in the bank after each;
+// filters run over a linear copy of the window so that no per-sample
+// buffer management is needed
+//  _q      : firpfb object
+//  _x      : pointer to input array [size: _n x 1]
+//  _n      : number of input samples
+//  _y      : output array, num_filters per input [size: num_filters*_n x 1]
+void FIRPFB(_execute_bank_block)(FIRPFB()     _q,
+                                 TI *         _x,
+                                 unsigned int _n,
+                                 TO *         _y)
+{
+    unsigned int hl = _q->h_sub_len;
+    unsigned int M  = _q->num_filters;
+
+    // load history (all but oldest sample in window)
+    TI * r;
+    WINDOW(_read)(_q->w, &r);
+    memmove(_q->buf, r + 1, (hl-1)*sizeof(TI));
+
+    unsigned int i;
+    unsigned int j;
+    while (_n > 0) {
+        // append inputs to linear buffer
+        unsigned int n = _n < FIRPFB_BLOCK_LEN ? _n : FIRPFB_BLOCK_LEN;
+        memmove(_q->buf + hl - 1, _x, n*sizeof(TI));
+
+        // run each filter, buffer index i ending at input sample i
+        for (i=0; i<n; i++) {
+            for (j=0; j<M; j++) {
+                DOTPROD(_execute)(_q->dp[j], _q->buf + i, &_y[j]);
+                _y[j] *= _q->scale;
+            }
+            _y += M;
+        }
+
+        // retain history for next block and update window
+        WINDOW(_write)(_q->w, _x + (n < hl ? 0 : n - hl), n < hl ? n : hl);
+        memmove(_q->buf, _q->buf + n, (hl-1)*sizeof(TI));
+        _x += n;
+        _n -= n;
+    }
+}
+
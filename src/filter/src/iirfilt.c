@@ -69,6 +69,11 @@ struct IIRFILT(_s) {
     // second-order sections 
     IIRFILTSOS() * qsos;    // second-order sections filters
     unsigned int nsos;      // number of second-order sections
+
+    // fused cascade of second-order sections, stored contiguously
+    // and executed in transposed direct form II
+    TC * sos_coeff;         // {b0,b1,b2,a1,a2} per section [size: 5*nsos x 1]
+    TO * sos_state;         // {w1,w2} per section          [size: 2*nsos x 1]
 };
 
 // initialize internal objects/arrays
@@ -79,6 +84,8 @@ void IIRFILT(_init)(IIRFILT() _q)
     _q->v    = NULL;
     _q->qsos = NULL;
     _q->nsos = 0;
+    _q->sos_coeff = NULL;
+    _q->sos_state = NULL;
 #if LIQUID_IIRFILT_USE_DOTPROD
     _q->dpb  = NULL;
     _q->dpa  = NULL;
@@ -196,6 +203,21 @@ IIRFILT() IIRFILT(_create_sos)(TC *         _B,
         q->qsos[i] = IIRFILTSOS(_create)(bt,at);
         //q->qsos[i] = IIRFILT(_create)(q->b+3*i,3,q->a+3*i,3);
     }
+
+    // store normalized section coefficients contiguously for fused cascade
+    q->sos_coeff = (TC *) malloc(5*(q->nsos)*sizeof(TC));
+    q->sos_state = (TO *) malloc(2*(q->nsos)*sizeof(TO));
+    for (i=0; i<q->nsos; i++) {
+        TC a0 = q->a[3*i+0];
+        q->sos_coeff[5*i+0] = q->b[3*i+0] / a0;
+        q->sos_coeff[5*i+1] = q->b[3*i+1] / a0;
+        q->sos_coeff[5*i+2] = q->b[3*i+2] / a0;
+        q->sos_coeff[5*i+3] = q->a[3*i+1] / a0;
+        q->sos_coeff[5*i+4] = q->a[3*i+2] / a0;
+    }
+
+    // reset internal state and return object
+    IIRFILT(_reset)(q);
     return q;
 }
 
@@ -441,6 +463,8 @@ void IIRFILT(_destroy)(IIRFILT() _q)
     if (_q->b   != NULL) free(_q->b);
     if (_q->a   != NULL) free(_q->a);
     if (_q->v   != NULL) free(_q->v);
+    if (_q->sos_coeff != NULL) free(_q->sos_coeff);
+    if (_q->sos_state != NULL) free(_q->sos_state);
 
     // if filter is comprised of cascaded second-order sections,
     // delete sub-filters separately
@@ -495,6 +519,10 @@ void IIRFILT(_reset)(IIRFILT() _q)
         for (i=0; i<_q->nsos; i++) {
             IIRFILTSOS(_reset)(_q->qsos[i]);
         }
+
+        // clear fused cascade state
+        for (i=0; i<2*_q->nsos; i++)
+            _q->sos_state[i] = 0;
     } else {
         // set internal buffer to zero
         for (i=0; i<_q->n; i++)
@@ -551,17 +579,59 @@ void IIRFILT(_execute_sos)(IIRFILT() _q,
                            TI        _x,
                            TO *      _y)
 {
-    TI t0 = _x;     // intermediate input
-    TO t1 = 0.;     // intermediate output
+    TO t = _x;      // intermediate input/output
+    TO y;
     unsigned int i;
     for (i=0; i<_q->nsos; i++) {
-        // run each filter separately
-        IIRFILTSOS(_execute)(_q->qsos[i], t0, &t1);
+        TC * c = _q->sos_coeff + 5*i;
+        TO * w = _q->sos_state + 2*i;
+
+        // transposed direct form II; output for section n becomes
+        // input to section n+1
+        y    = c[0]*t + w[0];
+        w[0] = c[1]*t - c[3]*y + w[1];
+        w[1] = c[2]*t - c[4]*y;
+        t    = y;
+    }
+    *_y = t;
+}
 
-        // output for filter n becomes input to filter n+1
-        t0 = t1;
+// execute iir filter using second-order sections form on a block of
+// samples, running each section over the entire block before moving
+// on to the next so that its coefficients and state remain in
+// registers; the input and output buffers may be the same
+//  _q      :   iirfilt object
+//  _x      :   pointer to input array [size: _n x 1]
+//  _n      :   number of input, output samples
+//  _y      :   pointer to output array [size: _n x 1]
+void IIRFILT(_execute_block_sos)(IIRFILT()    _q,
+                                 TI *         _x,
+                                 unsigned int _n,
+                                 TO *         _y)
+{
+    unsigned int i, k;
+    for (i=0; i<_q->nsos; i++) {
+        TC b0 = _q->sos_coeff[5*i+0];
+        TC b1 = _q->sos_coeff[5*i+1];
+        TC b2 = _q->sos_coeff[5*i+2];
+        TC a1 = _q->sos_coeff[5*i+3];
+        TC a2 = _q->sos_coeff[5*i+4];
+        TO w0 = _q->sos_state[2*i+0];
+        TO w1 = _q->sos_state[2*i+1];
+
+        for (k=0; k<_n; k++) {
+            // first section reads from input, the rest operate in place
+            TO t = (i == 0) ? _x[k] : _y[k];
+            TO y = b0*t + w0;
+            w0   = b1*t - a1*y + w1;
+            w1   = b2*t - a2*y;
+            _y[k] = y;
+        }
+
+        // save state
+        _q->sos_state[2*i+0] = w0;
+        _q->sos_state[2*i+1] = w1;
     }
-    *_y = t1;
 }
 
 // execute iir filter, switching to type-specific function
@@ -589,6 +659,11 @@ void IIRFILT(_execute_block)(IIRFILT()    _q,
                              unsigned int _n,
                              TO *         _y)
 {
+    if (_q->type == IIRFILT_TYPE_SOS) {
+        IIRFILT(_execute_block_sos)(_q, _x, _n, _y);
+        return;
+    }
+
     unsigned int i;
     for (i=0; i<_n; i++)
         // compute output sample
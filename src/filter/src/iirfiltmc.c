@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Multi-channel infinite impulse response filter (cascaded
+// second-order sections)
+//
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+
+// defined:
+//  IIRFILTMC()     name-mangling macro
+//  TO              output type
+//  TC              coefficients type
+//  TI              input type
+//  PRINTVAL()      print macro(s)
+
+struct IIRFILTMC(_s) {
+    unsigned int nsos;          // number of second-order sections
+    unsigned int num_channels;  // number of channels
+
+    // normalized coefficients {b0,b1,b2,a1,a2} per section [size: 5*nsos x 1]
+    TC * coeff;
+
+    // transposed direct form II state for each section; all channels
+    // for a given section are stored contiguously so that each section
+    // update runs across channels in lanes
+    TO * w0;                    // [size: nsos*num_channels x 1]
+    TO * w1;                    // [size: nsos*num_channels x 1]
+};
+
+// create multi-channel iirfilt object from second-order sections
+//  _B              :   feed-forward coefficients [size: _nsos x 3]
+//  _A              :   feed-back coefficients    [size: _nsos x 3]
+//  _nsos           :   number of second-order sections
+//  _num_channels   :   number of channels
+IIRFILTMC() IIRFILTMC(_create_sos)(TC *         _B,
+                                   TC *         _A,
+                                   unsigned int _nsos,
+                                   unsigned int _num_channels)
+{
+    // validate input
+    if (_nsos == 0) {
+        fprintf(stderr,"error: iirfiltmc_%s_create_sos(), filter must have at least one 2nd-order section\n", EXTENSION_FULL);
+        exit(1);
+    } else if (_num_channels == 0) {
+        fprintf(stderr,"error: iirfiltmc_%s_create_sos(), number of channels must be greater than zero\n", EXTENSION_FULL);
+        exit(1);
+    }
+
+    // create structure and initialize
+    IIRFILTMC() q = (IIRFILTMC()) malloc(sizeof(struct IIRFILTMC(_s)));
+    q->nsos         = _nsos;
+    q->num_channels = _num_channels;
+
+    // normalize and store coefficients contiguously
+    q->coeff = (TC *) malloc(5*q->nsos*sizeof(TC));
+    unsigned int i;
+    for (i=0; i<q->nsos; i++) {
+        TC a0 = _A[3*i+0];
+        q->coeff[5*i+0] = _B[3*i+0] / a0;
+        q->coeff[5*i+1] = _B[3*i+1] / a0;
+        q->coeff[5*i+2] = _B[3*i+2] / a0;
+        q->coeff[5*i+3] = _A[3*i+1] / a0;
+        q->coeff[5*i+4] = _A[3*i+2] / a0;
+    }
+
+    // allocate state
+    q->w0 = (TO *) malloc(q->nsos*q->num_channels*sizeof(TO));
+    q->w1 = (TO *) malloc(q->nsos*q->num_channels*sizeof(TO));
+
+    // reset internal state and return object
+    IIRFILTMC(_reset)(q);
+    return q;
+}
+
+// create multi-channel iirfilt object from prototype
+//  _ftype          :   filter type (e.g. LIQUID_IIRDES_BUTTER)
+//  _btype          :   band type (e.g. LIQUID_IIRDES_BANDPASS)
+//  _order          :   filter order
+//  _fc             :   low-pass prototype cut-off frequency
+//  _f0             :   center frequency (band-pass, band-stop)
+//  _Ap             :   pass-band ripple in dB
+//  _As             :   stop-band ripple in dB
+//  _num_channels   :   number of channels
+IIRFILTMC() IIRFILTMC(_create_prototype)(liquid_iirdes_filtertype _ftype,
+                                         liquid_iirdes_bandtype   _btype,
+                                         unsigned int             _order,
+                                         float                    _fc,
+                                         float                    _f0,
+                                         float                    _Ap,
+                                         float                    _As,
+                                         unsigned int             _num_channels)
+{
+    // derived values : compute number of second-order sections; order
+    // effectively doubles for band-pass, band-stop filters
+    unsigned int N = _order;
+    if (_btype == LIQUID_IIRDES_BANDPASS ||
+        _btype == LIQUID_IIRDES_BANDSTOP)
+    {
+        N *= 2;
+    }
+    unsigned int r = N%2;       // odd/even order
+    unsigned int L = (N-r)/2;   // filter semi-length
+
+    // design filter (compute coefficients)
+    unsigned int h_len = 3*(L+r);
+    float B[h_len];
+    float A[h_len];
+    liquid_iirdes(_ftype, _btype, LIQUID_IIRDES_SOS, _order, _fc, _f0, _Ap, _As, B, A);
+
+    // move coefficients to type-specific arrays (e.g. float complex)
+    TC Bc[h_len];
+    TC Ac[h_len];
+    unsigned int i;
+    for (i=0; i<h_len; i++) {
+        Bc[i] = B[i];
+        Ac[i] = A[i];
+    }
+
+    // create and return filter object
+    return IIRFILTMC(_create_sos)(Bc, Ac, L+r, _num_channels);
+}
+
+// destroy iirfiltmc object, freeing all internal memory
+void IIRFILTMC(_destroy)(IIRFILTMC() _q)
+{
+    free(_q->coeff);
+    free(_q->w0);
+    free(_q->w1);
+    free(_q);
+}
+
+// print iirfiltmc object properties to stdout
+void IIRFILTMC(_print)(IIRFILTMC() _q)
+{
+    printf("iir filter [multi-channel, sos]: %u channels\n", _q->num_channels);
+    unsigned int i;
+    for (i=0; i<_q->nsos; i++) {
+        printf("  b : ");
+        PRINTVAL_TC(_q->coeff[5*i+0],%12.8f); printf(",");
+        PRINTVAL_TC(_q->coeff[5*i+1],%12.8f); printf(",");
+        PRINTVAL_TC(_q->coeff[5*i+2],%12.8f); printf("\n");
+
+        printf("  a : ");
+        PRINTVAL_TC(_q->coeff[5*i+3],%12.8f); printf(",");
+        PRINTVAL_TC(_q->coeff[5*i+4],%12.8f); printf("\n");
+    }
+}
+
+// clear/reset iirfiltmc object internals
+void IIRFILTMC(_reset)(IIRFILTMC() _q)
+{
+    unsigned int i;
+    for (i=0; i<_q->nsos*_q->num_channels; i++) {
+        _q->w0[i] = 0;
+        _q->w1[i] = 0;
+    }
+}
+
+// get number of channels
+unsigned int IIRFILTMC(_get_num_channels)(IIRFILTMC() _q)
+{
+    return _q->num_channels;
+}
+
+// compute filter output for one sample on each channel
+//  _q      : iirfiltmc object
+//  _x      : input samples [size: num_channels x 1]
+//  _y      : output samples [size: num_channels x 1]
+void IIRFILTMC(_execute)(IIRFILTMC() _q,
+                         TI *        _x,
+                         TO *        _y)
+{
+    IIRFILTMC(_execute_block)(_q, _x, 1, _y);
+}
+
+// execute filter on a block of channel-interleaved samples; each
+// section is applied to all channels in a single pass (channels in
+// lanes) before moving to the next section, keeping one sample's worth
+// of intermediate values in the output row; in-place operation is
+// permitted
+//  _q      : iirfiltmc object
+//  _x      : input array [size: _n*num_channels x 1]
+//  _n      : number of samples per channel
+//  _y      : output array [size: _n*num_channels x 1]
+void IIRFILTMC(_execute_block)(IIRFILTMC()  _q,
+                               TI *         _x,
+                               unsigned int _n,
+                               TO *         _y)
+{
+    unsigned int C = _q->num_channels;
+    unsigned int i, s, c;
+    for (i=0; i<_n; i++) {
+        TI * x = _x + i*C;
+        TO * y = _y + i*C;
+
+        // copy input row to output; sections then operate in place
+        for (c=0; c<C; c++)
+            y[c] = x[c];
+
+        for (s=0; s<_q->nsos; s++) {
+            TC b0 = _q->coeff[5*s+0];
+            TC b1 = _q->coeff[5*s+1];
+            TC b2 = _q->coeff[5*s+2];
+            TC a1 = _q->coeff[5*s+3];
+            TC a2 = _q->coeff[5*s+4];
+            TO * w0 = _q->w0 + s*C;
+            TO * w1 = _q->w1 + s*C;
+            for (c=0; c<C; c++) {
+                TO v  = y[c];
+                TO yc = b0*v + w0[c];
+                w0[c] = b1*v - a1*yc + w1[c];
+                w1[c] = b2*v - a2*yc;
+                y[c]  = yc;
+            }
+        }
+    }
+}
@@ -31,6 +31,9 @@
 
 #include "liquid.internal.h"
 
+// nominal number of samples at the high rate processed per block stage
+#define MSRESAMP2_BLOCK_LEN (1024)
+
 // 
 // forward declaration of internal methods
 //
@@ -52,8 +55,14 @@ struct MSRESAMP2(_s) {
     float *         As_stage;   // stop-band attenuation for each stage
     unsigned int *  m_stage;    // filter semi-length for each stage
     RESAMP2() *     resamp2;    // array of half-band resamplers
-    T *             buffer0;    // buffer[0]
-    T *             buffer1;    // buffer[1]
+
+    // scratch arena holding intermediate stage outputs, split into two
+    // halves; scratch_len is a multiple of M so a block of high-rate
+    // samples always maps onto a whole number of low-rate samples
+    T *             scratch;    // scratch arena [size: scratch_len x 1]
+    unsigned int    scratch_len;// arena length: max(M, MSRESAMP2_BLOCK_LEN)
+    T *             buffer0;    // buffer[0], first half of arena
+    T *             buffer1;    // buffer[1], second half of arena
     unsigned int    buffer_index;  // index of buffer
     float           zeta;       // scaling factor
 };
@@ -74,6 +83,26 @@ void MSRESAMP2(_decim_execute)(MSRESAMP2() _q,
                                TI *        _x,
                                TO *        _y);
 
+// execute multi-stage resampler as interpolator on a block
+//  _q      : msresamp object
+//  _x      : input sample array  [size: _n x 1]
+//  _n      : number of input samples
+//  _y      : output sample array [size: _n*2^_num_stages x 1]
+void MSRESAMP2(_interp_execute_block)(MSRESAMP2()  _q,
+                                      TI *         _x,
+                                      unsigned int _n,
+                                      TO *         _y);
+
+// execute multi-stage resampler as decimator on a block
+//  _q      : msresamp object
+//  _x      : input sample array  [size: _n*2^_num_stages x 1]
+//  _n      : number of output samples
+//  _y      : output sample array [size: _n x 1]
+void MSRESAMP2(_decim_execute_block)(MSRESAMP2()  _q,
+                                     TI *         _x,
+                                     unsigned int _n,
+                                     TO *         _y);
+
 // create multi-stage half-band resampler
 //  _type       : resampler type (e.g. LIQUID_RESAMP_DECIM)
 //  _num_stages : number of resampling stages
@@ -124,9 +153,12 @@ MSRESAMP2() MSRESAMP2(_create)(int          _type,
     q->M    = 1 << q->num_stages;
     q->zeta = 1.0f / (float)(q->M);
 
-    // allocate memory for buffers
-    q->buffer0 = (T*) malloc( q->M * sizeof(T) );
-    q->buffer1 = (T*) malloc( q->M * sizeof(T) );
+    // allocate scratch arena; each half holds at least M/2 samples as
+    // needed by the single-sample methods
+    q->scratch_len = q->M > MSRESAMP2_BLOCK_LEN ? q->M : MSRESAMP2_BLOCK_LEN;
+    q->scratch = (T*) malloc( q->scratch_len * sizeof(T) );
+    q->buffer0 = q->scratch;
+    q->buffer1 = q->scratch + q->scratch_len/2;
 
     // allocate arrays for half-band resampler parameters
     q->fc_stage = (float*)        malloc(q->num_stages*sizeof(float)       );
@@ -173,9 +205,8 @@ MSRESAMP2() MSRESAMP2(_create)(int          _type,
 // destroy msresamp2 object, freeing all internally-allocated memory
 void MSRESAMP2(_destroy)(MSRESAMP2() _q)
 {
-    // free buffers
-    free(_q->buffer0);
-    free(_q->buffer1);
+    // free scratch arena
+    free(_q->scratch);
 
     // free half-band resampler design parameter arrays
     free(_q->fc_stage);
@@ -303,6 +334,29 @@ void MSRESAMP2(_execute)(MSRESAMP2() _q,
     }
 }
 
+// execute multi-stage resampler on a block of samples
+//  _q      : msresamp object
+//  _x      : input sample array
+//  _n      : number of calls to _execute() equivalent to this block
+//  _y      : output sample array
+void MSRESAMP2(_execute_block)(MSRESAMP2()  _q,
+                               TI *         _x,
+                               unsigned int _n,
+                               TO *         _y)
+{
+    // switch resampling method based on type
+    if (_q->num_stages == 0) {
+        // pass through
+        memmove(_y, _x, _n*sizeof(TI));
+    } else if (_q->type == LIQUID_RESAMP_INTERP) {
+        // execute multi-stage resampler as interpolator
+        MSRESAMP2(_interp_execute_block)(_q, _x, _n, _y);
+    } else {
+        // execute multi-stage resampler as decimator
+        MSRESAMP2(_decim_execute_block)(_q, _x, _n, _y);
+    }
+}
+
 //
 // internal methods
 //
@@ -376,3 +430,81 @@ void MSRESAMP2(_decim_execute)(MSRESAMP2() _q,
     *_y = b0[0] * _q->zeta;
 }
 
+
+// execute multi-stage resampler as interpolator on a block
+//  _q      : msresamp object
+//  _x      : input sample array  [size: _n x 1]
+//  _n      : number of input samples
+//  _y      : output sample array [size: _n*2^_num_stages x 1]
+void MSRESAMP2(_interp_execute_block)(MSRESAMP2()  _q,
+                                      TI *         _x,
+                                      unsigned int _n,
+                                      TO *         _y)
+{
+    // maximum number of input samples per block
+    unsigned int n_max = _q->scratch_len / _q->M;
+
+    while (_n > 0) {
+        unsigned int n = _n < n_max ? _n : n_max;
+
+        // run each stage over the entire block, alternating between arena
+        // halves and writing the final stage directly to the output
+        T * b0 = _x;
+        T * b1 = _q->buffer0;
+        unsigned int s;
+        for (s=0; s<_q->num_stages; s++) {
+            if (s == _q->num_stages-1)
+                b1 = _y;
+
+            RESAMP2(_interp_execute_block)(_q->resamp2[s], b0, n << s, b1);
+
+            b0 = b1;
+            b1 = (b1 == _q->buffer0) ? _q->buffer1 : _q->buffer0;
+        }
+
+        _x += n;
+        _y += n*_q->M;
+        _n -= n;
+    }
+}
+
+// execute multi-stage resampler as decimator on a block
+//  _q      : msresamp object
+//  _x      : input sample array  [size: _n*2^_num_stages x 1]
+//  _n      : number of output samples
+//  _y      : output sample array [size: _n x 1]
+void MSRESAMP2(_decim_execute_block)(MSRESAMP2()  _q,
+                                     TI *         _x,
+                                     unsigned int _n,
+                                     TO *         _y)
+{
+    // maximum number of output samples per block
+    unsigned int n_max = _q->scratch_len / _q->M;
+
+    while (_n > 0) {
+        unsigned int n = _n < n_max ? _n : n_max;
+
+        // run each stage over the entire block; half-band decimation can
+        // operate in place, so all intermediate stages share one buffer
+        T * b0 = _x;
+        T * b1 = _q->scratch;
+        unsigned int s;
+        for (s=0; s<_q->num_stages; s++) {
+            unsigned int g = _q->num_stages-s-1;    // reversed resampler index
+            if (s == _q->num_stages-1)
+                b1 = _y;
+
+            RESAMP2(_decim_execute_block)(_q->resamp2[g], b0, n << g, b1);
+            b0 = b1;
+        }
+
+        // scale output appropriately
+        unsigned int i;
+        for (i=0; i<n; i++)
+            _y[i] *= _q->zeta;
+
+        _x += n*_q->M;
+        _y += n;
+        _n -= n;
+    }
+}
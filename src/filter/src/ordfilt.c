@@ -35,13 +35,27 @@
 //  DOTPROD()       dotprod macro
 //  PRINTVAL()      print macro
 
-#define LIQUID_ORDFILT_USE_WINDOW 1
+#define LIQUID_ORDFILT_USE_WINDOW 0
 
 #if LIQUID_ORDFILT_USE_WINDOW
 int ordfilt_sort_compf(const void * _v1, const void * _v2)
 {
     return *(float*)_v1 > *(float*)_v2 ? 1 : -1;
 }
+#else
+// swap two heap entries, tracking buffer positions
+//  _q      : filter object
+//  _i      : first heap entry
+//  _j      : second heap entry
+void ORDFILT(_heap_swap)(ORDFILT()    _q,
+                         unsigned int _i,
+                         unsigned int _j);
+
+// restore heap property for entry displaced by a new value
+//  _q      : filter object
+//  _i      : heap entry
+void ORDFILT(_heap_sift)(ORDFILT()    _q,
+                         unsigned int _i);
 #endif
 
 // ordfilt object structure
@@ -53,9 +67,15 @@ struct ORDFILT(_s) {
     WINDOW()        buf;        // input buffer
     TI *            buf_sorted; // input buffer (sorted)
 #else
-    // trickier to implement but faster
-    TI *            buf;        // input buffer
-    uint16_t *      buf_index;  // buffer index of sorted values
+    // trickier to implement but faster: the buffer is partitioned into
+    // its k+1 smallest values (max-heap, entries 0..k) and the remainder
+    // (min-heap, entries k+1..n-1), so the order statistic is the root
+    // of the first heap; each input replaces the oldest sample in place
+    // and the heaps are restored in O(log n)
+    TI *            buf;        // input buffer (circular) [size: n x 1]
+    unsigned int    buf_index;  // index of oldest sample in buffer
+    unsigned int *  heap;       // buffer index of each heap entry [size: n x 1]
+    unsigned int *  heap_pos;   // heap entry of each buffer index [size: n x 1]
 #endif
 };
 
@@ -85,6 +105,10 @@ ORDFILT() ORDFILT(_create)(unsigned int _n,
     q->buf        = WINDOW(_create)(q->n);
     q->buf_sorted = (TI*) malloc(q->n * sizeof(TI));
 #else
+    // create circular buffer and heaps
+    q->buf      = (TI*)           malloc(q->n * sizeof(TI));
+    q->heap     = (unsigned int*) malloc(q->n * sizeof(unsigned int));
+    q->heap_pos = (unsigned int*) malloc(q->n * sizeof(unsigned int));
 #endif
 
     // reset filter state (clear buffer)
@@ -106,6 +130,9 @@ void ORDFILT(_destroy)(ORDFILT() _q)
     WINDOW(_destroy)(_q->buf);
     free(_q->buf_sorted);
 #else
+    free(_q->buf);
+    free(_q->heap);
+    free(_q->heap_pos);
 #endif
     free(_q);
 }
@@ -116,6 +143,14 @@ void ORDFILT(_reset)(ORDFILT() _q)
 #if LIQUID_ORDFILT_USE_WINDOW
     WINDOW(_reset)(_q->buf);
 #else
+    // all-zero buffer satisfies both heaps in natural order
+    unsigned int i;
+    for (i=0; i<_q->n; i++) {
+        _q->buf[i]      = 0;
+        _q->heap[i]     = i;
+        _q->heap_pos[i] = i;
+    }
+    _q->buf_index = 0;
 #endif
 }
 
@@ -134,6 +169,19 @@ void ORDFILT(_push)(ORDFILT() _q,
 #if LIQUID_ORDFILT_USE_WINDOW
     WINDOW(_push)(_q->buf, _x);
 #else
+    // replace oldest sample and restore its heap
+    unsigned int b = _q->buf_index;
+    _q->buf[b] = _x;
+    _q->buf_index = (b + 1 == _q->n) ? 0 : b + 1;
+    ORDFILT(_heap_sift)(_q, _q->heap_pos[b]);
+
+    // new value may belong to the other heap: exchange roots
+    unsigned int o = _q->k + 1;
+    if (o < _q->n && _q->buf[_q->heap[0]] > _q->buf[_q->heap[o]]) {
+        ORDFILT(_heap_swap)(_q, 0, o);
+        ORDFILT(_heap_sift)(_q, 0);
+        ORDFILT(_heap_sift)(_q, o);
+    }
 #endif
 }
 
@@ -148,6 +196,9 @@ void ORDFILT(_write)(ORDFILT()    _q,
 #if LIQUID_ORDFILT_USE_WINDOW
     WINDOW(_write)(_q->buf, _x, _n);
 #else
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        ORDFILT(_push)(_q, _x[i]);
 #endif
 }
 
@@ -172,6 +223,8 @@ void ORDFILT(_execute)(ORDFILT() _q,
     // save output
     *_y = _q->buf_sorted[_q->k];
 #else
+    // order statistic is root of max-heap
+    *_y = _q->buf[_q->heap[0]];
 #endif
 }
 
@@ -196,3 +249,58 @@ void ORDFILT(_execute_block)(ORDFILT()    _q,
     }
 }
 
+
+#if !LIQUID_ORDFILT_USE_WINDOW
+// swap two heap entries, tracking buffer positions
+//  _q      : filter object
+//  _i      : first heap entry
+//  _j      : second heap entry
+void ORDFILT(_heap_swap)(ORDFILT()    _q,
+                         unsigned int _i,
+                         unsigned int _j)
+{
+    unsigned int bi = _q->heap[_i];
+    unsigned int bj = _q->heap[_j];
+    _q->heap[_i] = bj;
+    _q->heap[_j] = bi;
+    _q->heap_pos[bj] = _i;
+    _q->heap_pos[bi] = _j;
+}
+
+// restore heap property for entry displaced by a new value: sift
+// toward the root while out of order with the parent, otherwise
+// toward the leaves
+//  _q      : filter object
+//  _i      : heap entry
+void ORDFILT(_heap_sift)(ORDFILT()    _q,
+                         unsigned int _i)
+{
+    // select heap: max-heap at [0,k], min-heap at [k+1,n-1]; map entry
+    // onto local index j and flip sign of comparisons for the min-heap
+    unsigned int o   = _i <= _q->k ? 0 : _q->k + 1;
+    unsigned int len = _i <= _q->k ? _q->k + 1 : _q->n - _q->k - 1;
+    TI           s   = _i <= _q->k ? 1 : -1;
+    unsigned int * h = _q->heap + o;
+    TI *           v = _q->buf;
+    unsigned int j = _i - o;
+
+    // sift up
+    while (j > 0 && s*v[h[(j-1)/2]] < s*v[h[j]]) {
+        ORDFILT(_heap_swap)(_q, o+j, o+(j-1)/2);
+        j = (j-1)/2;
+    }
+
+    // sift down
+    while (1) {
+        unsigned int c = 2*j + 1;
+        if (c >= len)
+            break;
+        if (c+1 < len && s*v[h[c+1]] > s*v[h[c]])
+            c++;
+        if (s*v[h[c]] <= s*v[h[j]])
+            break;
+        ORDFILT(_heap_swap)(_q, o+j, o+c);
+        j = c;
+    }
+}
+#endif
@@ -31,6 +31,12 @@
 
 #define DEBUG_RESAMP_PRINT  0
 
+// number of input samples buffered linearly before shifting history
+#define RESAMP_BUFFER_LEN   (256)
+
+// maximum number of output samples scheduled at a time
+#define RESAMP_SCHEDULE_LEN (256)
+
 // main object
 struct RESAMP(_s) {
     // filter design parameters
@@ -43,7 +49,22 @@ struct RESAMP(_s) {
     uint32_t        step;   // step size (quantized resampling rate)
     uint32_t        phase;  // sampling phase
     unsigned int    npfb;   // 256
-    FIRPFB()        pfb;    // filter bank
+
+    // polyphase filter bank
+    unsigned int    h_sub_len;  // length of each sub-filter
+    DOTPROD() *     dp;         // sub-filter dot products [size: npfb x 1]
+
+    // linear input buffer: the most recent h_sub_len-1 samples of
+    // history followed by up to RESAMP_BUFFER_LEN new samples, so
+    // each output can be computed directly on contiguous memory
+    TI *            buf;        // [size: h_sub_len-1+RESAMP_BUFFER_LEN x 1]
+    unsigned int    buf_index;  // number of samples currently in buffer
+
+    // output schedule: buffer position and filter index of each
+    // output, computed from the phase accumulator ahead of the
+    // dot products
+    unsigned int    sched_pos  [RESAMP_SCHEDULE_LEN];
+    unsigned int    sched_index[RESAMP_SCHEDULE_LEN];
 };
 
 // create arbitrary resampler
@@ -107,7 +128,20 @@ RESAMP() RESAMP(_create)(float        _rate,
     // copy to type-specific array, applying gain
     for (i=0; i<n; i++)
         h[i] = hf[i]*gain;
-    q->pfb = FIRPFB(_create)(q->npfb,h,n-1);
+
+    // generate bank of sub-sampled filters, each loaded in reverse order
+    q->h_sub_len = (n-1) / q->npfb;
+    q->dp = (DOTPROD()*) malloc((q->npfb)*sizeof(DOTPROD()));
+    TC h_sub[q->h_sub_len];
+    unsigned int k;
+    for (i=0; i<q->npfb; i++) {
+        for (k=0; k<q->h_sub_len; k++)
+            h_sub[q->h_sub_len-k-1] = h[i + k*(q->npfb)];
+        q->dp[i] = DOTPROD(_create)(h_sub, q->h_sub_len);
+    }
+
+    // allocate linear input buffer
+    q->buf = (TI*) malloc((q->h_sub_len - 1 + RESAMP_BUFFER_LEN)*sizeof(TI));
 
     // reset object and return
     RESAMP(_reset)(q);
@@ -142,7 +176,13 @@ RESAMP() RESAMP(_create_default)(float _rate)
 void RESAMP(_destroy)(RESAMP() _q)
 {
     // free polyphase filterbank
-    FIRPFB(_destroy)(_q->pfb);
+    unsigned int i;
+    for (i=0; i<_q->npfb; i++)
+        DOTPROD(_destroy)(_q->dp[i]);
+    free(_q->dp);
+
+    // free input buffer
+    free(_q->buf);
 
     // free main object memory
     free(_q);
@@ -152,14 +192,15 @@ void RESAMP(_destroy)(RESAMP() _q)
 void RESAMP(_print)(RESAMP() _q)
 {
     printf("resampler [rate: %f]\n", _q->r);
-    FIRPFB(_print)(_q->pfb);
+    printf("  filter bank   : %u x %u\n", _q->npfb, _q->h_sub_len);
 }
 
 // reset resampler object
 void RESAMP(_reset)(RESAMP() _q)
 {
-    // clear filterbank
-    FIRPFB(_reset)(_q->pfb);
+    // clear input buffer, leaving h_sub_len-1 samples of zero history
+    _q->buf_index = _q->h_sub_len - 1;
+    memset(_q->buf, 0x00, (_q->buf_index)*sizeof(TI));
 
     // reset state
     _q->phase = 0;
@@ -251,23 +292,7 @@ void RESAMP(_execute)(RESAMP()       _q,
                       TO *           _y,
                       unsigned int * _num_written)
 {
-    // push input
-    FIRPFB(_push)(_q->pfb, _x);
-
-    // continue to produce output
-    unsigned int n=0;
-    while (_q->phase <= 0x00ffffff) {
-        //unsigned int index = (_q->phase + 0x00008000) >> 16;
-        unsigned int index = _q->phase >> 16; // round down
-        FIRPFB(_execute)(_q->pfb, index, &_y[n++]);
-        _q->phase += _q->step;
-    }
-
-    // decrement filter-bank index by output rate
-    _q->phase -= (1<<24);
-
-    // error checking for now
-    *_num_written = n;
+    RESAMP(_execute_block)(_q, &_x, 1, _y, _num_written);
 }
 
 // execute arbitrary resampler on a block of samples
@@ -282,20 +307,52 @@ void RESAMP(_execute_block)(RESAMP()       _q,
                             TO *           _y,
                             unsigned int * _ny)
 {
-    // initialize number of output samples to zero
+    unsigned int h_sub_len = _q->h_sub_len;
     unsigned int ny = 0;
-
-    // number of samples written for each individual iteration
-    unsigned int num_written;
-
-    // iterate over each input sample
-    unsigned int i;
-    for (i=0; i<_nx; i++) {
-        // run resampler on single input
-        RESAMP(_execute)(_q, _x[i], &_y[ny], &num_written);
-
-        // update output counter
-        ny += num_written;
+    unsigned int i, k;
+
+    while (_nx > 0) {
+        // shift history to front of buffer if it is full
+        if (_q->buf_index == h_sub_len - 1 + RESAMP_BUFFER_LEN) {
+            memmove(_q->buf, _q->buf + RESAMP_BUFFER_LEN, (h_sub_len-1)*sizeof(TI));
+            _q->buf_index = h_sub_len - 1;
+        }
+
+        // copy as many input samples as will fit into the buffer
+        unsigned int n = h_sub_len - 1 + RESAMP_BUFFER_LEN - _q->buf_index;
+        n = n < _nx ? n : _nx;
+        memmove(_q->buf + _q->buf_index, _x, n*sizeof(TI));
+
+        // run phase accumulator over new samples: each scheduled output
+        // records the start of its input window and its filter index
+        unsigned int pos     = _q->buf_index + 1 - h_sub_len;
+        unsigned int pos_end = pos + n;
+        while (pos < pos_end) {
+            unsigned int num_sched = 0;
+            while (pos < pos_end && num_sched < RESAMP_SCHEDULE_LEN) {
+                if (_q->phase <= 0x00ffffff) {
+                    _q->sched_pos  [num_sched] = pos;
+                    _q->sched_index[num_sched] = _q->phase >> 16; // round down
+                    num_sched++;
+                    _q->phase += _q->step;
+                } else {
+                    // decrement filter-bank index by output rate
+                    _q->phase -= (1<<24);
+                    pos++;
+                }
+            }
+
+            // compute scheduled outputs directly on buffer
+            for (k=0; k<num_sched; k++) {
+                i = _q->sched_index[k];
+                DOTPROD(_execute)(_q->dp[i], _q->buf + _q->sched_pos[k], &_y[ny++]);
+            }
+        }
+
+        // update counters
+        _q->buf_index += n;
+        _x            += n;
+        _nx           -= n;
     }
 
     // set return value for number of output samples written
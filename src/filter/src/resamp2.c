@@ -38,6 +38,9 @@
 //  DOTPROD()       dotprod macro
 //  PRINTVAL()      print macro
 
+// number of outputs per branch computed between block buffer refills
+#define RESAMP2_BLOCK_LEN   (256)
+
 struct RESAMP2(_s) {
     TC * h;                 // filter prototype
     unsigned int m;         // primitive filter length
@@ -56,8 +59,32 @@ struct RESAMP2(_s) {
 
     // halfband filter operation
     unsigned int toggle;
+
+    // block processing: the 2*m branch coefficients are symmetric (or
+    // conjugate-symmetric for complex coefficients) so each output only
+    // needs m multiplies; branch histories are copied from the windows
+    // into linear buffers so consecutive outputs share contiguous input
+    TC * hs;                // folded filter branch coefficients [size: m x 1]
+    TI * buf0;              // delay branch buffer  [size: 2*m-1+RESAMP2_BLOCK_LEN x 1]
+    TI * buf1;              // filter branch buffer [size: 2*m-1+RESAMP2_BLOCK_LEN x 1]
 };
 
+// compute filter branch outputs on a linear buffer using the folded
+// coefficients, output _k is written to _y[_k*_stride]
+//  _q      :   resamp2 object
+//  _x      :   input buffer [size: 2*m-1+_n x 1]
+//  _n      :   number of outputs
+//  _y      :   output array
+//  _stride :   output stride
+void RESAMP2(_dotprod_block)(RESAMP2()    _q,
+                             TI *         _x,
+                             unsigned int _n,
+                             TO *         _y,
+                             unsigned int _stride);
+
+// fold filter branch coefficients for block processing
+void RESAMP2(_fold_coefficients)(RESAMP2() _q);
+
 // create a resamp2 object
 //  _m      :   filter semi-length (effective length: 4*_m+1)
 //  _f0     :   center frequency of half-band filter
@@ -119,6 +146,14 @@ RESAMP2() RESAMP2(_create)(unsigned int _m,
     q->w0 = WINDOW(_create)(2*(q->m));
     q->w1 = WINDOW(_create)(2*(q->m));
 
+    // allocate block processing buffers
+    q->hs   = (TC *) malloc((q->m)*sizeof(TC));
+    q->buf0 = (TI *) malloc((2*q->m-1+RESAMP2_BLOCK_LEN)*sizeof(TI));
+    q->buf1 = (TI *) malloc((2*q->m-1+RESAMP2_BLOCK_LEN)*sizeof(TI));
+    memset(q->buf0, 0x00, (2*q->m-1+RESAMP2_BLOCK_LEN)*sizeof(TI));
+    memset(q->buf1, 0x00, (2*q->m-1+RESAMP2_BLOCK_LEN)*sizeof(TI));
+    RESAMP2(_fold_coefficients)(q);
+
     RESAMP2(_reset)(q);
 
     return q;
@@ -165,6 +200,7 @@ RESAMP2() RESAMP2(_recreate)(RESAMP2()    _q,
 
         // create dotprod object
         _q->dp = DOTPROD(_recreate)(_q->dp, _q->h1, 2*_q->m);
+        RESAMP2(_fold_coefficients)(_q);
     }
     return _q;
 }
@@ -182,6 +218,9 @@ void RESAMP2(_destroy)(RESAMP2() _q)
     // free arrays
     free(_q->h);
     free(_q->h1);
+    free(_q->hs);
+    free(_q->buf0);
+    free(_q->buf1);
 
     // free main object memory
     free(_q);
@@ -360,3 +399,158 @@ void RESAMP2(_interp_execute)(RESAMP2() _q,
     DOTPROD(_execute)(_q->dp, r, &_y[1]);
 }
 
+
+// execute half-band decimation on a block of samples
+//  _q      :   resamp2 object
+//  _x      :   input array [size: 2*_n x 1]
+//  _n      :   number of output samples
+//  _y      :   output array [size: _n x 1]
+void RESAMP2(_decim_execute_block)(RESAMP2()    _q,
+                                   TI *         _x,
+                                   unsigned int _n,
+                                   TO *         _y)
+{
+    unsigned int p = 2*_q->m - 1;   // history length
+    TI * r;                         // window read pointer
+    unsigned int i;
+
+    while (_n > 0) {
+        unsigned int n = _n < RESAMP2_BLOCK_LEN ? _n : RESAMP2_BLOCK_LEN;
+
+        // restore branch histories and de-interleave input
+        WINDOW(_read)(_q->w0, &r);
+        memmove(_q->buf0, r+1, p*sizeof(TI));
+        WINDOW(_read)(_q->w1, &r);
+        memmove(_q->buf1, r+1, p*sizeof(TI));
+        for (i=0; i<n; i++) {
+            _q->buf1[p+i] = _x[2*i+0];
+            _q->buf0[p+i] = _x[2*i+1];
+        }
+
+        // filter branch, then add delay branch
+        RESAMP2(_dotprod_block)(_q, _q->buf1, n, _y, 1);
+        for (i=0; i<n; i++)
+            _y[i] += _q->buf0[i + _q->m - 1];
+
+        // save branch histories
+        WINDOW(_write)(_q->w0, _q->buf0 + n - 1, p+1);
+        WINDOW(_write)(_q->w1, _q->buf1 + n - 1, p+1);
+
+        _x += 2*n;
+        _y += n;
+        _n -= n;
+    }
+}
+
+// execute half-band interpolation on a block of samples
+//  _q      :   resamp2 object
+//  _x      :   input array [size: _n x 1]
+//  _n      :   number of input samples
+//  _y      :   output array [size: 2*_n x 1]
+void RESAMP2(_interp_execute_block)(RESAMP2()    _q,
+                                    TI *         _x,
+                                    unsigned int _n,
+                                    TO *         _y)
+{
+    unsigned int p = 2*_q->m - 1;   // history length
+    TI * r;                         // window read pointer
+    unsigned int i;
+
+    while (_n > 0) {
+        unsigned int n = _n < RESAMP2_BLOCK_LEN ? _n : RESAMP2_BLOCK_LEN;
+
+        // both branches see the same input, but their histories may
+        // differ if the object was previously used for other methods
+        WINDOW(_read)(_q->w1, &r);
+        memmove(_q->buf1, r+1, p*sizeof(TI));
+        memmove(_q->buf1+p, _x, n*sizeof(TI));
+
+        // delay branch (even outputs): only the first m outputs reach
+        // back into the delay branch history
+        WINDOW(_read)(_q->w0, &r);
+        for (i=0; i<n; i++)
+            _y[2*i] = i < _q->m ? r[i + _q->m] : _x[i - _q->m];
+
+        // filter branch (odd outputs)
+        RESAMP2(_dotprod_block)(_q, _q->buf1, n, _y+1, 2);
+
+        // save branch histories (delay branch keeps its own history)
+        unsigned int k = n < p+1 ? n : p+1;
+        WINDOW(_write)(_q->w0, _x + n - k, k);
+        WINDOW(_write)(_q->w1, _q->buf1 + n - 1, p+1);
+
+        _x += n;
+        _y += 2*n;
+        _n -= n;
+    }
+}
+
+//
+// internal methods
+//
+
+// fold filter branch coefficients for block processing
+void RESAMP2(_fold_coefficients)(RESAMP2() _q)
+{
+    unsigned int p = 2*_q->m - 1;
+    unsigned int i;
+    for (i=0; i<_q->m; i++) {
+#if TC_COMPLEX == 1
+        // h1[i] = hr + j*hi, h1[p-i] = hr - j*hi
+        _q->hs[i] = 0.5f*(_q->h1[i] + conjf(_q->h1[p-i]));
+#else
+        _q->hs[i] = 0.5f*(_q->h1[i] + _q->h1[p-i]);
+#endif
+    }
+}
+
+// compute filter branch outputs on a linear buffer using the folded
+// coefficients, output _k is written to _y[_k*_stride]
+void RESAMP2(_dotprod_block)(RESAMP2()    _q,
+                             TI *         _x,
+                             unsigned int _n,
+                             TO *         _y,
+                             unsigned int _stride)
+{
+    unsigned int m = _q->m;
+    unsigned int p = 2*m - 1;
+    unsigned int i;
+    unsigned int j;
+
+#if TC_COMPLEX == 1
+    // h1[j]*a + h1[p-j]*b = hr*(a+b) + j*hi*(a-b)
+    for (i=0; i<_n; i++) {
+        TI * r = _x + i;
+        TO ya = 0;
+        TO yb = 0;
+        for (j=0; j<m; j++) {
+            ya += crealf(_q->hs[j]) * (r[j] + r[p-j]);
+            yb += cimagf(_q->hs[j]) * (r[j] - r[p-j]);
+        }
+        _y[i*_stride] = ya + (-cimagf(yb) + _Complex_I*crealf(yb));
+    }
+#else
+    // tap-major over the block: for each folded tap, consecutive outputs
+    // read consecutive samples from both halves of the window, so the
+    // inner loop maps directly onto vector registers; it is unrolled by
+    // four, and as RESAMP2_BLOCK_LEN is a multiple of four the trailing
+    // reads stay within the (zero-initialized) buffers
+    TO acc[RESAMP2_BLOCK_LEN];
+    unsigned int n4 = (_n + 3) & ~3u;
+    for (i=0; i<n4; i++)
+        acc[i] = 0;
+    for (j=0; j<m; j++) {
+        TC h = _q->hs[j];
+        TI * ra = _x + j;
+        TI * rb = _x + p - j;
+        for (i=0; i<n4; i+=4) {
+            acc[i+0] += h * (ra[i+0] + rb[i+0]);
+            acc[i+1] += h * (ra[i+1] + rb[i+1]);
+            acc[i+2] += h * (ra[i+2] + rb[i+2]);
+            acc[i+3] += h * (ra[i+3] + rb[i+3]);
+        }
+    }
+    for (i=0; i<_n; i++)
+        _y[i*_stride] = acc[i];
+#endif
+}
@@ -44,6 +44,9 @@
 #define DEBUG_SYMSYNC_FILENAME  "symsync_internal_debug.m"
 #define DEBUG_BUFFER_LEN        (1024)
 
+// number of input samples buffered per pass of the block method
+#define SYMSYNC_BLOCK_LEN       (256)
+
 //
 // forward declaration of internal methods
 //
@@ -58,6 +61,16 @@ void SYMSYNC(_step)(SYMSYNC()      _q,
                     TO *           _y,
                     unsigned int * _ny);
 
+// step synchronizer with input buffer ending at newest sample
+//  _q      : symsync object
+//  _r      : input buffer, oldest sample first [size: h_len x 1]
+//  _y      : output sample array pointer
+//  _ny     : number of output samples written
+void SYMSYNC(_step_buffer)(SYMSYNC()      _q,
+                           TI *           _r,
+                           TO *           _y,
+                           unsigned int * _ny);
+
 // advance synchronizer's internal loop filter
 //  _q      : synchronizer object
 //  _mf     : matched-filter output
@@ -102,6 +115,12 @@ struct SYMSYNC(_s) {
     FIRPFB()      mf;           // matched filter
     FIRPFB()     dmf;           // derivative matched filter
 
+    // input history shared by both filterbanks, evaluated on the same
+    // buffer so that each sample is buffered once; the block method
+    // copies history followed by input into a linear buffer
+    WINDOW()     w;             // input window [size: h_len x 1]
+    TI *         buf;           // block buffer [size: h_len-1+SYMSYNC_BLOCK_LEN]
+
 #if DEBUG_SYMSYNC
     windowf debug_rate;
     windowf debug_del;
@@ -175,6 +194,10 @@ SYMSYNC() SYMSYNC(_create)(unsigned int _k,
     q->mf  = FIRPFB(_create)(q->npfb, _h, _h_len);
     q->dmf = FIRPFB(_create)(q->npfb, dh, _h_len);
 
+    // create input buffers
+    q->w   = WINDOW(_create)(q->h_len);
+    q->buf = (TI*) malloc((q->h_len-1+SYMSYNC_BLOCK_LEN)*sizeof(TI));
+
     // reset state and initialize loop filter
     q->A[0] = 1.0f;     q->B[0] = 0.0f;
     q->A[1] = 0.0f;     q->B[1] = 0.0f;
@@ -311,6 +334,10 @@ void SYMSYNC(_destroy)(SYMSYNC() _q)
     FIRPFB(_destroy)(_q->mf);
     FIRPFB(_destroy)(_q->dmf);
 
+    // destroy input buffers
+    WINDOW(_destroy)(_q->w);
+    free(_q->buf);
+
     // destroy timing phase-locked loop filter
     iirfiltsos_rrrf_destroy(_q->pll);
 
@@ -328,8 +355,9 @@ void SYMSYNC(_print)(SYMSYNC() _q)
 // reset symsync internal state
 void SYMSYNC(_reset)(SYMSYNC() _q)
 {
-    // reset polyphase filterbank
+    // reset polyphase filterbank and input window
     FIRPFB(_reset)(_q->mf);
+    WINDOW(_reset)(_q->w);
 
     // reset counters, etc.
     _q->rate          = (float)_q->k / (float)_q->k_out;
@@ -437,6 +465,46 @@ void SYMSYNC(_execute)(SYMSYNC()      _q,
     *_ny = ny;
 }
 
+// execute synchronizer on block of input samples; history and input are
+// copied into a linear buffer so the filterbanks read directly from it
+//  _q      : synchronizer object
+//  _x      : input data array [size: _nx x 1]
+//  _nx     : number of input samples
+//  _y      : output data array
+//  _ny     : number of samples written to output buffer
+void SYMSYNC(_execute_block)(SYMSYNC()      _q,
+                             TI *           _x,
+                             unsigned int   _nx,
+                             TO *           _y,
+                             unsigned int * _ny)
+{
+    unsigned int i, ny=0, k=0;
+    unsigned int p = _q->h_len - 1;     // history length
+    TI * r;
+    while (_nx > 0) {
+        unsigned int n = _nx < SYMSYNC_BLOCK_LEN ? _nx : SYMSYNC_BLOCK_LEN;
+
+        // fill buffer: most recent h_len-1 samples, then input
+        WINDOW(_read)(_q->w, &r);
+        memmove(_q->buf,   r+1, p*sizeof(TI));
+        memmove(_q->buf+p, _x,  n*sizeof(TI));
+
+        // step through buffer, window for sample i starting at buf[i]
+        for (i=0; i<n; i++) {
+            SYMSYNC(_step_buffer)(_q, _q->buf + i, &_y[ny], &k);
+            ny += k;
+        }
+
+        // update window with most recent samples
+        unsigned int m = n < _q->h_len ? n : _q->h_len;
+        WINDOW(_write)(_q->w, _x + n - m, m);
+
+        _x  += n;
+        _nx -= n;
+    }
+    *_ny = ny;
+}
+
 //
 // internal methods
 //
@@ -451,10 +519,24 @@ void SYMSYNC(_step)(SYMSYNC()      _q,
                     TO *           _y,
                     unsigned int * _ny)
 {
-    // push sample into MF and dMF filterbanks
-    FIRPFB(_push)(_q->mf,  _x);
-    FIRPFB(_push)(_q->dmf, _x);
+    // push sample into window shared by MF and dMF filterbanks
+    WINDOW(_push)(_q->w, _x);
 
+    TI * r;
+    WINDOW(_read)(_q->w, &r);
+    SYMSYNC(_step_buffer)(_q, r, _y, _ny);
+}
+
+// step synchronizer with input buffer ending at newest sample
+//  _q      : symsync object
+//  _r      : input buffer, oldest sample first [size: h_len x 1]
+//  _y      : output sample array pointer
+//  _ny     : number of output samples written
+void SYMSYNC(_step_buffer)(SYMSYNC()      _q,
+                           TI *           _r,
+                           TO *           _y,
+                           unsigned int * _ny)
+{
     // matched and derivative matched-filter outputs
     TO  mf; // matched filter output
     TO dmf; // derivative matched filter output
@@ -469,7 +551,7 @@ void SYMSYNC(_step)(SYMSYNC()      _q,
 #endif
 
         // compute filterbank output
-        FIRPFB(_execute)(_q->mf, _q->b, &mf);
+        FIRPFB(_run)(_q->mf, _q->b, _r, &mf);
 
         // scale output by samples/symbol
         _y[n] = mf / (float)(_q->k);
@@ -494,7 +576,7 @@ void SYMSYNC(_step)(SYMSYNC()      _q,
                 continue;
 
             // compute dMF output
-            FIRPFB(_execute)(_q->dmf, _q->b, &dmf);
+            FIRPFB(_run)(_q->dmf, _q->b, _r, &dmf);
 
             // update internal state
             SYMSYNC(_advance_internal_loop)(_q, mf, dmf);
@@ -24,6 +24,7 @@
 // firdecim_xxxf_autotest.c : test floating-point filters
 //
 
+#include <stdlib.h>
 #include "autotest/autotest.h"
 #include "liquid.h"
 
@@ -128,4 +129,260 @@ void autotest_firdecim_cccf_data_M5h23x50()
                        firdecim_cccf_data_M5h23x50_y, 10);
 }
 
+// compare block execution against single-sample execution for linear-phase
+// (symmetric) and general filters, spanning several internal blocks
+void testbench_firdecim_block(unsigned int _M,
+                              unsigned int _h_len,
+                              int          _symmetric)
+{
+    unsigned int n   = 600;     // number of output samples
+    float        tol = 1e-4f;   // error tolerance
+
+    float h[_h_len];
+    liquid_firdes_kaiser(_h_len, 0.5f/(float)_M, 60.0f, _symmetric ? 0.0f : 0.3f, h);
+    firdecim_crcf q0 = firdecim_crcf_create(_M, h, _h_len);
+    firdecim_crcf q1 = firdecim_crcf_create(_M, h, _h_len);
+    firdecim_crcf_set_scale(q0, 0.5f);
+    firdecim_crcf_set_scale(q1, 0.5f);
+
+    float complex x[n*_M], y0[n], y1[n];
+    unsigned int i;
+    for (i=0; i<n*_M; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+    for (i=0; i<n; i++)
+        firdecim_crcf_execute(q0, &x[i*_M], &y0[i]);
+
+    // irregular blocks, mixed with single samples
+    unsigned int k, b;
+    for (k=0, b=1; k < n; k += b, b = (b * 7 + 5) % 283) {
+        b = k + b > n ? n - k : b;
+        if (b == 1)
+            firdecim_crcf_execute(q1, &x[k*_M], &y1[k]);
+        else
+            firdecim_crcf_execute_block(q1, &x[k*_M], b, &y1[k]);
+    }
+
+    for (i=0; i<n; i++) {
+        CONTEND_DELTA( crealf(y0[i]), crealf(y1[i]), tol );
+        CONTEND_DELTA( cimagf(y0[i]), cimagf(y1[i]), tol );
+    }
+
+    firdecim_crcf_destroy(q0);
+    firdecim_crcf_destroy(q1);
+}
+
+void autotest_firdecim_block_M2_h21()   { testbench_firdecim_block(2,  21, 1); }
+void autotest_firdecim_block_M3_h4()    { testbench_firdecim_block(3,   4, 1); }
+void autotest_firdecim_block_M4_h64()   { testbench_firdecim_block(4,  64, 1); }
+void autotest_firdecim_block_M7_h129()  { testbench_firdecim_block(7, 129, 1); }
+void autotest_firdecim_block_M1_h9_ns() { testbench_firdecim_block(1,   9, 0); }
+void autotest_firdecim_block_M3_h40_ns(){ testbench_firdecim_block(3,  40, 0); }
+
+
+// long filters: block method switches to fast convolution for blocks
+// large enough; compare against single-sample execution
+void testbench_firdecim_fft(unsigned int _M,
+                            unsigned int _h_len,
+                            float        _mu)
+{
+    unsigned int n   = 12000;   // number of output samples
+    float        tol = 1e-4f;   // error tolerance
+
+    float h[_h_len];
+    liquid_firdes_kaiser(_h_len, 0.5f/(float)_M, 60.0f, _mu, h);
+    firdecim_crcf q0 = firdecim_crcf_create(_M, h, _h_len);
+    firdecim_crcf q1 = firdecim_crcf_create(_M, h, _h_len);
+    firdecim_crcf_set_scale(q0, 0.5f);
+    firdecim_crcf_set_scale(q1, 0.5f);
+
+    float complex * x  = (float complex*) malloc(n*_M*sizeof(float complex));
+    float complex * y0 = (float complex*) malloc(n*sizeof(float complex));
+    float complex * y1 = (float complex*) malloc(n*sizeof(float complex));
+    unsigned int i;
+    for (i=0; i<n*_M; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+    for (i=0; i<n; i++)
+        firdecim_crcf_execute(q0, &x[i*_M], &y0[i]);
+
+    // large blocks mixed with short blocks and single samples
+    unsigned int blocks[8] = {4000, 1, 37, 5100, 2, 1900, 1, 0};
+    unsigned int k = 0;
+    for (i=0; i<8; i++) {
+        unsigned int b = blocks[i] == 0 ? n - k : blocks[i];
+        if (b == 1)
+            firdecim_crcf_execute(q1, &x[k*_M], &y1[k]);
+        else
+            firdecim_crcf_execute_block(q1, &x[k*_M], b, &y1[k]);
+        k += b;
+    }
+
+    for (i=0; i<n; i++) {
+        CONTEND_DELTA( crealf(y0[i]), crealf(y1[i]), tol );
+        CONTEND_DELTA( cimagf(y0[i]), cimagf(y1[i]), tol );
+    }
+
+    if (liquid_autotest_verbose)
+        firdecim_crcf_print(q1);
+
+    firdecim_crcf_destroy(q0);
+    firdecim_crcf_destroy(q1);
+    free(x);
+    free(y0);
+    free(y1);
+}
+
+void autotest_firdecim_fft_M2_h2049()   { testbench_firdecim_fft(2, 2049, 0.0f); }
+void autotest_firdecim_fft_M3_h1500()   { testbench_firdecim_fft(3, 1500, 0.3f); }
+void autotest_firdecim_fft_M4_h4097()   { testbench_firdecim_fft(4, 4097, 0.0f); }
+
+// interleaved integer I/Q input: converting while buffering should match
+// converting to floating-point first, for direct-form, linear-phase and
+// fast-convolution block paths
+void testbench_firdecim_ci(unsigned int _M,
+                           unsigned int _h_len,
+                           float        _mu)
+{
+    unsigned int n   = 6000;    // number of output samples
+    float        tol = 1e-4f;   // error tolerance
+
+    float h[_h_len];
+    liquid_firdes_kaiser(_h_len, 0.5f/(float)_M, 60.0f, _mu, h);
+    firdecim_crcf q0 = firdecim_crcf_create(_M, h, _h_len);
+    firdecim_crcf q1 = firdecim_crcf_create(_M, h, _h_len);
+    firdecim_crcf q2 = firdecim_crcf_create(_M, h, _h_len);
+    firdecim_crcf_set_scale(q0, 0.5f);
+    firdecim_crcf_set_scale(q1, 0.5f);
+    firdecim_crcf_set_scale(q2, 0.5f);
+
+    // integer inputs and their floating-point equivalents
+    int16_t *       x16 = (int16_t*)       malloc(2*n*_M*sizeof(int16_t));
+    int8_t *        x8  = (int8_t*)        malloc(2*n*_M*sizeof(int8_t));
+    float complex * x   = (float complex*) malloc(n*_M*sizeof(float complex));
+    float complex * y0  = (float complex*) malloc(n*sizeof(float complex));
+    float complex * y1  = (float complex*) malloc(n*sizeof(float complex));
+    float complex * y2  = (float complex*) malloc(n*sizeof(float complex));
+    unsigned int i;
+    for (i=0; i<2*n*_M; i++) {
+        x16[i] = (int16_t)(rand() % 65536 - 32768);
+        x8 [i] = (int8_t) (x16[i] >> 8);
+    }
+
+    // reference: convert int16 input then decimate
+    for (i=0; i<n*_M; i++)
+        x[i] = (x16[2*i] + _Complex_I*x16[2*i+1]) / 32768.0f;
+    firdecim_crcf_execute_block(q0, x, n, y0);
+
+    // large blocks mixed with short blocks and single samples
+    unsigned int blocks[8] = {2000, 1, 37, 2500, 2, 900, 1, 0};
+    unsigned int k = 0;
+    for (i=0; i<8; i++) {
+        unsigned int b = blocks[i] == 0 ? n - k : blocks[i];
+        firdecim_crcf_execute_block_ci16(q1, &x16[2*k*_M], b, &y1[k]);
+        k += b;
+    }
+    for (i=0; i<n; i++) {
+        CONTEND_DELTA( crealf(y0[i]), crealf(y1[i]), tol );
+        CONTEND_DELTA( cimagf(y0[i]), cimagf(y1[i]), tol );
+    }
+
+    // int8 input, compared against reference on its converted samples
+    firdecim_crcf_reset(q0);
+    for (i=0; i<n*_M; i++)
+        x[i] = (x8[2*i] + _Complex_I*x8[2*i+1]) / 128.0f;
+    firdecim_crcf_execute_block(q0, x, n, y0);
+    for (k=0, i=0; i<8; i++) {
+        unsigned int b = blocks[i] == 0 ? n - k : blocks[i];
+        firdecim_crcf_execute_block_ci8(q2, &x8[2*k*_M], b, &y2[k]);
+        k += b;
+    }
+    for (i=0; i<n; i++) {
+        CONTEND_DELTA( crealf(y0[i]), crealf(y2[i]), tol );
+        CONTEND_DELTA( cimagf(y0[i]), cimagf(y2[i]), tol );
+    }
+
+    firdecim_crcf_destroy(q0);
+    firdecim_crcf_destroy(q1);
+    firdecim_crcf_destroy(q2);
+    free(x16);
+    free(x8);
+    free(x);
+    free(y0);
+    free(y1);
+    free(y2);
+}
+
+void autotest_firdecim_ci_M3_h40_ns()   { testbench_firdecim_ci(3,   40, 0.3f); }
+void autotest_firdecim_ci_M4_h64()      { testbench_firdecim_ci(4,   64, 0.0f); }
+void autotest_firdecim_ci_M3_h1500()    { testbench_firdecim_ci(3, 1500, 0.3f); }
+
+// switching one decimator between integer and floating-point entry points
+// should match a floating-point reference on the normalized samples, i.e.
+// the history is held at the same scale regardless of input format
+void testbench_firdecim_ci_mixed(unsigned int _M,
+                                 unsigned int _h_len,
+                                 float        _mu)
+{
+    unsigned int n   = 5000;    // number of output samples
+    float        tol = 1e-4f;   // error tolerance
+
+    float h[_h_len];
+    liquid_firdes_kaiser(_h_len, 0.5f/(float)_M, 60.0f, _mu, h);
+    firdecim_crcf q0 = firdecim_crcf_create(_M, h, _h_len);   // reference
+    firdecim_crcf q1 = firdecim_crcf_create(_M, h, _h_len);   // mixed input
+
+    int16_t *       x16 = (int16_t*)       malloc(2*n*_M*sizeof(int16_t));
+    int8_t *        x8  = (int8_t*)        malloc(2*n*_M*sizeof(int8_t));
+    float complex * x   = (float complex*) malloc(n*_M*sizeof(float complex));
+    float complex * y0  = (float complex*) malloc(n*sizeof(float complex));
+    float complex * y1  = (float complex*) malloc(n*sizeof(float complex));
+    unsigned int i;
+    for (i=0; i<2*n*_M; i++) {
+        x16[i] = (int16_t)(rand() % 65536 - 32768);
+        x8 [i] = (int8_t) (rand() % 256   - 128);
+    }
+
+    // segments: 0 = float block, 1 = float single output, 16 = int16, 8 = int8
+    unsigned int fmt   [9] = {16,  0, 16, 1, 8,   0, 8,   1, 16};
+    unsigned int blocks[9] = {300, 2500, 1, 1, 400, 2, 700, 1, 0};
+    unsigned int k = 0;
+    for (i=0; i<9; i++) {
+        unsigned int b = blocks[i] == 0 ? n - k : blocks[i];
+        unsigned int j;
+        for (j=2*k*_M; j<2*(k+b)*_M; j+=2) {
+            if (fmt[i] == 16)
+                x[j/2] = (x16[j] + _Complex_I*x16[j+1]) / 32768.0f;
+            else if (fmt[i] == 8)
+                x[j/2] = (x8[j] + _Complex_I*x8[j+1]) / 128.0f;
+            else
+                x[j/2] = x16[j] / 32768.0f + _Complex_I*x8[j+1] / 128.0f;
+        }
+        if (fmt[i] == 16)
+            firdecim_crcf_execute_block_ci16(q1, &x16[2*k*_M], b, &y1[k]);
+        else if (fmt[i] == 8)
+            firdecim_crcf_execute_block_ci8(q1, &x8[2*k*_M], b, &y1[k]);
+        else if (fmt[i] == 1)
+            firdecim_crcf_execute(q1, &x[k*_M], &y1[k]);
+        else
+            firdecim_crcf_execute_block(q1, &x[k*_M], b, &y1[k]);
+        k += b;
+    }
+
+    // reference on floating-point samples only
+    firdecim_crcf_execute_block(q0, x, n, y0);
+    for (i=0; i<n; i++) {
+        CONTEND_DELTA( crealf(y0[i]), crealf(y1[i]), tol );
+        CONTEND_DELTA( cimagf(y0[i]), cimagf(y1[i]), tol );
+    }
+
+    firdecim_crcf_destroy(q0);
+    firdecim_crcf_destroy(q1);
+    free(x16);
+    free(x8);
+    free(x);
+    free(y0);
+    free(y1);
+}
 
+void autotest_firdecim_ci_mixed_M3_h40_ns() { testbench_firdecim_ci_mixed(3,   40, 0.3f); }
+void autotest_firdecim_ci_mixed_M4_h64()    { testbench_firdecim_ci_mixed(4,   64, 0.0f); }
+void autotest_firdecim_ci_mixed_M3_h1500()  { testbench_firdecim_ci_mixed(3, 1500, 0.3f); }
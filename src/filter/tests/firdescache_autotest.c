@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// cached designs must be identical to the original designs
+void autotest_firdescache_hit()
+{
+    unsigned int n = 51;
+    float h0[n], h1[n], h2[n];
+    firdescache q = firdescache_create(4);
+
+    // Kaiser : miss, then hit
+    liquid_firdes_kaiser(n, 0.2f, 60.0f, 0.0f, h0);
+    firdescache_kaiser(q, n, 0.2f, 60.0f, 0.0f, h1);
+    firdescache_kaiser(q, n, 0.2f, 60.0f, 0.0f, h2);
+    CONTEND_SAME_DATA(h0, h1, n*sizeof(float));
+    CONTEND_SAME_DATA(h0, h2, n*sizeof(float));
+
+    // Parks-McClellan : miss, then hit
+    float bands[4] = {0.0f, 0.1f, 0.15f, 0.5f};
+    float des[2]   = {1.0f, 0.0f};
+    float w[2]     = {1.0f, 1.0f};
+    firdespm_run(n, 2, bands, des, w, NULL, LIQUID_FIRDESPM_BANDPASS, h0);
+    firdescache_firdespm(q, n, 2, bands, des, w, NULL, LIQUID_FIRDESPM_BANDPASS, h1);
+    firdescache_firdespm(q, n, 2, bands, des, w, NULL, LIQUID_FIRDESPM_BANDPASS, h2);
+    CONTEND_SAME_DATA(h0, h1, n*sizeof(float));
+    CONTEND_SAME_DATA(h0, h2, n*sizeof(float));
+
+    // different parameters must miss
+    firdescache_kaiser(q, n, 0.2f, 60.0f, 0.1f, h1);
+    CONTEND_EQUALITY(firdescache_get_num_hits  (q), 2);
+    CONTEND_EQUALITY(firdescache_get_num_misses(q), 3);
+    CONTEND_EQUALITY(firdescache_get_num_seeded(q), 0);
+
+    firdescache_destroy(q);
+}
+
+// least-recently-used design is evicted when cache is full
+void autotest_firdescache_lru()
+{
+    unsigned int n = 21;
+    float h[n];
+    firdescache q = firdescache_create(3);
+
+    // fill cache with designs A, B, C
+    firdescache_kaiser(q, n, 0.10f, 60.0f, 0.0f, h);
+    firdescache_kaiser(q, n, 0.20f, 60.0f, 0.0f, h);
+    firdescache_kaiser(q, n, 0.30f, 60.0f, 0.0f, h);
+
+    // use A so that B is least recently used, then add D to evict B
+    firdescache_kaiser(q, n, 0.10f, 60.0f, 0.0f, h);
+    firdescache_kaiser(q, n, 0.40f, 60.0f, 0.0f, h);
+    CONTEND_EQUALITY(firdescache_get_num_hits  (q), 1);
+    CONTEND_EQUALITY(firdescache_get_num_misses(q), 4);
+
+    // A, C, D are retained
+    firdescache_kaiser(q, n, 0.10f, 60.0f, 0.0f, h);
+    firdescache_kaiser(q, n, 0.30f, 60.0f, 0.0f, h);
+    firdescache_kaiser(q, n, 0.40f, 60.0f, 0.0f, h);
+    CONTEND_EQUALITY(firdescache_get_num_hits  (q), 4);
+    CONTEND_EQUALITY(firdescache_get_num_misses(q), 4);
+
+    // B was evicted
+    firdescache_kaiser(q, n, 0.20f, 60.0f, 0.0f, h);
+    CONTEND_EQUALITY(firdescache_get_num_hits  (q), 4);
+    CONTEND_EQUALITY(firdescache_get_num_misses(q), 5);
+
+    // reset clears designs and statistics
+    firdescache_reset(q);
+    firdescache_kaiser(q, n, 0.20f, 60.0f, 0.0f, h);
+    CONTEND_EQUALITY(firdescache_get_num_hits  (q), 0);
+    CONTEND_EQUALITY(firdescache_get_num_misses(q), 1);
+
+    firdescache_destroy(q);
+}
+
+// warm-started designs converge to the same filter as cold designs
+void autotest_firdescache_seeded()
+{
+    unsigned int n = 61;
+    float h0[n], h1[n];
+    float des[3] = {0.0f, 1.0f, 0.0f};
+    float w[3]   = {1.0f, 1.0f, 1.0f};
+    float tol    = 1e-4f;
+    firdescache q = firdescache_create(8);
+
+    // sweep pass band of band-pass filter
+    unsigned int i, j;
+    for (i=0; i<8; i++) {
+        float fc = 0.20f + 0.005f*i;
+        float bands[6] = {0.0f, fc-0.10f, fc-0.06f, fc+0.06f, fc+0.10f, 0.5f};
+        firdespm_run(n, 3, bands, des, w, NULL, LIQUID_FIRDESPM_BANDPASS, h0);
+        firdescache_firdespm(q, n, 3, bands, des, w, NULL, LIQUID_FIRDESPM_BANDPASS, h1);
+        for (j=0; j<n; j++)
+            CONTEND_DELTA(h0[j], h1[j], tol);
+    }
+
+    // all but the first design were seeded from cache
+    CONTEND_EQUALITY(firdescache_get_num_misses(q), 8);
+    CONTEND_EQUALITY(firdescache_get_num_seeded(q), 7);
+
+    firdescache_destroy(q);
+}
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// test variable-delay block method against setting the delay and
+// executing one sample at a time
+void testbench_firfarrow_crcf_block(unsigned int _h_len,
+                                    unsigned int _p)
+{
+    unsigned int n   = 1200;    // number of samples
+    float        tol = 1e-4f;   // error tolerance
+
+    firfarrow_crcf q0 = firfarrow_crcf_create(_h_len, _p, 0.45f, 60.0f);
+    firfarrow_crcf q1 = firfarrow_crcf_create(_h_len, _p, 0.45f, 60.0f);
+
+    // input and slowly-varying delay (e.g. Doppler)
+    float complex x[n], y0[n], y1[n];
+    float         mu[n];
+    unsigned int i;
+    for (i=0; i<n; i++) {
+        x[i]  = randnf() + _Complex_I*randnf();
+        mu[i] = 0.45f*sinf(2*M_PI*0.003f*i);
+    }
+
+    for (i=0; i<n; i++) {
+        firfarrow_crcf_push     (q0, x[i]);
+        firfarrow_crcf_set_delay(q0, mu[i]);
+        firfarrow_crcf_execute  (q0, &y0[i]);
+    }
+
+    // irregular blocks, mixed with single samples
+    unsigned int k, b;
+    for (k=0, b=1; k < n; k += b, b = (b * 7 + 5) % 283) {
+        b = k + b > n ? n - k : b;
+        if (b == 1) {
+            firfarrow_crcf_push     (q1, x[k]);
+            firfarrow_crcf_set_delay(q1, mu[k]);
+            firfarrow_crcf_execute  (q1, &y1[k]);
+        } else {
+            firfarrow_crcf_execute_block_delay(q1, &x[k], &mu[k], b, &y1[k]);
+        }
+    }
+
+    for (i=0; i<n; i++) {
+        CONTEND_DELTA( crealf(y0[i]), crealf(y1[i]), tol );
+        CONTEND_DELTA( cimagf(y0[i]), cimagf(y1[i]), tol );
+    }
+
+    // filter taps retained for last delay
+    float h0[_h_len], h1[_h_len];
+    firfarrow_crcf_get_coefficients(q0, h0);
+    firfarrow_crcf_get_coefficients(q1, h1);
+    for (i=0; i<_h_len; i++)
+        CONTEND_DELTA( h0[i], h1[i], tol );
+
+    firfarrow_crcf_destroy(q0);
+    firfarrow_crcf_destroy(q1);
+}
+
+void autotest_firfarrow_crcf_block_h19_p4() { testbench_firfarrow_crcf_block(19, 4); }
+void autotest_firfarrow_crcf_block_h24_p5() { testbench_firfarrow_crcf_block(24, 5); }
+void autotest_firfarrow_crcf_block_h40_p2() { testbench_firfarrow_crcf_block(40, 2); }
@@ -0,0 +1,229 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "autotest/autotest.h"
+#include "liquid.internal.h"
+
+// random Q15 sample bounded by _peak
+liquid_q15 firfilt_q15_autotest_rand(int _peak)
+{
+    return (liquid_q15)( (rand() % (2*_peak+1)) - _peak );
+}
+
+// test that block execution matches sample-by-sample execution exactly
+// across several internal buffer shifts
+//  _h_len  : filter length
+void firfilt_q15_test_block(unsigned int _h_len)
+{
+    unsigned int num_samples = 1200;
+    unsigned int i;
+
+    // random coefficients and input
+    liquid_q15  hr[_h_len];
+    liquid_cq15 hc[_h_len];
+    for (i=0; i<_h_len; i++) {
+        hr[i]      = firfilt_q15_autotest_rand(6000);
+        hc[i].real = firfilt_q15_autotest_rand(6000);
+        hc[i].imag = firfilt_q15_autotest_rand(6000);
+    }
+    liquid_cq15 * x  = (liquid_cq15*) malloc(num_samples*sizeof(liquid_cq15));
+    liquid_cq15 * y0 = (liquid_cq15*) malloc(num_samples*sizeof(liquid_cq15));
+    liquid_cq15 * y1 = (liquid_cq15*) malloc(num_samples*sizeof(liquid_cq15));
+    for (i=0; i<num_samples; i++) {
+        x[i].real = firfilt_q15_autotest_rand(32767);
+        x[i].imag = firfilt_q15_autotest_rand(32767);
+    }
+
+    // complex coefficients: one sample at a time, then irregular blocks
+    firfilt_cccq15 q = firfilt_cccq15_create(hc, _h_len);
+    for (i=0; i<num_samples; i++) {
+        firfilt_cccq15_push(q, x[i]);
+        firfilt_cccq15_execute(q, &y0[i]);
+    }
+    firfilt_cccq15_reset(q);
+    unsigned int n = 0;
+    unsigned int block_len = 1;
+    while (n < num_samples) {
+        unsigned int k = n + block_len > num_samples ? num_samples - n : block_len;
+        firfilt_cccq15_execute_block(q, x+n, k, y1+n);
+        n += k;
+        block_len = (3*block_len + 5) % 301;
+    }
+    for (i=0; i<num_samples; i++) {
+        CONTEND_EQUALITY(y0[i].real, y1[i].real);
+        CONTEND_EQUALITY(y0[i].imag, y1[i].imag);
+    }
+    firfilt_cccq15_destroy(q);
+
+    // real coefficients, complex input: in-place block operation
+    firfilt_crcq15 qc = firfilt_crcq15_create(hr, _h_len);
+    for (i=0; i<num_samples; i++) {
+        firfilt_crcq15_push(qc, x[i]);
+        firfilt_crcq15_execute(qc, &y0[i]);
+    }
+    firfilt_crcq15_reset(qc);
+    memmove(y1, x, num_samples*sizeof(liquid_cq15));
+    firfilt_crcq15_execute_block(qc, y1, num_samples, y1);
+    for (i=0; i<num_samples; i++) {
+        CONTEND_EQUALITY(y0[i].real, y1[i].real);
+        CONTEND_EQUALITY(y0[i].imag, y1[i].imag);
+    }
+    firfilt_crcq15_destroy(qc);
+
+    // real coefficients, real input
+    liquid_q15 * xr = (liquid_q15*)x;
+    liquid_q15 * z0 = (liquid_q15*)y0;
+    liquid_q15 * z1 = (liquid_q15*)y1;
+    firfilt_rrrq15 qr = firfilt_rrrq15_create(hr, _h_len);
+    for (i=0; i<num_samples; i++) {
+        firfilt_rrrq15_push(qr, xr[i]);
+        firfilt_rrrq15_execute(qr, &z0[i]);
+    }
+    firfilt_rrrq15_reset(qr);
+    firfilt_rrrq15_execute_block(qr, xr, num_samples, z1);
+    for (i=0; i<num_samples; i++)
+        CONTEND_EQUALITY(z0[i], z1[i]);
+    firfilt_rrrq15_destroy(qr);
+
+    free(x);
+    free(y0);
+    free(y1);
+}
+
+void autotest_firfilt_q15_block_h1()   { firfilt_q15_test_block(  1); }
+void autotest_firfilt_q15_block_h7()   { firfilt_q15_test_block(  7); }
+void autotest_firfilt_q15_block_h57()  { firfilt_q15_test_block( 57); }
+void autotest_firfilt_q15_block_h300() { firfilt_q15_test_block(300); }
+
+// compare fixed-point filter against floating-point filter with the same
+// (quantized) coefficients and input
+void autotest_firfilt_q15_float()
+{
+    unsigned int h_len       = 41;
+    unsigned int num_samples = 400;
+    unsigned int i;
+
+    // design filter and quantize
+    firfilt_crcq15 q0 = firfilt_crcq15_create_kaiser(h_len, 0.2f, 60.0f, 0.0f);
+    float      hf[h_len];
+    liquid_q15 hq[h_len];
+    liquid_firdes_kaiser(h_len, 0.2f, 60.0f, 0.0f, hf);
+    for (i=0; i<h_len; i++) {
+        hq[i] = liquid_float_to_q15(hf[i]);
+        hf[i] = liquid_q15_to_float(hq[i]);
+    }
+    firfilt_crcf q1 = firfilt_crcf_create(hf, h_len);
+
+    // filter noise through both, keeping outputs well inside full scale;
+    // fixed-point outputs are rounded to nearest Q15 level
+    float tol = 1.0f / 32768.0f;
+    for (i=0; i<num_samples; i++) {
+        liquid_cq15 xq = {liquid_float_to_q15(0.1f*randnf()),
+                          liquid_float_to_q15(0.1f*randnf())};
+        float complex xf = liquid_q15_to_float(xq.real) +
+                           liquid_q15_to_float(xq.imag)*_Complex_I;
+        liquid_cq15   yq;
+        float complex yf;
+        firfilt_crcq15_push(q0, xq);
+        firfilt_crcq15_execute(q0, &yq);
+        firfilt_crcf_push(q1, xf);
+        firfilt_crcf_execute(q1, &yf);
+        CONTEND_DELTA(liquid_q15_to_float(yq.real), crealf(yf), tol);
+        CONTEND_DELTA(liquid_q15_to_float(yq.imag), cimagf(yf), tol);
+    }
+    firfilt_crcq15_destroy(q0);
+    firfilt_crcf_destroy(q1);
+}
+
+// test that large inputs saturate rather than wrap
+void autotest_firfilt_q15_saturate()
+{
+    liquid_q15 h[4] = {32767, 32767, 32767, 32767};
+    firfilt_rrrq15 q = firfilt_rrrq15_create(h, 4);
+    unsigned int i;
+    liquid_q15 y;
+    for (i=0; i<8; i++) {
+        firfilt_rrrq15_push(q, i < 4 ? 32767 : -32768);
+        firfilt_rrrq15_execute(q, &y);
+        if (i==0) CONTEND_EQUALITY(y,  32766);
+        if (i>=1 && i<4) CONTEND_EQUALITY(y,  32767);
+        if (i==7) CONTEND_EQUALITY(y, -32768);
+    }
+    firfilt_rrrq15_destroy(q);
+}
+
+// test decimator: block execution against single outputs, and against
+// floating-point decimator with the same quantized coefficients
+void autotest_firdecim_q15()
+{
+    unsigned int M           = 4;
+    unsigned int m           = 5;
+    unsigned int num_outputs = 300;
+    unsigned int h_len       = 2*M*m;
+    unsigned int i;
+
+    // quantized prototype
+    float      hf[h_len];
+    liquid_q15 hq[h_len];
+    liquid_firdes_kaiser(h_len, 0.5f/(float)M, 60.0f, 0.0f, hf);
+    for (i=0; i<h_len; i++) {
+        hq[i] = liquid_float_to_q15(hf[i]);
+        hf[i] = liquid_q15_to_float(hq[i]);
+    }
+    firdecim_crcq15 q0 = firdecim_crcq15_create(M, hq, h_len);
+    firdecim_crcq15 q1 = firdecim_crcq15_create(M, hq, h_len);
+    firdecim_crcf   q2 = firdecim_crcf_create  (M, hf, h_len);
+
+    // generate input
+    liquid_cq15   xq[num_outputs*M];
+    float complex xf[num_outputs*M];
+    for (i=0; i<num_outputs*M; i++) {
+        xq[i].real = liquid_float_to_q15(0.1f*randnf());
+        xq[i].imag = liquid_float_to_q15(0.1f*randnf());
+        xf[i] = liquid_q15_to_float(xq[i].real) +
+                liquid_q15_to_float(xq[i].imag)*_Complex_I;
+    }
+
+    // run decimators
+    liquid_cq15   y0[num_outputs];
+    liquid_cq15   y1[num_outputs];
+    float complex y2[num_outputs];
+    for (i=0; i<num_outputs; i++)
+        firdecim_crcq15_execute(q0, &xq[i*M], &y0[i]);
+    firdecim_crcq15_execute_block(q1, xq, num_outputs, y1);
+    firdecim_crcf_execute_block  (q2, xf, num_outputs, y2);
+
+    float tol = 1.0f / 32768.0f;
+    for (i=0; i<num_outputs; i++) {
+        CONTEND_EQUALITY(y0[i].real, y1[i].real);
+        CONTEND_EQUALITY(y0[i].imag, y1[i].imag);
+        CONTEND_DELTA(liquid_q15_to_float(y0[i].real), crealf(y2[i]), tol);
+        CONTEND_DELTA(liquid_q15_to_float(y0[i].imag), cimagf(y2[i]), tol);
+    }
+
+    firdecim_crcq15_destroy(q0);
+    firdecim_crcq15_destroy(q1);
+    firdecim_crcf_destroy(q2);
+}
+
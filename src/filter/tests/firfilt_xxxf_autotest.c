@@ -116,4 +116,75 @@ void autotest_firfilt_cccf_data_h23x64()
                       firfilt_cccf_data_h23x64_y, 64);
 }
 
+// compare block execution against single-sample execution for linear-phase
+// (symmetric) and general filters, spanning several internal blocks with
+// irregular block sizes
+void testbench_firfilt_block(unsigned int _h_len,
+                             int          _symmetric)
+{
+    unsigned int n   = 1000;    // number of samples
+    float        tol = 1e-4f;   // error tolerance
+
+    // design filters: real, and complex with the same symmetry
+    float         hr[_h_len];
+    float complex hc[_h_len];
+    liquid_firdes_kaiser(_h_len, 0.2f, 60.0f, 0.0f, hr);
+    unsigned int i;
+    for (i=0; i<_h_len; i++) {
+        if (!_symmetric)
+            hr[i] *= 1.0f + 0.01f*i;
+        unsigned int k = _symmetric && i >= _h_len/2 ? _h_len-i-1 : i;
+        hc[i] = hr[i] * cexpf(_Complex_I*0.3f*k);
+    }
+    firfilt_rrrf q0 = firfilt_rrrf_create(hr, _h_len);
+    firfilt_rrrf q1 = firfilt_rrrf_create(hr, _h_len);
+    firfilt_cccf r0 = firfilt_cccf_create(hc, _h_len);
+    firfilt_cccf r1 = firfilt_cccf_create(hc, _h_len);
+    firfilt_rrrf_set_scale(q0, 2.0f);
+    firfilt_rrrf_set_scale(q1, 2.0f);
+
+    float         x [n], y0[n], y1[n];
+    float complex xc[n], z0[n], z1[n];
+    for (i=0; i<n; i++) {
+        x[i]  = randnf();
+        xc[i] = randnf() + _Complex_I*randnf();
+        firfilt_rrrf_push(q0, x[i]);
+        firfilt_rrrf_execute(q0, &y0[i]);
+        firfilt_cccf_push(r0, xc[i]);
+        firfilt_cccf_execute(r0, &z0[i]);
+    }
+
+    // irregular blocks, mixed with single samples
+    unsigned int k, b;
+    for (k=0, b=1; k < n; k += b, b = (b * 7 + 5) % 311) {
+        b = k + b > n ? n - k : b;
+        if (b == 1) {
+            firfilt_rrrf_push(q1, x[k]);
+            firfilt_rrrf_execute(q1, &y1[k]);
+            firfilt_cccf_push(r1, xc[k]);
+            firfilt_cccf_execute(r1, &z1[k]);
+        } else {
+            firfilt_rrrf_execute_block(q1, &x[k],  b, &y1[k]);
+            firfilt_cccf_execute_block(r1, &xc[k], b, &z1[k]);
+        }
+    }
+
+    for (i=0; i<n; i++) {
+        CONTEND_DELTA( y0[i], y1[i], tol );
+        CONTEND_DELTA( crealf(z0[i]), crealf(z1[i]), tol );
+        CONTEND_DELTA( cimagf(z0[i]), cimagf(z1[i]), tol );
+    }
+
+    firfilt_rrrf_destroy(q0);
+    firfilt_rrrf_destroy(q1);
+    firfilt_cccf_destroy(r0);
+    firfilt_cccf_destroy(r1);
+}
+
+void autotest_firfilt_block_h1()        { testbench_firfilt_block(  1, 1); }
+void autotest_firfilt_block_h2()        { testbench_firfilt_block(  2, 1); }
+void autotest_firfilt_block_h21()       { testbench_firfilt_block( 21, 1); }
+void autotest_firfilt_block_h64()       { testbench_firfilt_block( 64, 1); }
+void autotest_firfilt_block_h301()      { testbench_firfilt_block(301, 1); }
+void autotest_firfilt_block_h21_asym()  { testbench_firfilt_block( 21, 0); }
 
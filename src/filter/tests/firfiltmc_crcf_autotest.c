@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <string.h>
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// compare multi-channel filter output against independent firfilt
+// objects running on each channel
+void testbench_firfiltmc_crcf(unsigned int _h_len,
+                              unsigned int _num_channels)
+{
+    unsigned int n   = 150;     // samples per channel (spans buffer shifts)
+    float        tol = 1e-5f;   // error tolerance
+
+    // create multi-channel filter and reference filters
+    float h[_h_len];
+    liquid_firdes_kaiser(_h_len, 0.2f, 60.0f, 0.0f, h);
+    firfiltmc_crcf q = firfiltmc_crcf_create(h, _h_len, _num_channels);
+    firfiltmc_crcf_set_scale(q, 0.5f);
+    firfilt_crcf r[_num_channels];
+    unsigned int i, c;
+    for (c=0; c<_num_channels; c++) {
+        r[c] = firfilt_crcf_create(h, _h_len);
+        firfilt_crcf_set_scale(r[c], 0.5f);
+    }
+
+    // generate interleaved input, distinct per channel
+    float complex x[n*_num_channels];
+    float complex y[n*_num_channels];
+    for (i=0; i<n*_num_channels; i++)
+        x[i] = cexpf(_Complex_I*0.37f*i*i) * (i%7==0 ? 2.0f : 1.0f);
+
+    // run single samples first, then an in-place block
+    unsigned int n0 = 3;
+    for (i=0; i<n0; i++)
+        firfiltmc_crcf_execute(q, &x[i*_num_channels], &y[i*_num_channels]);
+    memmove(&y[n0*_num_channels], &x[n0*_num_channels], (n-n0)*_num_channels*sizeof(float complex));
+    firfiltmc_crcf_execute_block(q, &y[n0*_num_channels], n-n0, &y[n0*_num_channels]);
+
+    // compare against reference
+    for (i=0; i<n; i++) {
+        for (c=0; c<_num_channels; c++) {
+            float complex v;
+            firfilt_crcf_push(r[c], x[i*_num_channels+c]);
+            firfilt_crcf_execute(r[c], &v);
+            CONTEND_DELTA( crealf(y[i*_num_channels+c]), crealf(v), tol );
+            CONTEND_DELTA( cimagf(y[i*_num_channels+c]), cimagf(v), tol );
+        }
+    }
+
+    // clean up objects
+    firfiltmc_crcf_destroy(q);
+    for (c=0; c<_num_channels; c++)
+        firfilt_crcf_destroy(r[c]);
+}
+
+void autotest_firfiltmc_crcf_h1_c3()    { testbench_firfiltmc_crcf( 1,  3); }
+void autotest_firfiltmc_crcf_h17_c1()   { testbench_firfiltmc_crcf(17,  1); }
+void autotest_firfiltmc_crcf_h33_c8()   { testbench_firfiltmc_crcf(33,  8); }
+void autotest_firfiltmc_crcf_h80_c5()   { testbench_firfiltmc_crcf(80,  5); }
+
+// compare multi-channel decimator output against independent firdecim
+// objects running on each channel
+void testbench_firdecimmc_crcf(unsigned int _M,
+                               unsigned int _m,
+                               unsigned int _num_channels)
+{
+    unsigned int n   = 40;      // output samples per channel
+    float        tol = 1e-5f;   // error tolerance
+
+    // create multi-channel decimator and reference decimators
+    firdecimmc_crcf q = firdecimmc_crcf_create_kaiser(_M, _m, 60.0f, _num_channels);
+    firdecim_crcf r[_num_channels];
+    unsigned int i, j, c;
+    for (c=0; c<_num_channels; c++)
+        r[c] = firdecim_crcf_create_kaiser(_M, _m, 60.0f);
+
+    // generate interleaved input, distinct per channel
+    float complex x[n*_M*_num_channels];
+    float complex y[n*_num_channels];
+    for (i=0; i<n*_M*_num_channels; i++)
+        x[i] = cexpf(_Complex_I*0.21f*i*i) * (i%5==0 ? 2.0f : 1.0f);
+
+    // run single output first, then the remaining block
+    firdecimmc_crcf_execute(q, x, y);
+    firdecimmc_crcf_execute_block(q, &x[_M*_num_channels], n-1, &y[_num_channels]);
+
+    // compare against reference
+    for (i=0; i<n; i++) {
+        for (c=0; c<_num_channels; c++) {
+            float complex xc[_M];
+            for (j=0; j<_M; j++)
+                xc[j] = x[(i*_M+j)*_num_channels + c];
+            float complex v;
+            firdecim_crcf_execute(r[c], xc, &v);
+            CONTEND_DELTA( crealf(y[i*_num_channels+c]), crealf(v), tol );
+            CONTEND_DELTA( cimagf(y[i*_num_channels+c]), cimagf(v), tol );
+        }
+    }
+
+    // clean up objects
+    firdecimmc_crcf_destroy(q);
+    for (c=0; c<_num_channels; c++)
+        firdecim_crcf_destroy(r[c]);
+}
+
+void autotest_firdecimmc_crcf_M2_c4()   { testbench_firdecimmc_crcf(2, 5, 4); }
+void autotest_firdecimmc_crcf_M3_c1()   { testbench_firdecimmc_crcf(3, 4, 1); }
+void autotest_firdecimmc_crcf_M8_c6()   { testbench_firdecimmc_crcf(8, 3, 6); }
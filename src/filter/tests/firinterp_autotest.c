@@ -20,6 +20,7 @@
  * THE SOFTWARE.
  */
 
+#include <stdlib.h>
 #include "autotest/autotest.h"
 #include "liquid.h"
 
@@ -150,3 +151,63 @@ void autotest_firinterp_crcf_generic()
     firinterp_crcf_destroy(q);
 }
 
+
+// long filters: block method switches to fast convolution for blocks
+// large enough; compare against single-sample execution
+void testbench_firinterp_fft(unsigned int _M,
+                             unsigned int _h_len,
+                             float        _mu)
+{
+    unsigned int n   = 12000;   // number of input samples
+    float        tol = 1e-4f;   // error tolerance
+
+    float h[_h_len];
+    liquid_firdes_kaiser(_h_len, 0.5f/(float)_M, 60.0f, _mu, h);
+    firinterp_crcf q0 = firinterp_crcf_create(_M, h, _h_len);
+    firinterp_crcf q1 = firinterp_crcf_create(_M, h, _h_len);
+    firinterp_crcf_set_scale(q0, 0.5f);
+    firinterp_crcf_set_scale(q1, 0.5f);
+
+    float complex * x  = (float complex*) malloc(n*sizeof(float complex));
+    float complex * y0 = (float complex*) malloc(n*_M*sizeof(float complex));
+    float complex * y1 = (float complex*) malloc(n*_M*sizeof(float complex));
+    unsigned int i;
+    for (i=0; i<n; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+    for (i=0; i<n; i++)
+        firinterp_crcf_execute(q0, x[i], &y0[i*_M]);
+
+    // large blocks mixed with short blocks and single samples
+    unsigned int blocks[8] = {4000, 1, 37, 5100, 2, 1900, 1, 0};
+    unsigned int k = 0;
+    for (i=0; i<8; i++) {
+        unsigned int b = blocks[i] == 0 ? n - k : blocks[i];
+        if (b == 1)
+            firinterp_crcf_execute(q1, x[k], &y1[k*_M]);
+        else
+            firinterp_crcf_execute_block(q1, &x[k], b, &y1[k*_M]);
+        k += b;
+    }
+
+    for (i=0; i<n*_M; i++) {
+        CONTEND_DELTA( crealf(y0[i]), crealf(y1[i]), tol );
+        CONTEND_DELTA( cimagf(y0[i]), cimagf(y1[i]), tol );
+    }
+
+    if (liquid_autotest_verbose)
+        firinterp_crcf_print(q1);
+
+    firinterp_crcf_destroy(q0);
+    firinterp_crcf_destroy(q1);
+    free(x);
+    free(y0);
+    free(y1);
+}
+
+void autotest_firinterp_fft_M2_h2048()  { testbench_firinterp_fft(2, 2048, 0.0f); }
+void autotest_firinterp_fft_M3_h1500()  { testbench_firinterp_fft(3, 1500, 0.3f); }
+void autotest_firinterp_fft_M8_h8192()  { testbench_firinterp_fft(8, 8192, 0.0f); }
+
+// short filters: block method runs direct form over linear buffer
+void autotest_firinterp_block_M2_h29()  { testbench_firinterp_fft(2,   29, 0.0f); }
+void autotest_firinterp_block_M4_h97()  { testbench_firinterp_fft(4,   97, 0.2f); }
@@ -0,0 +1,108 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// compare multi-channel filter output against independent iirfilt
+// objects running on each channel
+void testbench_iirfiltmc_crcf(liquid_iirdes_filtertype _ftype,
+                              unsigned int             _order,
+                              unsigned int             _num_channels)
+{
+    unsigned int n   = 80;      // samples per channel
+    float        tol = 1e-5f;   // error tolerance
+
+    // create multi-channel filter and reference filters
+    iirfiltmc_crcf q = iirfiltmc_crcf_create_prototype(_ftype, LIQUID_IIRDES_LOWPASS,
+            _order, 0.15f, 0.0f, 0.5f, 60.0f, _num_channels);
+    iirfilt_crcf r[_num_channels];
+    unsigned int i, c;
+    for (c=0; c<_num_channels; c++) {
+        r[c] = iirfilt_crcf_create_prototype(_ftype, LIQUID_IIRDES_LOWPASS,
+            LIQUID_IIRDES_SOS, _order, 0.15f, 0.0f, 0.5f, 60.0f);
+    }
+
+    // generate interleaved input, distinct per channel
+    float complex x[n*_num_channels];
+    float complex y[n*_num_channels];
+    for (i=0; i<n; i++) {
+        for (c=0; c<_num_channels; c++)
+            x[i*_num_channels+c] = cexpf(_Complex_I*(0.07f*(c+1)*i + c)) * (i%5==0 ? 2.0f : 1.0f);
+    }
+
+    // run first half one sample at a time, second half as a block
+    for (i=0; i<n/2; i++)
+        iirfiltmc_crcf_execute(q, &x[i*_num_channels], &y[i*_num_channels]);
+    iirfiltmc_crcf_execute_block(q, &x[(n/2)*_num_channels], n-n/2, &y[(n/2)*_num_channels]);
+
+    // compare against reference
+    for (i=0; i<n; i++) {
+        for (c=0; c<_num_channels; c++) {
+            float complex v;
+            iirfilt_crcf_execute(r[c], x[i*_num_channels+c], &v);
+            CONTEND_DELTA( crealf(y[i*_num_channels+c]), crealf(v), tol );
+            CONTEND_DELTA( cimagf(y[i*_num_channels+c]), cimagf(v), tol );
+        }
+    }
+
+    // clean up objects
+    iirfiltmc_crcf_destroy(q);
+    for (c=0; c<_num_channels; c++)
+        iirfilt_crcf_destroy(r[c]);
+}
+
+void autotest_iirfiltmc_crcf_butter_n3_c1()  { testbench_iirfiltmc_crcf(LIQUID_IIRDES_BUTTER, 3,  1); }
+void autotest_iirfiltmc_crcf_cheby1_n6_c4()  { testbench_iirfiltmc_crcf(LIQUID_IIRDES_CHEBY1, 6,  4); }
+void autotest_iirfiltmc_crcf_ellip_n7_c13()  { testbench_iirfiltmc_crcf(LIQUID_IIRDES_ELLIP,  7, 13); }
+
+// block execution of second-order sections must match sample-by-sample
+// execution, including in-place operation
+void autotest_iirfilt_crcf_sos_block()
+{
+    unsigned int n = 100;
+    iirfilt_crcf q0 = iirfilt_crcf_create_prototype(LIQUID_IIRDES_ELLIP,
+            LIQUID_IIRDES_BANDPASS, LIQUID_IIRDES_SOS, 5, 0.1f, 0.2f, 0.5f, 60.0f);
+    iirfilt_crcf q1 = iirfilt_crcf_create_prototype(LIQUID_IIRDES_ELLIP,
+            LIQUID_IIRDES_BANDPASS, LIQUID_IIRDES_SOS, 5, 0.1f, 0.2f, 0.5f, 60.0f);
+
+    float complex x[n];
+    float complex y[n];
+    unsigned int i;
+    for (i=0; i<n; i++)
+        x[i] = (i % 11 == 0 ? 1.0f : 0.0f) + _Complex_I*0.1f*(i%3);
+
+    for (i=0; i<n; i++)
+        iirfilt_crcf_execute(q0, x[i], &y[i]);
+
+    // run block in place on two separate segments
+    iirfilt_crcf_execute_block(q1, x,      n/3, x);
+    iirfilt_crcf_execute_block(q1, x+n/3,  n-n/3, x+n/3);
+
+    for (i=0; i<n; i++) {
+        CONTEND_DELTA( crealf(x[i]), crealf(y[i]), 1e-6f );
+        CONTEND_DELTA( cimagf(x[i]), cimagf(y[i]), 1e-6f );
+    }
+
+    iirfilt_crcf_destroy(q0);
+    iirfilt_crcf_destroy(q1);
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// test multi-stage half-band block execution against single-sample method
+void testbench_msresamp2_crcf_block(int          _type,
+                                    unsigned int _num_stages)
+{
+    unsigned int M   = 1 << _num_stages;    // resampling rate
+    unsigned int n   = 2400 / M + 7;        // number of calls to execute()
+    float        tol = 1e-5f;               // error tolerance
+
+    msresamp2_crcf q0 = msresamp2_crcf_create(_type, _num_stages, 0.4f, 0.0f, 60.0f);
+    msresamp2_crcf q1 = msresamp2_crcf_create(_type, _num_stages, 0.4f, 0.0f, 60.0f);
+
+    // input/output lengths per call
+    unsigned int nx = _type == LIQUID_RESAMP_INTERP ? 1 : M;
+    unsigned int ny = _type == LIQUID_RESAMP_INTERP ? M : 1;
+
+    float complex x [n*nx];
+    float complex y0[n*ny];
+    float complex y1[n*ny];
+    unsigned int i;
+    for (i=0; i<n*nx; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // run single-sample and block methods, the latter on irregular blocks
+    for (i=0; i<n; i++)
+        msresamp2_crcf_execute(q0, &x[i*nx], &y0[i*ny]);
+
+    unsigned int k, b;
+    for (k=0, b=1; k < n; k += b, b = (b * 5 + 2) % 37) {
+        b = k + b > n ? n - k : b;
+        msresamp2_crcf_execute_block(q1, &x[k*nx], b, &y1[k*ny]);
+    }
+
+    for (i=0; i<n*ny; i++) {
+        CONTEND_DELTA( crealf(y0[i]), crealf(y1[i]), tol );
+        CONTEND_DELTA( cimagf(y0[i]), cimagf(y1[i]), tol );
+    }
+
+    msresamp2_crcf_destroy(q0);
+    msresamp2_crcf_destroy(q1);
+}
+
+void autotest_msresamp2_crcf_block_interp_s1() { testbench_msresamp2_crcf_block(LIQUID_RESAMP_INTERP, 1); }
+void autotest_msresamp2_crcf_block_interp_s3() { testbench_msresamp2_crcf_block(LIQUID_RESAMP_INTERP, 3); }
+void autotest_msresamp2_crcf_block_interp_s6() { testbench_msresamp2_crcf_block(LIQUID_RESAMP_INTERP, 6); }
+void autotest_msresamp2_crcf_block_decim_s1()  { testbench_msresamp2_crcf_block(LIQUID_RESAMP_DECIM,  1); }
+void autotest_msresamp2_crcf_block_decim_s3()  { testbench_msresamp2_crcf_block(LIQUID_RESAMP_DECIM,  3); }
+void autotest_msresamp2_crcf_block_decim_s6()  { testbench_msresamp2_crcf_block(LIQUID_RESAMP_DECIM,  6); }
+void autotest_msresamp2_crcf_block_decim_s11() { testbench_msresamp2_crcf_block(LIQUID_RESAMP_DECIM, 11); }
+
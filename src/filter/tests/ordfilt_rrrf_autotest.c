@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+int testbench_ordfilt_compf(const void * _v1, const void * _v2)
+{
+    return *(float*)_v1 > *(float*)_v2 ? 1 : -1;
+}
+
+// compare order statistic against sorting the buffer directly; inputs
+// are quantized so that the buffer frequently holds repeated values
+void testbench_ordfilt_rrrf(unsigned int _n,
+                            unsigned int _k)
+{
+    unsigned int num_samples = 4*_n + 200;
+
+    ordfilt_rrrf q = ordfilt_rrrf_create(_n, _k);
+
+    float buf[_n];          // most recent _n samples, oldest first
+    float buf_sorted[_n];
+    memset(buf, 0x00, _n*sizeof(float));
+
+    unsigned int i;
+    for (i=0; i<num_samples; i++) {
+        float x = roundf(4.0f*randnf()) + (i % 97 == 0 ? 100.0f : 0.0f);
+
+        // reference: shift buffer and sort copy
+        memmove(buf, buf+1, (_n-1)*sizeof(float));
+        buf[_n-1] = x;
+        memmove(buf_sorted, buf, _n*sizeof(float));
+        qsort(buf_sorted, _n, sizeof(float), testbench_ordfilt_compf);
+
+        // alternate single-sample and block methods
+        float y;
+        if (i % 2)
+            ordfilt_rrrf_execute_block(q, &x, 1, &y);
+        else {
+            ordfilt_rrrf_push(q, x);
+            ordfilt_rrrf_execute(q, &y);
+        }
+        CONTEND_EQUALITY(y, buf_sorted[_k]);
+    }
+
+    ordfilt_rrrf_destroy(q);
+}
+
+void autotest_ordfilt_rrrf_n1_k0()      { testbench_ordfilt_rrrf(  1,   0); }
+void autotest_ordfilt_rrrf_n2_k1()      { testbench_ordfilt_rrrf(  2,   1); }
+void autotest_ordfilt_rrrf_n7_k0()      { testbench_ordfilt_rrrf(  7,   0); }
+void autotest_ordfilt_rrrf_n7_k3()      { testbench_ordfilt_rrrf(  7,   3); }
+void autotest_ordfilt_rrrf_n7_k6()      { testbench_ordfilt_rrrf(  7,   6); }
+void autotest_ordfilt_rrrf_n64_k10()    { testbench_ordfilt_rrrf( 64,  10); }
+void autotest_ordfilt_rrrf_n301_k150()  { testbench_ordfilt_rrrf(301, 150); }
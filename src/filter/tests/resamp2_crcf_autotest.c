@@ -173,3 +173,74 @@ void autotest_resamp2_synthesis()
     printf("results written to '%s'\n","resamp2_test.m");
 #endif
 }
+
+// test block decimation/interpolation against single-sample methods,
+// using irregular block sizes to exercise buffer refills
+void testbench_resamp2_block(unsigned int _m,
+                             float        _f0)
+{
+    unsigned int n   = 1200;    // number of low-rate samples
+    float        tol = 1e-5f;   // error tolerance
+
+    // create two identical objects of each type
+    resamp2_crcf q0 = resamp2_crcf_create(_m, _f0, 60.0f);
+    resamp2_crcf q1 = resamp2_crcf_create(_m, _f0, 60.0f);
+    resamp2_cccf r0 = resamp2_cccf_create(_m, _f0, 60.0f);
+    resamp2_cccf r1 = resamp2_cccf_create(_m, _f0, 60.0f);
+
+    float complex x[2*n];
+    float complex y0[2*n];
+    float complex y1[2*n];
+    unsigned int i;
+    for (i=0; i<2*n; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // decimation
+    unsigned int k = 0, b = 1;
+    for (i=0; i<n; i++) {
+        resamp2_crcf_decim_execute(q0, &x[2*i], &y0[i]);
+        resamp2_cccf_decim_execute(r0, &x[2*i], &y1[i]);
+    }
+    float complex z0[n], z1[n];
+    while (k < n) {
+        unsigned int nb = k + b > n ? n - k : b;
+        resamp2_crcf_decim_execute_block(q1, &x[2*k], nb, &z0[k]);
+        resamp2_cccf_decim_execute_block(r1, &x[2*k], nb, &z1[k]);
+        k += nb;
+        b = (b * 7 + 3) % 301;
+    }
+    for (i=0; i<n; i++) {
+        CONTEND_DELTA( crealf(y0[i]), crealf(z0[i]), tol );
+        CONTEND_DELTA( cimagf(y0[i]), cimagf(z0[i]), tol );
+        CONTEND_DELTA( crealf(y1[i]), crealf(z1[i]), tol );
+        CONTEND_DELTA( cimagf(y1[i]), cimagf(z1[i]), tol );
+    }
+
+    // interpolation (state carries over from decimation on both objects)
+    for (i=0; i<n; i++) {
+        resamp2_crcf_interp_execute(q0, x[i], &y0[2*i]);
+        resamp2_cccf_interp_execute(r0, x[i], &y1[2*i]);
+    }
+    float complex w0[2*n], w1[2*n];
+    for (k=0, b=5; k < n; k += b, b = (b * 7 + 3) % 301) {
+        b = k + b > n ? n - k : b;
+        resamp2_crcf_interp_execute_block(q1, &x[k], b, &w0[2*k]);
+        resamp2_cccf_interp_execute_block(r1, &x[k], b, &w1[2*k]);
+    }
+    for (i=0; i<2*n; i++) {
+        CONTEND_DELTA( crealf(y0[i]), crealf(w0[i]), tol );
+        CONTEND_DELTA( cimagf(y0[i]), cimagf(w0[i]), tol );
+        CONTEND_DELTA( crealf(y1[i]), crealf(w1[i]), tol );
+        CONTEND_DELTA( cimagf(y1[i]), cimagf(w1[i]), tol );
+    }
+
+    resamp2_crcf_destroy(q0);
+    resamp2_crcf_destroy(q1);
+    resamp2_cccf_destroy(r0);
+    resamp2_cccf_destroy(r1);
+}
+
+void autotest_resamp2_block_m2()        { testbench_resamp2_block( 2, 0.0f  ); }
+void autotest_resamp2_block_m7()        { testbench_resamp2_block( 7, 0.0f  ); }
+void autotest_resamp2_block_m12_f0()    { testbench_resamp2_block(12, 0.17f ); }
+
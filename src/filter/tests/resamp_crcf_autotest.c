@@ -165,3 +165,53 @@ void autotest_resamp_crcf()
     printf("results written to %s\n",filename);
 #endif
 }
+
+// test that block execution matches sample-by-sample execution,
+// including across internal buffer and schedule boundaries
+void testbench_resamp_crcf_block(float _rate)
+{
+    unsigned int nx = 1200;     // number of input samples
+    unsigned int ny_max = (unsigned int)ceilf(_rate*nx) + 8;
+
+    // create two identical resamplers
+    resamp_crcf q0 = resamp_crcf_create(_rate,7,0.4f,60.0f,256);
+    resamp_crcf q1 = resamp_crcf_create(_rate,7,0.4f,60.0f,256);
+
+    float complex x [nx];
+    float complex y0[ny_max];
+    float complex y1[ny_max];
+    unsigned int i;
+    for (i=0; i<nx; i++)
+        x[i] = cexpf(_Complex_I*0.1f*i) * (i % 3 ? 1.0f : 0.5f);
+
+    // run sample-by-sample
+    unsigned int ny0 = 0, nw;
+    for (i=0; i<nx; i++) {
+        resamp_crcf_execute(q0, x[i], &y0[ny0], &nw);
+        ny0 += nw;
+    }
+
+    // run in irregular block sizes
+    unsigned int ny1 = 0, n = 0, block_len = 1;
+    while (n < nx) {
+        unsigned int num_in = n + block_len < nx ? block_len : nx - n;
+        resamp_crcf_execute_block(q1, &x[n], num_in, &y1[ny1], &nw);
+        n   += num_in;
+        ny1 += nw;
+        block_len = (block_len * 7 + 3) % 331 + 1;
+    }
+
+    CONTEND_EQUALITY(ny0, ny1);
+    for (i=0; i<ny0 && i<ny1; i++) {
+        CONTEND_DELTA( crealf(y0[i]), crealf(y1[i]), 1e-6f );
+        CONTEND_DELTA( cimagf(y0[i]), cimagf(y1[i]), 1e-6f );
+    }
+
+    resamp_crcf_destroy(q0);
+    resamp_crcf_destroy(q1);
+}
+
+void autotest_resamp_crcf_block_r0p37() { testbench_resamp_crcf_block(0.37f); }
+void autotest_resamp_crcf_block_r0p99() { testbench_resamp_crcf_block(0.99f); }
+void autotest_resamp_crcf_block_r1p01() { testbench_resamp_crcf_block(1.01f); }
+void autotest_resamp_crcf_block_r3p70() { testbench_resamp_crcf_block(3.70f); }
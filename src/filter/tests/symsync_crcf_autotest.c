@@ -175,3 +175,55 @@ void autotest_symsync_crcf_scenario_1() { symsync_crcf_test(2, 7, 0.35, -0.25, 1
 void autotest_symsync_crcf_scenario_2() { symsync_crcf_test(2, 7, 0.35, -0.25, 1.0001f ); }
 void autotest_symsync_crcf_scenario_3() { symsync_crcf_test(2, 7, 0.35, -0.25, 0.9999f ); }
 
+
+// block method must match sample-by-sample execution exactly, for any
+// partitioning of the input and with timing loop active
+void testbench_symsync_crcf_block(unsigned int _k,
+                                  unsigned int _m)
+{
+    unsigned int num_samples = 2400;
+    float        tol         = 1e-6f;
+
+    symsync_crcf q0 = symsync_crcf_create_rnyquist(LIQUID_FIRFILT_ARKAISER, _k, _m, 0.35f, 32);
+    symsync_crcf q1 = symsync_crcf_create_rnyquist(LIQUID_FIRFILT_ARKAISER, _k, _m, 0.35f, 32);
+    symsync_crcf_set_lf_bw(q0, 0.02f);
+    symsync_crcf_set_lf_bw(q1, 0.02f);
+
+    // random QPSK-like input with timing drift
+    float complex x[num_samples];
+    float complex y0[num_samples], y1[num_samples];
+    unsigned int i;
+    for (i=0; i<num_samples; i++)
+        x[i] = (randnf() > 0 ? 1.0f : -1.0f) + _Complex_I*(randnf() > 0 ? 1.0f : -1.0f);
+
+    // single sample at a time
+    unsigned int ny0 = 0, ny1 = 0, n;
+    for (i=0; i<num_samples; i++) {
+        symsync_crcf_execute(q0, &x[i], 1, &y0[ny0], &n);
+        ny0 += n;
+    }
+
+    // irregular blocks, mixed with single-sample calls
+    unsigned int k, b;
+    for (k=0, b=1; k < num_samples; k += b, b = (b * 7 + 5) % 613) {
+        b = k + b > num_samples ? num_samples - k : b;
+        if (b == 1)
+            symsync_crcf_execute(q1, &x[k], b, &y1[ny1], &n);
+        else
+            symsync_crcf_execute_block(q1, &x[k], b, &y1[ny1], &n);
+        ny1 += n;
+    }
+
+    CONTEND_EQUALITY(ny0, ny1);
+    for (i=0; i<ny0 && i<ny1; i++) {
+        CONTEND_DELTA( crealf(y0[i]), crealf(y1[i]), tol );
+        CONTEND_DELTA( cimagf(y0[i]), cimagf(y1[i]), tol );
+    }
+    CONTEND_DELTA( symsync_crcf_get_tau(q0), symsync_crcf_get_tau(q1), tol );
+
+    symsync_crcf_destroy(q0);
+    symsync_crcf_destroy(q1);
+}
+
+void autotest_symsync_crcf_block_k2_m3() { testbench_symsync_crcf_block(2, 3); }
+void autotest_symsync_crcf_block_k4_m7() { testbench_symsync_crcf_block(4, 7); }
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <sys/resource.h>
+#include "liquid.h"
+#include "bench/bench.h"
+
+// Helper function to keep code base small; a trial is one output sample,
+// timed by wall clock so that rates over thread counts are comparable
+//  _num_sources    :   number of sources
+//  _mixed          :   cycle through source types? (otherwise linear modem)
+//  _num_threads    :   number of threads generating sources
+void msourcecf_bench(struct rusage *     _start,
+                     struct rusage *     _finish,
+                     unsigned long int * _num_iterations,
+                     unsigned int        _num_sources,
+                     int                 _mixed,
+                     unsigned int        _num_threads)
+{
+    // normalize number of iterations: cycles/sample ~ 20 + 10*_num_sources
+    *_num_iterations *= 100;
+    *_num_iterations /= 20 + 10*_num_sources;
+
+    // create generator with sources spread across band
+    msourcecf gen = msourcecf_create_default();
+    msourcecf_set_num_threads(gen, _num_threads);
+    unsigned int i;
+    for (i=0; i<_num_sources; i++) {
+        float fc = -0.4f + 0.8f*((float)i + 0.5f) / (float)_num_sources;
+        float bw =  0.5f / (float)_num_sources;
+        switch (_mixed ? i % 6 : 0) {
+        case 0: msourcecf_add_modem(gen, fc, bw, -10.0f, LIQUID_MODEM_QPSK, 12, 0.25f); break;
+        case 1: msourcecf_add_fsk  (gen, fc, bw, -10.0f, 2, 8);                         break;
+        case 2: msourcecf_add_gmsk (gen, fc, bw, -10.0f, 4, 0.3f);                      break;
+        case 3: msourcecf_add_noise(gen, fc, bw, -40.0f);                               break;
+        case 4: msourcecf_add_tone (gen, fc, 0.0f, -20.0f);                             break;
+        case 5: msourcecf_add_chirp(gen, fc, bw, -20.0f, 1e4f, 0, 0);                   break;
+        }
+    }
+
+    // output buffer
+    unsigned int  buf_len = 1024;
+    float complex buf[buf_len];
+
+    // start trials
+    unsigned long int t;
+    unsigned long int num_blocks = *_num_iterations / buf_len + 1;
+    benchmark_get_wall_time(_start);
+    for (t=0; t<num_blocks; t++)
+        msourcecf_write_samples(gen, buf, buf_len);
+    benchmark_get_wall_time(_finish);
+    *_num_iterations = num_blocks * buf_len;
+
+    msourcecf_destroy(gen);
+}
+
+#define MSOURCECF_BENCH_API(N,MIXED)        \
+(   struct rusage *     _start,             \
+    struct rusage *     _finish,            \
+    unsigned long int * _num_iterations)    \
+{ msourcecf_bench(_start, _finish, _num_iterations, N, MIXED, 1); }
+
+#define MSOURCECF_THREADS_BENCH_API(N,T)    \
+(   struct rusage *     _start,             \
+    struct rusage *     _finish,            \
+    unsigned long int * _num_iterations)    \
+{ msourcecf_bench(_start, _finish, _num_iterations, N, 1, T); }
+
+// linear modem sources
+void benchmark_msourcecf_modem_1    MSOURCECF_BENCH_API(  1, 0)
+void benchmark_msourcecf_modem_8    MSOURCECF_BENCH_API(  8, 0)
+void benchmark_msourcecf_modem_32   MSOURCECF_BENCH_API( 32, 0)
+
+// mixed sources: modem, fsk, gmsk, noise, tone, chirp
+void benchmark_msourcecf_mixed_6    MSOURCECF_BENCH_API(  6, 1)
+void benchmark_msourcecf_mixed_36   MSOURCECF_BENCH_API( 36, 1)
+void benchmark_msourcecf_mixed_120  MSOURCECF_BENCH_API(120, 1)
+
+// mixed sources on multiple threads
+void benchmark_msourcecf_mixed_36_t4   MSOURCECF_THREADS_BENCH_API( 36, 4)
+void benchmark_msourcecf_mixed_120_t4  MSOURCECF_THREADS_BENCH_API(120, 4)
+
+// Helper function for symbol stream generator; a trial is one sample
+void symstreamcf_bench(struct rusage *     _start,
+                       struct rusage *     _finish,
+                       unsigned long int * _num_iterations,
+                       unsigned int        _k,
+                       unsigned int        _m)
+{
+    // normalize number of iterations: cycles/sample ~ 10 + 4*_m
+    *_num_iterations *= 50;
+    *_num_iterations /= 10 + 4*_m;
+
+    symstreamcf gen = symstreamcf_create_linear(LIQUID_FIRFILT_ARKAISER, _k, _m, 0.3f, LIQUID_MODEM_QPSK);
+
+    // output buffer
+    unsigned int  buf_len = 1024;
+    float complex buf[buf_len];
+
+    // start trials
+    unsigned long int t;
+    unsigned long int num_blocks = *_num_iterations / buf_len + 1;
+    getrusage(RUSAGE_SELF, _start);
+    for (t=0; t<num_blocks; t++)
+        symstreamcf_write_samples(gen, buf, buf_len);
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations = num_blocks * buf_len;
+
+    symstreamcf_destroy(gen);
+}
+
+#define SYMSTREAMCF_BENCH_API(K,M)          \
+(   struct rusage *     _start,             \
+    struct rusage *     _finish,            \
+    unsigned long int * _num_iterations)    \
+{ symstreamcf_bench(_start, _finish, _num_iterations, K, M); }
+
+void benchmark_symstreamcf_k2_m7    SYMSTREAMCF_BENCH_API(2,  7)
+void benchmark_symstreamcf_k4_m12   SYMSTREAMCF_BENCH_API(4, 12)
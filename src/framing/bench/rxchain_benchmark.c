@@ -0,0 +1,308 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// rxchain_benchmark.c
+//
+// End-to-end receiver chains, from captured samples to decoded
+// payloads; a trial is one input sample at the nominal sample rate of
+// the chain, for which the real-time factor is reported.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <math.h>
+#include <sys/resource.h>
+#include "liquid.h"
+#include "bench/bench.h"
+
+// number of input samples processed per block
+#define RXCHAIN_BLOCK_LEN   (1024)
+
+// count received frames
+static int rxchain_callback(unsigned char *  _header,
+                            int              _header_valid,
+                            unsigned char *  _payload,
+                            unsigned int     _payload_len,
+                            int              _payload_valid,
+                            framesyncstats_s _stats,
+                            void *           _userdata)
+{
+    unsigned int * num_valid = (unsigned int*) _userdata;
+    *num_valid += _payload_valid ? 1 : 0;
+    return 0;
+}
+
+// Helper function: interleaved 16-bit I/Q capture at _fs with carrier
+// offset, downconverted (nco), resampled to 2 samples/symbol (msresamp)
+// and synchronized/decoded (flexframesync)
+void rxchain_flexframe_ci16_bench(struct rusage *     _start,
+                                  struct rusage *     _finish,
+                                  unsigned long int * _num_iterations,
+                                  float               _fs,
+                                  float               _symbol_rate,
+                                  unsigned int        _payload_len)
+{
+    benchmark_set_sample_rate(_fs);
+    unsigned long int i;
+
+    // create frame generator
+    flexframegenprops_s fgprops;
+    flexframegenprops_init_default(&fgprops);
+    fgprops.check      = LIQUID_CRC_32;
+    fgprops.fec0       = LIQUID_FEC_HAMMING74;
+    fgprops.fec1       = LIQUID_FEC_NONE;
+    fgprops.mod_scheme = LIQUID_MODEM_QPSK;
+    flexframegen fg = flexframegen_create(&fgprops);
+
+    // generate frame at 2 samples/symbol
+    unsigned char header[14] = {0};
+    unsigned char payload[_payload_len];
+    for (i=0; i<_payload_len; i++)
+        payload[i] = rand() & 0xff;
+    flexframegen_assemble(fg, header, payload, _payload_len);
+    unsigned int frame_len = flexframegen_getframelen(fg);
+    float complex * frame = (float complex*) malloc(frame_len*sizeof(float complex));
+    flexframegen_write_samples(fg, frame, frame_len);
+    flexframegen_destroy(fg);
+
+    // resample frame to capture rate, with gap between frames
+    float r = _fs / (2.0f*_symbol_rate);
+    msresamp_crcf resamp = msresamp_crcf_create(r, 60.0f);
+    unsigned int num_gap = 64;
+    unsigned int num_capture = (unsigned int)(r*(frame_len + 2*num_gap)) + 64;
+    float complex * capture = (float complex*) malloc(num_capture*sizeof(float complex));
+    float complex zeros[num_gap];
+    for (i=0; i<num_gap; i++)
+        zeros[i] = 0.0f;
+    unsigned int n, ny = 0;
+    msresamp_crcf_execute(resamp, zeros, num_gap,   capture+ny, &n); ny += n;
+    msresamp_crcf_execute(resamp, frame, frame_len, capture+ny, &n); ny += n;
+    msresamp_crcf_execute(resamp, zeros, num_gap,   capture+ny, &n); ny += n;
+    msresamp_crcf_destroy(resamp);
+    free(frame);
+
+    // apply carrier offset, noise and quantize to 16 bits
+    float dphi = 0.2f;
+    int16_t * x16 = (int16_t*) malloc(2*ny*sizeof(int16_t));
+    for (i=0; i<ny; i++) {
+        float complex v = capture[i]*cexpf(_Complex_I*dphi*i) +
+                          0.02f*(randnf() + _Complex_I*randnf());
+        x16[2*i+0] = (int16_t) lroundf(8192.0f*crealf(v));
+        x16[2*i+1] = (int16_t) lroundf(8192.0f*cimagf(v));
+    }
+    free(capture);
+
+    // create receiver chain
+    unsigned int num_valid = 0;
+    nco_crcf       nco = nco_crcf_create(LIQUID_NCO);
+    nco_crcf_set_frequency(nco, dphi);
+    msresamp_crcf  rx  = msresamp_crcf_create(1.0f/r, 60.0f);
+    flexframesync  fs  = flexframesync_create(rxchain_callback, (void*)&num_valid);
+    float complex buf  [RXCHAIN_BLOCK_LEN];
+    float complex buf_y[RXCHAIN_BLOCK_LEN];
+
+    // normalize number of iterations to whole captures
+    unsigned long int num_loops = *_num_iterations / ny + 1;
+
+    // start trials
+    unsigned long int t;
+    getrusage(RUSAGE_SELF, _start);
+    for (t=0; t<num_loops; t++) {
+        for (i=0; i<ny; i+=RXCHAIN_BLOCK_LEN) {
+            n = ny - i < RXCHAIN_BLOCK_LEN ? ny - i : RXCHAIN_BLOCK_LEN;
+            nco_crcf_mix_block_down_ci16(nco, &x16[2*i], buf, n);
+            unsigned int num_written;
+            msresamp_crcf_execute(rx, buf, n, buf_y, &num_written);
+            flexframesync_execute(fs, buf_y, num_written);
+        }
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations = num_loops * ny;
+
+    if (num_valid < num_loops)
+        fprintf(stderr,"warning: rxchain_flexframe_ci16_bench(), payloads valid/transmitted: %u / %lu\n", num_valid, num_loops);
+
+    nco_crcf_destroy(nco);
+    msresamp_crcf_destroy(rx);
+    flexframesync_destroy(fs);
+    free(x16);
+}
+
+// Helper function: OFDM frames at _fs through ofdmflexframesync with
+// payload decoding
+void rxchain_ofdmflexframe_bench(struct rusage *     _start,
+                                 struct rusage *     _finish,
+                                 unsigned long int * _num_iterations,
+                                 float               _fs,
+                                 unsigned int        _M,
+                                 unsigned int        _cp_len,
+                                 int                 _ms,
+                                 unsigned int        _payload_len)
+{
+    benchmark_set_sample_rate(_fs);
+    unsigned long int i;
+    unsigned int taper_len = 4;
+
+    // create frame generator
+    ofdmflexframegenprops_s fgprops;
+    ofdmflexframegenprops_init_default(&fgprops);
+    fgprops.check      = LIQUID_CRC_32;
+    fgprops.fec0       = LIQUID_FEC_HAMMING74;
+    fgprops.fec1       = LIQUID_FEC_NONE;
+    fgprops.mod_scheme = _ms;
+    ofdmflexframegen fg = ofdmflexframegen_create(_M, _cp_len, taper_len, NULL, &fgprops);
+
+    // generate frame, followed by gap
+    unsigned char header[8] = {0};
+    unsigned char payload[_payload_len];
+    for (i=0; i<_payload_len; i++)
+        payload[i] = rand() & 0xff;
+    ofdmflexframegen_assemble(fg, header, payload, _payload_len);
+    unsigned int symbol_len = _M + _cp_len;
+    unsigned int num_capture = 0;
+    float complex * capture = NULL;
+    int last_symbol = 0;
+    while (!last_symbol) {
+        capture = (float complex*) realloc(capture, (num_capture+symbol_len)*sizeof(float complex));
+        last_symbol = ofdmflexframegen_write(fg, capture+num_capture, symbol_len);
+        num_capture += symbol_len;
+    }
+    capture = (float complex*) realloc(capture, (num_capture+4*symbol_len)*sizeof(float complex));
+    for (i=0; i<4*symbol_len; i++)
+        capture[num_capture++] = 0.0f;
+    for (i=0; i<num_capture; i++)
+        capture[i] += 0.01f*(randnf() + _Complex_I*randnf());
+    ofdmflexframegen_destroy(fg);
+
+    // create synchronizer
+    unsigned int num_valid = 0;
+    ofdmflexframesync fs = ofdmflexframesync_create(_M, _cp_len, taper_len, NULL,
+                                                    rxchain_callback, (void*)&num_valid);
+
+    // normalize number of iterations to whole captures
+    unsigned long int num_loops = *_num_iterations / num_capture + 1;
+
+    // start trials
+    unsigned long int t;
+    getrusage(RUSAGE_SELF, _start);
+    for (t=0; t<num_loops; t++) {
+        for (i=0; i<num_capture; i+=RXCHAIN_BLOCK_LEN) {
+            unsigned int n = num_capture - i < RXCHAIN_BLOCK_LEN ? num_capture - i : RXCHAIN_BLOCK_LEN;
+            ofdmflexframesync_execute(fs, capture+i, n);
+        }
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations = num_loops * num_capture;
+
+    if (num_valid < num_loops)
+        fprintf(stderr,"warning: rxchain_ofdmflexframe_bench(), payloads valid/transmitted: %u / %lu\n", num_valid, num_loops);
+
+    ofdmflexframesync_destroy(fs);
+    free(capture);
+}
+
+// Helper function: _M-channel analysis filterbank at _fs with symbol
+// demodulation on every channel; channel outputs are at 2 samples/
+// symbol, so every other output block is demodulated
+void rxchain_firpfbch2_bench(struct rusage *     _start,
+                             struct rusage *     _finish,
+                             unsigned long int * _num_iterations,
+                             float               _fs,
+                             unsigned int        _M,
+                             unsigned int        _m,
+                             int                 _ms)
+{
+    benchmark_set_sample_rate(_fs);
+    unsigned long int i;
+
+    // create channelizer, demodulator
+    firpfbch2_crcf q = firpfbch2_crcf_create_kaiser(LIQUID_ANALYZER, _M, _m, 60.0f);
+    modem demod = modem_create(_ms);
+
+    // wideband input, processed _M/2 samples at a time
+    unsigned int num_capture = 64*_M;
+    float complex * x = (float complex*) malloc(num_capture*sizeof(float complex));
+    float complex * y = (float complex*) malloc(_M*sizeof(float complex));
+    for (i=0; i<num_capture; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // normalize number of iterations to whole captures
+    unsigned long int num_loops = *_num_iterations / num_capture + 1;
+
+    // start trials
+    unsigned long int t;
+    unsigned int k, sym, sym_sum = 0;
+    int demod_block = 0;
+    getrusage(RUSAGE_SELF, _start);
+    for (t=0; t<num_loops; t++) {
+        for (i=0; i<num_capture; i+=_M/2) {
+            firpfbch2_crcf_execute(q, x+i, y);
+            demod_block = !demod_block;
+            if (!demod_block)
+                continue;
+            for (k=0; k<_M; k++) {
+                modem_demodulate(demod, y[k], &sym);
+                sym_sum += sym;
+            }
+        }
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations = num_loops * num_capture;
+
+    // keep result live
+    if (sym_sum == 0)
+        printf("  (no symbols)\n");
+
+    firpfbch2_crcf_destroy(q);
+    modem_destroy(demod);
+    free(x);
+    free(y);
+}
+
+#define RXCHAIN_FLEXFRAME_CI16_BENCHMARK_API(FS,RS,N)   \
+(   struct rusage *_start,                              \
+    struct rusage *_finish,                             \
+    unsigned long int *_num_iterations)                 \
+{ rxchain_flexframe_ci16_bench(_start, _finish, _num_iterations, FS, RS, N); }
+
+#define RXCHAIN_OFDMFLEXFRAME_BENCHMARK_API(FS,M,CP,MS,N)   \
+(   struct rusage *_start,                                  \
+    struct rusage *_finish,                                 \
+    unsigned long int *_num_iterations)                     \
+{ rxchain_ofdmflexframe_bench(_start, _finish, _num_iterations, FS, M, CP, MS, N); }
+
+#define RXCHAIN_FIRPFBCH2_BENCHMARK_API(FS,M,P,MS)      \
+(   struct rusage *_start,                              \
+    struct rusage *_finish,                             \
+    unsigned long int *_num_iterations)                 \
+{ rxchain_firpfbch2_bench(_start, _finish, _num_iterations, FS, M, P, MS); }
+
+// ci16 capture at 2.5 MHz, 500 kS/s QPSK frames, 256-byte payloads
+void benchmark_rxchain_flexframe_ci16_2M5       RXCHAIN_FLEXFRAME_CI16_BENCHMARK_API(2.5e6f, 500e3f, 256)
+
+// 20 MHz OFDM (64 subcarriers), 1500-byte payloads
+void benchmark_rxchain_ofdmflexframe_20M_qpsk   RXCHAIN_OFDMFLEXFRAME_BENCHMARK_API(20e6f, 64, 16, LIQUID_MODEM_QPSK,  1500)
+void benchmark_rxchain_ofdmflexframe_20M_qam16  RXCHAIN_OFDMFLEXFRAME_BENCHMARK_API(20e6f, 64, 16, LIQUID_MODEM_QAM16, 1500)
+
+// 1024-channel analysis filterbank at 61.44 MHz, QPSK per channel
+void benchmark_rxchain_firpfbch2_1024           RXCHAIN_FIRPFBCH2_BENCHMARK_API(61.44e6f, 1024, 4, LIQUID_MODEM_QPSK)
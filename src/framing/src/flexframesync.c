@@ -76,6 +76,18 @@ static flexframegenprops_s flexframesyncprops_header_default = {
    FLEXFRAME_H_MOD,
 };
 
+// profile stages
+enum {
+    FLEXFRAMESYNC_PROFILE_DETECT=0, // frame detector (qdetector)
+    FLEXFRAMESYNC_PROFILE_MF,       // mixer, matched filter (firpfb)
+    FLEXFRAMESYNC_PROFILE_EQ,       // equalizer (eqlms)
+    FLEXFRAMESYNC_PROFILE_DEMOD,    // pilot recovery, payload demod, pll
+    FLEXFRAMESYNC_PROFILE_DECODE,   // header/payload decoding (qpacketmodem)
+    FLEXFRAMESYNC_PROFILE_NUM_STAGES
+};
+static const char * flexframesync_profile_stages[FLEXFRAMESYNC_PROFILE_NUM_STAGES] = {
+    "detect", "mf", "eq", "demod", "decode"};
+
 // flexframesync object structure
 struct flexframesync_s {
     // callback
@@ -83,6 +95,7 @@ struct flexframesync_s {
     void *              userdata;       // user-defined data structure
     framesyncstats_s    framesyncstats; // frame statistic object (synchronizer)
     framedatastats_s    framedatastats; // frame statistic object (packet statistics)
+    liquid_profile_s    profile;        // per-stage instrumentation
     
     // synchronizer objects
     unsigned int    m;                  // filter delay (symbols)
@@ -157,7 +170,7 @@ struct flexframesync_s {
 flexframesync flexframesync_create(framesync_callback _callback,
                                    void *             _userdata)
 {
-    flexframesync q = (flexframesync) malloc(sizeof(struct flexframesync_s));
+    flexframesync q = (flexframesync) liquid_malloc(sizeof(struct flexframesync_s), "flexframesync");
     q->callback = _callback;
     q->userdata = _userdata;
     q->m        = 7;    // filter delay (symbols)
@@ -166,8 +179,8 @@ flexframesync flexframesync_create(framesync_callback _callback,
     unsigned int i;
 
     // generate p/n sequence
-    q->preamble_pn = (float complex*) malloc(64*sizeof(float complex));
-    q->preamble_rx = (float complex*) malloc(64*sizeof(float complex));
+    q->preamble_pn = (float complex*) liquid_malloc(64*sizeof(float complex), "flexframesync");
+    q->preamble_rx = (float complex*) liquid_malloc(64*sizeof(float complex), "flexframesync");
     msequence ms = msequence_create(7, 0x0089, 1);
     for (i=0; i<64; i++) {
         q->preamble_pn[i] = (msequence_advance(ms) ? M_SQRT1_2 : -M_SQRT1_2);
@@ -222,13 +235,18 @@ flexframesync flexframesync_create(framesync_callback _callback,
     q->payload_sym_len = qpacketmodem_get_frame_len(q->payload_decoder);
 
     // allocate memory for payload symbols and recovered data bytes
-    q->payload_sym = (float complex*) malloc(q->payload_sym_len*sizeof(float complex));
-    q->payload_dec = (unsigned char*) malloc(q->payload_dec_len*sizeof(unsigned char));
+    q->payload_sym = (float complex*) liquid_malloc(q->payload_sym_len*sizeof(float complex), "flexframesync");
+    q->payload_dec = (unsigned char*) liquid_malloc(q->payload_dec_len*sizeof(unsigned char), "flexframesync");
     q->payload_soft = 0;
 
     // reset global data counters
     flexframesync_reset_framedatastats(q);
 
+    // initialize profile and add to registry
+    liquid_profile_init(&q->profile, "flexframesync",
+                        flexframesync_profile_stages, FLEXFRAMESYNC_PROFILE_NUM_STAGES);
+    liquid_profile_register(&q->profile);
+
 #if DEBUG_FLEXFRAMESYNC
     // set debugging flags, objects to NULL
     q->debug_enabled         = 0;
@@ -251,14 +269,17 @@ void flexframesync_destroy(flexframesync _q)
         windowcf_destroy(_q->debug_x);
 #endif
 
+    // remove profile from registry
+    liquid_profile_unregister(&_q->profile);
+
     // free allocated arrays
-    free(_q->preamble_pn);
-    free(_q->preamble_rx);
-    free(_q->header_sym);
-    free(_q->header_mod);
-    free(_q->header_dec);
-    free(_q->payload_sym);
-    free(_q->payload_dec);
+    liquid_free(_q->preamble_pn, "flexframesync");
+    liquid_free(_q->preamble_rx, "flexframesync");
+    liquid_free(_q->header_sym, "flexframesync");
+    liquid_free(_q->header_mod, "flexframesync");
+    liquid_free(_q->header_dec, "flexframesync");
+    liquid_free(_q->payload_sym, "flexframesync");
+    liquid_free(_q->payload_dec, "flexframesync");
 
     // destroy synchronization objects
     qpilotsync_destroy    (_q->header_pilotsync); // header demodulator/decoder
@@ -274,7 +295,7 @@ void flexframesync_destroy(flexframesync _q)
 #endif
 
     // free main object memory
-    free(_q);
+    liquid_free(_q, "flexframesync");
 }
 
 // print frame synchronizer object internals
@@ -284,6 +305,23 @@ void flexframesync_print(flexframesync _q)
     framedatastats_print(&_q->framedatastats);
 }
 
+// get number of bytes allocated by object: frame buffers, detector and
+// header/payload decoders; a lower bound, as sub-objects without
+// accounting are not included (see liquid.h)
+unsigned long int flexframesync_get_memory_usage(flexframesync _q)
+{
+    return sizeof(struct flexframesync_s) +
+           2*64*sizeof(float complex) +                 // preamble
+           _q->header_sym_len*sizeof(float complex) +   // header symbols
+           _q->header_mod_len*sizeof(float complex) +
+           _q->header_dec_len*sizeof(unsigned char) +   // header bytes
+           _q->payload_sym_len*sizeof(float complex) +  // payload symbols
+           _q->payload_dec_len*sizeof(unsigned char) +  // payload bytes
+           qdetector_cccf_get_memory_usage(_q->detector) +
+           qpacketmodem_get_memory_usage(_q->header_decoder) +
+           qpacketmodem_get_memory_usage(_q->payload_decoder);
+}
+
 // reset frame synchronizer object
 void flexframesync_reset(flexframesync _q)
 {
@@ -316,7 +354,7 @@ void flexframesync_set_header_len(flexframesync _q,
 {
     _q->header_user_len = _len;
     _q->header_dec_len = FLEXFRAME_H_DEC + _q->header_user_len;
-    _q->header_dec     = (unsigned char *) realloc(_q->header_dec, _q->header_dec_len*sizeof(unsigned char));
+    _q->header_dec     = (unsigned char *) liquid_realloc(_q->header_dec, _q->header_dec_len*sizeof(unsigned char), "flexframesync");
     if (_q->header_decoder) {
         qpacketmodem_destroy(_q->header_decoder);
     }
@@ -328,7 +366,7 @@ void flexframesync_set_header_len(flexframesync _q,
                            _q->header_props.fec1,
                            _q->header_props.mod_scheme);
     _q->header_mod_len = qpacketmodem_get_frame_len(_q->header_decoder);
-    _q->header_mod     = (float complex*) realloc(_q->header_mod, _q->header_mod_len*sizeof(float complex));
+    _q->header_mod     = (float complex*) liquid_realloc(_q->header_mod, _q->header_mod_len*sizeof(float complex), "flexframesync");
 
     // header pilot synchronizer
     if (_q->header_pilotsync) {
@@ -336,7 +374,7 @@ void flexframesync_set_header_len(flexframesync _q,
     }
     _q->header_pilotsync = qpilotsync_create(_q->header_mod_len, 16);
     _q->header_sym_len   = qpilotsync_get_frame_len(_q->header_pilotsync);
-    _q->header_sym       = (float complex*) realloc(_q->header_sym, _q->header_sym_len*sizeof(float complex));
+    _q->header_sym       = (float complex*) liquid_realloc(_q->header_sym, _q->header_sym_len*sizeof(float complex), "flexframesync");
 }
 
 void flexframesync_decode_header_soft(flexframesync _q,
@@ -431,7 +469,9 @@ void flexframesync_execute_seekpn(flexframesync _q,
                                   float complex _x)
 {
     // push through pre-demod synchronizer
+    LIQUID_PROFILE_BEGIN(t0);
     float complex * v = qdetector_cccf_execute(_q->detector, _x);
+    LIQUID_PROFILE_END(&_q->profile, FLEXFRAMESYNC_PROFILE_DETECT, t0, 1);
 
     // check if frame has been detected
     if (v == NULL)
@@ -488,6 +528,7 @@ int flexframesync_step(flexframesync   _q,
                        float complex * _y)
 {
     // mix sample down
+    LIQUID_PROFILE_BEGIN(t0);
     float complex v;
     nco_crcf_mix_down(_q->mixer, _x, &v);
     nco_crcf_step    (_q->mixer);
@@ -495,10 +536,13 @@ int flexframesync_step(flexframesync   _q,
     // push sample into filterbank
     firpfb_crcf_push   (_q->mf, v);
     firpfb_crcf_execute(_q->mf, _q->pfb_index, &v);
+    LIQUID_PROFILE_END(&_q->profile, FLEXFRAMESYNC_PROFILE_MF, t0, 1);
 
 #if FLEXFRAMESYNC_ENABLE_EQ
     // push sample through equalizer
+    LIQUID_PROFILE_BEGIN(t1);
     eqlms_cccf_push(_q->equalizer, v);
+    LIQUID_PROFILE_END(&_q->profile, FLEXFRAMESYNC_PROFILE_EQ, t1, 1);
 #endif
 
     // increment counter to determine if sample is available
@@ -509,7 +553,9 @@ int flexframesync_step(flexframesync   _q,
     if (sample_available) {
 #if FLEXFRAMESYNC_ENABLE_EQ
         // compute equalizer output
+        LIQUID_PROFILE_BEGIN(t2);
         eqlms_cccf_execute(_q->equalizer, &v);
+        LIQUID_PROFILE_END(&_q->profile, FLEXFRAMESYNC_PROFILE_EQ, t2, 0);
 #endif
 
         // set output
@@ -550,7 +596,9 @@ void flexframesync_execute_rxpreamble(flexframesync _q,
         
 #if FLEXFRAMESYNC_ENABLE_EQ
             // train equalizer
+            LIQUID_PROFILE_BEGIN(t0);
             eqlms_cccf_step(_q->equalizer, _q->preamble_pn[index], mf_out);
+            LIQUID_PROFILE_END(&_q->profile, FLEXFRAMESYNC_PROFILE_EQ, t0, 0);
 #endif
         }
 
@@ -631,9 +679,12 @@ void flexframesync_execute_rxheader(flexframesync _q,
 void flexframesync_decode_header(flexframesync _q)
 {
     // recover data symbols from pilots
+    LIQUID_PROFILE_BEGIN(t0);
     qpilotsync_execute(_q->header_pilotsync, _q->header_sym, _q->header_mod);
+    LIQUID_PROFILE_END(&_q->profile, FLEXFRAMESYNC_PROFILE_DEMOD, t0, _q->header_sym_len);
 
     // decode payload
+    LIQUID_PROFILE_BEGIN(t1);
     if (_q->header_soft) {
         _q->header_valid = qpacketmodem_decode_soft(_q->header_decoder,
                                                     _q->header_mod,
@@ -643,6 +694,7 @@ void flexframesync_decode_header(flexframesync _q)
                                                _q->header_mod,
                                                _q->header_dec);
     }
+    LIQUID_PROFILE_END(&_q->profile, FLEXFRAMESYNC_PROFILE_DECODE, t1, _q->header_mod_len);
 
     if (!_q->header_valid)
         return;
@@ -710,8 +762,8 @@ void flexframesync_decode_header(flexframesync _q)
     _q->payload_sym_len = qpacketmodem_get_frame_len(_q->payload_decoder);
 
     // re-allocate buffers accordingly
-    _q->payload_sym = (float complex*) realloc(_q->payload_sym, (_q->payload_sym_len)*sizeof(float complex));
-    _q->payload_dec = (unsigned char*) realloc(_q->payload_dec, (_q->payload_dec_len)*sizeof(unsigned char));
+    _q->payload_sym = (float complex*) liquid_realloc(_q->payload_sym, (_q->payload_sym_len)*sizeof(float complex), "flexframesync");
+    _q->payload_dec = (unsigned char*) liquid_realloc(_q->payload_dec, (_q->payload_dec_len)*sizeof(unsigned char), "flexframesync");
 
     if (_q->payload_sym == NULL || _q->payload_dec == NULL) {
         fprintf(stderr,"error: flexframesync_decode_header(), could not re-allocate payload arrays\n");
@@ -753,6 +805,7 @@ void flexframesync_execute_rxpayload(flexframesync _q,
     if (sample_available) {
         // TODO: clean this up
         // mix down with fine-tuned oscillator
+        LIQUID_PROFILE_BEGIN(t0);
         nco_crcf_mix_down(_q->pll, mf_out, &mf_out);
         // track phase, accumulate error-vector magnitude
         unsigned int sym;
@@ -762,6 +815,7 @@ void flexframesync_execute_rxpayload(flexframesync _q,
         nco_crcf_pll_step(_q->pll, phase_error);
         nco_crcf_step(_q->pll);
         _q->framesyncstats.evm += evm*evm;
+        LIQUID_PROFILE_END(&_q->profile, FLEXFRAMESYNC_PROFILE_DEMOD, t0, 1);
 
         // save payload symbols (modem input/output)
         _q->payload_sym[_q->symbol_counter] = mf_out;
@@ -771,6 +825,7 @@ void flexframesync_execute_rxpayload(flexframesync _q,
 
         if (_q->symbol_counter == _q->payload_sym_len) {
             // decode payload
+            LIQUID_PROFILE_BEGIN(t1);
             if (_q->payload_soft) {
                 _q->payload_valid = qpacketmodem_decode_soft(_q->payload_decoder,
                                                              _q->payload_sym,
@@ -780,6 +835,7 @@ void flexframesync_execute_rxpayload(flexframesync _q,
                                                         _q->payload_sym,
                                                         _q->payload_dec);
             }
+            LIQUID_PROFILE_END(&_q->profile, FLEXFRAMESYNC_PROFILE_DECODE, t1, _q->payload_sym_len);
 
             // update statistics
             _q->framedatastats.num_frames_detected++;
@@ -825,6 +881,18 @@ void flexframesync_reset_framedatastats(flexframesync _q)
     framedatastats_reset(&_q->framedatastats);
 }
 
+// reset per-stage profile counters
+void flexframesync_reset_profile(flexframesync _q)
+{
+    liquid_profile_reset(&_q->profile);
+}
+
+// retrieve per-stage profile
+liquid_profile_s flexframesync_get_profile(flexframesync _q)
+{
+    return _q->profile;
+}
+
 // retrieve frame data statistics
 framedatastats_s flexframesync_get_framedatastats(flexframesync _q)
 {
@@ -0,0 +1,661 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// linksim.c
+//
+// Monte-Carlo link-level performance (bit/packet error rate) simulation,
+// sharding trials across threads
+//
+
+#include <stdlib.h>
+#include <stdio.h>
+#include <string.h>
+#include <math.h>
+#include <complex.h>
+
+#include "liquid.internal.h"
+
+#if HAVE_PTHREAD_H && HAVE_LIBPTHREAD
+#  define LINKSIM_THREADS 1
+#  include <pthread.h>
+#else
+#  define LINKSIM_THREADS 0
+#endif
+#if HAVE_UNISTD_H
+#  include <unistd.h>
+#endif
+
+// fewest trials run between checks of the stopping criterion; the number
+// of trials between checks otherwise grows with the number already run
+#define LINKSIM_ROUND_MIN   (64)
+
+// two-sided 95% confidence interval normal quantile
+#define LINKSIM_Z95         (1.959964f)
+
+struct linksim_s {
+    // trial and per-thread contexts
+    linksim_trial_callback           trial;             // trial callback
+    linksim_context_create_callback  context_create;    // context constructor
+    linksim_context_destroy_callback context_destroy;   // context destructor
+    void *                           userdata;          // passed to context constructor
+    int                              userdata_owned;    // free userdata on destroy?
+    void **                          context;           // contexts [size: num_contexts x 1]
+    unsigned int                     num_contexts;      // number of contexts created
+
+    // options
+    unsigned int        num_threads;    // number of worker threads
+    unsigned long int   seed;           // simulation seed
+    unsigned long int   min_trials;     // fewest trials per point
+    unsigned long int   max_trials;     // most trials per point
+    float               precision;      // relative confidence interval half-width
+};
+
+// range of trials shared by worker threads, each taking the next index
+struct linksim_job_s {
+    linksim             q;              // simulation object
+    float               SNRdB;          // signal-to-noise ratio [dB]
+    unsigned long int   next;           // next trial index
+    unsigned long int   end;            // one past last trial index
+#if LINKSIM_THREADS
+    pthread_mutex_t     lock;           // guards next
+#endif
+};
+
+// worker thread state and partial results
+struct linksim_worker_s {
+    struct linksim_job_s * job;         // shared job
+    void *                 context;     // trial context
+    unsigned long int      num_trials;
+    unsigned long int      num_packet_errors;
+    unsigned long int      num_bits;
+    unsigned long int      num_bit_errors;
+};
+
+// derive seed of trial _i at _SNRdB from simulation seed
+unsigned long int linksim_trial_seed(unsigned long int _seed,
+                                     float             _SNRdB,
+                                     unsigned long int _i);
+
+// run trials of job until none remain (thread entry point)
+void * linksim_worker(void * _worker);
+
+// run trials [_begin,_end) at _SNRdB, accumulating into _stats
+void linksim_run_range(linksim            _q,
+                       float              _SNRdB,
+                       unsigned long int  _begin,
+                       unsigned long int  _end,
+                       linksimstats_s *   _stats);
+
+// update error rates and confidence interval from counts
+void linksimstats_update(linksimstats_s * _stats);
+
+// create link simulation from user-defined trial
+//  _trial      : trial callback
+//  _create     : per-thread context constructor (NULL: userdata is shared)
+//  _destroy    : per-thread context destructor (may be NULL)
+//  _userdata   : user data passed to constructor
+linksim linksim_create(linksim_trial_callback           _trial,
+                       linksim_context_create_callback  _create,
+                       linksim_context_destroy_callback _destroy,
+                       void *                           _userdata)
+{
+    // validate input
+    if (_trial == NULL) {
+        fprintf(stderr,"error: linksim_create(), trial callback cannot be NULL\n");
+        exit(1);
+    }
+
+    linksim q = (linksim) malloc(sizeof(struct linksim_s));
+    q->trial            = _trial;
+    q->context_create   = _create;
+    q->context_destroy  = _destroy;
+    q->userdata         = _userdata;
+    q->userdata_owned   = 0;
+    q->context          = NULL;
+    q->num_contexts     = 0;
+
+    // set default options
+    q->seed             = 1;
+    q->min_trials       = 100;
+    q->max_trials       = 10000;
+    q->precision        = 0.2f;
+    linksim_set_num_threads(q, 0);
+
+    return q;
+}
+
+// destroy link simulation, freeing all internal memory
+void linksim_destroy(linksim _q)
+{
+    unsigned int i;
+    for (i=0; i<_q->num_contexts; i++) {
+        if (_q->context_destroy != NULL)
+            _q->context_destroy(_q->context[i]);
+    }
+    free(_q->context);
+    if (_q->userdata_owned)
+        free(_q->userdata);
+    free(_q);
+}
+
+// print link simulation object
+void linksim_print(linksim _q)
+{
+    printf("linksim:\n");
+    printf("  threads           :   %u\n",  _q->num_threads);
+    printf("  seed              :   %lu\n", _q->seed);
+    printf("  trials            :   %lu to %lu\n", _q->min_trials, _q->max_trials);
+    printf("  precision         :   %.3f\n", _q->precision);
+}
+
+// set number of worker threads, 0 for one per online processor
+void linksim_set_num_threads(linksim      _q,
+                             unsigned int _num_threads)
+{
+#if LINKSIM_THREADS
+    if (_num_threads == 0) {
+#if HAVE_UNISTD_H && defined(_SC_NPROCESSORS_ONLN)
+        long n = sysconf(_SC_NPROCESSORS_ONLN);
+        _num_threads = n > 0 ? (unsigned int)n : 1;
+#else
+        _num_threads = 1;
+#endif
+    }
+    _q->num_threads = _num_threads;
+#else
+    // built without thread support
+    _q->num_threads = 1;
+#endif
+}
+
+// get number of worker threads
+unsigned int linksim_get_num_threads(linksim _q)
+{
+    return _q->num_threads;
+}
+
+// set simulation seed
+void linksim_set_seed(linksim           _q,
+                      unsigned long int _seed)
+{
+    _q->seed = _seed;
+}
+
+// set fewest and most trials per signal-to-noise ratio
+void linksim_set_num_trials(linksim           _q,
+                            unsigned long int _min_trials,
+                            unsigned long int _max_trials)
+{
+    if (_min_trials == 0 || _max_trials < _min_trials) {
+        fprintf(stderr,"error: linksim_set_num_trials(), invalid range [%lu,%lu]\n",
+                _min_trials, _max_trials);
+        exit(1);
+    }
+    _q->min_trials = _min_trials;
+    _q->max_trials = _max_trials;
+}
+
+// set early-stopping precision
+void linksim_set_precision(linksim _q,
+                           float   _precision)
+{
+    if (_precision < 0.0f) {
+        fprintf(stderr,"error: linksim_set_precision(), precision must be non-negative\n");
+        exit(1);
+    }
+    _q->precision = _precision;
+}
+
+// run simulation at one signal-to-noise ratio
+void linksim_run(linksim          _q,
+                 float            _SNRdB,
+                 linksimstats_s * _stats)
+{
+    memset(_stats, 0x00, sizeof(linksimstats_s));
+    _stats->SNRdB = _SNRdB;
+
+    // run trials in rounds, the first of min_trials and each subsequent one
+    // at least half as long as all before it, checking the stopping
+    // criterion in between; as round boundaries depend only on the counts,
+    // results do not depend on the number of threads
+    unsigned long int n = 0;
+    while (n < _q->max_trials) {
+        unsigned long int r = n == 0 ? _q->min_trials : n / 2;
+        if (r < LINKSIM_ROUND_MIN) r = LINKSIM_ROUND_MIN;
+        if (r > _q->max_trials - n) r = _q->max_trials - n;
+        linksim_run_range(_q, _SNRdB, n, n + r, _stats);
+        n += r;
+
+        // stop once confidence interval is narrow relative to PER
+        float half_width = 0.5f*(_stats->PER_hi - _stats->PER_lo);
+        if (_q->precision > 0 && _stats->num_packet_errors > 0 &&
+            half_width <= _q->precision * _stats->PER)
+            break;
+    }
+}
+
+// run simulation over signal-to-noise ratios
+unsigned int linksim_run_sweep(linksim          _q,
+                               float            _SNRdB_min,
+                               float            _SNRdB_max,
+                               unsigned int     _num_steps,
+                               linksimstats_s * _stats)
+{
+    if (_num_steps == 0) {
+        fprintf(stderr,"error: linksim_run_sweep(), number of steps must be greater than zero\n");
+        exit(1);
+    }
+
+    unsigned int i;
+    for (i=0; i<_num_steps; i++) {
+        float SNRdB = _num_steps == 1 ? _SNRdB_min :
+            _SNRdB_min + (_SNRdB_max - _SNRdB_min)*(float)i/(float)(_num_steps-1);
+        linksim_run(_q, SNRdB, &_stats[i]);
+
+        // curve has fallen below what the trial budget can resolve
+        if (_stats[i].num_packet_errors == 0)
+            return i+1;
+    }
+    return _num_steps;
+}
+
+// print link simulation results
+void linksimstats_print(linksimstats_s * _stats)
+{
+    printf("  SNR %7.2f dB : trials %8lu, BER %12.4e, PER %12.4e [%10.4e,%10.4e]\n",
+            _stats->SNRdB,
+            _stats->num_trials,
+            _stats->BER,
+            _stats->PER,
+            _stats->PER_lo,
+            _stats->PER_hi);
+}
+
+// derive seed of trial _i at _SNRdB from simulation seed
+unsigned long int linksim_trial_seed(unsigned long int _seed,
+                                     float             _SNRdB,
+                                     unsigned long int _i)
+{
+    // splitmix64 finalizer over seed, signal-to-noise ratio, and index
+    union { float f; uint32_t u; } s = { _SNRdB };
+    uint64_t z = (uint64_t)_seed * 0x9e3779b97f4a7c15ULL ^
+                 (uint64_t)s.u   * 0xc2b2ae3d27d4eb4fULL ^
+                 (uint64_t)_i;
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+    return (unsigned long int)(z ^ (z >> 31));
+}
+
+// run trials of job until none remain (thread entry point)
+void * linksim_worker(void * _worker)
+{
+    struct linksim_worker_s * w = (struct linksim_worker_s*) _worker;
+    struct linksim_job_s * job = w->job;
+    linksim q = job->q;
+    for (;;) {
+        // take next trial index
+#if LINKSIM_THREADS
+        pthread_mutex_lock(&job->lock);
+#endif
+        unsigned long int i = job->next;
+        if (i < job->end)
+            job->next++;
+#if LINKSIM_THREADS
+        pthread_mutex_unlock(&job->lock);
+#endif
+        if (i >= job->end)
+            break;
+
+        // run trial
+        unsigned int num_bits       = 0;
+        unsigned int num_bit_errors = 0;
+        int packet_error = q->trial(w->context, job->SNRdB,
+                                    linksim_trial_seed(q->seed, job->SNRdB, i),
+                                    &num_bits, &num_bit_errors);
+        w->num_trials++;
+        w->num_packet_errors += packet_error ? 1 : 0;
+        w->num_bits          += num_bits;
+        w->num_bit_errors    += num_bit_errors;
+    }
+    return NULL;
+}
+
+// run trials [_begin,_end) at _SNRdB, accumulating into _stats
+void linksim_run_range(linksim            _q,
+                       float              _SNRdB,
+                       unsigned long int  _begin,
+                       unsigned long int  _end,
+                       linksimstats_s *   _stats)
+{
+    unsigned int i;
+    unsigned int num_threads = _q->num_threads;
+    if (num_threads > _end - _begin)
+        num_threads = _end - _begin;
+
+    // create contexts as needed (in calling thread), kept between runs
+    if (_q->num_contexts < num_threads) {
+        _q->context = (void**) realloc(_q->context, num_threads*sizeof(void*));
+        for (i=_q->num_contexts; i<num_threads; i++)
+            _q->context[i] = _q->context_create == NULL ? _q->userdata :
+                             _q->context_create(_q->userdata);
+        _q->num_contexts = num_threads;
+    }
+
+    struct linksim_job_s job;
+    job.q     = _q;
+    job.SNRdB = _SNRdB;
+    job.next  = _begin;
+    job.end   = _end;
+    struct linksim_worker_s worker[num_threads];
+    for (i=0; i<num_threads; i++) {
+        memset(&worker[i], 0x00, sizeof(struct linksim_worker_s));
+        worker[i].job     = &job;
+        worker[i].context = _q->context[i];
+    }
+
+#if LINKSIM_THREADS
+    // run first worker in calling thread, remaining in their own
+    pthread_mutex_init(&job.lock, NULL);
+    pthread_t thread[num_threads];
+    for (i=1; i<num_threads; i++) {
+        if (pthread_create(&thread[i], NULL, linksim_worker, &worker[i]) != 0) {
+            fprintf(stderr,"error: linksim_run(), could not create thread\n");
+            exit(1);
+        }
+    }
+    linksim_worker(&worker[0]);
+    for (i=1; i<num_threads; i++)
+        pthread_join(thread[i], NULL);
+    pthread_mutex_destroy(&job.lock);
+#else
+    linksim_worker(&worker[0]);
+#endif
+
+    // accumulate results
+    for (i=0; i<num_threads; i++) {
+        _stats->num_trials        += worker[i].num_trials;
+        _stats->num_packet_errors += worker[i].num_packet_errors;
+        _stats->num_bits          += worker[i].num_bits;
+        _stats->num_bit_errors    += worker[i].num_bit_errors;
+    }
+    linksimstats_update(_stats);
+}
+
+// update error rates and confidence interval from counts
+void linksimstats_update(linksimstats_s * _stats)
+{
+    float n = (float)_stats->num_trials;
+    float p = n > 0 ? (float)_stats->num_packet_errors / n : 0.0f;
+    _stats->PER = p;
+    _stats->BER = _stats->num_bits > 0 ?
+        (float)_stats->num_bit_errors / (float)_stats->num_bits : 0.0f;
+
+    // Wilson score interval, well-behaved as PER approaches 0 or 1
+    float z2     = LINKSIM_Z95*LINKSIM_Z95;
+    float d      = 1.0f + z2/n;
+    float center = (p + 0.5f*z2/n) / d;
+    float half   = LINKSIM_Z95 * sqrtf(p*(1.0f-p)/n + 0.25f*z2/(n*n)) / d;
+    _stats->PER_lo = center - half < 0.0f ? 0.0f : center - half;
+    _stats->PER_hi = center + half > 1.0f ? 1.0f : center + half;
+}
+
+//
+// built-in trials
+//
+
+// configuration shared by built-in trials
+struct linksim_config_s {
+    unsigned int      payload_len;  // payload length [bytes]
+    crc_scheme        check;        // data validity check
+    fec_scheme        fec0;         // inner forward error-correction
+    fec_scheme        fec1;         // outer forward error-correction
+    modulation_scheme ms;           // modulation scheme
+};
+
+// allocate built-in configuration, validating input
+struct linksim_config_s * linksim_config_create(const char *      _method,
+                                                unsigned int      _payload_len,
+                                                crc_scheme        _check,
+                                                fec_scheme        _fec0,
+                                                fec_scheme        _fec1,
+                                                int               _ms)
+{
+    if (_payload_len == 0) {
+        fprintf(stderr,"error: %s(), payload length must be greater than zero\n", _method);
+        exit(1);
+    } else if (_ms == LIQUID_MODEM_UNKNOWN || _ms >= LIQUID_MODEM_NUM_SCHEMES) {
+        fprintf(stderr,"error: %s(), invalid modulation scheme\n", _method);
+        exit(1);
+    }
+    struct linksim_config_s * c = (struct linksim_config_s *) malloc(sizeof(struct linksim_config_s));
+    c->payload_len = _payload_len;
+    c->check       = _check;
+    c->fec0        = _fec0;
+    c->fec1        = _fec1;
+    c->ms          = _ms;
+    return c;
+}
+
+// generate random payload from trial seed, leaving generator state for
+// further use (e.g. seeding channel)
+void linksim_payload_generate(liquid_rng *      _rng,
+                              unsigned long int _seed,
+                              unsigned char *   _payload,
+                              unsigned int      _payload_len)
+{
+    liquid_rng_seed(_rng, _seed);
+    unsigned int i;
+    for (i=0; i<_payload_len; i++)
+        _payload[i] = liquid_rng_next(_rng) >> 24;
+}
+
+// packet modem trial context
+struct linksim_qpacketmodem_s {
+    unsigned int    payload_len;    // payload length [bytes]
+    qpacketmodem    q;              // packet modem
+    channel_cccf    channel;        // AWGN channel
+    unsigned int    frame_len;      // number of symbols in frame
+    float complex * frame;          // frame symbols [size: frame_len x 1]
+    unsigned char * payload_tx;     // transmitted payload
+    unsigned char * payload_rx;     // received payload
+};
+
+void * linksim_qpacketmodem_create(void * _config)
+{
+    struct linksim_config_s * c = (struct linksim_config_s *) _config;
+    struct linksim_qpacketmodem_s * t = (struct linksim_qpacketmodem_s *) malloc(sizeof(struct linksim_qpacketmodem_s));
+    t->payload_len = c->payload_len;
+    t->q = qpacketmodem_create();
+    qpacketmodem_configure(t->q, c->payload_len, c->check, c->fec0, c->fec1, c->ms);
+    t->channel    = channel_cccf_create();
+    t->frame_len  = qpacketmodem_get_frame_len(t->q);
+    t->frame      = (float complex*) malloc(t->frame_len*sizeof(float complex));
+    t->payload_tx = (unsigned char*) malloc(t->payload_len*sizeof(unsigned char));
+    t->payload_rx = (unsigned char*) malloc(t->payload_len*sizeof(unsigned char));
+    return t;
+}
+
+void linksim_qpacketmodem_destroy(void * _context)
+{
+    struct linksim_qpacketmodem_s * t = (struct linksim_qpacketmodem_s *) _context;
+    qpacketmodem_destroy(t->q);
+    channel_cccf_destroy(t->channel);
+    free(t->frame);
+    free(t->payload_tx);
+    free(t->payload_rx);
+    free(t);
+}
+
+int linksim_qpacketmodem_trial(void *            _context,
+                               float             _SNRdB,
+                               unsigned long int _seed,
+                               unsigned int *    _num_bits,
+                               unsigned int *    _num_bit_errors)
+{
+    struct linksim_qpacketmodem_s * t = (struct linksim_qpacketmodem_s *) _context;
+    liquid_rng rng;
+    linksim_payload_generate(&rng, _seed, t->payload_tx, t->payload_len);
+
+    // encode, add noise (unit-energy symbols), and decode
+    qpacketmodem_encode(t->q, t->payload_tx, t->frame);
+    channel_cccf_add_awgn(t->channel, -_SNRdB, _SNRdB);
+    channel_cccf_set_seed(t->channel, liquid_rng_next(&rng));
+    channel_cccf_execute_block(t->channel, t->frame, t->frame_len, t->frame);
+    int crc_pass = qpacketmodem_decode(t->q, t->frame, t->payload_rx);
+
+    *_num_bits       = 8*t->payload_len;
+    *_num_bit_errors = count_bit_errors_array(t->payload_tx, t->payload_rx, t->payload_len);
+    return !crc_pass || *_num_bit_errors > 0;
+}
+
+// create link simulation of packet modem: modulation and forward error
+// correction with ideal timing and carrier recovery
+linksim linksim_create_qpacketmodem(unsigned int      _payload_len,
+                                    crc_scheme        _check,
+                                    fec_scheme        _fec0,
+                                    fec_scheme        _fec1,
+                                    int               _ms)
+{
+    struct linksim_config_s * c = linksim_config_create("linksim_create_qpacketmodem",
+                                    _payload_len, _check, _fec0, _fec1, _ms);
+    linksim q = linksim_create(linksim_qpacketmodem_trial,
+                               linksim_qpacketmodem_create,
+                               linksim_qpacketmodem_destroy,
+                               c);
+    q->userdata_owned = 1;
+    return q;
+}
+
+// flexible frame trial context
+struct linksim_flexframe_s {
+    unsigned int    payload_len;    // payload length [bytes]
+    flexframegen    fg;             // frame generator
+    flexframesync   fs;             // frame synchronizer
+    channel_cccf    channel;        // AWGN channel
+    float complex   buf[256];       // sample buffer
+    unsigned char   header[FLEXFRAME_H_USER_DEFAULT];
+    unsigned char * payload_tx;     // transmitted payload
+    int             detected;       // frame detected in trial?
+    int             payload_valid;  // payload passed check?
+    unsigned int    num_bit_errors; // bit errors in received payload
+};
+
+int linksim_flexframe_callback(unsigned char *  _header,
+                               int              _header_valid,
+                               unsigned char *  _payload,
+                               unsigned int     _payload_len,
+                               int              _payload_valid,
+                               framesyncstats_s _stats,
+                               void *           _userdata)
+{
+    struct linksim_flexframe_s * t = (struct linksim_flexframe_s *) _userdata;
+    if (t->detected)
+        return 0;
+    t->detected      = 1;
+    t->payload_valid = _header_valid && _payload_valid;
+    if (_header_valid && _payload_len == t->payload_len)
+        t->num_bit_errors = count_bit_errors_array(t->payload_tx, _payload, t->payload_len);
+    return 0;
+}
+
+void * linksim_flexframe_create(void * _config)
+{
+    struct linksim_config_s * c = (struct linksim_config_s *) _config;
+    struct linksim_flexframe_s * t = (struct linksim_flexframe_s *) malloc(sizeof(struct linksim_flexframe_s));
+    t->payload_len = c->payload_len;
+    flexframegenprops_s props;
+    flexframegenprops_init_default(&props);
+    props.check      = c->check;
+    props.fec0       = c->fec0;
+    props.fec1       = c->fec1;
+    props.mod_scheme = c->ms;
+    t->fg         = flexframegen_create(&props);
+    t->fs         = flexframesync_create(linksim_flexframe_callback, t);
+    t->channel    = channel_cccf_create();
+    t->payload_tx = (unsigned char*) malloc(t->payload_len*sizeof(unsigned char));
+    return t;
+}
+
+void linksim_flexframe_destroy(void * _context)
+{
+    struct linksim_flexframe_s * t = (struct linksim_flexframe_s *) _context;
+    flexframegen_destroy(t->fg);
+    flexframesync_destroy(t->fs);
+    channel_cccf_destroy(t->channel);
+    free(t->payload_tx);
+    free(t);
+}
+
+int linksim_flexframe_trial(void *            _context,
+                            float             _SNRdB,
+                            unsigned long int _seed,
+                            unsigned int *    _num_bits,
+                            unsigned int *    _num_bit_errors)
+{
+    struct linksim_flexframe_s * t = (struct linksim_flexframe_s *) _context;
+    liquid_rng rng;
+    linksim_payload_generate(&rng, _seed, t->payload_tx, t->payload_len);
+    unsigned int i;
+    for (i=0; i<FLEXFRAME_H_USER_DEFAULT; i++)
+        t->header[i] = liquid_rng_next(&rng) >> 24;
+
+    // missed frames count as half of the payload bits in error
+    t->detected       = 0;
+    t->payload_valid  = 0;
+    t->num_bit_errors = 4*t->payload_len;
+    flexframesync_reset(t->fs);
+    channel_cccf_add_awgn(t->channel, -_SNRdB, _SNRdB);
+    channel_cccf_set_seed(t->channel, liquid_rng_next(&rng));
+
+    // generate frame, followed by enough noise to flush synchronizer
+    unsigned int num_flush = 4;
+    flexframegen_assemble(t->fg, t->header, t->payload_tx, t->payload_len);
+    while (num_flush > 0 && !t->detected) {
+        if (flexframegen_write_samples(t->fg, t->buf, 256))
+            num_flush--;
+        channel_cccf_execute_block(t->channel, t->buf, 256, t->buf);
+        flexframesync_execute(t->fs, t->buf, 256);
+    }
+
+    *_num_bits       = 8*t->payload_len;
+    *_num_bit_errors = t->num_bit_errors;
+    return !t->payload_valid || t->num_bit_errors > 0;
+}
+
+// create link simulation of flexible frame: modulation and forward error
+// correction including frame detection and synchronization
+linksim linksim_create_flexframe(unsigned int      _payload_len,
+                                 crc_scheme        _check,
+                                 fec_scheme        _fec0,
+                                 fec_scheme        _fec1,
+                                 int               _ms)
+{
+    struct linksim_config_s * c = linksim_config_create("linksim_create_flexframe",
+                                    _payload_len, _check, _fec0, _fec1, _ms);
+    linksim q = linksim_create(linksim_flexframe_trial,
+                               linksim_flexframe_create,
+                               linksim_flexframe_destroy,
+                               c);
+    q->userdata_owned = 1;
+    return q;
+}
@@ -29,6 +29,16 @@
 #include <string.h>
 #include <math.h>
 
+#if HAVE_PTHREAD_H && HAVE_LIBPTHREAD
+#  define MSOURCE_THREADS 1
+#  include <pthread.h>
+#else
+#  define MSOURCE_THREADS 0
+#endif
+#if HAVE_UNISTD_H
+#  include <unistd.h>
+#endif
+
 // internal structure
 struct MSOURCE(_s)
 {
@@ -51,6 +61,20 @@ struct MSOURCE(_s)
 
     // global counters
     unsigned long long num_samples; // total number of samples generated
+
+    // worker threads: sources are taken in turn by the calling thread and
+    // workers, each generating into its own buffer, then combined in order
+    unsigned int    num_threads;    // number of threads, including caller
+    unsigned int    next_source;    // index of next source to generate
+#if MSOURCE_THREADS
+    pthread_t *     threads;        // worker threads [size: num_threads-1]
+    pthread_mutex_t lock;           // guards values below
+    pthread_cond_t  cond_work;      // signals block is ready (or exit)
+    pthread_cond_t  cond_done;      // signals all workers finished block
+    unsigned long   block_id;       // identifier of block being generated
+    unsigned int    num_busy;       // number of workers generating block
+    int             exit_flag;      // workers should exit
+#endif
 };
 
 //
@@ -64,6 +88,16 @@ int MSOURCE(_add_source)(MSOURCE() _q,
 // generate samples internally
 void MSOURCE(_generate)(MSOURCE() _q);
 
+// generate sources' channelizer outputs until none remain
+void MSOURCE(_generate_sources)(MSOURCE() _q);
+
+// start/stop worker threads
+void MSOURCE(_threads_start)(MSOURCE() _q);
+void MSOURCE(_threads_stop)(MSOURCE() _q);
+
+// worker thread entry point
+void * MSOURCE(_worker)(void * _q);
+
 // create msource object
 MSOURCE() MSOURCE(_create)(unsigned int _M,
                            unsigned int _m,
@@ -89,6 +123,13 @@ MSOURCE() MSOURCE(_create)(unsigned int _M,
     q->read_index = q->M/2; // indicate buffer is empty
     q->num_blocks = 0;
 
+    // single-threaded by default
+    q->num_threads = 1;
+    q->next_source = 0;
+#if MSOURCE_THREADS
+    q->threads     = NULL;
+#endif
+
     // reset and return main object
     MSOURCE(_reset)(q);
     return q;
@@ -103,6 +144,9 @@ MSOURCE() MSOURCE(_create_default)(void)
 // destroy msource object, freeing all internal memory
 void MSOURCE(_destroy)(MSOURCE() _q)
 {
+    // stop worker threads
+    MSOURCE(_threads_stop)(_q);
+
     // destroy internal objects
     unsigned int i;
     for (i=0; i<_q->num_sources; i++)
@@ -395,6 +439,35 @@ int MSOURCE(_get_frequency)(MSOURCE() _q,
     return 0;
 }
 
+// set number of threads used to generate sources, 0 for one per online
+// processor
+void MSOURCE(_set_num_threads)(MSOURCE()    _q,
+                               unsigned int _num_threads)
+{
+    MSOURCE(_threads_stop)(_q);
+#if MSOURCE_THREADS
+    if (_num_threads == 0) {
+#if HAVE_UNISTD_H && defined(_SC_NPROCESSORS_ONLN)
+        long n = sysconf(_SC_NPROCESSORS_ONLN);
+        _num_threads = n > 0 ? (unsigned int)n : 1;
+#else
+        _num_threads = 1;
+#endif
+    }
+    _q->num_threads = _num_threads;
+#else
+    // built without thread support
+    _q->num_threads = 1;
+#endif
+    MSOURCE(_threads_start)(_q);
+}
+
+// get number of threads used to generate sources
+unsigned int MSOURCE(_get_num_threads)(MSOURCE() _q)
+{
+    return _q->num_threads;
+}
+
 // write block of samples to output buffer
 //  _q      : synchronizer object
 //  _buf    : output buffer [size: _buf_len x 1]
@@ -403,15 +476,19 @@ void MSOURCE(_write_samples)(MSOURCE()    _q,
                              TO *         _buf,
                              unsigned int _buf_len)
 {
-    unsigned int i;
-    for (i=0; i<_buf_len; i++) {
+    unsigned int i = 0;
+    while (i < _buf_len) {
         // generate more samples if needed
         if (_q->read_index >= _q->M/2) {
             MSOURCE(_generate)(_q);
         }
 
-        // write output sample and update counter
-        _buf[i] = _q->buf_time[_q->read_index++];
+        // copy as many samples as are available and update counter
+        unsigned int n = _q->M/2 - _q->read_index;
+        n = n < _buf_len - i ? n : _buf_len - i;
+        memmove(_buf + i, _q->buf_time + _q->read_index, n*sizeof(TO));
+        _q->read_index += n;
+        i += n;
     }
 }
 
@@ -464,13 +541,38 @@ QSOURCE() MSOURCE(_get_source)(MSOURCE() _q,
 // generate samples internally
 void MSOURCE(_generate)(MSOURCE() _q)
 {
+    // generate each source's channelizer output
+#if MSOURCE_THREADS
+    if (_q->num_threads > 1 && _q->num_sources > 1) {
+        // wake workers and take part in generating sources
+        pthread_mutex_lock(&_q->lock);
+        _q->next_source = 0;
+        _q->num_busy    = _q->num_threads - 1;
+        _q->block_id++;
+        pthread_cond_broadcast(&_q->cond_work);
+        pthread_mutex_unlock(&_q->lock);
+
+        MSOURCE(_generate_sources)(_q);
+
+        // wait for workers to finish
+        pthread_mutex_lock(&_q->lock);
+        while (_q->num_busy > 0)
+            pthread_cond_wait(&_q->cond_done, &_q->lock);
+        pthread_mutex_unlock(&_q->lock);
+    } else
+#endif
+    {
+        _q->next_source = 0;
+        MSOURCE(_generate_sources)(_q);
+    }
+
     // clear buffer
     memset(_q->buf_freq, 0, _q->M*sizeof(float complex));
 
-    // add sources into main frequency buffer
+    // add sources into main frequency buffer in order, applying gain
     unsigned int i;
     for (i=0; i<_q->num_sources; i++)
-        QSOURCE(_generate_into)(_q->sources[i], _q->buf_freq);
+        QSOURCE(_add_channels)(_q->sources[i], _q->buf_freq);
 
     // run synthesis channelizer
     firpfbch2_crcf_execute(_q->ch, _q->buf_freq, _q->buf_time);
@@ -481,4 +583,102 @@ void MSOURCE(_generate)(MSOURCE() _q)
     _q->num_samples += _q->M / 2;
 }
 
+// generate sources' channelizer outputs until none remain
+void MSOURCE(_generate_sources)(MSOURCE() _q)
+{
+    for (;;) {
+        // take next source index
+#if MSOURCE_THREADS
+        if (_q->num_threads > 1) pthread_mutex_lock(&_q->lock);
+#endif
+        unsigned int i = _q->next_source;
+        if (i < _q->num_sources)
+            _q->next_source++;
+#if MSOURCE_THREADS
+        if (_q->num_threads > 1) pthread_mutex_unlock(&_q->lock);
+#endif
+        if (i >= _q->num_sources)
+            break;
 
+        QSOURCE(_generate_channels)(_q->sources[i]);
+    }
+}
+
+// start worker threads
+void MSOURCE(_threads_start)(MSOURCE() _q)
+{
+#if MSOURCE_THREADS
+    _q->threads = NULL;
+    if (_q->num_threads < 2)
+        return;
+
+    pthread_mutex_init(&_q->lock, NULL);
+    pthread_cond_init (&_q->cond_work, NULL);
+    pthread_cond_init (&_q->cond_done, NULL);
+    _q->block_id  = 0;
+    _q->num_busy  = 0;
+    _q->exit_flag = 0;
+    _q->threads = (pthread_t*) malloc((_q->num_threads-1)*sizeof(pthread_t));
+    unsigned int i;
+    for (i=0; i<_q->num_threads-1; i++) {
+        if (pthread_create(&_q->threads[i], NULL, MSOURCE(_worker), _q) != 0) {
+            fprintf(stderr,"error: msource%s_set_num_threads(), could not create thread\n", EXTENSION);
+            exit(1);
+        }
+    }
+#endif
+}
+
+// stop worker threads
+void MSOURCE(_threads_stop)(MSOURCE() _q)
+{
+#if MSOURCE_THREADS
+    if (_q->num_threads < 2 || _q->threads == NULL)
+        return;
+
+    pthread_mutex_lock(&_q->lock);
+    _q->exit_flag = 1;
+    pthread_cond_broadcast(&_q->cond_work);
+    pthread_mutex_unlock(&_q->lock);
+
+    unsigned int i;
+    for (i=0; i<_q->num_threads-1; i++)
+        pthread_join(_q->threads[i], NULL);
+    free(_q->threads);
+    _q->threads = NULL;
+
+    pthread_mutex_destroy(&_q->lock);
+    pthread_cond_destroy (&_q->cond_work);
+    pthread_cond_destroy (&_q->cond_done);
+#endif
+}
+
+// worker thread entry point: generate sources for each new block until
+// asked to exit
+void * MSOURCE(_worker)(void * _q)
+{
+#if MSOURCE_THREADS
+    MSOURCE() q = (MSOURCE()) _q;
+    unsigned long block_id = 0;
+    pthread_mutex_lock(&q->lock);
+    for (;;) {
+        // wait for new block
+        while (!q->exit_flag && q->block_id == block_id)
+            pthread_cond_wait(&q->cond_work, &q->lock);
+        if (q->exit_flag)
+            break;
+        block_id = q->block_id;
+        pthread_mutex_unlock(&q->lock);
+
+        MSOURCE(_generate_sources)(q);
+
+        // signal completion
+        pthread_mutex_lock(&q->lock);
+        q->num_busy--;
+        if (q->num_busy == 0)
+            pthread_cond_signal(&q->cond_done);
+    }
+    pthread_mutex_unlock(&q->lock);
+#endif
+    return NULL;
+}
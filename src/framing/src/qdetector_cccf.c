@@ -94,26 +94,26 @@ qdetector_cccf qdetector_cccf_create(float complex * _s,
     }
     
     // allocate memory for main object and set internal properties
-    qdetector_cccf q = (qdetector_cccf) malloc(sizeof(struct qdetector_cccf_s));
+    qdetector_cccf q = (qdetector_cccf) liquid_malloc(sizeof(struct qdetector_cccf_s), "qdetector_cccf");
     q->s_len = _s_len;
 
     // allocate memory and copy sequence
-    q->s = (float complex*) malloc(q->s_len * sizeof(float complex));
+    q->s = (float complex*) liquid_malloc(q->s_len * sizeof(float complex), "qdetector_cccf");
     memmove(q->s, _s, q->s_len*sizeof(float complex));
     q->s2_sum = liquid_sumsqcf(q->s, q->s_len); // compute sum{ s^2 }
 
     // prepare transforms
     q->nfft       = 1 << liquid_nextpow2( (unsigned int)( 2 * q->s_len ) ); // NOTE: must be even
-    q->buf_time_0 = (float complex*) malloc(q->nfft * sizeof(float complex));
-    q->buf_freq_0 = (float complex*) malloc(q->nfft * sizeof(float complex));
-    q->buf_freq_1 = (float complex*) malloc(q->nfft * sizeof(float complex));
-    q->buf_time_1 = (float complex*) malloc(q->nfft * sizeof(float complex));
+    q->buf_time_0 = (float complex*) liquid_malloc(q->nfft * sizeof(float complex), "qdetector_cccf");
+    q->buf_freq_0 = (float complex*) liquid_malloc(q->nfft * sizeof(float complex), "qdetector_cccf");
+    q->buf_freq_1 = (float complex*) liquid_malloc(q->nfft * sizeof(float complex), "qdetector_cccf");
+    q->buf_time_1 = (float complex*) liquid_malloc(q->nfft * sizeof(float complex), "qdetector_cccf");
 
     q->fft  = fft_create_plan(q->nfft, q->buf_time_0, q->buf_freq_0, LIQUID_FFT_FORWARD,  0);
     q->ifft = fft_create_plan(q->nfft, q->buf_freq_1, q->buf_time_1, LIQUID_FFT_BACKWARD, 0);
 
     // create frequency-domain template by taking nfft-point transform on 's', storing in 'S'
-    q->S = (float complex*) malloc(q->nfft * sizeof(float complex));
+    q->S = (float complex*) liquid_malloc(q->nfft * sizeof(float complex), "qdetector_cccf");
     memset(q->buf_time_0, 0x00, q->nfft*sizeof(float complex));
     memmove(q->buf_time_0, q->s, q->s_len*sizeof(float complex));
     fft_execute(q->fft);
@@ -174,7 +174,7 @@ qdetector_cccf qdetector_cccf_create_linear(float complex * _sequence,
     
     // create time-domain template
     unsigned int    s_len = _k * (_sequence_len + 2*_m);
-    float complex * s     = (float complex*) malloc(s_len * sizeof(float complex));
+    float complex * s     = (float complex*) liquid_malloc(s_len * sizeof(float complex), "qdetector_cccf");
     firinterp_crcf interp = firinterp_crcf_create_prototype(_ftype, _k, _m, _beta, 0);
     unsigned int i;
     for (i=0; i<_sequence_len + 2*_m; i++)
@@ -185,7 +185,7 @@ qdetector_cccf qdetector_cccf_create_linear(float complex * _sequence,
     qdetector_cccf q = qdetector_cccf_create(s, s_len);
 
     // free allocated temporary array
-    free(s);
+    liquid_free(s, "qdetector_cccf");
 
     // return object
     return q;
@@ -220,7 +220,7 @@ qdetector_cccf qdetector_cccf_create_gmsk(unsigned char * _sequence,
     
     // create time-domain template using GMSK modem
     unsigned int    s_len = _k * (_sequence_len + 2*_m);
-    float complex * s     = (float complex*) malloc(s_len * sizeof(float complex));
+    float complex * s     = (float complex*) liquid_malloc(s_len * sizeof(float complex), "qdetector_cccf");
     gmskmod mod = gmskmod_create(_k, _m, _beta);
     unsigned int i;
     for (i=0; i<_sequence_len + 2*_m; i++)
@@ -231,7 +231,7 @@ qdetector_cccf qdetector_cccf_create_gmsk(unsigned char * _sequence,
     qdetector_cccf q = qdetector_cccf_create(s, s_len);
 
     // free allocated temporary array
-    free(s);
+    liquid_free(s, "qdetector_cccf");
 
     // return object
     return q;
@@ -272,7 +272,7 @@ qdetector_cccf qdetector_cccf_create_cpfsk(unsigned char * _sequence,
 
     // create time-domain template using GMSK modem
     unsigned int    s_len = _k * (_sequence_len + 2*_m);
-    float complex * s     = (float complex*) malloc(s_len * sizeof(float complex));
+    float complex * s     = (float complex*) liquid_malloc(s_len * sizeof(float complex), "qdetector_cccf");
     cpfskmod mod = cpfskmod_create(_bps, _h, _k, _m, _beta, _type);
     unsigned int i;
     for (i=0; i<_sequence_len + 2*_m; i++)
@@ -283,7 +283,7 @@ qdetector_cccf qdetector_cccf_create_cpfsk(unsigned char * _sequence,
     qdetector_cccf q = qdetector_cccf_create(s, s_len);
 
     // free allocated temporary array
-    free(s);
+    liquid_free(s, "qdetector_cccf");
 
     // return object
     return q;
@@ -292,19 +292,19 @@ qdetector_cccf qdetector_cccf_create_cpfsk(unsigned char * _sequence,
 void qdetector_cccf_destroy(qdetector_cccf _q)
 {
     // free allocated arrays
-    free(_q->s         );
-    free(_q->S         );
-    free(_q->buf_time_0);
-    free(_q->buf_freq_0);
-    free(_q->buf_freq_1);
-    free(_q->buf_time_1);
+    liquid_free(_q->s,          "qdetector_cccf");
+    liquid_free(_q->S,          "qdetector_cccf");
+    liquid_free(_q->buf_time_0, "qdetector_cccf");
+    liquid_free(_q->buf_freq_0, "qdetector_cccf");
+    liquid_free(_q->buf_freq_1, "qdetector_cccf");
+    liquid_free(_q->buf_time_1, "qdetector_cccf");
 
     // destroy objects
     fft_destroy_plan(_q->fft);
     fft_destroy_plan(_q->ifft);
 
     // free main object memory
-    free(_q);
+    liquid_free(_q, "qdetector_cccf");
 }
 
 void qdetector_cccf_print(qdetector_cccf _q)
@@ -317,6 +317,15 @@ void qdetector_cccf_print(qdetector_cccf _q)
     printf("  sum{ s^2 }            :   %.2f\n",  _q->s2_sum);
 }
 
+// get number of bytes allocated by object (excluding FFT plans)
+unsigned long int qdetector_cccf_get_memory_usage(qdetector_cccf _q)
+{
+    // object, time template, frequency template and four FFT buffers
+    return sizeof(struct qdetector_cccf_s) +
+           _q->s_len*sizeof(float complex) +
+           5*_q->nfft*sizeof(float complex);
+}
+
 void qdetector_cccf_reset(qdetector_cccf _q)
 {
 }
@@ -53,7 +53,7 @@ struct qpacketmodem_s {
 qpacketmodem qpacketmodem_create()
 {
     // allocate memory for main object
-    qpacketmodem q = (qpacketmodem) malloc(sizeof(struct qpacketmodem_s));
+    qpacketmodem q = (qpacketmodem) liquid_malloc(sizeof(struct qpacketmodem_s), "qpacketmodem");
 
     // create payload modem (initially QPSK, overridden by properties)
     q->mod_payload = modem_create(LIQUID_MODEM_QPSK);
@@ -77,11 +77,11 @@ qpacketmodem qpacketmodem_create()
     q->payload_mod_len = d.quot + (d.rem ? 1 : 0);
 
     // soft demodulator uses one byte to represent each soft bit
-    q->payload_enc = (unsigned char*) malloc(q->bits_per_symbol*q->payload_mod_len*sizeof(unsigned char));
+    q->payload_enc = (unsigned char*) liquid_malloc(q->bits_per_symbol*q->payload_mod_len*sizeof(unsigned char), "qpacketmodem");
 
     // set symbol length appropriately
     q->payload_mod_len = q->payload_enc_len * q->bits_per_symbol;   // for QPSK
-    q->payload_mod = (unsigned char*) malloc(q->payload_mod_len*sizeof(unsigned char));
+    q->payload_mod = (unsigned char*) liquid_malloc(q->payload_mod_len*sizeof(unsigned char), "qpacketmodem");
 
     q->n = 0;
 
@@ -97,10 +97,10 @@ void qpacketmodem_destroy(qpacketmodem _q)
     modem_destroy(_q->mod_payload);
 
     // free arrays
-    free(_q->payload_enc);
-    free(_q->payload_mod);
+    liquid_free(_q->payload_enc, "qpacketmodem");
+    liquid_free(_q->payload_mod, "qpacketmodem");
 
-    free(_q);
+    liquid_free(_q, "qpacketmodem");
 }
 
 // reset object
@@ -123,6 +123,16 @@ void qpacketmodem_print(qpacketmodem _q)
     printf("  payload mod len   :   %u\n", _q->payload_mod_len);
 }
 
+// get number of bytes allocated by object, including packetizer (the
+// modem is not included)
+unsigned long int qpacketmodem_get_memory_usage(qpacketmodem _q)
+{
+    return sizeof(struct qpacketmodem_s) +
+           _q->bits_per_symbol*_q->payload_mod_len*sizeof(unsigned char) +
+           _q->payload_mod_len*sizeof(unsigned char) +
+           packetizer_get_memory_usage(_q->p);
+}
+
 //
 int qpacketmodem_configure(qpacketmodem _q,
                            unsigned int _payload_len,
@@ -150,12 +160,13 @@ int qpacketmodem_configure(qpacketmodem _q,
     _q->payload_mod_len = d.quot + (d.rem ? 1 : 0);
 
     // encoded payload array (leave room for soft-decision decoding)
-    _q->payload_enc = (unsigned char*) realloc(_q->payload_enc,
-            _q->bits_per_symbol*_q->payload_mod_len*sizeof(unsigned char));
+    _q->payload_enc = (unsigned char*) liquid_realloc(_q->payload_enc,
+            _q->bits_per_symbol*_q->payload_mod_len*sizeof(unsigned char), "qpacketmodem");
 
     // reallocate memory for modem symbols
-    _q->payload_mod = (unsigned char*) realloc(_q->payload_mod,
-                                               _q->payload_mod_len*sizeof(unsigned char));
+    _q->payload_mod = (unsigned char*) liquid_realloc(_q->payload_mod,
+                                                      _q->payload_mod_len*sizeof(unsigned char),
+                                                      "qpacketmodem");
 
     _q->n = 0;
 
@@ -55,6 +55,7 @@ struct QSOURCE(_s)
     firpfbch2_crcf  ch;         // analysis channelizer
     int             enabled;    // signal enabled?
     uint64_t        num_samples;// total number of output samples generated
+    liquid_rng      rng;        // random symbols and noise for this source
 
     // signal type
     enum {
@@ -80,6 +81,15 @@ struct QSOURCE(_s)
     } source;
 };
 
+// accumulate scaled block into parent channelizer buffer starting at
+// index _base, wrapping around the M channels
+void QSOURCE(_accumulate)(QSOURCE()    _q,
+                          TO *         _buf,
+                          unsigned int _base,
+                          TO *         _x,
+                          unsigned int _n,
+                          float        _g);
+
 QSOURCE() QSOURCE(_create)(unsigned int _M,
                            unsigned int _m,
                            float        _As,
@@ -110,6 +120,10 @@ QSOURCE() QSOURCE(_create)(unsigned int _M,
     q->fc          = _fc;                       // center frequency (relative to sample rate)
     q->bw          = _bw;                       // bandwidth (relative to sample rate)
 
+    // seed from global generator so that sources remain reproducible
+    // with srand() but are independent of each other once created
+    liquid_rng_seed(&q->rng, rand());
+
     // set channelizer values appropriately
     q->M = _M;
     q->P = 2*(unsigned int)ceilf( 0.5 * _bw * _M );
@@ -360,69 +374,92 @@ float QSOURCE(_get_frequency)(QSOURCE() _q)
 void QSOURCE(_generate)(QSOURCE() _q,
                         TO *      _v)
 {
-    // generate type-specific sample
-    TO sample;
+    QSOURCE(_generate_block)(_q, _v, 1);
+}
+
+// generate a block of samples
+void QSOURCE(_generate_block)(QSOURCE()    _q,
+                              TO *         _v,
+                              unsigned int _n)
+{
+    // generate type-specific samples
+    unsigned int i;
+    unsigned int n;
     switch (_q->type) {
     case QSOURCE_USER:
-        _q->source.user.callback(_q->source.user.userdata, &sample, 1);
+        _q->source.user.callback(_q->source.user.userdata, _v, _n);
         break;
     case QSOURCE_TONE:
-        sample = 1.0f;
+        for (i=0; i<_n; i++)
+            _v[i] = 1.0f;
         break;
     case QSOURCE_CHIRP:
-        NCO(_cexpf)           (_q->source.chirp.nco, &sample);
-        NCO(_adjust_frequency)(_q->source.chirp.nco, _q->source.chirp.df);
-        NCO(_step)            (_q->source.chirp.nco);
-        _q->source.chirp.timer--;
-        if (_q->source.chirp.timer==0) {
-            _q->source.chirp.timer = _q->source.chirp.num;  // reset timer
-            // disable for just one instance
-            if (_q->source.chirp.single)
-                QSOURCE(_disable)(_q);
-            // reset NCO frequency
-            NCO(_set_frequency)(_q->source.chirp.nco, _q->source.chirp.negate ? M_PI : -M_PI);
+        for (i=0; i<_n; i++) {
+            NCO(_cexpf)           (_q->source.chirp.nco, &_v[i]);
+            NCO(_adjust_frequency)(_q->source.chirp.nco, _q->source.chirp.df);
+            NCO(_step)            (_q->source.chirp.nco);
+            _q->source.chirp.timer--;
+            if (_q->source.chirp.timer==0) {
+                _q->source.chirp.timer = _q->source.chirp.num;  // reset timer
+                // disable for just one instance
+                if (_q->source.chirp.single)
+                    QSOURCE(_disable)(_q);
+                // reset NCO frequency
+                NCO(_set_frequency)(_q->source.chirp.nco, _q->source.chirp.negate ? M_PI : -M_PI);
+            }
+            // chirp can disable itself within block
+            if (!_q->enabled)
+                _v[i] = 0.0f;
         }
         break;
     case QSOURCE_NOISE:
-        sample = (randnf() + _Complex_I*randnf()) * M_SQRT1_2;
+        liquid_rng_randnf_block(&_q->rng, (float*)_v, 2*_n);
+        for (i=0; i<_n; i++)
+            _v[i] *= M_SQRT1_2;
         break;
     case QSOURCE_MODEM:
-        SYMSTREAM(_write_samples)(_q->source.linmod.symstream, &sample, 1);
-        sample *= M_SQRT1_2; // compensate for 2 samples/symbol
+        SYMSTREAM(_write_samples)(_q->source.linmod.symstream, _v, _n);
+        for (i=0; i<_n; i++)
+            _v[i] *= M_SQRT1_2; // compensate for 2 samples/symbol
         break;
     case QSOURCE_FSK:
-        // fill buffer when necessary
-        if (_q->source.fsk.index==0)
-            fskmod_modulate(_q->source.fsk.mod, rand() & _q->source.fsk.mask, _q->source.fsk.buf);
-
-        // compensate for k samples/symbol
-        sample = _q->source.fsk.buf[ _q->source.fsk.index++ ]; // *  M_SQRT1_2;
-        _q->source.fsk.index %= _q->source.fsk.len; // reset index every k samples
+        for (i=0; i<_n; i+=n) {
+            // fill buffer when necessary
+            if (_q->source.fsk.index==0)
+                fskmod_modulate(_q->source.fsk.mod, liquid_rng_next(&_q->rng) & _q->source.fsk.mask, _q->source.fsk.buf);
+
+            // copy remainder of symbol
+            n = _q->source.fsk.len - _q->source.fsk.index;
+            n = n < _n - i ? n : _n - i;
+            memmove(_v + i, _q->source.fsk.buf + _q->source.fsk.index, n*sizeof(TO));
+            _q->source.fsk.index = (_q->source.fsk.index + n) % _q->source.fsk.len;
+        }
         break;
     case QSOURCE_GMSK:
-        // fill buffer when necessary
-        if (_q->source.gmsk.index==0)
-            gmskmod_modulate(_q->source.gmsk.mod, rand() & 1, _q->source.gmsk.buf);
-
-        // compensate for 2 samples/symbol
-        sample = _q->source.gmsk.buf[ _q->source.gmsk.index++ ] *  M_SQRT1_2;
-        _q->source.gmsk.index &= 1; // reset index every 2 samples
+        for (i=0; i<_n; i++) {
+            // fill buffer when necessary
+            if (_q->source.gmsk.index==0)
+                gmskmod_modulate(_q->source.gmsk.mod, liquid_rng_next(&_q->rng) & 1, _q->source.gmsk.buf);
+
+            // compensate for 2 samples/symbol
+            _v[i] = _q->source.gmsk.buf[ _q->source.gmsk.index++ ] *  M_SQRT1_2;
+            _q->source.gmsk.index &= 1; // reset index every 2 samples
+        }
         break;
     default:
         fprintf(stderr,"error: qsource%s_generate(), internal logic error\n", EXTENSION);
         exit(1);
     }
-    
-    if (!_q->enabled)
-        sample = 0.0f;
 
-    // TODO: push through resampler
+    if (!_q->enabled && _q->type != QSOURCE_CHIRP) {
+        for (i=0; i<_n; i++)
+            _v[i] = 0.0f;
+    }
 
-    // mix sample up
-    NCO(_mix_up)(_q->mixer, sample, _v);
+    // TODO: push through resampler
 
-    // step mixer
-    NCO(_step)(_q->mixer);
+    // mix block up, stepping mixer
+    NCO(_mix_block_up)(_q->mixer, _v, _v, _n);
 }
 
 // generate a block of samples, convert to frequency domain, and write
@@ -430,33 +467,65 @@ void QSOURCE(_generate)(QSOURCE() _q,
 void QSOURCE(_generate_into)(QSOURCE() _q,
                              TO *      _buf)
 {
-    // add into output buffer, applying appropriate scaling
-    unsigned int i;
+    QSOURCE(_generate_channels)(_q);
+    QSOURCE(_add_channels)(_q, _buf);
+}
+
+// generate a block of samples and run analysis channelizer, storing
+// result in internal frequency buffer
+void QSOURCE(_generate_channels)(QSOURCE() _q)
+{
     unsigned int P2 = _q->P/2;
 
     // fill input buffer for channelizer
-    for (i=0; i<P2; i++)
-        QSOURCE(_generate)(_q, _q->buf_time+i);
+    QSOURCE(_generate_block)(_q, _q->buf_time, P2);
 
     // run analysis channelizer
     firpfbch2_crcf_execute(_q->ch, _q->buf_time, _q->buf_freq);
 
+    _q->num_samples += P2;
+}
+
+// add internal frequency buffer into parent channelizer buffer at
+// appropriate frequency location, applying appropriate scaling
+void QSOURCE(_add_channels)(QSOURCE() _q,
+                            TO *      _buf)
+{
+    unsigned int P2 = _q->P/2;
+
     // aggregate gain
     float g = _q->gain * _q->gain_ch;
 
     // copy upper frequency band (base index = _q->index)
-    unsigned int base_index = _q->index;
-    for (i=0; i<P2; i++)
-        _buf[ (base_index+i) % _q->M ] += _q->buf_freq[i] * g;
+    QSOURCE(_accumulate)(_q, _buf, _q->index, _q->buf_freq, P2, g);
 
     // copy lower frequency band (base index = _q->index-P/2)
-    base_index = _q->index;
+    unsigned int base_index = _q->index;
     while (base_index <= P2)
         base_index += _q->M;
     base_index -= P2;
-    for (i=0; i<P2; i++)
-        _buf[ (base_index+i) % _q->M ] += _q->buf_freq[i+P2] * g;
-    
-    _q->num_samples += P2;
+    QSOURCE(_accumulate)(_q, _buf, base_index, _q->buf_freq + P2, P2, g);
+}
+
+// accumulate scaled block into parent channelizer buffer starting at
+// index _base, wrapping around the M channels
+void QSOURCE(_accumulate)(QSOURCE()    _q,
+                          TO *         _buf,
+                          unsigned int _base,
+                          TO *         _x,
+                          unsigned int _n,
+                          float        _g)
+{
+    unsigned int i;
+    _base %= _q->M;
+    while (_n > 0) {
+        // contiguous run up to end of buffer
+        unsigned int n = _q->M - _base < _n ? _q->M - _base : _n;
+        for (i=0; i<n; i++)
+            _buf[_base+i] += _x[i] * _g;
+        _x    += n;
+        _n    -= n;
+        _base  = 0;
+    }
 }
 
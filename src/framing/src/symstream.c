@@ -29,6 +29,9 @@
 #include <string.h>
 #include <math.h>
 
+// number of symbols generated per interpolator block
+#define SYMSTREAM_BATCH (64)
+
 // internal structure
 struct SYMSTREAM(_s) {
     int             filter_type;    // filter type (e.g. LIQUID_FIRFILT_RRC)
@@ -41,8 +44,14 @@ struct SYMSTREAM(_s) {
     FIRINTERP()     interp;         // interpolator
     TO *            buf;            // output buffer
     unsigned int    buf_index;      // output buffer sample index
+    TO              sym[SYMSTREAM_BATCH]; // batch of modulated symbols
+    liquid_rng      rng;            // random symbol generator
 };
 
+// generate batch of modulated symbols, storing result in 'sym'
+void SYMSTREAM(_generate_symbols)(SYMSTREAM() _q,
+                                  unsigned int _n);
+
 // create symstream object using default parameters
 SYMSTREAM() SYMSTREAM(_create)()
 {
@@ -91,6 +100,10 @@ SYMSTREAM() SYMSTREAM(_create_linear)(int          _ftype,
     q->mod_scheme  = _ms;
     q->gain        = 1.0f;
 
+    // seed own symbol generator (rather than sharing rand()) so that
+    // independent streams may run concurrently
+    liquid_rng_seed(&q->rng, rand());
+
     // modulator
     q->mod = MODEM(_create)(q->mod_scheme);
 
@@ -163,18 +176,25 @@ float SYMSTREAM(_get_gain)(SYMSTREAM() _q)
 // fill buffer with samples
 void SYMSTREAM(_fill_buffer)(SYMSTREAM() _q)
 {
-    // generate random symbol
-    unsigned int sym = MODEM(_gen_rand_sym)(_q->mod);
-
-    // modulate
-    TO v;
-    MODEM(_modulate)(_q->mod, sym, &v);
+    // generate symbol and interpolate
+    SYMSTREAM(_generate_symbols)(_q, 1);
+    FIRINTERP(_execute)(_q->interp, _q->sym[0], _q->buf);
+}
 
-    // apply gain
-    v *= _q->gain;
+// generate batch of modulated symbols, storing result in 'sym'
+void SYMSTREAM(_generate_symbols)(SYMSTREAM() _q,
+                                  unsigned int _n)
+{
+    unsigned int M = 1 << MODEM(_get_bps)(_q->mod);
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        // generate random symbol and modulate
+        unsigned int sym = liquid_rng_next(&_q->rng) % M;
+        MODEM(_modulate)(_q->mod, sym, &_q->sym[i]);
 
-    // interpolate
-    FIRINTERP(_execute)(_q->interp, v, _q->buf);
+        // apply gain
+        _q->sym[i] *= _q->gain;
+    }
 }
 
 // write block of samples to output buffer
@@ -185,17 +205,29 @@ void SYMSTREAM(_write_samples)(SYMSTREAM()  _q,
                                TO *         _buf,
                                unsigned int _buf_len)
 {
-    unsigned int i;
-    for (i=0; i<_buf_len; i++) {
-        // check to see if buffer needs samples
-        if (_q->buf_index==0)
-            SYMSTREAM(_fill_buffer)(_q);
+    // write samples remaining in internal buffer
+    unsigned int n = 0;
+    if (_q->buf_index > 0) {
+        n = _q->k - _q->buf_index;
+        n = n < _buf_len ? n : _buf_len;
+        memmove(_buf, _q->buf + _q->buf_index, n*sizeof(TO));
+        _q->buf_index = (_q->buf_index + n) % _q->k;
+    }
 
-        // write output sample from internal buffer
-        _buf[i] = _q->buf[_q->buf_index];
+    // interpolate whole symbols directly into output buffer
+    while (_buf_len - n >= _q->k) {
+        unsigned int num_symbols = (_buf_len - n) / _q->k;
+        if (num_symbols > SYMSTREAM_BATCH)
+            num_symbols = SYMSTREAM_BATCH;
+        SYMSTREAM(_generate_symbols)(_q, num_symbols);
+        FIRINTERP(_execute_block)(_q->interp, _q->sym, num_symbols, _buf + n);
+        n += num_symbols * _q->k;
+    }
 
-        // increment internal index
-        _q->buf_index = (_q->buf_index + 1) % _q->k;
+    // generate partial symbol into internal buffer
+    if (n < _buf_len) {
+        SYMSTREAM(_fill_buffer)(_q);
+        _q->buf_index = _buf_len - n;
+        memmove(_buf + n, _q->buf, _q->buf_index*sizeof(TO));
     }
 }
-
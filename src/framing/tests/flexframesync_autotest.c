@@ -89,3 +89,68 @@ void autotest_flexframesync()
     flexframesync_destroy(fs);
 }
 
+
+// 
+// AUTOTEST : per-stage profile counters
+//
+void autotest_flexframesync_profile()
+{
+    unsigned int i;
+    unsigned int payload_len = 120;
+
+    // create frame generator, synchronizer
+    flexframegenprops_s fgprops;
+    flexframegenprops_init_default(&fgprops);
+    fgprops.mod_scheme = LIQUID_MODEM_QPSK;
+    flexframegen  fg = flexframegen_create(&fgprops);
+    flexframesync fs = flexframesync_create(NULL,NULL);
+
+    // assemble and generate frame
+    unsigned char header[14] = {0};
+    unsigned char payload[payload_len];
+    for (i=0; i<payload_len; i++)
+        payload[i] = rand() & 0xff;
+    flexframegen_assemble(fg, header, payload, payload_len);
+    int frame_complete = 0;
+    float complex buf[2];
+    while (!frame_complete) {
+        frame_complete = flexframegen_write_samples(fg, buf, 2);
+        flexframesync_execute(fs, buf, 2);
+    }
+
+    // check frame was recovered and profile layout
+    framedatastats_s stats = flexframesync_get_framedatastats(fs);
+    liquid_profile_s p = flexframesync_get_profile(fs);
+    if (liquid_autotest_verbose) {
+        liquid_profile_print(&p);
+        liquid_profile_registry_print();
+    }
+    CONTEND_EQUALITY( stats.num_payloads_valid, 1 );
+    CONTEND_EQUALITY( p.num_stages, 5 );
+    CONTEND_SAME_DATA( p.stages[0].name, "detect", 7 );
+    CONTEND_SAME_DATA( p.stages[4].name, "decode", 7 );
+
+    if (liquid_profile_is_enabled()) {
+        // header and payload each decoded once
+        CONTEND_GREATER_THAN( p.stages[0].num_calls,   0 );
+        CONTEND_GREATER_THAN( p.stages[1].num_samples, 0 );
+        CONTEND_GREATER_THAN( p.stages[3].num_samples, 0 );
+        CONTEND_EQUALITY    ( p.stages[4].num_calls,   2 );
+    } else {
+        // counters are never updated
+        for (i=0; i<p.num_stages; i++)
+            CONTEND_EQUALITY( p.stages[i].num_calls, 0 );
+    }
+
+    // reset counters
+    flexframesync_reset_profile(fs);
+    p = flexframesync_get_profile(fs);
+    for (i=0; i<p.num_stages; i++) {
+        CONTEND_EQUALITY( p.stages[i].num_calls,   0 );
+        CONTEND_EQUALITY( p.stages[i].num_samples, 0 );
+        CONTEND_EQUALITY( p.stages[i].num_cycles,  0 );
+    }
+
+    flexframegen_destroy(fg);
+    flexframesync_destroy(fs);
+}
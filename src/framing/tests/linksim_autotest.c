@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// results must not depend on the number of threads
+void autotest_linksim_threads()
+{
+    linksimstats_s s0, s1;
+    linksim q = linksim_create_qpacketmodem(16, LIQUID_CRC_32, LIQUID_FEC_NONE,
+                                            LIQUID_FEC_NONE, LIQUID_MODEM_QPSK);
+    linksim_set_num_trials(q, 100, 400);
+    linksim_set_seed(q, 7);
+
+    linksim_set_num_threads(q, 1);
+    linksim_run(q, 6.0f, &s0);
+    linksim_set_num_threads(q, 4);
+    linksim_run(q, 6.0f, &s1);
+    if (liquid_autotest_verbose) {
+        linksimstats_print(&s0);
+        linksimstats_print(&s1);
+    }
+
+    CONTEND_EQUALITY(s0.num_trials,        s1.num_trials);
+    CONTEND_EQUALITY(s0.num_packet_errors, s1.num_packet_errors);
+    CONTEND_EQUALITY(s0.num_bits,          s1.num_bits);
+    CONTEND_EQUALITY(s0.num_bit_errors,    s1.num_bit_errors);
+    CONTEND_GREATER_THAN(s0.num_packet_errors, 0);
+
+    // different seed gives different trials
+    linksim_set_seed(q, 8);
+    linksim_run(q, 6.0f, &s1);
+    CONTEND_INEQUALITY(s0.num_bit_errors, s1.num_bit_errors);
+
+    linksim_destroy(q);
+}
+
+// trial in error with probability 1/4, as drawn from seed
+int linksim_autotest_trial(void *            _context,
+                           float             _SNRdB,
+                           unsigned long int _seed,
+                           unsigned int *    _num_bits,
+                           unsigned int *    _num_bit_errors)
+{
+    int error = (_seed >> 17) % 4 == 0;
+    *_num_bits       = 8;
+    *_num_bit_errors = error ? 1 : 0;
+    return error;
+}
+
+// trials stop once confidence interval is sufficiently narrow
+void autotest_linksim_early_stop()
+{
+    linksimstats_s s;
+    linksim q = linksim_create(linksim_autotest_trial, NULL, NULL, NULL);
+    linksim_set_num_trials(q, 100, 1000000);
+    linksim_set_precision(q, 0.1f);
+    linksim_run(q, 0.0f, &s);
+    if (liquid_autotest_verbose)
+        linksimstats_print(&s);
+
+    CONTEND_LESS_THAN(s.num_trials, 10000);
+    CONTEND_DELTA(s.PER, 0.25f, 0.03f);
+    CONTEND_DELTA(s.BER, 0.25f/8.0f, 0.004f);
+    CONTEND_LESS_THAN(0.5f*(s.PER_hi - s.PER_lo), 0.1f*s.PER + 1e-6f);
+    CONTEND_LESS_THAN(s.PER_lo, 0.25f);
+    CONTEND_GREATER_THAN(s.PER_hi, 0.25f);
+
+    linksim_destroy(q);
+}
+
+// error rates fall with SNR; sweep ends after first error-free point
+void autotest_linksim_sweep()
+{
+    linksimstats_s s[8];
+    linksim q = linksim_create_qpacketmodem(8, LIQUID_CRC_16, LIQUID_FEC_HAMMING74,
+                                            LIQUID_FEC_NONE, LIQUID_MODEM_QPSK);
+    linksim_set_num_trials(q, 100, 200);
+    unsigned int n = linksim_run_sweep(q, -4.0f, 24.0f, 8, s);
+    unsigned int i;
+    for (i=0; i<n && liquid_autotest_verbose; i++)
+        linksimstats_print(&s[i]);
+
+    CONTEND_LESS_THAN(n, 8);
+    CONTEND_EQUALITY(s[n-1].num_packet_errors, 0);
+    CONTEND_GREATER_THAN(s[0].PER, 0.9f);
+    for (i=1; i<n; i++)
+        CONTEND_LESS_THAN(s[i].BER, s[i-1].BER + 1e-6f);
+
+    linksim_destroy(q);
+}
+
+// frame detection and decoding
+void autotest_linksim_flexframe()
+{
+    linksimstats_s s;
+    linksim q = linksim_create_flexframe(32, LIQUID_CRC_32, LIQUID_FEC_NONE,
+                                         LIQUID_FEC_NONE, LIQUID_MODEM_QPSK);
+    linksim_set_num_trials(q, 20, 20);
+
+    linksim_run(q, 20.0f, &s);
+    CONTEND_EQUALITY(s.num_packet_errors, 0);
+    CONTEND_EQUALITY(s.num_bits, 20*32*8);
+
+    linksim_run(q, -10.0f, &s);
+    CONTEND_EQUALITY(s.num_packet_errors, 20);
+
+    linksim_destroy(q);
+}
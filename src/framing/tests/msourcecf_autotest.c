@@ -0,0 +1,290 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+#include <stdlib.h>
+#include "autotest/autotest.h"
+#include "liquid.internal.h"
+
+// symbol stream should produce same output regardless of block size
+void autotest_symstreamcf_block()
+{
+    unsigned int n = 2000;
+    float complex y0[n];    // one sample at a time
+    float complex y1[n];    // irregular block sizes
+    unsigned int i;
+
+    // create two identical generators (symbols are seeded on creation)
+    symstreamcf gen[2];
+    for (i=0; i<2; i++) {
+        srand(7);
+        gen[i] = symstreamcf_create_linear(LIQUID_FIRFILT_ARKAISER, 3, 9, 0.3f, LIQUID_MODEM_QAM16);
+    }
+
+    // generate one sample at a time
+    for (i=0; i<n; i++)
+        symstreamcf_write_samples(gen[0], &y0[i], 1);
+
+    // generate in blocks of irregular sizes
+    unsigned int block_len[5] = {1, 5, 300, 2, 77};
+    i = 0;
+    unsigned int b = 0;
+    while (i < n) {
+        unsigned int len = block_len[b++ % 5];
+        len = len < n - i ? len : n - i;
+        symstreamcf_write_samples(gen[1], &y1[i], len);
+        i += len;
+    }
+
+    // compare (block interpolation may use fast convolution)
+    for (i=0; i<n; i++) {
+        CONTEND_DELTA( crealf(y1[i]), crealf(y0[i]), 1e-4f );
+        CONTEND_DELTA( cimagf(y1[i]), cimagf(y0[i]), 1e-4f );
+    }
+    symstreamcf_destroy(gen[0]);
+    symstreamcf_destroy(gen[1]);
+}
+
+// create multi-source generator with each source type; sources are seeded
+// on creation
+msourcecf msourcecf_test_create(unsigned int _seed)
+{
+    srand(_seed);
+    msourcecf q = msourcecf_create(64, 4, 60.0f);
+    msourcecf_add_tone (q, -0.40f, 0.00f, -10.0f);
+    msourcecf_add_chirp(q, -0.30f, 0.10f, -10.0f, 500.0f, 0, 1);
+    msourcecf_add_noise(q, -0.15f, 0.10f, -20.0f);
+    msourcecf_add_modem(q,  0.00f, 0.05f,   0.0f, LIQUID_MODEM_QPSK, 7, 0.3f);
+    msourcecf_add_fsk  (q,  0.15f, 0.05f,   0.0f, 2, 8);
+    msourcecf_add_gmsk (q,  0.30f, 0.05f,   0.0f, 4, 0.3f);
+    return q;
+}
+
+// multi-source generator should produce same output regardless of block
+// size, for all source types
+void autotest_msourcecf_block()
+{
+    unsigned int n = 3000;
+    float complex y0[n];    // one sample at a time
+    float complex y1[n];    // irregular block sizes
+    unsigned int i;
+
+    // create two identical generators with each source type
+    msourcecf gen[2];
+    for (i=0; i<2; i++)
+        gen[i] = msourcecf_test_create(11);
+
+    // generate one sample at a time
+    for (i=0; i<n; i++)
+        msourcecf_write_samples(gen[0], &y0[i], 1);
+
+    // generate in blocks of irregular sizes
+    unsigned int block_len[5] = {1, 17, 500, 3, 64};
+    i = 0;
+    unsigned int b = 0;
+    while (i < n) {
+        unsigned int len = block_len[b++ % 5];
+        len = len < n - i ? len : n - i;
+        msourcecf_write_samples(gen[1], &y1[i], len);
+        i += len;
+    }
+
+    // compare
+    for (i=0; i<n; i++) {
+        CONTEND_DELTA( crealf(y1[i]), crealf(y0[i]), 1e-6f );
+        CONTEND_DELTA( cimagf(y1[i]), cimagf(y0[i]), 1e-6f );
+    }
+    CONTEND_EQUALITY( msourcecf_get_num_samples(gen[1]), msourcecf_get_num_samples(gen[0]) );
+
+    msourcecf_destroy(gen[0]);
+    msourcecf_destroy(gen[1]);
+}
+
+// multi-source generator should produce identical output regardless of
+// number of threads, including when gain changes between blocks
+void autotest_msourcecf_threads()
+{
+    unsigned int n = 4000;
+    float complex y0[n];    // single thread
+    float complex y1[n];    // multiple threads
+    unsigned int i;
+
+    msourcecf gen[2];
+    for (i=0; i<2; i++)
+        gen[i] = msourcecf_test_create(13);
+    msourcecf_set_num_threads(gen[1], 4);
+
+    // generate in two halves, changing a source's gain in between
+    unsigned int h = n/2;
+    msourcecf_write_samples(gen[0], y0,   h);
+    msourcecf_write_samples(gen[1], y1,   h);
+    msourcecf_set_gain(gen[0], 3, -6.0f);
+    msourcecf_set_gain(gen[1], 3, -6.0f);
+    msourcecf_write_samples(gen[0], y0+h, n-h);
+    msourcecf_write_samples(gen[1], y1+h, n-h);
+
+    // sources are combined in order, so output is bit-exact
+    for (i=0; i<n; i++) {
+        CONTEND_EQUALITY( crealf(y1[i]), crealf(y0[i]) );
+        CONTEND_EQUALITY( cimagf(y1[i]), cimagf(y0[i]) );
+    }
+
+    msourcecf_destroy(gen[0]);
+    msourcecf_destroy(gen[1]);
+}
+
+// create single-signal source of a given type (0:tone, 1:chirp, 2:noise,
+// 3:modem, 4:fsk, 5:gmsk); sources are seeded on creation
+qsourcecf qsourcecf_test_create(unsigned int _type,
+                                unsigned int _seed)
+{
+    srand(_seed);
+    qsourcecf q = qsourcecf_create(64, 4, 60.0f, 0.13f, 0.10f, 0.0f);
+    switch (_type) {
+    case 0: qsourcecf_init_tone (q);                             break;
+    case 1: qsourcecf_init_chirp(q, 500.0f, 0, 0);               break;
+    case 2: qsourcecf_init_noise(q);                             break;
+    case 3: qsourcecf_init_modem(q, LIQUID_MODEM_QPSK, 7, 0.3f); break;
+    case 4: qsourcecf_init_fsk  (q, 2, 8);                       break;
+    default:qsourcecf_init_gmsk (q, 4, 0.3f);
+    }
+    return q;
+}
+
+// single-signal source block generation should match per-sample
+// generation with the same seed, for all source types
+void autotest_qsourcecf_block()
+{
+    unsigned int n = 1500;
+    float complex y0[n];    // one sample at a time
+    float complex y1[n];    // irregular block sizes
+    unsigned int i;
+    unsigned int t;
+
+    for (t=0; t<6; t++) {
+        qsourcecf q0 = qsourcecf_test_create(t, 17);
+        qsourcecf q1 = qsourcecf_test_create(t, 17);
+
+        // generate one sample at a time
+        for (i=0; i<n; i++)
+            qsourcecf_generate(q0, &y0[i]);
+
+        // generate in blocks of irregular sizes
+        unsigned int block_len[5] = {1, 23, 400, 2, 9};
+        i = 0;
+        unsigned int b = 0;
+        while (i < n) {
+            unsigned int len = block_len[b++ % 5];
+            len = len < n - i ? len : n - i;
+            qsourcecf_generate_block(q1, &y1[i], len);
+            i += len;
+        }
+
+        // compare (modem block interpolation may use fast convolution)
+        float tol = t == 3 ? 1e-4f : 1e-6f;
+        for (i=0; i<n; i++) {
+            CONTEND_DELTA( crealf(y1[i]), crealf(y0[i]), tol );
+            CONTEND_DELTA( cimagf(y1[i]), cimagf(y0[i]), tol );
+        }
+        qsourcecf_destroy(q0);
+        qsourcecf_destroy(q1);
+    }
+}
+
+// deterministic user-defined source: short periodic sequence
+int qsourcecf_test_callback(void *          _userdata,
+                            float complex * _v,
+                            unsigned int    _n)
+{
+    unsigned int * k = (unsigned int*)_userdata;
+    unsigned int i;
+    for (i=0; i<_n; i++, (*k)++)
+        _v[i] = (float)((*k)%7) - 3.0f + _Complex_I*((float)((*k)%5) - 2.0f);
+    return 0;
+}
+
+// block generation and channel accumulation should match a reference that
+// mixes one sample at a time and accumulates with a modulo per sample,
+// including when the lower band wraps around the parent channelizer
+void autotest_qsourcecf_generate_into()
+{
+    unsigned int M  = 64;       // parent channelizer size
+    unsigned int m  = 4;        // filter semi-length
+    float        As = 60.0f;    // stop-band suppression
+    float        fc = 0.02f;    // center frequency (lower band wraps)
+    float        bw = 0.10f;    // bandwidth
+    unsigned int num_blocks = 50;
+
+    // source under test
+    unsigned int k0 = 0;
+    qsourcecf q = qsourcecf_create(M, m, As, fc, bw, 0.0f);
+    qsourcecf_init_user(q, &k0, (void*)qsourcecf_test_callback);
+
+    // reference: per-sample mixer, analysis channelizer and placement
+    unsigned int k1    = 0;
+    unsigned int P     = 2*(unsigned int)ceilf(0.5f*bw*M);
+    unsigned int P2    = P/2;
+    unsigned int index = (unsigned int)roundf(fc*M) % M;
+    float        g     = sqrtf((float)P/(float)M);
+    nco_crcf mixer = nco_crcf_create(LIQUID_VCO);
+    nco_crcf_set_frequency(mixer, qsourcecf_get_frequency(q));
+    firpfbch2_crcf ch = firpfbch2_crcf_create_kaiser(LIQUID_ANALYZER, P, m, As);
+
+    float complex buf0[M];  // output of source under test
+    float complex buf1[M];  // reference output
+    float complex x[P2];
+    float complex X[P];
+    unsigned int i;
+    unsigned int b;
+    for (b=0; b<num_blocks; b++) {
+        for (i=0; i<M; i++) {
+            buf0[i] = 0.0f;
+            buf1[i] = 0.0f;
+        }
+        qsourcecf_generate_into(q, buf0);
+
+        // reference path
+        for (i=0; i<P2; i++) {
+            float complex v;
+            qsourcecf_test_callback(&k1, &v, 1);
+            nco_crcf_mix_up(mixer, v, &x[i]);
+            nco_crcf_step(mixer);
+        }
+        firpfbch2_crcf_execute(ch, x, X);
+        for (i=0; i<P2; i++)
+            buf1[ (index+i) % M ] += X[i] * g;
+        unsigned int base_index = index;
+        while (base_index <= P2)
+            base_index += M;
+        base_index -= P2;
+        for (i=0; i<P2; i++)
+            buf1[ (base_index+i) % M ] += X[i+P2] * g;
+
+        for (i=0; i<M; i++) {
+            CONTEND_DELTA( crealf(buf0[i]), crealf(buf1[i]), 1e-4f );
+            CONTEND_DELTA( cimagf(buf0[i]), cimagf(buf1[i]), 1e-4f );
+        }
+    }
+    CONTEND_EQUALITY( qsourcecf_get_num_samples(q), num_blocks*P2 );
+
+    qsourcecf_destroy(q);
+    nco_crcf_destroy(mixer);
+    firpfbch2_crcf_destroy(ch);
+}
@@ -75,4 +75,47 @@ void benchmark_freqdem(struct rusage *     _start,
     freqdem_destroy(dem);
 }
 
+// Helper function to keep code base small; a trial is one sample
+// demodulated in blocks with discriminator tolerance _tol
+void freqdem_block_bench(struct rusage *     _start,
+                         struct rusage *     _finish,
+                         unsigned long int * _num_iterations,
+                         float               _tol)
+{
+    // create demodulator
+    float   kf  = 0.05f; // modulation index
+    freqdem dem = freqdem_create(kf);
+    freqdem_set_tolerance(dem, _tol);
+
+    unsigned int  n = 256;
+    float complex r[n];     // modulated signal
+    float         m[n];     // message signal
+
+    // generate modulated signal
+    unsigned long int i;
+    for (i=0; i<n; i++)
+        r[i] = 0.3f*cexpf(_Complex_I*2*M_PI*i/20.0f);
+
+    // start trials
+    unsigned long int num_blocks = 4*(*_num_iterations) / n + 1;
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<num_blocks; i++)
+        freqdem_demodulate_block(dem, r, n, m);
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations = num_blocks * n;
+
+    // destroy demodulator
+    freqdem_destroy(dem);
+}
 
+#define FREQDEM_BLOCK_BENCHMARK_API(TOL)    \
+(   struct rusage *_start,                  \
+    struct rusage *_finish,                 \
+    unsigned long int *_num_iterations)     \
+{ freqdem_block_bench(_start, _finish, _num_iterations, TOL); }
+// block demodulation: full precision (default) and reduced accuracy
+// block demodulation: full precision, default, and reduced accuracy
+void benchmark_freqdem_block_exact  FREQDEM_BLOCK_BENCHMARK_API(0.0f )
+void benchmark_freqdem_block_2e_6   FREQDEM_BLOCK_BENCHMARK_API(2e-6f)
+void benchmark_freqdem_block_1e_4   FREQDEM_BLOCK_BENCHMARK_API(1e-4f)
+void benchmark_freqdem_block_5e_3   FREQDEM_BLOCK_BENCHMARK_API(5e-3f)
@@ -24,13 +24,19 @@
 #include <stdlib.h>
 #include <math.h>
 #include <sys/resource.h>
-#include "liquid.h"
+#include "liquid.internal.h"
 
 #define FSKDEM_BENCH_API(m,k,bandwidth)     \
 (   struct rusage *     _start,             \
     struct rusage *     _finish,            \
     unsigned long int * _num_iterations)    \
-{ fskdem_bench(_start, _finish, _num_iterations, m, k, bandwidth); }
+{ fskdem_bench(_start, _finish, _num_iterations, m, k, bandwidth, -1); }
+
+#define FSKDEM_METHOD_BENCH_API(m,k,bandwidth,method) \
+(   struct rusage *     _start,             \
+    struct rusage *     _finish,            \
+    unsigned long int * _num_iterations)    \
+{ fskdem_bench(_start, _finish, _num_iterations, m, k, bandwidth, method); }
 
 // Helper function to keep code base small
 void fskdem_bench(struct rusage *     _start,
@@ -38,7 +44,8 @@ void fskdem_bench(struct rusage *     _start,
                   unsigned long int * _num_iterations,
                   unsigned int        _m,
                   unsigned int        _k,
-                  float               _bandwidth)
+                  float               _bandwidth,
+                  int                 _method)
 {
     // normalize number of iterations
     *_num_iterations /= _k;
@@ -47,6 +54,8 @@ void fskdem_bench(struct rusage *     _start,
 
     // initialize demodulator
     fskdem dem = fskdem_create(_m,_k,_bandwidth);
+    if (_method >= 0)
+        fskdem_set_method(dem, _method);
 
     //unsigned int M = 1 << _m;   // constellation size
     
@@ -101,3 +110,20 @@ void benchmark_fskdem_misc_M256    FSKDEM_BENCH_API( 8,  500, 0.3721451)
 void benchmark_fskdem_misc_M512    FSKDEM_BENCH_API( 9, 1000, 0.3721451)
 void benchmark_fskdem_misc_M1024   FSKDEM_BENCH_API(10, 2000, 0.3721451)
 
+
+// BENCHMARKS: each tone detection method (default is selected by cost)
+void benchmark_fskdem_fft_M2             FSKDEM_METHOD_BENCH_API( 1,   4, 0.25f,     LIQUID_FSKDEM_FFT       )
+void benchmark_fskdem_fft_M8             FSKDEM_METHOD_BENCH_API( 3,  16, 0.25f,     LIQUID_FSKDEM_FFT       )
+void benchmark_fskdem_fft_M32            FSKDEM_METHOD_BENCH_API( 5,  64, 0.25f,     LIQUID_FSKDEM_FFT       )
+void benchmark_fskdem_fft_M128           FSKDEM_METHOD_BENCH_API( 7, 256, 0.25f,     LIQUID_FSKDEM_FFT       )
+void benchmark_fskdem_fft_misc_M8        FSKDEM_METHOD_BENCH_API( 3,  20, 0.3721451, LIQUID_FSKDEM_FFT       )
+void benchmark_fskdem_goertzel_M2        FSKDEM_METHOD_BENCH_API( 1,   4, 0.25f,     LIQUID_FSKDEM_GOERTZEL  )
+void benchmark_fskdem_goertzel_M8        FSKDEM_METHOD_BENCH_API( 3,  16, 0.25f,     LIQUID_FSKDEM_GOERTZEL  )
+void benchmark_fskdem_goertzel_M32       FSKDEM_METHOD_BENCH_API( 5,  64, 0.25f,     LIQUID_FSKDEM_GOERTZEL  )
+void benchmark_fskdem_goertzel_M128      FSKDEM_METHOD_BENCH_API( 7, 256, 0.25f,     LIQUID_FSKDEM_GOERTZEL  )
+void benchmark_fskdem_goertzel_misc_M8   FSKDEM_METHOD_BENCH_API( 3,  20, 0.3721451, LIQUID_FSKDEM_GOERTZEL  )
+void benchmark_fskdem_correlator_M2      FSKDEM_METHOD_BENCH_API( 1,   4, 0.25f,     LIQUID_FSKDEM_CORRELATOR)
+void benchmark_fskdem_correlator_M8      FSKDEM_METHOD_BENCH_API( 3,  16, 0.25f,     LIQUID_FSKDEM_CORRELATOR)
+void benchmark_fskdem_correlator_M32     FSKDEM_METHOD_BENCH_API( 5,  64, 0.25f,     LIQUID_FSKDEM_CORRELATOR)
+void benchmark_fskdem_correlator_M128    FSKDEM_METHOD_BENCH_API( 7, 256, 0.25f,     LIQUID_FSKDEM_CORRELATOR)
+void benchmark_fskdem_correlator_misc_M8 FSKDEM_METHOD_BENCH_API( 3,  20, 0.3721451, LIQUID_FSKDEM_CORRELATOR)
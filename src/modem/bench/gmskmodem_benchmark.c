@@ -70,6 +70,7 @@ void benchmark_gmskmodem_demodulate(struct rusage *_start,
 
     // create modem object
     gmskdem demod = gmskdem_create(k, m, BT);
+    gmskdem_set_tolerance(demod, 1e-4f);
 
     float complex x[k];
     unsigned int symbol_out = 0;
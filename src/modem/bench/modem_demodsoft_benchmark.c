@@ -32,6 +32,12 @@
     unsigned long int *_num_iterations) \
 { modem_demodulate_soft_bench(_start, _finish, _num_iterations, MS); }
 
+#define MODEM_DEMODSOFT_Q15_BENCH_API(MS) \
+(   struct rusage *_start,              \
+    struct rusage *_finish,             \
+    unsigned long int *_num_iterations) \
+{ modem_demodulate_soft_q15_bench(_start, _finish, _num_iterations, MS); }
+
 // Helper function to keep code base small
 void modem_demodulate_soft_bench(struct rusage *_start,
                                  struct rusage *_finish,
@@ -159,3 +165,53 @@ void benchmark_demodsoft_arb128opt MODEM_DEMODSOFT_BENCH_API(LIQUID_MODEM_ARB128
 void benchmark_demodsoft_arb256opt MODEM_DEMODSOFT_BENCH_API(LIQUID_MODEM_ARB256OPT)
 void benchmark_demodsoft_arb64vt   MODEM_DEMODSOFT_BENCH_API(LIQUID_MODEM_ARB64VT)
 
+
+// Helper function for fixed-point soft demodulation
+void modem_demodulate_soft_q15_bench(struct rusage *_start,
+                                     struct rusage *_finish,
+                                     unsigned long int *_num_iterations,
+                                     modulation_scheme _ms)
+{
+    // normalize number of iterations
+    *_num_iterations /= (_ms == LIQUID_MODEM_BPSK || _ms == LIQUID_MODEM_QPSK) ? 1 : 8;
+    if (*_num_iterations < 1) *_num_iterations = 1;
+
+    // initialize modulator
+    modem demod = modem_create(_ms);
+    unsigned int bps = modem_get_bps(demod);
+
+    unsigned long int i;
+    unsigned int k;
+
+    // generate input vector to demodulate (spiral) at half scale
+    liquid_cq15 x[20];
+    for (i=0; i<20; i++) {
+        float complex v = 0.5f * 0.07 * i * cexpf(_Complex_I*2*M_PI*0.1*i);
+        x[i].real = liquid_float_to_q15(crealf(v));
+        x[i].imag = liquid_float_to_q15(cimagf(v));
+    }
+
+    unsigned int symbol_out;
+    unsigned char soft_bits[bps];
+
+    // start trials
+    getrusage(RUSAGE_SELF, _start);
+    for (i=0; i<(*_num_iterations); i++) {
+        for (k=0; k<20; k++)
+            modem_demodulate_soft_q15(demod, x[k], &symbol_out, soft_bits);
+    }
+    getrusage(RUSAGE_SELF, _finish);
+    *_num_iterations *= 20;
+
+    modem_destroy(demod);
+}
+
+// fixed-point soft demodulation
+void benchmark_demodsoft_q15_bpsk     MODEM_DEMODSOFT_Q15_BENCH_API(LIQUID_MODEM_BPSK)
+void benchmark_demodsoft_q15_qpsk     MODEM_DEMODSOFT_Q15_BENCH_API(LIQUID_MODEM_QPSK)
+void benchmark_demodsoft_q15_psk8     MODEM_DEMODSOFT_Q15_BENCH_API(LIQUID_MODEM_PSK8)
+void benchmark_demodsoft_q15_qam16    MODEM_DEMODSOFT_Q15_BENCH_API(LIQUID_MODEM_QAM16)
+void benchmark_demodsoft_q15_qam64    MODEM_DEMODSOFT_Q15_BENCH_API(LIQUID_MODEM_QAM64)
+void benchmark_demodsoft_q15_qam256   MODEM_DEMODSOFT_Q15_BENCH_API(LIQUID_MODEM_QAM256)
+void benchmark_demodsoft_q15_apsk32   MODEM_DEMODSOFT_Q15_BENCH_API(LIQUID_MODEM_APSK32)
+void benchmark_demodsoft_q15_arb64opt MODEM_DEMODSOFT_Q15_BENCH_API(LIQUID_MODEM_ARB64OPT)
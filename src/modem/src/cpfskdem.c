@@ -72,9 +72,11 @@ struct cpfskdem_s {
     unsigned int m;             // filter delay (symbols)
     float        beta;          // filter bandwidth parameter
     float        h;             // modulation index
+    float        h_inv;         // discriminator scaling, 1/(h*pi)
     int          type;          // filter type (e.g. LIQUID_CPFSK_GMSK)
     unsigned int M;             // constellation size
     unsigned int symbol_delay;  // receiver filter delay [symbols]
+    float        tol;           // discriminator accuracy, 0 for full precision
 
     // demodulator type
     enum {
@@ -162,9 +164,11 @@ cpfskdem cpfskdem_create(unsigned int _bps,
     q->m    = _m;       // filter delay (symbols)
     q->beta = _beta;    // filter roll-off factor (only for certain filters)
     q->type = _type;    // filter type
+    q->tol  = 0.0f;     // full-precision discriminator
 
     // derived values
-    q->M = 1 << q->bps; // constellation size
+    q->M     = 1 << q->bps;         // constellation size
+    q->h_inv = 1.0f / (q->h * M_PI);
 
     // coherent or non-coherent?
     // TODO: allow user to specify
@@ -303,6 +307,19 @@ unsigned int cpfskdem_get_delay(cpfskdem _q)
     return _q->symbol_delay;
 }
 
+// set discriminator accuracy
+//  _q      :   demodulator object
+//  _tol    :   maximum absolute phase error [radians], 0 for full precision
+void cpfskdem_set_tolerance(cpfskdem _q,
+                            float    _tol)
+{
+    if (_tol < 0.0f) {
+        fprintf(stderr,"error: cpfskdem_set_tolerance(), tolerance must be non-negative\n");
+        exit(1);
+    }
+    _q->tol = _tol;
+}
+
 #if 0
 // demodulate array of samples
 //  _q      :   continuous-phase frequency demodulator object
@@ -362,8 +379,10 @@ void cpfskdem_demodulate_coherent(cpfskdem        _q,
         firfilt_crcf_execute(_q->data.coherent.mf, &z);
 
         // compute instantaneous frequency scaled by modulation index
-        // TODO: pre-compute scaling factor
-        float phi_hat = cargf(conjf(_q->z_prime) * z) / (_q->h * M_PI);
+        float complex zz[2] = {_q->z_prime, z};
+        float phi_hat;
+        liquid_vectorcf_cargdiff(zz, 1, _q->tol, &phi_hat);
+        phi_hat *= _q->h_inv;
 
         // estimate transmitted symbol
         float v = (phi_hat + (_q->M-1.0))*0.5f;
@@ -430,8 +449,10 @@ unsigned int cpfskdem_demodulate_coherent(cpfskdem        _q,
             firfilt_crcf_execute(_q->data.coherent.mf, &z);
 
             // compute instantaneous frequency scaled by modulation index
-            // TODO: pre-compute scaling factor
-            float phi_hat = cargf(conjf(_q->z_prime) * z) / (_q->h * M_PI);
+            float complex zz[2] = {_q->z_prime, z};
+            float phi_hat;
+            liquid_vectorcf_cargdiff(zz, 1, _q->tol, &phi_hat);
+            phi_hat *= _q->h_inv;
 
             // estimate transmitted symbol
             float v = (phi_hat + (_q->M-1.0))*0.5f;
@@ -35,6 +35,7 @@ struct FREQDEM(_s) {
     // common
     float kf;   // modulation index
     T     ref;  // 1/(2*pi*kf)
+    T     tol;  // discriminator accuracy, 0 for full precision
 
     TC r_prime; // previous received sample
 };
@@ -57,6 +58,7 @@ FREQDEM() FREQDEM(_create)(float _kf)
 
     // compute derived values
     q->ref = 1.0f / (2*M_PI*q->kf);
+    q->tol = 0.0f;
 
     // reset modem object
     FREQDEM(_reset)(q);
@@ -77,6 +79,7 @@ void FREQDEM(_print)(FREQDEM() _q)
 {
     printf("freqdem:\n");
     printf("    mod. factor :   %8.4f\n", _q->kf);
+    printf("    tolerance   :   %12.4e\n", _q->tol);
 }
 
 // reset modem object
@@ -86,6 +89,19 @@ void FREQDEM(_reset)(FREQDEM() _q)
     _q->r_prime = 0;
 }
 
+// set accuracy of discriminator
+//  _q      :   FM demodulator object
+//  _tol    :   maximum absolute phase error [radians], 0 for full precision
+void FREQDEM(_set_tolerance)(FREQDEM() _q,
+                             float     _tol)
+{
+    if (_tol < 0.0f) {
+        fprintf(stderr,"error: freqdem_set_tolerance(), tolerance must be non-negative\n");
+        exit(1);
+    }
+    _q->tol = _tol;
+}
+
 // demodulate sample
 //  _q      :   FM demodulator object
 //  _r      :   received signal
@@ -95,7 +111,13 @@ void FREQDEM(_demodulate)(FREQDEM() _q,
                           T *       _m)
 {
     // compute phase difference and normalize by modulation index
-    *_m = cargf( conjf(_q->r_prime)*_r ) * _q->ref;
+    if (_q->tol == 0.0f) {
+        *_m = cargf( conjf(_q->r_prime)*_r ) * _q->ref;
+    } else {
+        TC x[2] = {_q->r_prime, _r};
+        liquid_vectorcf_cargdiff(x, 1, _q->tol, _m);
+        *_m *= _q->ref;
+    }
 
     // save previous input sample
     _q->r_prime = _r;
@@ -111,9 +133,18 @@ void FREQDEM(_demodulate_block)(FREQDEM()    _q,
                                 unsigned int _n,
                                 T *          _m)
 {
-    // TODO: implement more efficient method
-    unsigned int i;
-    for (i=0; i<_n; i++)
-        FREQDEM(_demodulate)(_q, _r[i], &_m[i]);
+    if (_n == 0)
+        return;
+
+    // compute phase differences, the first against previous sample
+    TC x[2] = {_q->r_prime, _r[0]};
+    liquid_vectorcf_cargdiff(x,  1,    _q->tol, _m);
+    liquid_vectorcf_cargdiff(_r, _n-1, _q->tol, _m+1);
+
+    // normalize by modulation index
+    liquid_vectorf_mulscalar(_m, _n, _q->ref, _m);
+
+    // save previous input sample
+    _q->r_prime = _r[_n-1];
 }
 
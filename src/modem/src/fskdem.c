@@ -33,10 +33,32 @@
 
 #define DEBUG_FSKDEM 0
 
+// approximate tone detection costs (ns) used to select method
+#define FSKDEM_COST_DFT             (0.5f)  // per K^2, direct DFT (small K)
+#define FSKDEM_COST_FFT_RADIX2      (1.7f)  // per K log2(K), K = 2^n
+#define FSKDEM_COST_FFT_SMOOTH      (4.0f)  // per K log2(K), factors <= 7
+#define FSKDEM_COST_FFT_PRIME       (10.0f) // per K log2(K), large factors
+#define FSKDEM_COST_GOERTZEL        (1.7f)  // per tone per sample
+#define FSKDEM_COST_CORRELATOR      (0.6f)  // per tone per sample
+#define FSKDEM_COST_TONE            (10.0f) // per tone overhead
+#define FSKDEM_CORRELATOR_MAX       (65536) // maximum reference samples
+
 // 
 // internal methods
 //
 
+// estimate lowest-cost tone detection method for given dimensions
+int fskdem_estimate_method(unsigned int _M,
+                           unsigned int _k,
+                           unsigned int _K);
+
+// detect tones with bank of Goertzel resonators, storing in 'v'
+void fskdem_execute_goertzel(fskdem          _q,
+                             float complex * _y);
+
+// compute full transform of time buffer if not already computed
+void fskdem_update_spectrum(fskdem _q);
+
 // fskdem
 struct fskdem_s {
     // common
@@ -53,6 +75,15 @@ struct fskdem_s {
     FFT_PLAN        fft;        // FFT object
     unsigned int *  demod_map;  // demodulation map
 
+    // tone detection
+    int             method;     // tone detection method
+    float complex * v;          // tone bin values [size: M x 1]
+    int             spectrum_valid; // buf_freq holds transform of buf_time?
+    float *         g_coeff;    // Goertzel coefficients, 2 cos(w)
+    float complex * g_rot;      // Goertzel output rotation, exp(-j w)
+    float complex * g_phase;    // Goertzel output phase, exp(-j w (k-1))
+    dotprod_cccf *  dp;         // correlator bank [size: M x 1]
+
     // state variables
     unsigned int    s_demod;    // demodulated symbol (used for frequency error)
 };
@@ -145,6 +176,22 @@ fskdem fskdem_create(unsigned int _m,
     q->buf_freq = (float complex*) malloc(q->K * sizeof(float complex));
     q->fft = FFT_CREATE_PLAN(q->K, q->buf_time, q->buf_freq, FFT_DIR_FORWARD, 0);
 
+    // compute Goertzel coefficients for tone bins
+    q->v       = (float complex*) malloc(q->M * sizeof(float complex));
+    q->g_coeff = (float*)         malloc(q->M * sizeof(float));
+    q->g_rot   = (float complex*) malloc(q->M * sizeof(float complex));
+    q->g_phase = (float complex*) malloc(q->M * sizeof(float complex));
+    for (i=0; i<q->M; i++) {
+        float w = 2*M_PI*(float)(q->demod_map[i]) / (float)(q->K);
+        q->g_coeff[i] = 2.0f*cosf(w);
+        q->g_rot[i]   = cexpf(-_Complex_I*w);
+        q->g_phase[i] = cexpf(-_Complex_I*w*(float)(q->k-1));
+    }
+
+    // select tone detection method
+    q->dp = NULL;
+    fskdem_set_method(q, fskdem_estimate_method(q->M, q->k, q->K));
+
     // reset modem object
     fskdem_reset(q);
 
@@ -161,6 +208,13 @@ void fskdem_destroy(fskdem _q)
     free(_q->buf_freq);
     FFT_DESTROY_PLAN(_q->fft);
 
+    // free tone detection objects
+    fskdem_set_method(_q, LIQUID_FSKDEM_FFT);
+    free(_q->v);
+    free(_q->g_coeff);
+    free(_q->g_rot);
+    free(_q->g_phase);
+
     // free main object memory
     free(_q);
 }
@@ -172,6 +226,54 @@ void fskdem_print(fskdem _q)
     printf("    bits/symbol     :   %u\n", _q->m);
     printf("    samples/symbol  :   %u\n", _q->k);
     printf("    bandwidth       :   %8.5f\n", _q->bandwidth);
+    printf("    tone detection  :   %s\n",
+        _q->method == LIQUID_FSKDEM_GOERTZEL   ? "goertzel"   :
+        _q->method == LIQUID_FSKDEM_CORRELATOR ? "correlator" : "fft");
+}
+
+// set tone detection method (default is selected by cost at creation)
+//  _q      :   fskdem object
+//  _method :   detection method, e.g. LIQUID_FSKDEM_GOERTZEL
+void fskdem_set_method(fskdem _q,
+                       int    _method)
+{
+    if (_method != LIQUID_FSKDEM_FFT      &&
+        _method != LIQUID_FSKDEM_GOERTZEL &&
+        _method != LIQUID_FSKDEM_CORRELATOR)
+    {
+        fprintf(stderr,"error: fskdem_set_method(), invalid method (%d)\n", _method);
+        exit(1);
+    }
+
+    // destroy existing correlator bank
+    unsigned int i;
+    if (_q->dp != NULL) {
+        for (i=0; i<_q->M; i++)
+            dotprod_cccf_destroy(_q->dp[i]);
+        free(_q->dp);
+        _q->dp = NULL;
+    }
+
+    // create correlator bank: one reference tone per symbol
+    if (_method == LIQUID_FSKDEM_CORRELATOR) {
+        _q->dp = (dotprod_cccf*) malloc(_q->M * sizeof(dotprod_cccf));
+        float complex h[_q->k];
+        unsigned int n;
+        for (i=0; i<_q->M; i++) {
+            for (n=0; n<_q->k; n++)
+                h[n] = cexpf(-_Complex_I*2*M_PI*(float)((_q->demod_map[i]*n) % _q->K) / (float)(_q->K));
+            _q->dp[i] = dotprod_cccf_create(h, _q->k);
+        }
+    }
+
+    _q->method = _method;
+    _q->spectrum_valid = 0;
+}
+
+// get tone detection method
+int fskdem_get_method(fskdem _q)
+{
+    return _q->method;
 }
 
 // reset state
@@ -183,6 +285,9 @@ void fskdem_reset(fskdem _q)
         _q->buf_time[i] = 0.0f;
         _q->buf_freq[i] = 0.0f;
     }
+    for (i=0; i<_q->M; i++)
+        _q->v[i] = 0.0f;
+    _q->spectrum_valid = 1;
 
     // clear state variables
     _q->s_demod = 0;
@@ -197,16 +302,32 @@ unsigned int fskdem_demodulate(fskdem          _q,
     // copy input to internal time buffer
     memmove(_q->buf_time, _y, _q->k*sizeof(float complex));
 
-    // compute transform, storing result in 'buf_freq'
-    FFT_EXECUTE(_q->fft);
+    // compute tone bin values, storing result in 'v'
+    unsigned int s;
+    switch (_q->method) {
+    case LIQUID_FSKDEM_GOERTZEL:
+        fskdem_execute_goertzel(_q, _y);
+        _q->spectrum_valid = 0;
+        break;
+    case LIQUID_FSKDEM_CORRELATOR:
+        for (s=0; s<_q->M; s++)
+            dotprod_cccf_execute(_q->dp[s], _y, &_q->v[s]);
+        _q->spectrum_valid = 0;
+        break;
+    default:
+        // compute transform, storing result in 'buf_freq'
+        FFT_EXECUTE(_q->fft);
+        for (s=0; s<_q->M; s++)
+            _q->v[s] = _q->buf_freq[_q->demod_map[s]];
+        _q->spectrum_valid = 1;
+    }
 
     // find maximum by looking at particular bins
-    float        vmax  = 0;
-    unsigned int s     = 0;
+    float vmax = 0;
 
     // run search
     for (s=0; s<_q->M; s++) {
-        float v = cabsf( _q->buf_freq[_q->demod_map[s]] );
+        float v = crealf(_q->v[s])*crealf(_q->v[s]) + cimagf(_q->v[s])*cimagf(_q->v[s]);
         if (s==0 || v > vmax) {
             // save optimal output symbol
             _q->s_demod = s;
@@ -225,6 +346,7 @@ float fskdem_get_frequency_error(fskdem _q)
 {
     // get index of peak bin
     //unsigned int index = _q->buf_freq[ _q->s_demod ];
+    fskdem_update_spectrum(_q);
 
     // extract peak value of previous, post FFT index
     float vm = cabsf(_q->buf_freq[(_q->s_demod+_q->K-1)%_q->K]);  // previous
@@ -255,8 +377,13 @@ float fskdem_get_symbol_energy(fskdem       _q,
     // map input symbol to FFT bin
     unsigned int index = _q->demod_map[_s];
 
+    // energy at tone bin alone is available without the full transform
+    float complex v = _q->v[_s];
+    if (_range == 0)
+        return crealf(v)*crealf(v) + cimagf(v)*cimagf(v);
+
     // compute energy around FFT bin
-    float complex v = _q->buf_freq[index];
+    fskdem_update_spectrum(_q);
     float energy = crealf(v)*crealf(v) + cimagf(v)*cimagf(v);
     int i;
     for (i=0; i<_range; i++) {
@@ -274,3 +401,106 @@ float fskdem_get_symbol_energy(fskdem       _q,
     return energy;
 }
 
+
+// 
+// internal methods
+//
+
+// estimate lowest-cost tone detection method for given dimensions
+int fskdem_estimate_method(unsigned int _M,
+                           unsigned int _k,
+                           unsigned int _K)
+{
+    // FFT cost depends upon the largest prime factor of K, which sets
+    // whether transform uses radix-2, mixed-radix, or Rader's method
+    unsigned int factors[LIQUID_MAX_FACTORS];
+    unsigned int num_factors;
+    liquid_factor(_K, factors, &num_factors);
+    unsigned int p = factors[num_factors-1];
+    float KlogK = (float)_K * log2f((float)_K);
+    float c_fft;
+    if (liquid_fft_estimate_method(_K) == LIQUID_FFT_METHOD_DFT)
+        c_fft = FSKDEM_COST_DFT * (float)(_K*_K);
+    else if (p == 2)
+        c_fft = FSKDEM_COST_FFT_RADIX2 * KlogK;
+    else if (p <= 7)
+        c_fft = FSKDEM_COST_FFT_SMOOTH * KlogK;
+    else
+        c_fft = FSKDEM_COST_FFT_PRIME  * KlogK;
+
+    // Goertzel and correlator banks compute only the M tone bins
+    float c_goertzel   = FSKDEM_COST_GOERTZEL  *(float)(_M*_k) + FSKDEM_COST_TONE*_M;
+    float c_correlator = FSKDEM_COST_CORRELATOR*(float)(_M*_k) + FSKDEM_COST_TONE*_M;
+
+    // correlator bank stores M x k reference samples; limit memory
+    if (_M*_k > FSKDEM_CORRELATOR_MAX)
+        c_correlator = c_fft;
+
+    if (c_goertzel < c_fft && c_goertzel < c_correlator)
+        return LIQUID_FSKDEM_GOERTZEL;
+    if (c_correlator < c_fft)
+        return LIQUID_FSKDEM_CORRELATOR;
+    return LIQUID_FSKDEM_FFT;
+}
+
+// detect tones with bank of Goertzel resonators, storing in 'v'; tones
+// are processed four at a time so that their eight independent
+// recursions (real and imaginary) stay in registers over the symbol
+void fskdem_execute_goertzel(fskdem          _q,
+                             float complex * _y)
+{
+    unsigned int i;
+    unsigned int n;
+    for (i=0; i<_q->M; i+=4) {
+        // coefficients (pad final group by repeating last tone)
+        unsigned int r = _q->M - i < 4 ? _q->M - i : 4;
+        float c0 = _q->g_coeff[i];
+        float c1 = _q->g_coeff[i + (r > 1 ? 1 : 0)];
+        float c2 = _q->g_coeff[i + (r > 2 ? 2 : 0)];
+        float c3 = _q->g_coeff[i + (r > 3 ? 3 : 0)];
+
+        // resonator states s[n-1] (a) and s[n-2] (b)
+        float a0r=0, a0i=0, a1r=0, a1i=0, a2r=0, a2i=0, a3r=0, a3i=0;
+        float b0r=0, b0i=0, b1r=0, b1i=0, b2r=0, b2i=0, b3r=0, b3i=0;
+
+        // run recursion s[n] = x[n] + 2 cos(w) s[n-1] - s[n-2]
+        for (n=0; n<_q->k; n++) {
+            float xr = crealf(_y[n]);
+            float xi = cimagf(_y[n]);
+            float t;
+            t = xr - b0r + c0*a0r; b0r = a0r; a0r = t;
+            t = xi - b0i + c0*a0i; b0i = a0i; a0i = t;
+            t = xr - b1r + c1*a1r; b1r = a1r; a1r = t;
+            t = xi - b1i + c1*a1i; b1i = a1i; a1i = t;
+            t = xr - b2r + c2*a2r; b2r = a2r; a2r = t;
+            t = xi - b2i + c2*a2i; b2i = a2i; a2i = t;
+            t = xr - b3r + c3*a3r; b3r = a3r; a3r = t;
+            t = xi - b3i + c3*a3i; b3i = a3i; a3i = t;
+        }
+
+        // save states for output computation
+        float g[16];
+        g[ 0]=a0r; g[ 1]=a0i; g[ 2]=b0r; g[ 3]=b0i;
+        g[ 4]=a1r; g[ 5]=a1i; g[ 6]=b1r; g[ 7]=b1i;
+        g[ 8]=a2r; g[ 9]=a2i; g[10]=b2r; g[11]=b2i;
+        g[12]=a3r; g[13]=a3i; g[14]=b3r; g[15]=b3i;
+
+        // X(w) = exp(-j w (k-1)) (s[k-1] - exp(-j w) s[k-2])
+        unsigned int j;
+        for (j=0; j<r; j++) {
+            float complex s1 = g[4*j+0] + _Complex_I*g[4*j+1];
+            float complex s2 = g[4*j+2] + _Complex_I*g[4*j+3];
+            _q->v[i+j] = _q->g_phase[i+j] * (s1 - _q->g_rot[i+j]*s2);
+        }
+    }
+}
+
+// compute full transform of time buffer if not already computed
+void fskdem_update_spectrum(fskdem _q)
+{
+    if (_q->spectrum_valid)
+        return;
+
+    FFT_EXECUTE(_q->fft);
+    _q->spectrum_valid = 1;
+}
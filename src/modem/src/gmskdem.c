@@ -28,6 +28,7 @@
 #include <assert.h>
 #include <math.h>
 #include <stdlib.h>
+#include <string.h>
 
 #include "liquid.internal.h"
 
@@ -55,7 +56,10 @@ struct gmskdem_s {
     firfilt_rrrf filter;    // receiver matched filter
 #endif
 
-    float complex x_prime;  // received signal state
+    float complex * x;      // received signal, previous and current
+                            // symbol [size: k+1 x 1]
+    float * phi;            // phase differences [size: k x 1]
+    float tol;              // discriminator accuracy, 0 for full precision
 
     // demodulated symbols counter
     unsigned int num_symbols_demod;
@@ -91,6 +95,7 @@ gmskdem gmskdem_create(unsigned int _k,
     q->k  = _k;
     q->m  = _m;
     q->BT = _BT;
+    q->tol = 0.0f;
 
     // allocate memory for filter taps
     q->h_len = 2*(q->k)*(q->m)+1;
@@ -99,6 +104,10 @@ gmskdem gmskdem_create(unsigned int _k,
     // compute filter coefficients
     liquid_firdes_gmskrx(q->k, q->m, q->BT, 0.0f, q->h);
 
+    // allocate memory for received signal and phase differences
+    q->x   = (float complex*) malloc((q->k+1) * sizeof(float complex));
+    q->phi = (float*)         malloc( q->k    * sizeof(float));
+
 #if GMSKDEM_USE_EQUALIZER
     // receiver matched filter/equalizer
     q->eq = eqlms_rrrf_create_rnyquist(LIQUID_FIRFILT_GMSKRX,
@@ -141,8 +150,10 @@ void gmskdem_destroy(gmskdem _q)
     firfilt_rrrf_destroy(_q->filter);
 #endif
 
-    // free filter array
+    // free filter and internal arrays
     free(_q->h);
+    free(_q->x);
+    free(_q->phi);
 
     // free main object memory
     free(_q);
@@ -151,6 +162,7 @@ void gmskdem_destroy(gmskdem _q)
 void gmskdem_print(gmskdem _q)
 {
     printf("gmskdem [k=%u, m=%u, BT=%8.3f]\n", _q->k, _q->m, _q->BT);
+    printf("    tolerance           :   %12.4e\n", _q->tol);
 #if GMSKDEM_USE_EQUALIZER
     printf("    equalizer bandwidth :   %12.8f\n", eqlms_rrrf_get_bw(_q->eq));
 #endif
@@ -162,7 +174,7 @@ void gmskdem_print(gmskdem _q)
 void gmskdem_reset(gmskdem _q)
 {
     // reset phase state
-    _q->x_prime = 0.0f;
+    _q->x[_q->k] = 0.0f;
 
     // set demod. counter to zero
     _q->num_symbols_demod = 0;
@@ -193,6 +205,19 @@ void gmskdem_set_eq_bw(gmskdem _q,
 #endif
 }
 
+// set discriminator accuracy
+//  _q      :   demodulator object
+//  _tol    :   maximum absolute phase error [radians], 0 for full precision
+void gmskdem_set_tolerance(gmskdem _q,
+                           float   _tol)
+{
+    if (_tol < 0.0f) {
+        fprintf(stderr,"error: gmskdem_set_tolerance(), tolerance must be non-negative\n");
+        exit(1);
+    }
+    _q->tol = _tol;
+}
+
 void gmskdem_demodulate(gmskdem _q,
                         float complex * _x,
                         unsigned int * _s)
@@ -200,20 +225,20 @@ void gmskdem_demodulate(gmskdem _q,
     // increment symbol counter
     _q->num_symbols_demod++;
 
+    // compute phase differences, retaining last sample of symbol
+    _q->x[0] = _q->x[_q->k];
+    memmove(&_q->x[1], _x, _q->k*sizeof(float complex));
+    liquid_vectorcf_cargdiff(_q->x, _q->k, _q->tol, _q->phi);
+
     // run matched filter
     unsigned int i;
-    float phi;
     float d_hat;
     for (i=0; i<_q->k; i++) {
-        // compute phase difference
-        phi = cargf( conjf(_q->x_prime)*_x[i] );
-        _q->x_prime = _x[i];
-
         // run through matched filter
 #if GMSKDEM_USE_EQUALIZER
-        eqlms_rrrf_push(_q->eq, phi);
+        eqlms_rrrf_push(_q->eq, _q->phi[i]);
 #else
-        firfilt_rrrf_push(_q->filter, phi);
+        firfilt_rrrf_push(_q->filter, _q->phi[i]);
 #endif
 
 #if DEBUG_GMSKDEM
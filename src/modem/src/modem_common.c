@@ -130,6 +130,10 @@ struct MODEM(_s)
     // neighbors array
     unsigned char * demod_soft_neighbors;   // array of nearest neighbors
     unsigned int demod_soft_p;              // number of neighbors in array
+
+    // fixed-point soft demodulation: constellation at half scale with
+    // components interleaved, allocated on first use
+    liquid_q15 * symbol_map_q15;            // [size: 2*M x 1]
 };
 
 // create digital modem of a specific scheme and bits/symbol
@@ -241,6 +245,9 @@ void MODEM(_destroy)(MODEM() _q)
     if (_q->demod_soft_neighbors != NULL)
         free(_q->demod_soft_neighbors);
 
+    // free fixed-point symbol map
+    free(_q->symbol_map_q15);
+
     // free memory in specific data types
     if (_q->scheme == LIQUID_MODEM_SQAM32) {
         free(_q->data.sqam32.map);
@@ -299,6 +306,7 @@ void MODEM(_init)(MODEM() _q,
     // soft demodulation
     _q->demod_soft_neighbors = NULL;
     _q->demod_soft_p = 0;
+    _q->symbol_map_q15 = NULL;
 }
 
 // initialize symbol map for fast modulation
@@ -515,6 +523,145 @@ void MODEM(_demodulate_soft_table)(MODEM() _q,
 }
 
 
+// squared distance between half-scale Q15 samples, in units of 2^-26 at
+// full scale; each squared component difference is below 2^32
+#define MODEM_DISTANCE_Q15(xr,xi,p) \
+    ( ((uint32_t)((xr)-(p)[0])*(uint32_t)((xr)-(p)[0]) >> 2) + \
+      ((uint32_t)((xi)-(p)[1])*(uint32_t)((xi)-(p)[1]) >> 2) )
+
+// demodulate fixed-point sample, providing soft bits; the hard decision
+// uses the scheme's own slicer while the per-bit distance metrics, which
+// dominate the cost, are computed in integer arithmetic
+//  _q          :   demodulator object
+//  _x          :   received sample, scaled by 1/2
+//  _s          :   hard demodulator output
+//  _soft_bits  :   soft bit ouput (approximate log-likelihood ratio)
+void MODEM(_demodulate_soft_q15)(MODEM()         _q,
+                                 liquid_cq15     _x,
+                                 unsigned int  * _s,
+                                 unsigned char * _soft_bits)
+{
+    // received sample at full scale
+    TC r = 2.0f*(liquid_q15_to_float(_x.real) + _Complex_I*liquid_q15_to_float(_x.imag));
+    int32_t xr = _x.real;
+    int32_t xi = _x.imag;
+    unsigned int bps = _q->m;
+    unsigned int k;
+    int64_t v;
+
+    switch (_q->scheme) {
+    case LIQUID_MODEM_BPSK:
+        // LLR*16 + 127 = 127 - 128*x, with x = 2*xr/32768
+        MODEM(_demodulate)(_q, r, _s);
+        v = (16256 - xr) >> 7;
+        _soft_bits[0] = v > 255 ? 255 : (v < 0 ? 0 : v);
+        return;
+    case LIQUID_MODEM_QPSK:
+        // LLR*16 + 127 = 127 - 185.6*x, with x = 2*xr/32768
+        MODEM(_demodulate)(_q, r, _s);
+        v = (((int64_t)127<<23) - (int64_t)xi*95027) >> 23;
+        _soft_bits[0] = v > 255 ? 255 : (v < 0 ? 0 : v);
+        v = (((int64_t)127<<23) - (int64_t)xr*95027) >> 23;
+        _soft_bits[1] = v > 255 ? 255 : (v < 0 ? 0 : v);
+        return;
+    default:;
+    }
+
+    // differential schemes depend on the previous symbol
+    if (liquid_modem_is_dpsk(_q->scheme)) {
+        MODEM(_demodulate_soft)(_q, r, _s, _soft_bits);
+        return;
+    }
+
+    if (_q->symbol_map_q15 == NULL)
+        MODEM(_init_map_q15)(_q);
+    liquid_q15 * map = _q->symbol_map_q15;
+    int64_t gain = (int64_t)(19.2f*_q->M*1024.0f + 0.5f);   // gamma*16, gamma = 1.2*M
+    uint32_t dmin_0[bps];
+    uint32_t dmin_1[bps];
+    uint32_t d;
+    unsigned int s = 0;
+
+    if (_q->scheme == LIQUID_MODEM_ARB) {
+        // exhaustive search over all symbols
+        for (k=0; k<bps; k++) {
+            dmin_0[k] = UINT32_MAX;
+            dmin_1[k] = UINT32_MAX;
+        }
+        uint32_t dmin = UINT32_MAX;
+        unsigned int i;
+        for (i=0; i<_q->M; i++) {
+            d = MODEM_DISTANCE_Q15(xr, xi, map + 2*i);
+            if (d < dmin) {
+                s    = i;
+                dmin = d;
+            }
+            for (k=0; k<bps; k++) {
+                if ( (i >> (bps-k-1)) & 0x01 ) {
+                    if (d < dmin_1[k]) dmin_1[k] = d;
+                } else {
+                    if (d < dmin_0[k]) dmin_0[k] = d;
+                }
+            }
+        }
+        _q->r     = r;
+        _q->x_hat = _q->symbol_map[s];
+    } else if (_q->demod_soft_neighbors != NULL && _q->demod_soft_p != 0) {
+        // hard decision, then nearest neighbors from look-up table
+        MODEM(_demodulate)(_q, r, &s);
+        for (k=0; k<bps; k++) {
+            dmin_0[k] = 8u << 26;
+            dmin_1[k] = 8u << 26;
+        }
+        unsigned char * softab = _q->demod_soft_neighbors;
+        unsigned int p = _q->demod_soft_p;
+        unsigned int i;
+        d = MODEM_DISTANCE_Q15(xr, xi, map + 2*s);
+        for (k=0; k<bps; k++) {
+            if ( (s >> (bps-k-1)) & 0x01 ) dmin_1[k] = d;
+            else                           dmin_0[k] = d;
+        }
+        for (i=0; i<p; i++) {
+            unsigned int sym = softab[s*p + i];
+            d = MODEM_DISTANCE_Q15(xr, xi, map + 2*sym);
+            for (k=0; k<bps; k++) {
+                if ( (sym >> (bps-k-1)) & 0x01 ) {
+                    if (d < dmin_1[k]) dmin_1[k] = d;
+                } else {
+                    if (d < dmin_0[k]) dmin_0[k] = d;
+                }
+            }
+        }
+    } else {
+        // demodulate normally and copy the hard-demodulated bits
+        MODEM(_demodulate)(_q, r, _s);
+        liquid_unpack_soft_bits(*_s, bps, _soft_bits);
+        return;
+    }
+
+    // make soft bit assignments: the floating-point demodulators compute
+    // (dmin_0 - dmin_1)*gamma*16 + 127, and distances here carry 26
+    // fractional bits while the gain carries 10
+    for (k=0; k<bps; k++) {
+        v = ((((int64_t)dmin_0[k] - (int64_t)dmin_1[k]) * gain) >> 36) + 127;
+        _soft_bits[k] = v > 255 ? 255 : (v < 0 ? 0 : v);
+    }
+    *_s = s;
+}
+
+// initialize half-scale Q15 symbol map for fixed-point soft demodulation
+void MODEM(_init_map_q15)(MODEM() _q)
+{
+    _q->symbol_map_q15 = (liquid_q15*) malloc(2*_q->M*sizeof(liquid_q15));
+    unsigned int i;
+    TC x;
+    for (i=0; i<_q->M; i++) {
+        MODEM(_modulate)(_q, i, &x);
+        _q->symbol_map_q15[2*i+0] = liquid_float_to_q15(0.5f*crealf(x));
+        _q->symbol_map_q15[2*i+1] = liquid_float_to_q15(0.5f*cimagf(x));
+    }
+}
+
 
 // get demodulator's estimated transmit sample
 void MODEM(_get_demodulator_sample)(MODEM() _q,
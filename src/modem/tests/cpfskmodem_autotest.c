@@ -118,3 +118,44 @@ void autotest_cpfskmodem_bps2_h0p0250_k4_m3_square()    { cpfskmodem_test_mod_de
 void autotest_cpfskmodem_bps3_h0p1250_k4_m3_square()    { cpfskmodem_test_mod_demod( 3, 0.1250f, 4, 3, 0.25f, LIQUID_CPFSK_SQUARE ); }
 void autotest_cpfskmodem_bps4_h0p0625_k4_m3_square()    { cpfskmodem_test_mod_demod( 4, 0.0625f, 4, 3, 0.25f, LIQUID_CPFSK_SQUARE ); }
 
+
+// approximate discriminator still decodes, and matches default output
+void autotest_cpfskmodem_tolerance()
+{
+    unsigned int bps  = 1;
+    float        h    = 0.5f;
+    unsigned int k    = 4;
+    unsigned int m    = 3;
+    float        beta = 0.25f;
+    float        tol  = 1e-4f;
+
+    cpfskmod mod  = cpfskmod_create(bps, h, k, m, beta, LIQUID_CPFSK_GMSK);
+    cpfskdem dem0 = cpfskdem_create(bps, h, k, m, beta, LIQUID_CPFSK_GMSK);
+    cpfskdem dem1 = cpfskdem_create(bps, h, k, m, beta, LIQUID_CPFSK_GMSK);
+    cpfskdem_set_tolerance(dem1, tol);
+
+    unsigned int delay       = cpfskmod_get_delay(mod) + cpfskdem_get_delay(dem0);
+    unsigned int num_symbols = 80 + delay;
+
+    msequence ms = msequence_create_default(7);
+
+    float complex buf[k];
+    unsigned int  sym_in[num_symbols];
+    unsigned int  i;
+    for (i=0; i<num_symbols; i++) {
+        sym_in[i] = msequence_generate_symbol(ms, bps);
+        cpfskmod_modulate(mod, sym_in[i], buf);
+        unsigned int s0 = cpfskdem_demodulate(dem0, buf);
+        unsigned int s1 = cpfskdem_demodulate(dem1, buf);
+
+        CONTEND_EQUALITY(s0, s1);
+        if (i >= delay)
+            CONTEND_EQUALITY(sym_in[i-delay], s1);
+    }
+
+    msequence_destroy(ms);
+    cpfskmod_destroy(mod);
+    cpfskdem_destroy(dem0);
+    cpfskdem_destroy(dem1);
+}
+
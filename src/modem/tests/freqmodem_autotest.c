@@ -20,6 +20,7 @@
  * THE SOFTWARE.
  */
 
+#include <stdlib.h>
 #include "autotest/autotest.h"
 #include "liquid.h"
 
@@ -69,3 +70,100 @@ void autotest_freqmodem_kf_0_02() { freqmodem_test(0.02f); }
 void autotest_freqmodem_kf_0_04() { freqmodem_test(0.04f); }
 void autotest_freqmodem_kf_0_08() { freqmodem_test(0.08f); }
 
+
+// Help function to keep code base small; compare discriminator with
+// given accuracy against full-precision result, and block against
+// sample-by-sample demodulation
+//  _tol    :   discriminator tolerance [radians]
+void freqdem_tolerance_test(float _tol)
+{
+    // options
+    float        kf          = 0.1f;
+    unsigned int num_samples = 1031;    // not a multiple of SIMD width
+    float        ref         = 1.0f / (2*M_PI*kf);
+
+    // create demodulators
+    freqdem dem0 = freqdem_create(kf);  // full precision
+    freqdem dem1 = freqdem_create(kf);  // approximate, block
+    freqdem dem2 = freqdem_create(kf);  // approximate, per sample
+    freqdem_set_tolerance(dem0, 0.0f);
+    freqdem_set_tolerance(dem1, _tol);
+    freqdem_set_tolerance(dem2, _tol);
+
+    // random input covering all quadrants, including points on axes
+    unsigned int i;
+    float complex * r  = (float complex*) malloc(num_samples*sizeof(float complex));
+    float         * y0 = (float        *) malloc(num_samples*sizeof(float));
+    float         * y1 = (float        *) malloc(num_samples*sizeof(float));
+    float         * y2 = (float        *) malloc(num_samples*sizeof(float));
+    for (i=0; i<num_samples; i++)
+        r[i] = (i % 37) == 5 ? 0.0f : randnf() + _Complex_I*randnf();
+    r[11] = 1.0f;
+    r[12] = _Complex_I;
+    r[13] = -1.0f;
+    r[14] = -_Complex_I;
+
+    // demodulate, splitting block call
+    freqdem_demodulate_block(dem0, r, num_samples, y0);
+    freqdem_demodulate_block(dem1, r,      7,             y1);
+    freqdem_demodulate_block(dem1, r + 7,  num_samples-7, y1 + 7);
+    for (i=0; i<num_samples; i++)
+        freqdem_demodulate(dem2, r[i], &y2[i]);
+
+    // compare, skipping phase of zero (including initial state) and
+    // allowing wrap-around at +/- pi
+    for (i=0; i<num_samples; i++) {
+        CONTEND_DELTA( y1[i], y2[i], 1e-6f );
+        if (i == 0 || r[i] == 0.0f || r[i-1] == 0.0f)
+            continue;
+        float e = (y1[i] - y0[i]) / ref;
+        if (e >  M_PI) e -= 2*M_PI;
+        if (e < -M_PI) e += 2*M_PI;
+        CONTEND_LESS_THAN( fabsf(e), _tol + 1e-6f );
+    }
+
+    // clean up
+    freqdem_destroy(dem0);
+    freqdem_destroy(dem1);
+    freqdem_destroy(dem2);
+    free(r);
+    free(y0);
+    free(y1);
+    free(y2);
+}
+
+void autotest_freqdem_tolerance_5e_3() { freqdem_tolerance_test(5e-3f); }
+void autotest_freqdem_tolerance_1e_4() { freqdem_tolerance_test(1e-4f); }
+void autotest_freqdem_tolerance_2e_6() { freqdem_tolerance_test(2e-6f); }
+
+// default demodulator is full precision: per-sample output matches
+// arg{ conj(r[i-1]) r[i] } exactly, and block output matches per-sample
+void autotest_freqdem_default_exact()
+{
+    float        kf          = 0.1f;
+    unsigned int num_samples = 263;
+    float        ref         = 1.0f / (2*M_PI*kf);
+
+    freqdem dem0 = freqdem_create(kf);  // per sample
+    freqdem dem1 = freqdem_create(kf);  // block
+
+    unsigned int i;
+    float complex r[num_samples];
+    float         y0[num_samples];
+    float         y1[num_samples];
+    for (i=0; i<num_samples; i++)
+        r[i] = randnf() + _Complex_I*randnf();
+
+    for (i=0; i<num_samples; i++)
+        freqdem_demodulate(dem0, r[i], &y0[i]);
+    freqdem_demodulate_block(dem1, r, num_samples, y1);
+
+    for (i=0; i<num_samples; i++) {
+        float complex r_prime = i == 0 ? 0.0f : r[i-1];
+        CONTEND_EQUALITY( y0[i], cargf(conjf(r_prime)*r[i]) * ref );
+        CONTEND_EQUALITY( y1[i], y0[i] );
+    }
+
+    freqdem_destroy(dem0);
+    freqdem_destroy(dem1);
+}
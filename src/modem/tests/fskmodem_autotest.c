@@ -20,8 +20,9 @@
  * THE SOFTWARE.
  */
 
+#include <stdlib.h>
 #include "autotest/autotest.h"
-#include "liquid.h"
+#include "liquid.internal.h"
 
 // Help function to keep code base small
 void fskmodem_test_mod_demod(unsigned int _m,
@@ -83,3 +84,61 @@ void autotest_fskmodem_misc_M256()  { fskmodem_test_mod_demod( 8,  500, 0.372145
 void autotest_fskmodem_misc_M512()  { fskmodem_test_mod_demod( 9, 1000, 0.3721451); }
 void autotest_fskmodem_misc_M1024() { fskmodem_test_mod_demod(10, 2000, 0.3721451); }
 
+
+// Help function to compare tone detection method against full transform
+void fskdem_test_method(unsigned int _m,
+                        unsigned int _k,
+                        float        _bandwidth,
+                        int          _method)
+{
+    if (liquid_autotest_verbose)
+        printf("fskdem_test_method(m=%u, k=%u, bandwidth=%g, method=%d)\n", _m, _k, _bandwidth, _method);
+
+    // create modulator and demodulator pair using each method
+    fskmod mod  = fskmod_create(_m,_k,_bandwidth);
+    fskdem dem0 = fskdem_create(_m,_k,_bandwidth);
+    fskdem dem1 = fskdem_create(_m,_k,_bandwidth);
+    fskdem_set_method(dem0, LIQUID_FSKDEM_FFT);
+    fskdem_set_method(dem1, _method);
+    CONTEND_EQUALITY(fskdem_get_method(dem1), _method);
+
+    unsigned int M = 1 << _m;   // constellation size
+    float complex buf[_k];      // transmit buffer
+    unsigned int i, n, s;
+    for (i=0; i<2*M; i++) {
+        // modulate symbol and add noise
+        fskmod_modulate(mod, rand() % M, buf);
+        for (n=0; n<_k; n++)
+            buf[n] += 0.3f*(randnf() + _Complex_I*randnf());
+
+        // demodulate with each method; outputs should match
+        unsigned int sym0 = fskdem_demodulate(dem0, buf);
+        unsigned int sym1 = fskdem_demodulate(dem1, buf);
+        CONTEND_EQUALITY(sym0, sym1);
+
+        // tone energies should match with and without neighboring bins
+        for (s=0; s<M; s++) {
+            float e0 = fskdem_get_symbol_energy(dem0, s, 0);
+            float e1 = fskdem_get_symbol_energy(dem1, s, 0);
+            CONTEND_DELTA(e1, e0, 1e-3f*_k*_k + 1e-3f*e0);
+        }
+        float e0 = fskdem_get_symbol_energy(dem0, sym0, 2);
+        float e1 = fskdem_get_symbol_energy(dem1, sym0, 2);
+        CONTEND_DELTA(e1, e0, 1e-3f*e0);
+    }
+
+    // clean it up
+    fskmod_destroy(mod);
+    fskdem_destroy(dem0);
+    fskdem_destroy(dem1);
+}
+
+// AUTOTESTS: Goertzel and correlator tone detection match FFT
+void autotest_fskdem_goertzel_M2()      { fskdem_test_method( 1,    4, 0.25f,     LIQUID_FSKDEM_GOERTZEL);   }
+void autotest_fskdem_goertzel_M8()      { fskdem_test_method( 3,   20, 0.3721451, LIQUID_FSKDEM_GOERTZEL);   }
+void autotest_fskdem_goertzel_M32()     { fskdem_test_method( 5,   64, 0.25f,     LIQUID_FSKDEM_GOERTZEL);   }
+void autotest_fskdem_goertzel_k2000()   { fskdem_test_method( 1, 2000, 0.3721451, LIQUID_FSKDEM_GOERTZEL);   }
+void autotest_fskdem_correlator_M2()    { fskdem_test_method( 1,    4, 0.25f,     LIQUID_FSKDEM_CORRELATOR); }
+void autotest_fskdem_correlator_M8()    { fskdem_test_method( 3,   20, 0.3721451, LIQUID_FSKDEM_CORRELATOR); }
+void autotest_fskdem_correlator_M32()   { fskdem_test_method( 5,   64, 0.25f,     LIQUID_FSKDEM_CORRELATOR); }
+void autotest_fskdem_correlator_k2000() { fskdem_test_method( 1, 2000, 0.3721451, LIQUID_FSKDEM_CORRELATOR); }
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2007 - 2018 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// Help function to keep code base small; demodulates the same signal with
+// the default (full-precision) discriminator and with an approximate one
+void gmskmodem_test_mod_demod(unsigned int _k,
+                              unsigned int _m,
+                              float        _BT,
+                              float        _tol)
+{
+    // create modulator and demodulator pair
+    gmskmod mod  = gmskmod_create(_k, _m, _BT);
+    gmskdem dem0 = gmskdem_create(_k, _m, _BT);
+    gmskdem dem1 = gmskdem_create(_k, _m, _BT);
+    gmskdem_set_tolerance(dem1, _tol);
+
+    // derived values
+    unsigned int delay       = 2*_m;
+    unsigned int num_symbols = 80 + delay;
+
+    msequence ms = msequence_create_default(7);
+
+    float complex buf[_k];              // sample buffer
+    unsigned int  sym_in  [num_symbols];
+    unsigned int  sym_out0[num_symbols];
+    unsigned int  sym_out1[num_symbols];
+
+    // modulate, demodulate
+    unsigned int i;
+    for (i=0; i<num_symbols; i++) {
+        sym_in[i] = msequence_generate_symbol(ms, 1);
+        gmskmod_modulate(mod, sym_in[i], buf);
+        gmskdem_demodulate(dem0, buf, &sym_out0[i]);
+        gmskdem_demodulate(dem1, buf, &sym_out1[i]);
+    }
+
+    // count errors
+    for (i=delay; i<num_symbols; i++) {
+        if (liquid_autotest_verbose) {
+            printf("  %3u : input = %2u, output = %2u, %2u\n",
+                    i, sym_in[i-delay], sym_out0[i], sym_out1[i]);
+        }
+        CONTEND_EQUALITY(sym_in[i-delay], sym_out0[i]);
+        CONTEND_EQUALITY(sym_in[i-delay], sym_out1[i]);
+    }
+
+    // clean it up
+    msequence_destroy(ms);
+    gmskmod_destroy(mod);
+    gmskdem_destroy(dem0);
+    gmskdem_destroy(dem1);
+}
+
+void autotest_gmskmodem_k2_m3_BT0p30()  { gmskmodem_test_mod_demod(2, 3, 0.30f, 1e-4f); }
+void autotest_gmskmodem_k4_m3_BT0p30()  { gmskmodem_test_mod_demod(4, 3, 0.30f, 1e-4f); }
+void autotest_gmskmodem_k4_m5_BT0p50()  { gmskmodem_test_mod_demod(4, 5, 0.50f, 1e-2f); }
+
@@ -128,3 +128,67 @@ void autotest_demodsoft_arb128opt() { modem_test_demodsoft(LIQUID_MODEM_ARB128OP
 void autotest_demodsoft_arb256opt() { modem_test_demodsoft(LIQUID_MODEM_ARB256OPT); }
 void autotest_demodsoft_arb64vt()   { modem_test_demodsoft(LIQUID_MODEM_ARB64VT);   }
 
+
+// Help function: fixed-point soft demodulation should recover each
+// constellation point and, when _compare is set, agree with the
+// floating-point version on the hard decision and to within a couple of
+// levels on each soft bit
+void modem_test_demodsoft_q15(modulation_scheme _ms,
+                              int               _compare)
+{
+    modem mod     = modem_create(_ms);
+    modem demod_0 = modem_create(_ms);
+    modem demod_1 = modem_create(_ms);
+    unsigned int bps = modem_get_bps(demod_0);
+
+    unsigned int i, k, s0, s1, sym_soft;
+    unsigned char soft_0[bps];
+    unsigned char soft_1[bps];
+    float complex x;
+
+    // noise-free constellation points at half scale
+    for (i=0; i<(1U<<bps); i++) {
+        modem_modulate(mod, i, &x);
+        liquid_cq15 xq = { liquid_float_to_q15(0.5f*crealf(x)),
+                           liquid_float_to_q15(0.5f*cimagf(x)) };
+        modem_demodulate_soft_q15(demod_1, xq, &s1, soft_1);
+        CONTEND_EQUALITY(s1, i);
+        liquid_pack_soft_bits(soft_1, bps, &sym_soft);
+        CONTEND_EQUALITY(sym_soft, i);
+    }
+
+    // differential schemes carry state between symbols
+    modem_reset(demod_1);
+
+    for (i=0; _compare && i<2000; i++) {
+        // random half-scale sample within Q15 range
+        liquid_cq15 xq = { liquid_float_to_q15(0.7f*(2.0f*randf()-1.0f)),
+                           liquid_float_to_q15(0.7f*(2.0f*randf()-1.0f)) };
+        x = 2.0f*(liquid_q15_to_float(xq.real) +
+                  liquid_q15_to_float(xq.imag)*_Complex_I);
+
+        modem_demodulate_soft    (demod_0, x,  &s0, soft_0);
+        modem_demodulate_soft_q15(demod_1, xq, &s1, soft_1);
+
+        CONTEND_EQUALITY(s0, s1);
+        for (k=0; k<bps; k++)
+            CONTEND_DELTA((int)soft_0[k], (int)soft_1[k], 2);
+    }
+    modem_destroy(mod);
+    modem_destroy(demod_0);
+    modem_destroy(demod_1);
+}
+
+// AUTOTESTS: fixed-point soft demodulation (the floating-point arbitrary
+// demodulator assigns soft bits by the running hard decision, so only
+// hard decisions are checked for those)
+void autotest_demodsoft_q15_bpsk()     { modem_test_demodsoft_q15(LIQUID_MODEM_BPSK,     1); }
+void autotest_demodsoft_q15_qpsk()     { modem_test_demodsoft_q15(LIQUID_MODEM_QPSK,     1); }
+void autotest_demodsoft_q15_psk8()     { modem_test_demodsoft_q15(LIQUID_MODEM_PSK8,     1); }
+void autotest_demodsoft_q15_dpsk4()    { modem_test_demodsoft_q15(LIQUID_MODEM_DPSK4,    1); }
+void autotest_demodsoft_q15_qam16()    { modem_test_demodsoft_q15(LIQUID_MODEM_QAM16,    1); }
+void autotest_demodsoft_q15_qam64()    { modem_test_demodsoft_q15(LIQUID_MODEM_QAM64,    1); }
+void autotest_demodsoft_q15_qam256()   { modem_test_demodsoft_q15(LIQUID_MODEM_QAM256,   1); }
+void autotest_demodsoft_q15_apsk32()   { modem_test_demodsoft_q15(LIQUID_MODEM_APSK32,   1); }
+void autotest_demodsoft_q15_ook()      { modem_test_demodsoft_q15(LIQUID_MODEM_OOK,      1); }
+void autotest_demodsoft_q15_arb64opt() { modem_test_demodsoft_q15(LIQUID_MODEM_ARB64OPT, 0); }
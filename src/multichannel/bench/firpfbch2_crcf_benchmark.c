@@ -27,7 +27,13 @@
 (   struct rusage *_start,                                  \
     struct rusage *_finish,                                 \
     unsigned long int *_num_iterations)                     \
-{ firpfbch2_crcf_execute_bench(_start, _finish, _num_iterations, NUM_CHANNELS, M, TYPE); }
+{ firpfbch2_crcf_execute_bench(_start, _finish, _num_iterations, NUM_CHANNELS, M, TYPE, LIQUID_STORAGE_FLOAT32); }
+
+#define FIRPFBCH2_STORAGE_BENCH_API(NUM_CHANNELS,M,TYPE,S)  \
+(   struct rusage *_start,                                  \
+    struct rusage *_finish,                                 \
+    unsigned long int *_num_iterations)                     \
+{ firpfbch2_crcf_execute_bench(_start, _finish, _num_iterations, NUM_CHANNELS, M, TYPE, S); }
 
 // Helper function to keep code base small
 void firpfbch2_crcf_execute_bench(struct rusage *     _start,
@@ -35,11 +41,13 @@ void firpfbch2_crcf_execute_bench(struct rusage *     _start,
                                   unsigned long int * _num_iterations,
                                   unsigned int        _num_channels,
                                   unsigned int        _m,
-                                  int                 _type)
+                                  int                 _type,
+                                  liquid_storage_type _storage)
 {
     // initialize channelizer
     float As         = 60.0f;
     firpfbch2_crcf q = firpfbch2_crcf_create_kaiser(_type,_num_channels,_m,As);
+    firpfbch2_crcf_set_storage(q, _storage);
 
     unsigned long int i;
 
@@ -82,4 +90,8 @@ void benchmark_firpfbch2_crcf_s256  FIRPFBCH2_EXECUTE_BENCH_API(256,  2,  LIQUID
 void benchmark_firpfbch2_crcf_s512  FIRPFBCH2_EXECUTE_BENCH_API(512,  2,  LIQUID_SYNTHESIZER)
 void benchmark_firpfbch2_crcf_s1024 FIRPFBCH2_EXECUTE_BENCH_API(1024, 2,  LIQUID_SYNTHESIZER)
 
-
+// long filters, single vs. half-precision window storage
+void benchmark_firpfbch2_crcf_a1024_m12     FIRPFBCH2_STORAGE_BENCH_API(1024, 12, LIQUID_ANALYZER,    LIQUID_STORAGE_FLOAT32)
+void benchmark_firpfbch2_crcf_a1024_m12_f16 FIRPFBCH2_STORAGE_BENCH_API(1024, 12, LIQUID_ANALYZER,    LIQUID_STORAGE_FLOAT16)
+void benchmark_firpfbch2_crcf_s1024_m12     FIRPFBCH2_STORAGE_BENCH_API(1024, 12, LIQUID_SYNTHESIZER, LIQUID_STORAGE_FLOAT32)
+void benchmark_firpfbch2_crcf_s1024_m12_f16 FIRPFBCH2_STORAGE_BENCH_API(1024, 12, LIQUID_SYNTHESIZER, LIQUID_STORAGE_FLOAT16)
@@ -55,8 +55,49 @@ struct FIRPFBCH2(_s) {
     WINDOW() * w0;      // window buffer object array
     WINDOW() * w1;      // window buffer object array (synthesizer only)
     int flag;           // flag indicating filter/buffer alignment
+
+    // reduced-precision window storage, replacing window objects
+    liquid_storage_type storage;    // window storage format
+    unsigned int    w_len;          // window length: 2*m
+    unsigned int    sample_size;    // bytes per packed sample
+    unsigned char * b0;             // packed window buffers [M x w_len]
+    unsigned char * b1;             // packed window buffers (synthesizer only)
+    unsigned int *  i0;             // write (oldest sample) index per window
+    unsigned int *  i1;             // write index per window (synthesizer only)
+    unsigned char * v;              // packed input samples [M x 1]
+    TI *            r;              // unpacked window pair [2*w_len x 1]
 };
 
+// allocate window buffers according to storage format
+void FIRPFBCH2(_alloc_buffers)(FIRPFBCH2() _q);
+
+// free window buffers
+void FIRPFBCH2(_free_buffers)(FIRPFBCH2() _q);
+
+// push packed sample into window (reduced-precision storage)
+//  _q      :   filterbank object
+//  _b      :   packed window buffers
+//  _index  :   write index array
+//  _k      :   window index
+//  _v      :   packed sample
+void FIRPFBCH2(_push_packed)(FIRPFBCH2()     _q,
+                             unsigned char * _b,
+                             unsigned int *  _index,
+                             unsigned int    _k,
+                             unsigned char * _v);
+
+// read window contents, oldest sample first (reduced-precision storage)
+//  _q      :   filterbank object
+//  _b      :   packed window buffers
+//  _index  :   write index array
+//  _k      :   window index
+//  _r      :   unpacked window [size: w_len x 1]
+void FIRPFBCH2(_read_packed)(FIRPFBCH2()     _q,
+                             unsigned char * _b,
+                             unsigned int *  _index,
+                             unsigned int    _k,
+                             TI *            _r);
+
 // create firpfbch2 object
 //  _type   :   channelizer type (e.g. LIQUID_ANALYZER)
 //  _M      :   number of channels (must be even)
@@ -81,7 +122,7 @@ FIRPFBCH2() FIRPFBCH2(_create)(int          _type,
     }
 
     // create object
-    FIRPFBCH2() q = (FIRPFBCH2()) malloc(sizeof(struct FIRPFBCH2(_s)));
+    FIRPFBCH2() q = (FIRPFBCH2()) liquid_malloc(sizeof(struct FIRPFBCH2(_s)), "firpfbch2_" EXTENSION_FULL);
 
     // set input parameters
     q->type     = _type;        // channelizer type (e.g. LIQUID_ANALYZER)
@@ -93,7 +134,7 @@ FIRPFBCH2() FIRPFBCH2(_create)(int          _type,
     q->M2       = q->M / 2;     // number of channels / 2
 
     // generate bank of sub-samped filters
-    q->dp = (DOTPROD()*) malloc((q->M)*sizeof(DOTPROD()));
+    q->dp = (DOTPROD()*) liquid_malloc((q->M)*sizeof(DOTPROD()), "firpfbch2_" EXTENSION_FULL);
     unsigned int i;
     unsigned int n;
     unsigned int h_sub_len = 2 * q->m;
@@ -110,17 +151,14 @@ FIRPFBCH2() FIRPFBCH2(_create)(int          _type,
 
     // create FFT plan (inverse transform)
     // TODO : use fftw_malloc if HAVE_FFTW3_H
-    q->X = (T*) malloc((q->M)*sizeof(T));   // IFFT input
-    q->x = (T*) malloc((q->M)*sizeof(T));   // IFFT output
+    q->X = (T*) liquid_malloc((q->M)*sizeof(T), "firpfbch2_" EXTENSION_FULL); // IFFT input
+    q->x = (T*) liquid_malloc((q->M)*sizeof(T), "firpfbch2_" EXTENSION_FULL); // IFFT output
     q->ifft = FFT_CREATE_PLAN(q->M, q->X, q->x, FFT_DIR_BACKWARD, FFT_METHOD);
 
     // create buffer objects
-    q->w0 = (WINDOW()*) malloc((q->M)*sizeof(WINDOW()));
-    q->w1 = (WINDOW()*) malloc((q->M)*sizeof(WINDOW()));
-    for (i=0; i<q->M; i++) {
-        q->w0[i] = WINDOW(_create)(h_sub_len);
-        q->w1[i] = WINDOW(_create)(h_sub_len);
-    }
+    q->storage = LIQUID_STORAGE_FLOAT32;
+    q->w_len   = h_sub_len;
+    FIRPFBCH2(_alloc_buffers)(q);
 
     // reset filterbank object and return
     FIRPFBCH2(_reset)(q);
@@ -151,7 +189,7 @@ FIRPFBCH2() FIRPFBCH2(_create_kaiser)(int          _type,
 
     // design prototype filter
     unsigned int h_len = 2*_M*_m+1;
-    float * hf = (float*)malloc(h_len*sizeof(float));
+    float * hf = (float*)liquid_malloc(h_len*sizeof(float), "firpfbch2_" EXTENSION_FULL);
 
     // filter cut-off frequency (analyzer has twice the
     // bandwidth of the synthesizer)
@@ -167,7 +205,7 @@ FIRPFBCH2() FIRPFBCH2(_create_kaiser)(int          _type,
     for (i=0; i<h_len; i++) hf[i] = hf[i] * (float)_M / hf_sum;
 
     // convert to type-specific array
-    TC * h = (TC*) malloc(h_len * sizeof(TC));
+    TC * h = (TC*) liquid_malloc(h_len * sizeof(TC), "firpfbch2_" EXTENSION_FULL);
     for (i=0; i<h_len; i++)
         h[i] = (TC) hf[i];
 
@@ -175,8 +213,8 @@ FIRPFBCH2() FIRPFBCH2(_create_kaiser)(int          _type,
     FIRPFBCH2() q = FIRPFBCH2(_create)(_type, _M, _m, h);
 
     // free prototype filter coefficients
-    free(hf);
-    free(h);
+    liquid_free(hf, "firpfbch2_" EXTENSION_FULL);
+    liquid_free(h,  "firpfbch2_" EXTENSION_FULL);
 
     // return object
     return q;
@@ -190,23 +228,18 @@ void FIRPFBCH2(_destroy)(FIRPFBCH2() _q)
     // free dotprod objects
     for (i=0; i<_q->M; i++)
         DOTPROD(_destroy)(_q->dp[i]);
-    free(_q->dp);
+    liquid_free(_q->dp, "firpfbch2_" EXTENSION_FULL);
 
     // free transform object and arrays
     FFT_DESTROY_PLAN(_q->ifft);
-    free(_q->X);
-    free(_q->x);
+    liquid_free(_q->X, "firpfbch2_" EXTENSION_FULL);
+    liquid_free(_q->x, "firpfbch2_" EXTENSION_FULL);
     
     // free window objects (buffers)
-    for (i=0; i<_q->M; i++) {
-        WINDOW(_destroy)(_q->w0[i]);
-        WINDOW(_destroy)(_q->w1[i]);
-    }
-    free(_q->w0);
-    free(_q->w1);
+    FIRPFBCH2(_free_buffers)(_q);
 
     // free main object memory
-    free(_q);
+    liquid_free(_q, "firpfbch2_" EXTENSION_FULL);
 }
 
 // reset firpfbch2 object internals
@@ -215,15 +248,48 @@ void FIRPFBCH2(_reset)(FIRPFBCH2() _q)
     unsigned int i;
 
     // clear window buffers
-    for (i=0; i<_q->M; i++) {
-        WINDOW(_reset)(_q->w0[i]);
-        WINDOW(_reset)(_q->w1[i]);
+    if (_q->storage == LIQUID_STORAGE_FLOAT32) {
+        for (i=0; i<_q->M; i++) {
+            WINDOW(_reset)(_q->w0[i]);
+            WINDOW(_reset)(_q->w1[i]);
+        }
+    } else {
+        // all-zero bits represent zero in each storage format
+        memset(_q->b0, 0x00, _q->M*_q->w_len*_q->sample_size);
+        memset(_q->b1, 0x00, _q->M*_q->w_len*_q->sample_size);
+        memset(_q->i0, 0x00, _q->M*sizeof(unsigned int));
+        memset(_q->i1, 0x00, _q->M*sizeof(unsigned int));
     }
 
     // reset filter/buffer alignment flag
     _q->flag = 0;
 }
 
+// set storage format of window buffers, e.g. LIQUID_STORAGE_FLOAT16,
+// resetting the object
+//  _q          :   filterbank object
+//  _storage    :   storage format
+int FIRPFBCH2(_set_storage)(FIRPFBCH2()         _q,
+                            liquid_storage_type _storage)
+{
+    // validate input
+    if (_storage != LIQUID_STORAGE_FLOAT32 &&
+        _storage != LIQUID_STORAGE_FLOAT16 &&
+        _storage != LIQUID_STORAGE_BFLOAT16)
+    {
+        fprintf(stderr,"error: firpfbch2_%s_set_storage(), invalid storage type %d\n", EXTENSION_FULL, _storage);
+        return -1;
+    }
+
+    // re-allocate buffers in new format
+    FIRPFBCH2(_free_buffers)(_q);
+    _q->storage = _storage;
+    FIRPFBCH2(_alloc_buffers)(_q);
+
+    FIRPFBCH2(_reset)(_q);
+    return 0;
+}
+
 // print firpfbch2 object internals
 void FIRPFBCH2(_print)(FIRPFBCH2() _q)
 {
@@ -238,6 +304,32 @@ void FIRPFBCH2(_print)(FIRPFBCH2() _q)
         DOTPROD(_print)(_q->dp[i]);
 }
 
+// get number of bytes allocated by object for its window buffers and
+// IFFT arrays (dot products and FFT plan are not included)
+unsigned long int FIRPFBCH2(_get_memory_usage)(FIRPFBCH2() _q)
+{
+    // object, dot product array, IFFT input/output
+    unsigned long int n = sizeof(struct FIRPFBCH2(_s)) +
+                          _q->M*sizeof(DOTPROD()) +
+                          2*_q->M*sizeof(TO);
+
+    // window buffers
+    unsigned int i;
+    if (_q->storage == LIQUID_STORAGE_FLOAT32) {
+        n += 2*_q->M*sizeof(WINDOW());
+        for (i=0; i<_q->M; i++) {
+            n += WINDOW(_get_memory_usage)(_q->w0[i]);
+            n += WINDOW(_get_memory_usage)(_q->w1[i]);
+        }
+    } else {
+        n += 2*_q->M*_q->w_len*_q->sample_size +   // packed windows
+             2*_q->M*sizeof(unsigned int) +         // window indices
+             _q->M*_q->sample_size +                // packed input
+             2*_q->w_len*sizeof(TI);                // unpacked window pair
+    }
+    return n;
+}
+
 // execute filterbank channelizer (analyzer)
 //  _x      :   channelizer input,  [size: M/2 x 1]
 //  _y      :   channelizer output, [size: M   x 1]
@@ -251,9 +343,16 @@ void FIRPFBCH2(_execute_analyzer)(FIRPFBCH2() _q,
     // in the middle of the filter bank and moving in the
     // negative direction
     unsigned int base_index = _q->flag ? _q->M : _q->M2;
-    for (i=0; i<_q->M2; i++) {
-        // push sample into buffer at filter index
-        WINDOW(_push)(_q->w0[base_index-i-1], _x[i]);
+    if (_q->storage == LIQUID_STORAGE_FLOAT32) {
+        for (i=0; i<_q->M2; i++) {
+            // push sample into buffer at filter index
+            WINDOW(_push)(_q->w0[base_index-i-1], _x[i]);
+        }
+    } else {
+        // convert block of input samples at once, then distribute
+        liquid_storage_pack(_q->storage, (float*)_x, _q->M2*sizeof(TI)/sizeof(float), _q->v);
+        for (i=0; i<_q->M2; i++)
+            FIRPFBCH2(_push_packed)(_q, _q->b0, _q->i0, base_index-i-1, _q->v + i*_q->sample_size);
     }
 
     // execute filter outputs
@@ -264,7 +363,12 @@ void FIRPFBCH2(_execute_analyzer)(FIRPFBCH2() _q,
         unsigned int buffer_index  = (offset+i)%(_q->M);
 
         // read buffer at index
-        WINDOW(_read)(_q->w0[buffer_index], &r);
+        if (_q->storage == LIQUID_STORAGE_FLOAT32) {
+            WINDOW(_read)(_q->w0[buffer_index], &r);
+        } else {
+            r = _q->r;
+            FIRPFBCH2(_read_packed)(_q, _q->b0, _q->i0, buffer_index, r);
+        }
 
         // run dot product storing result in IFFT input buffer
         DOTPROD(_execute)(_q->dp[i], r, &_q->X[buffer_index]);
@@ -305,9 +409,17 @@ void FIRPFBCH2(_execute_synthesizer)(FIRPFBCH2() _q,
         _q->x[i] *= (float)(_q->M2);
 
     // push samples into appropriate buffer
-    WINDOW() * buffer = (_q->flag == 0 ? _q->w1 : _q->w0);
-    for (i=0; i<_q->M; i++)
-        WINDOW(_push)(buffer[i], _q->x[i]);
+    if (_q->storage == LIQUID_STORAGE_FLOAT32) {
+        WINDOW() * buffer = (_q->flag == 0 ? _q->w1 : _q->w0);
+        for (i=0; i<_q->M; i++)
+            WINDOW(_push)(buffer[i], _q->x[i]);
+    } else {
+        liquid_storage_pack(_q->storage, (float*)_q->x, _q->M*sizeof(TO)/sizeof(float), _q->v);
+        unsigned char * b     = _q->flag == 0 ? _q->b1 : _q->b0;
+        unsigned int *  index = _q->flag == 0 ? _q->i1 : _q->i0;
+        for (i=0; i<_q->M; i++)
+            FIRPFBCH2(_push_packed)(_q, b, index, i, _q->v + i*_q->sample_size);
+    }
 
     // compute filter outputs
     TO * r0, * r1;  // buffer read pointers
@@ -317,8 +429,15 @@ void FIRPFBCH2(_execute_synthesizer)(FIRPFBCH2() _q,
         unsigned int b = (_q->flag == 0) ? i : i+_q->M2;
 
         // read buffer with index offset
-        WINDOW(_read)(_q->w0[b], &r0);
-        WINDOW(_read)(_q->w1[b], &r1);
+        if (_q->storage == LIQUID_STORAGE_FLOAT32) {
+            WINDOW(_read)(_q->w0[b], &r0);
+            WINDOW(_read)(_q->w1[b], &r1);
+        } else {
+            r0 = _q->r;
+            r1 = _q->r + _q->w_len;
+            FIRPFBCH2(_read_packed)(_q, _q->b0, _q->i0, b, r0);
+            FIRPFBCH2(_read_packed)(_q, _q->b1, _q->i1, b, r1);
+        }
 
         // swap buffer outputs on alternating runs
         TO * p0 = _q->flag ? r0 : r1;
@@ -356,3 +475,93 @@ void FIRPFBCH2(_execute)(FIRPFBCH2() _q,
     }
 }
 
+
+// allocate window buffers according to storage format
+void FIRPFBCH2(_alloc_buffers)(FIRPFBCH2() _q)
+{
+    unsigned int i;
+    if (_q->storage == LIQUID_STORAGE_FLOAT32) {
+        _q->w0 = (WINDOW()*) liquid_malloc((_q->M)*sizeof(WINDOW()), "firpfbch2_" EXTENSION_FULL);
+        _q->w1 = (WINDOW()*) liquid_malloc((_q->M)*sizeof(WINDOW()), "firpfbch2_" EXTENSION_FULL);
+        for (i=0; i<_q->M; i++) {
+            _q->w0[i] = WINDOW(_create)(_q->w_len);
+            _q->w1[i] = WINDOW(_create)(_q->w_len);
+        }
+        _q->b0 = NULL;
+        _q->b1 = NULL;
+        _q->i0 = NULL;
+        _q->i1 = NULL;
+        _q->v  = NULL;
+        _q->r  = NULL;
+    } else {
+        // linear buffer of exactly w_len packed samples per window
+        _q->sample_size = liquid_storage_size(_q->storage) * sizeof(TI) / sizeof(float);
+        _q->b0 = (unsigned char*) liquid_malloc(_q->M*_q->w_len*_q->sample_size, "firpfbch2_" EXTENSION_FULL);
+        _q->b1 = (unsigned char*) liquid_malloc(_q->M*_q->w_len*_q->sample_size, "firpfbch2_" EXTENSION_FULL);
+        _q->i0 = (unsigned int*)  liquid_malloc(_q->M*sizeof(unsigned int), "firpfbch2_" EXTENSION_FULL);
+        _q->i1 = (unsigned int*)  liquid_malloc(_q->M*sizeof(unsigned int), "firpfbch2_" EXTENSION_FULL);
+        _q->v  = (unsigned char*) liquid_malloc(_q->M*_q->sample_size, "firpfbch2_" EXTENSION_FULL);
+        _q->r  = (TI*)            liquid_malloc(2*_q->w_len*sizeof(TI), "firpfbch2_" EXTENSION_FULL);
+        _q->w0 = NULL;
+        _q->w1 = NULL;
+    }
+}
+
+// free window buffers
+void FIRPFBCH2(_free_buffers)(FIRPFBCH2() _q)
+{
+    unsigned int i;
+    if (_q->storage == LIQUID_STORAGE_FLOAT32) {
+        for (i=0; i<_q->M; i++) {
+            WINDOW(_destroy)(_q->w0[i]);
+            WINDOW(_destroy)(_q->w1[i]);
+        }
+        liquid_free(_q->w0, "firpfbch2_" EXTENSION_FULL);
+        liquid_free(_q->w1, "firpfbch2_" EXTENSION_FULL);
+    } else {
+        liquid_free(_q->b0, "firpfbch2_" EXTENSION_FULL);
+        liquid_free(_q->b1, "firpfbch2_" EXTENSION_FULL);
+        liquid_free(_q->i0, "firpfbch2_" EXTENSION_FULL);
+        liquid_free(_q->i1, "firpfbch2_" EXTENSION_FULL);
+        liquid_free(_q->v, "firpfbch2_" EXTENSION_FULL);
+        liquid_free(_q->r, "firpfbch2_" EXTENSION_FULL);
+    }
+}
+
+// push packed sample into window (reduced-precision storage)
+//  _q      :   filterbank object
+//  _b      :   packed window buffers
+//  _index  :   write index array
+//  _k      :   window index
+//  _v      :   packed sample
+void FIRPFBCH2(_push_packed)(FIRPFBCH2()     _q,
+                             unsigned char * _b,
+                             unsigned int *  _index,
+                             unsigned int    _k,
+                             unsigned char * _v)
+{
+    unsigned int p = _index[_k];
+    memmove(_b + (_k*_q->w_len + p)*_q->sample_size, _v, _q->sample_size);
+    _index[_k] = (p + 1) % _q->w_len;
+}
+
+// read window contents, oldest sample first (reduced-precision storage)
+//  _q      :   filterbank object
+//  _b      :   packed window buffers
+//  _index  :   write index array
+//  _k      :   window index
+//  _r      :   unpacked window [size: w_len x 1]
+void FIRPFBCH2(_read_packed)(FIRPFBCH2()     _q,
+                             unsigned char * _b,
+                             unsigned int *  _index,
+                             unsigned int    _k,
+                             TI *            _r)
+{
+    // oldest samples run from write index to end of buffer, followed by
+    // newest samples from start of buffer
+    unsigned int    p  = _index[_k];
+    unsigned int    nc = sizeof(TI) / sizeof(float);
+    unsigned char * b  = _b + _k*_q->w_len*_q->sample_size;
+    liquid_storage_unpack(_q->storage, b + p*_q->sample_size, (_q->w_len-p)*nc, (float*)_r);
+    liquid_storage_unpack(_q->storage, b, p*nc, (float*)(_r + _q->w_len - p));
+}
@@ -97,3 +97,67 @@ void autotest_firpfbch2_crcf_n16()   { firpfbch2_crcf_runtest(  16, 5, 60.0f); }
 void autotest_firpfbch2_crcf_n32()   { firpfbch2_crcf_runtest(  32, 5, 60.0f); }
 void autotest_firpfbch2_crcf_n64()   { firpfbch2_crcf_runtest(  64, 5, 60.0f); }
 
+
+// reduced-precision window storage should track the single-precision
+// analysis/synthesis filterbank to within its storage precision
+void firpfbch2_crcf_storage_runtest(unsigned int        _M,
+                                    unsigned int        _m,
+                                    liquid_storage_type _storage,
+                                    float               _tol)
+{
+    unsigned int i;
+    unsigned int num_samples = 16 * _M * _m;
+
+    firpfbch2_crcf qa0 = firpfbch2_crcf_create_kaiser(LIQUID_ANALYZER,    _M, _m, 60.0f);
+    firpfbch2_crcf qs0 = firpfbch2_crcf_create_kaiser(LIQUID_SYNTHESIZER, _M, _m, 60.0f);
+    firpfbch2_crcf qa1 = firpfbch2_crcf_create_kaiser(LIQUID_ANALYZER,    _M, _m, 60.0f);
+    firpfbch2_crcf qs1 = firpfbch2_crcf_create_kaiser(LIQUID_SYNTHESIZER, _M, _m, 60.0f);
+    firpfbch2_crcf_set_storage(qa1, _storage);
+    firpfbch2_crcf_set_storage(qs1, _storage);
+
+    float complex x[_M/2];
+    float complex Y0[_M], Y1[_M];
+    float complex y0[_M/2], y1[_M/2];
+    unsigned int n;
+    for (n=0; n<num_samples; n+=_M/2) {
+        for (i=0; i<_M/2; i++)
+            x[i] = randnf() + _Complex_I*randnf();
+
+        firpfbch2_crcf_execute(qa0, x, Y0);
+        firpfbch2_crcf_execute(qa1, x, Y1);
+        for (i=0; i<_M; i++) {
+            CONTEND_DELTA( crealf(Y1[i]), crealf(Y0[i]), _tol );
+            CONTEND_DELTA( cimagf(Y1[i]), cimagf(Y0[i]), _tol );
+        }
+
+        firpfbch2_crcf_execute(qs0, Y0, y0);
+        firpfbch2_crcf_execute(qs1, Y0, y1);
+        for (i=0; i<_M/2; i++) {
+            CONTEND_DELTA( crealf(y1[i]), crealf(y0[i]), _tol );
+            CONTEND_DELTA( cimagf(y1[i]), cimagf(y0[i]), _tol );
+        }
+    }
+
+    // returning to single precision restores exact behavior
+    firpfbch2_crcf_set_storage(qa1, LIQUID_STORAGE_FLOAT32);
+    firpfbch2_crcf_reset(qa0);
+    for (n=0; n<4*_m; n++) {
+        for (i=0; i<_M/2; i++)
+            x[i] = randnf() + _Complex_I*randnf();
+        firpfbch2_crcf_execute(qa0, x, Y0);
+        firpfbch2_crcf_execute(qa1, x, Y1);
+        for (i=0; i<_M; i++) {
+            CONTEND_EQUALITY( crealf(Y1[i]), crealf(Y0[i]) );
+            CONTEND_EQUALITY( cimagf(Y1[i]), cimagf(Y0[i]) );
+        }
+    }
+
+    firpfbch2_crcf_destroy(qa0);
+    firpfbch2_crcf_destroy(qs0);
+    firpfbch2_crcf_destroy(qa1);
+    firpfbch2_crcf_destroy(qs1);
+}
+
+void autotest_firpfbch2_crcf_f16_n16()  { firpfbch2_crcf_storage_runtest(16, 5, LIQUID_STORAGE_FLOAT16,  4e-3f); }
+void autotest_firpfbch2_crcf_f16_n64()  { firpfbch2_crcf_storage_runtest(64, 3, LIQUID_STORAGE_FLOAT16,  4e-3f); }
+void autotest_firpfbch2_crcf_bf16_n16() { firpfbch2_crcf_storage_runtest(16, 5, LIQUID_STORAGE_BFLOAT16, 3e-2f); }
@@ -38,6 +38,7 @@
 struct NCO(_s) {
     liquid_ncotype  type;           // NCO type (e.g. LIQUID_VCO)
     T               sintab[1024];   // sine look-up table
+    liquid_q15      sintab_q15[1024]; // sine look-up table (Q15)
     uint32_t        theta;          // 32-bit phase     [radians]
     uint32_t        d_theta;        // 32-bit frequency [radians/sample]
 
@@ -52,6 +53,28 @@ uint32_t NCO(_constrain)(float _theta);
 // compute index for sine look-up table
 unsigned int NCO(_index)(NCO() _q);
 
+// look up sine and cosine of fixed-point phase _theta
+static inline void NCO(_sincos_lookup)(NCO()    _q,
+                                       uint32_t _theta,
+                                       T *      _s,
+                                       T *      _c)
+{
+    unsigned int index = ((_theta + (1<<21)) >> 22) & 0x3ff;
+    *_s = _q->sintab[ index            ];
+    *_c = _q->sintab[(index+256) & 0x3ff];
+}
+
+// look up sine and cosine (Q15) of fixed-point phase _theta
+static inline void NCO(_sincos_lookup_q15)(NCO()     _q,
+                                           uint32_t  _theta,
+                                           int32_t * _s,
+                                           int32_t * _c)
+{
+    unsigned int index = ((_theta + (1<<21)) >> 22) & 0x3ff;
+    *_s = _q->sintab_q15[ index            ];
+    *_c = _q->sintab_q15[(index+256) & 0x3ff];
+}
+
 // create nco/vco object
 NCO() NCO(_create)(liquid_ncotype _type)
 {
@@ -62,6 +85,8 @@ NCO() NCO(_create)(liquid_ncotype _type)
     unsigned int i;
     for (i=0; i<1024; i++)
         q->sintab[i] = SIN(2.0f*M_PI*(float)(i)/1024.0f);
+    for (i=0; i<1024; i++)
+        q->sintab_q15[i] = liquid_float_to_q15(q->sintab[i]);
 
     // set default pll bandwidth
     NCO(_pll_set_bandwidth)(q, NCO_PLL_BANDWIDTH_DEFAULT);
@@ -171,12 +196,7 @@ void NCO(_sincos)(NCO() _q,
                   T *   _s,
                   T *   _c)
 {
-    // add pi/2 phase shift
-    unsigned int index = NCO(_index)(_q);
-
-    // return result
-    *_s = _q->sintab[(index    )        ];
-    *_c = _q->sintab[(index+256) & 0x3ff];
+    NCO(_sincos_lookup)(_q, _q->theta, _s, _c);
 }
 
 // compute complex exponential of internal phase
@@ -273,29 +293,23 @@ void NCO(_mix_block_up)(NCO() _q,
                         TC *_y,
                         unsigned int _n)
 {
+    // step fixed-point phase locally; identical to mixing and stepping
+    // one sample at a time
+    uint32_t theta   = _q->theta;
+    uint32_t d_theta = _q->d_theta;
     unsigned int i;
-    // FIXME: this method should be more efficient but is causing occasional
-    //        errors so instead favor slower but more reliable algorithm
-#if 0
-    T theta =   _q->theta;
-    T d_theta = _q->d_theta;
     for (i=0; i<_n; i++) {
-        // multiply _x[i] by [cos(theta) + _Complex_I*sin(theta)]
-        _y[i] = _x[i] * liquid_cexpjf(theta);
-        
-        theta += d_theta;
-    }
+        T vsin, vcos;
+        NCO(_sincos_lookup)(_q, theta, &vsin, &vcos);
 
-    NCO(_set_phase)(_q, theta);
-#else
-    for (i=0; i<_n; i++) {
-        // mix single sample up
-        NCO(_mix_up)(_q, _x[i], &_y[i]);
+        // multiply _x[i] by [cos(theta) + _Complex_I*sin(theta)]
+        T xr = crealf(_x[i]);
+        T xi = cimagf(_x[i]);
+        _y[i] = (xr*vcos - xi*vsin) + _Complex_I*(xr*vsin + xi*vcos);
 
-        // step NCO phase
-        NCO(_step)(_q);
+        theta += d_theta;
     }
-#endif
+    _q->theta = theta;
 }
 
 // Rotate input vector array down by NCO angle:
@@ -310,29 +324,147 @@ void NCO(_mix_block_down)(NCO() _q,
                           TC *_y,
                           unsigned int _n)
 {
+    uint32_t theta   = _q->theta;
+    uint32_t d_theta = _q->d_theta;
     unsigned int i;
-    // FIXME: this method should be more efficient but is causing occasional
-    //        errors so instead favor slower but more reliable algorithm
-#if 0
-    T theta =   _q->theta;
-    T d_theta = _q->d_theta;
     for (i=0; i<_n; i++) {
+        T vsin, vcos;
+        NCO(_sincos_lookup)(_q, theta, &vsin, &vcos);
+
         // multiply _x[i] by [cos(-theta) + _Complex_I*sin(-theta)]
-        _y[i] = _x[i] * liquid_cexpjf(-theta);
-        
+        T xr = crealf(_x[i]);
+        T xi = cimagf(_x[i]);
+        _y[i] = (xr*vcos + xi*vsin) + _Complex_I*(xi*vcos - xr*vsin);
+
         theta += d_theta;
     }
+    _q->theta = theta;
+}
 
-    NCO(_set_phase)(_q, theta);
-#else
+// Rotate interleaved int16 I/Q input vector down by NCO angle,
+// converting to floating-point with full scale (32768) at unity
+//  _q      :   nco object
+//  _x      :   input array [size: 2*_n x 1]
+//  _y      :   output sample [size: _n x 1]
+//  _n      :   number of input, output samples
+void NCO(_mix_block_down_ci16)(NCO()        _q,
+                               int16_t *    _x,
+                               TC *         _y,
+                               unsigned int _n)
+{
+    uint32_t theta   = _q->theta;
+    uint32_t d_theta = _q->d_theta;
+    T        g       = 1.0f / 32768.0f;
+    unsigned int i;
     for (i=0; i<_n; i++) {
-        // mix single sample down
-        NCO(_mix_down)(_q, _x[i], &_y[i]);
+        T vsin, vcos;
+        NCO(_sincos_lookup)(_q, theta, &vsin, &vcos);
+        vsin *= g;
+        vcos *= g;
+
+        // multiply input by [cos(-theta) + _Complex_I*sin(-theta)], folding
+        // normalization into the rotation
+        T xr = (T) _x[2*i+0];
+        T xi = (T) _x[2*i+1];
+        _y[i] = (xr*vcos + xi*vsin) + _Complex_I*(xi*vcos - xr*vsin);
 
-        // step NCO phase
-        NCO(_step)(_q);
+        theta += d_theta;
     }
-#endif
+    _q->theta = theta;
+}
+
+// Rotate interleaved int8 I/Q input vector down by NCO angle,
+// converting to floating-point with full scale (128) at unity
+//  _q      :   nco object
+//  _x      :   input array [size: 2*_n x 1]
+//  _y      :   output sample [size: _n x 1]
+//  _n      :   number of input, output samples
+void NCO(_mix_block_down_ci8)(NCO()        _q,
+                              int8_t *     _x,
+                              TC *         _y,
+                              unsigned int _n)
+{
+    uint32_t theta   = _q->theta;
+    uint32_t d_theta = _q->d_theta;
+    T        g       = 1.0f / 128.0f;
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        T vsin, vcos;
+        NCO(_sincos_lookup)(_q, theta, &vsin, &vcos);
+        vsin *= g;
+        vcos *= g;
+
+        // multiply input by [cos(-theta) + _Complex_I*sin(-theta)], folding
+        // normalization into the rotation
+        T xr = (T) _x[2*i+0];
+        T xi = (T) _x[2*i+1];
+        _y[i] = (xr*vcos + xi*vsin) + _Complex_I*(xi*vcos - xr*vsin);
+
+        theta += d_theta;
+    }
+    _q->theta = theta;
+}
+
+// Rotate fixed-point input vector array up by NCO angle, stepping the
+// phase exactly as mix_block_up()
+//  _q      :   nco object
+//  _x      :   input array [size: _n x 1]
+//  _y      :   output sample [size: _n x 1]
+//  _n      :   number of input, output samples
+void NCO(_mix_block_up_q15)(NCO()         _q,
+                            liquid_cq15 * _x,
+                            liquid_cq15 * _y,
+                            unsigned int  _n)
+{
+    uint32_t theta   = _q->theta;
+    uint32_t d_theta = _q->d_theta;
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        int32_t vsin, vcos;
+        NCO(_sincos_lookup_q15)(_q, theta, &vsin, &vcos);
+
+        // multiply _x[i] by [cos(theta) + _Complex_I*sin(theta)]; each
+        // sum of two Q30 products fits in 32 bits
+        int32_t xr = _x[i].real;
+        int32_t xi = _x[i].imag;
+        int32_t yr = xr*vcos - xi*vsin;
+        int32_t yi = xr*vsin + xi*vcos;
+        _y[i].real = LIQUID_Q15_ROUND(yr);
+        _y[i].imag = LIQUID_Q15_ROUND(yi);
+
+        theta += d_theta;
+    }
+    _q->theta = theta;
+}
+
+// Rotate fixed-point input vector array down by NCO angle
+//  _q      :   nco object
+//  _x      :   input array [size: _n x 1]
+//  _y      :   output sample [size: _n x 1]
+//  _n      :   number of input, output samples
+void NCO(_mix_block_down_q15)(NCO()         _q,
+                              liquid_cq15 * _x,
+                              liquid_cq15 * _y,
+                              unsigned int  _n)
+{
+    uint32_t theta   = _q->theta;
+    uint32_t d_theta = _q->d_theta;
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        int32_t vsin, vcos;
+        NCO(_sincos_lookup_q15)(_q, theta, &vsin, &vcos);
+
+        // multiply _x[i] by [cos(-theta) + _Complex_I*sin(-theta)]
+        int32_t xr = _x[i].real;
+        int32_t xi = _x[i].imag;
+        int32_t yr = xr*vcos + xi*vsin;
+        int32_t yi = xi*vcos - xr*vsin;
+        _y[i].real = LIQUID_Q15_ROUND(yr);
+        _y[i].imag = LIQUID_Q15_ROUND(yi);
+
+        theta += d_theta;
+    }
+    _q->theta = theta;
 }
 
 //
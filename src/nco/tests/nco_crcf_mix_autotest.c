@@ -61,3 +61,139 @@ void autotest_nco_crcf_mix_block_up()
     nco_crcf_destroy(nco);
 }
 
+
+// block mixing should match mixing and stepping one sample at a time
+void autotest_nco_crcf_mix_block_consistency()
+{
+    unsigned int buf_len = 1000;
+    float complex x [buf_len];
+    float complex y0[buf_len];  // per-sample, up
+    float complex y1[buf_len];  // block, up
+    float complex z0[buf_len];  // per-sample, down
+    float complex z1[buf_len];  // block, down
+    unsigned int i;
+    for (i=0; i<buf_len; i++)
+        x[i] = randnf() + _Complex_I*randnf();
+
+    // create objects with identical phase and frequency
+    nco_crcf nco_0 = nco_crcf_create(LIQUID_VCO);
+    nco_crcf nco_1 = nco_crcf_create(LIQUID_VCO);
+    nco_crcf_set_phase    (nco_0, -1.2345f);
+    nco_crcf_set_phase    (nco_1, -1.2345f);
+    nco_crcf_set_frequency(nco_0,  0.0873f);
+    nco_crcf_set_frequency(nco_1,  0.0873f);
+
+    // mix up and down one sample at a time
+    for (i=0; i<buf_len; i++) {
+        nco_crcf_mix_up  (nco_0, x[i], &y0[i]);
+        nco_crcf_mix_down(nco_0, x[i], &z0[i]);
+        nco_crcf_step    (nco_0);
+    }
+
+    // mix up then back down with block methods
+    nco_crcf_mix_block_up  (nco_1, x, y1, buf_len);
+    nco_crcf_set_phase     (nco_1, -1.2345f);
+    nco_crcf_mix_block_down(nco_1, x, z1, buf_len);
+
+    for (i=0; i<buf_len; i++) {
+        CONTEND_DELTA( crealf(y1[i]), crealf(y0[i]), 1e-6f );
+        CONTEND_DELTA( cimagf(y1[i]), cimagf(y0[i]), 1e-6f );
+        CONTEND_DELTA( crealf(z1[i]), crealf(z0[i]), 1e-6f );
+        CONTEND_DELTA( cimagf(z1[i]), cimagf(z0[i]), 1e-6f );
+    }
+    CONTEND_DELTA( nco_crcf_get_phase(nco_1), nco_crcf_get_phase(nco_0), 1e-6f );
+
+    nco_crcf_destroy(nco_0);
+    nco_crcf_destroy(nco_1);
+}
+
+// fixed-point block mixing should match floating-point mixing to within a
+// few least-significant bits
+void autotest_nco_crcf_mix_block_q15()
+{
+    unsigned int buf_len = 1000;
+    liquid_cq15   xq[buf_len];
+    liquid_cq15   yq[buf_len];
+    liquid_cq15   zq[buf_len];
+    float complex xf[buf_len];
+    float complex yf[buf_len];
+    float complex zf[buf_len];
+    unsigned int i;
+    for (i=0; i<buf_len; i++) {
+        // keep magnitude below one so rotated outputs cannot saturate
+        xq[i].real = liquid_float_to_q15(0.7f*(2.0f*randf() - 1.0f));
+        xq[i].imag = liquid_float_to_q15(0.7f*(2.0f*randf() - 1.0f));
+        xf[i] = liquid_q15_to_float(xq[i].real) +
+                liquid_q15_to_float(xq[i].imag)*_Complex_I;
+    }
+
+    // create objects with identical phase and frequency
+    nco_crcf nco_0 = nco_crcf_create(LIQUID_NCO);
+    nco_crcf nco_1 = nco_crcf_create(LIQUID_NCO);
+    nco_crcf_set_phase    (nco_0, 0.4321f);
+    nco_crcf_set_phase    (nco_1, 0.4321f);
+    nco_crcf_set_frequency(nco_0, 0.0731f);
+    nco_crcf_set_frequency(nco_1, 0.0731f);
+
+    nco_crcf_mix_block_up      (nco_0, xf, yf, buf_len);
+    nco_crcf_mix_block_up_q15  (nco_1, xq, yq, buf_len);
+    nco_crcf_mix_block_down    (nco_0, xf, zf, buf_len);
+    nco_crcf_mix_block_down_q15(nco_1, xq, zq, buf_len);
+
+    float tol = 4.0f / 32768.0f;
+    for (i=0; i<buf_len; i++) {
+        CONTEND_DELTA( liquid_q15_to_float(yq[i].real), crealf(yf[i]), tol );
+        CONTEND_DELTA( liquid_q15_to_float(yq[i].imag), cimagf(yf[i]), tol );
+        CONTEND_DELTA( liquid_q15_to_float(zq[i].real), crealf(zf[i]), tol );
+        CONTEND_DELTA( liquid_q15_to_float(zq[i].imag), cimagf(zf[i]), tol );
+    }
+    CONTEND_DELTA( nco_crcf_get_phase(nco_1), nco_crcf_get_phase(nco_0), 1e-6f );
+
+    nco_crcf_destroy(nco_0);
+    nco_crcf_destroy(nco_1);
+}
+
+// mixing interleaved integer input should match converting it first
+void autotest_nco_crcf_mix_block_down_ci()
+{
+    unsigned int buf_len = 1000;
+    int16_t       x16[2*buf_len];
+    int8_t        x8 [2*buf_len];
+    float complex x  [buf_len];
+    float complex y0 [buf_len];
+    float complex y1 [buf_len];
+    unsigned int i;
+    for (i=0; i<2*buf_len; i++) {
+        x16[i] = (int16_t)(rand() % 65536 - 32768);
+        x8 [i] = (int8_t) (x16[i] >> 8);
+    }
+
+    nco_crcf nco_0 = nco_crcf_create(LIQUID_VCO);
+    nco_crcf nco_1 = nco_crcf_create(LIQUID_VCO);
+    nco_crcf_set_frequency(nco_0, 0.0873f);
+    nco_crcf_set_frequency(nco_1, 0.0873f);
+
+    // int16
+    for (i=0; i<buf_len; i++)
+        x[i] = (x16[2*i] + _Complex_I*x16[2*i+1]) / 32768.0f;
+    nco_crcf_mix_block_down     (nco_0, x,   y0, buf_len);
+    nco_crcf_mix_block_down_ci16(nco_1, x16, y1, buf_len);
+    for (i=0; i<buf_len; i++) {
+        CONTEND_DELTA( crealf(y1[i]), crealf(y0[i]), 1e-6f );
+        CONTEND_DELTA( cimagf(y1[i]), cimagf(y0[i]), 1e-6f );
+    }
+
+    // int8
+    for (i=0; i<buf_len; i++)
+        x[i] = (x8[2*i] + _Complex_I*x8[2*i+1]) / 128.0f;
+    nco_crcf_mix_block_down    (nco_0, x,  y0, buf_len);
+    nco_crcf_mix_block_down_ci8(nco_1, x8, y1, buf_len);
+    for (i=0; i<buf_len; i++) {
+        CONTEND_DELTA( crealf(y1[i]), crealf(y0[i]), 1e-6f );
+        CONTEND_DELTA( cimagf(y1[i]), cimagf(y0[i]), 1e-6f );
+    }
+    CONTEND_DELTA( nco_crcf_get_phase(nco_1), nco_crcf_get_phase(nco_0), 1e-6f );
+
+    nco_crcf_destroy(nco_0);
+    nco_crcf_destroy(nco_1);
+}
@@ -0,0 +1,240 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// half-precision (float16, bfloat16) storage conversion
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "liquid.internal.h"
+
+#if defined(__F16C__)
+#include <immintrin.h>  // F16C
+#endif
+
+// reinterpret float as its IEEE-754 bit pattern, and back
+static uint32_t liquid_float_bits(float _x)
+{
+    uint32_t v;
+    memcpy(&v, &_x, sizeof(float));
+    return v;
+}
+
+static float liquid_bits_float(uint32_t _v)
+{
+    float x;
+    memcpy(&x, &_v, sizeof(float));
+    return x;
+}
+
+// convert floating-point value to IEEE-754 binary16, rounding to the
+// nearest even value; values beyond the range (65504) become infinite
+liquid_float16 liquid_float_to_float16(float _x)
+{
+    uint32_t f    = liquid_float_bits(_x);
+    uint32_t sign = (f >> 16) & 0x8000;
+    f &= 0x7fffffff;
+
+    uint32_t h;
+    if (f >= 0x47800000) {
+        // overflow, infinity or NaN (keep NaN quiet)
+        h = f > 0x7f800000 ? 0x7e00 : 0x7c00;
+    } else if (f < 0x38800000) {
+        // subnormal result: let floating-point addition align and round
+        // the mantissa (0.5 places the least significant half-precision
+        // bit at the least significant bit of the sum)
+        h = liquid_float_bits(liquid_bits_float(f) + 0.5f) - 0x3f000000;
+    } else {
+        // normal result: rebias exponent and round to nearest even
+        uint32_t odd = (f >> 13) & 1;
+        f += 0xc8000fff + odd;  // ((15-127) << 23) + 0xfff, modulo 2^32
+        h = f >> 13;
+    }
+    return (liquid_float16)(sign | h);
+}
+
+// convert IEEE-754 binary16 value to floating-point (exact)
+float liquid_float16_to_float(liquid_float16 _x)
+{
+    uint32_t e = (_x >> 10) & 0x1f;
+    uint32_t m =  _x & 0x3ff;
+    uint32_t f;
+    if (e == 0x1f) {
+        // infinity or NaN
+        f = 0x7f800000 | (m << 13);
+    } else if (e == 0) {
+        // zero or subnormal: m * 2^-24
+        f = liquid_float_bits((float)m * (1.0f / 16777216.0f));
+    } else {
+        f = ((e + 112) << 23) | (m << 13);
+    }
+    return liquid_bits_float(f | ((uint32_t)(_x & 0x8000) << 16));
+}
+
+// convert floating-point value to bfloat16 (upper half of binary32),
+// rounding to the nearest even value
+liquid_bfloat16 liquid_float_to_bfloat16(float _x)
+{
+    uint32_t f = liquid_float_bits(_x);
+    if ((f & 0x7fffffff) > 0x7f800000)
+        return (liquid_bfloat16)((f >> 16) | 0x40); // keep NaN quiet
+    f += 0x7fff + ((f >> 16) & 1);
+    return (liquid_bfloat16)(f >> 16);
+}
+
+// convert bfloat16 value to floating-point (exact)
+float liquid_bfloat16_to_float(liquid_bfloat16 _x)
+{
+    return liquid_bits_float((uint32_t)_x << 16);
+}
+
+// convert block of floating-point samples to float16
+//  _x      : input array [size: _n x 1]
+//  _n      : number of samples
+//  _y      : output array [size: _n x 1]
+void liquid_float_to_float16_block(float *          _x,
+                                   unsigned int     _n,
+                                   liquid_float16 * _y)
+{
+    unsigned int i = 0;
+#if defined(__F16C__)
+    for (; i+4 <= _n; i+=4) {
+        __m128i h = _mm_cvtps_ph(_mm_loadu_ps(_x+i), _MM_FROUND_TO_NEAREST_INT);
+        _mm_storel_epi64((__m128i*)(_y+i), h);
+    }
+#endif
+    for (; i<_n; i++)
+        _y[i] = liquid_float_to_float16(_x[i]);
+}
+
+// convert block of float16 samples to floating-point
+//  _x      : input array [size: _n x 1]
+//  _n      : number of samples
+//  _y      : output array [size: _n x 1]
+void liquid_float16_to_float_block(liquid_float16 * _x,
+                                   unsigned int     _n,
+                                   float *          _y)
+{
+    unsigned int i = 0;
+#if defined(__F16C__)
+    for (; i+4 <= _n; i+=4)
+        _mm_storeu_ps(_y+i, _mm_cvtph_ps(_mm_loadl_epi64((__m128i*)(_x+i))));
+#endif
+    for (; i<_n; i++)
+        _y[i] = liquid_float16_to_float(_x[i]);
+}
+
+// convert block of floating-point samples to bfloat16
+//  _x      : input array [size: _n x 1]
+//  _n      : number of samples
+//  _y      : output array [size: _n x 1]
+void liquid_float_to_bfloat16_block(float *           _x,
+                                    unsigned int      _n,
+                                    liquid_bfloat16 * _y)
+{
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        _y[i] = liquid_float_to_bfloat16(_x[i]);
+}
+
+// convert block of bfloat16 samples to floating-point
+//  _x      : input array [size: _n x 1]
+//  _n      : number of samples
+//  _y      : output array [size: _n x 1]
+void liquid_bfloat16_to_float_block(liquid_bfloat16 * _x,
+                                    unsigned int      _n,
+                                    float *           _y)
+{
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        _y[i] = liquid_bfloat16_to_float(_x[i]);
+}
+
+// number of bytes used to store each value in a given format
+unsigned int liquid_storage_size(liquid_storage_type _type)
+{
+    switch (_type) {
+    case LIQUID_STORAGE_FLOAT32:  return sizeof(float);
+    case LIQUID_STORAGE_FLOAT16:  return sizeof(liquid_float16);
+    case LIQUID_STORAGE_BFLOAT16: return sizeof(liquid_bfloat16);
+    default:
+        fprintf(stderr,"error: liquid_storage_size(), invalid storage type %d\n", _type);
+        exit(1);
+    }
+    return 0;
+}
+
+// pack block of floating-point values into storage format
+//  _type   : storage format
+//  _x      : input array [size: _n x 1]
+//  _n      : number of values
+//  _y      : packed output, _n values of type _type
+void liquid_storage_pack(liquid_storage_type _type,
+                         float *             _x,
+                         unsigned int        _n,
+                         void *              _y)
+{
+    switch (_type) {
+    case LIQUID_STORAGE_FLOAT32:
+        memmove(_y, _x, _n*sizeof(float));
+        break;
+    case LIQUID_STORAGE_FLOAT16:
+        liquid_float_to_float16_block(_x, _n, (liquid_float16*)_y);
+        break;
+    case LIQUID_STORAGE_BFLOAT16:
+        liquid_float_to_bfloat16_block(_x, _n, (liquid_bfloat16*)_y);
+        break;
+    default:
+        fprintf(stderr,"error: liquid_storage_pack(), invalid storage type %d\n", _type);
+        exit(1);
+    }
+}
+
+// unpack block of values from storage format into floating-point
+//  _type   : storage format
+//  _x      : packed input, _n values of type _type
+//  _n      : number of values
+//  _y      : output array [size: _n x 1]
+void liquid_storage_unpack(liquid_storage_type _type,
+                           void *              _x,
+                           unsigned int        _n,
+                           float *             _y)
+{
+    switch (_type) {
+    case LIQUID_STORAGE_FLOAT32:
+        memmove(_y, _x, _n*sizeof(float));
+        break;
+    case LIQUID_STORAGE_FLOAT16:
+        liquid_float16_to_float_block((liquid_float16*)_x, _n, _y);
+        break;
+    case LIQUID_STORAGE_BFLOAT16:
+        liquid_bfloat16_to_float_block((liquid_bfloat16*)_x, _n, _y);
+        break;
+    default:
+        fprintf(stderr,"error: liquid_storage_unpack(), invalid storage type %d\n", _type);
+        exit(1);
+    }
+}
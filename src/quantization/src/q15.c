@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Q15 fixed-point conversion
+//
+
+#include <math.h>
+
+#include "liquid.internal.h"
+
+// convert floating-point value to Q15, rounding to the nearest level and
+// saturating to [-32768, 32767]
+liquid_q15 liquid_float_to_q15(float _x)
+{
+    float v = roundf(_x * 32768.0f);
+    if (v >  32767.0f) return  32767;
+    if (v < -32768.0f) return -32768;
+    return (liquid_q15) v;
+}
+
+// convert Q15 value to floating-point
+float liquid_q15_to_float(liquid_q15 _x)
+{
+    return (float)_x * (1.0f / 32768.0f);
+}
+
+// convert block of floating-point samples to Q15
+//  _x      : input array [size: _n x 1]
+//  _n      : number of samples
+//  _y      : output array [size: _n x 1]
+void liquid_float_to_q15_block(float *      _x,
+                               unsigned int _n,
+                               liquid_q15 * _y)
+{
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        _y[i] = liquid_float_to_q15(_x[i]);
+}
+
+// convert block of Q15 samples to floating-point
+//  _x      : input array [size: _n x 1]
+//  _n      : number of samples
+//  _y      : output array [size: _n x 1]
+void liquid_q15_to_float_block(liquid_q15 * _x,
+                               unsigned int _n,
+                               float *      _y)
+{
+    unsigned int i;
+    for (i=0; i<_n; i++)
+        _y[i] = liquid_q15_to_float(_x[i]);
+}
@@ -53,3 +53,97 @@ void autotest_quantize_float_n8() {
     }
 }
 
+
+// Q15 conversion: rounding to nearest level and saturation
+void autotest_quantize_q15()
+{
+    CONTEND_EQUALITY(liquid_float_to_q15( 0.0f),            0);
+    CONTEND_EQUALITY(liquid_float_to_q15( 0.5f),        16384);
+    CONTEND_EQUALITY(liquid_float_to_q15(-0.5f),       -16384);
+    CONTEND_EQUALITY(liquid_float_to_q15(-1.0f),       -32768);
+    CONTEND_EQUALITY(liquid_float_to_q15( 1.0f),        32767);
+    CONTEND_EQUALITY(liquid_float_to_q15( 3.7f),        32767);
+    CONTEND_EQUALITY(liquid_float_to_q15(-3.7f),       -32768);
+    CONTEND_EQUALITY(liquid_float_to_q15( 1.4f/32768.0f),   1);
+    CONTEND_EQUALITY(liquid_float_to_q15( 1.6f/32768.0f),   2);
+
+    // round trip through block conversion
+    unsigned int n = 200;
+    float      x[n];
+    liquid_q15 q[n];
+    float      y[n];
+    unsigned int i;
+    for (i=0; i<n; i++)
+        x[i] = 0.99f*(2.0f*randf() - 1.0f);
+    liquid_float_to_q15_block(x, n, q);
+    liquid_q15_to_float_block(q, n, y);
+    for (i=0; i<n; i++)
+        CONTEND_DELTA(y[i], x[i], 0.5f/32768.0f + 1e-7f);
+}
+
+void autotest_quantize_float16()
+{
+    CONTEND_EQUALITY(liquid_float_to_float16( 0.0f),                 0x0000);
+    CONTEND_EQUALITY(liquid_float_to_float16( 1.0f),                 0x3c00);
+    CONTEND_EQUALITY(liquid_float_to_float16(-2.0f),                 0xc000);
+    CONTEND_EQUALITY(liquid_float_to_float16( 65504.0f),             0x7bff);
+    CONTEND_EQUALITY(liquid_float_to_float16( 65519.0f),             0x7bff);
+    CONTEND_EQUALITY(liquid_float_to_float16( 65520.0f),             0x7c00);
+    CONTEND_EQUALITY(liquid_float_to_float16(-1e9f),                 0xfc00);
+
+    // ties round to even, including subnormals
+    CONTEND_EQUALITY(liquid_float_to_float16(1.0f + 1.0f/2048.0f),   0x3c00);
+    CONTEND_EQUALITY(liquid_float_to_float16(1.0f + 3.0f/2048.0f),   0x3c02);
+    CONTEND_EQUALITY(liquid_float_to_float16(ldexpf(1.0f,-24)),      0x0001);
+    CONTEND_EQUALITY(liquid_float_to_float16(ldexpf(1.0f,-25)),      0x0000);
+    CONTEND_EQUALITY(liquid_float_to_float16(ldexpf(3.0f,-25)),      0x0002);
+    CONTEND_EQUALITY(liquid_float_to_float16(ldexpf(1023.5f,-24)),   0x0400);
+
+    // every value other than NaN survives a round trip exactly
+    unsigned int i;
+    for (i=0; i<65536; i++) {
+        if ((i & 0x7c00) == 0x7c00 && (i & 0x03ff))
+            continue;
+        float v = liquid_float16_to_float((liquid_float16)i);
+        CONTEND_EQUALITY(liquid_float_to_float16(v), i);
+    }
+    CONTEND_EXPRESSION(isnan(liquid_float16_to_float(liquid_float_to_float16(nanf("")))));
+
+    // block conversion matches scalar conversion
+    unsigned int n = 203;
+    float          x[n];
+    liquid_float16 h[n];
+    float          y[n];
+    for (i=0; i<n; i++)
+        x[i] = 100.0f*randnf();
+    liquid_float_to_float16_block(x, n, h);
+    liquid_float16_to_float_block(h, n, y);
+    for (i=0; i<n; i++) {
+        CONTEND_EQUALITY(h[i], liquid_float_to_float16(x[i]));
+        CONTEND_EQUALITY(y[i], liquid_float16_to_float(h[i]));
+        CONTEND_DELTA(y[i], x[i], fabsf(x[i])/2048.0f);
+    }
+}
+
+void autotest_quantize_bfloat16()
+{
+    CONTEND_EQUALITY(liquid_float_to_bfloat16( 0.0f),                0x0000);
+    CONTEND_EQUALITY(liquid_float_to_bfloat16( 1.0f),                0x3f80);
+    CONTEND_EQUALITY(liquid_float_to_bfloat16(-2.0f),                0xc000);
+    CONTEND_EQUALITY(liquid_float_to_bfloat16(1.0f + 1.0f/256.0f),   0x3f80);
+    CONTEND_EQUALITY(liquid_float_to_bfloat16(1.0f + 3.0f/256.0f),   0x3f82);
+    CONTEND_EXPRESSION(isnan(liquid_bfloat16_to_float(liquid_float_to_bfloat16(nanf("")))));
+
+    // block round trip
+    unsigned int n = 203;
+    float           x[n];
+    liquid_bfloat16 h[n];
+    float           y[n];
+    unsigned int i;
+    for (i=0; i<n; i++)
+        x[i] = 1e6f*randnf();
+    liquid_float_to_bfloat16_block(x, n, h);
+    liquid_bfloat16_to_float_block(h, n, y);
+    for (i=0; i<n; i++)
+        CONTEND_DELTA(y[i], x[i], fabsf(x[i])/256.0f);
+}
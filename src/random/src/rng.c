@@ -0,0 +1,278 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// Re-entrant pseudo-random number generator: xoshiro128** [Blackman:2018]
+// with Gauss samples drawn by the ziggurat method [Marsaglia:2000]. Each
+// object holding its own state generates a reproducible stream which is
+// independent of rand() and of other objects, e.g. across threads.
+//
+// References:
+//  [Blackman:2018] D. Blackman and S. Vigna, "Scrambled Linear
+//      Pseudorandom Number Generators," arXiv:1805.01407, 2018.
+//  [Marsaglia:2000] G. Marsaglia and W. W. Tsang, "The Ziggurat Method
+//      for Generating Random Variables," Journal of Statistical
+//      Software, vol. 5, no. 8, 2000.
+//
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "liquid.internal.h"
+
+// ziggurat tables for 128 layers of the Gauss density: layer
+// thresholds (kn), widths scaled by 2^-31 (wn), and densities (fn)
+static const uint32_t liquid_rng_kn[128] = {
+    0x76ad2212, 0x00000000, 0x600f1b53, 0x6ce447a6, 0x725b46a2, 0x7560051d,
+    0x774921eb, 0x789a25bd, 0x799045c3, 0x7a4bce5d, 0x7adf629f, 0x7b5682a6,
+    0x7bb8a8c6, 0x7c0ae722, 0x7c50cce7, 0x7c8cec5b, 0x7cc12cd6, 0x7ceefed2,
+    0x7d177e0b, 0x7d3b8883, 0x7d5bce6c, 0x7d78dd64, 0x7d932886, 0x7dab0e57,
+    0x7dc0dd30, 0x7dd4d688, 0x7de73185, 0x7df81cea, 0x7e07c0a3, 0x7e163efa,
+    0x7e23b587, 0x7e303dfd, 0x7e3beec2, 0x7e46db77, 0x7e51155d, 0x7e5aabb3,
+    0x7e63abf7, 0x7e6c222c, 0x7e741906, 0x7e7b9a18, 0x7e82adfa, 0x7e895c63,
+    0x7e8fac4b, 0x7e95a3fb, 0x7e9b4924, 0x7ea0a0ef, 0x7ea5b00d, 0x7eaa7ac3,
+    0x7eaf04f3, 0x7eb3522a, 0x7eb765a5, 0x7ebb4259, 0x7ebeeafd, 0x7ec2620a,
+    0x7ec5a9c4, 0x7ec8c441, 0x7ecbb365, 0x7ece78ed, 0x7ed11671, 0x7ed38d62,
+    0x7ed5df12, 0x7ed80cb4, 0x7eda175c, 0x7edc0005, 0x7eddc78e, 0x7edf6ebf,
+    0x7ee0f647, 0x7ee25ebe, 0x7ee3a8a9, 0x7ee4d473, 0x7ee5e276, 0x7ee6d2f5,
+    0x7ee7a620, 0x7ee85c10, 0x7ee8f4cd, 0x7ee97047, 0x7ee9ce59, 0x7eea0eca,
+    0x7eea3147, 0x7eea3568, 0x7eea1aab, 0x7ee9e071, 0x7ee98602, 0x7ee90a88,
+    0x7ee86d08, 0x7ee7ac6a, 0x7ee6c769, 0x7ee5bc9c, 0x7ee48a67, 0x7ee32efc,
+    0x7ee1a857, 0x7edff42f, 0x7ede0ffa, 0x7edbf8d9, 0x7ed9ab94, 0x7ed7248d,
+    0x7ed45fae, 0x7ed1585c, 0x7ece095f, 0x7eca6ccb, 0x7ec67be2, 0x7ec22eee,
+    0x7ebd7d1a, 0x7eb85c35, 0x7eb2c075, 0x7eac9c20, 0x7ea5df27, 0x7e9e769f,
+    0x7e964c16, 0x7e8d44ba, 0x7e834033, 0x7e781728, 0x7e6b9933, 0x7e5d8a1a,
+    0x7e4d9ded, 0x7e3b737a, 0x7e268c2f, 0x7e0e3ff5, 0x7df1aa5d, 0x7dcf8c72,
+    0x7da61a1e, 0x7d72a0fb, 0x7d30e097, 0x7cd9b4ab, 0x7c600f1a, 0x7ba90bdc,
+    0x7a722176, 0x77d664e5,
+};
+
+static const float liquid_rng_wn[128] = {
+    1.729040522e-09, 1.268092845e-10, 1.689751777e-10, 1.986268844e-10,
+    2.223243179e-10, 2.424493613e-10, 2.601613190e-10, 2.761198871e-10,
+    2.907396282e-10, 3.042997041e-10, 3.169979521e-10, 3.289802053e-10,
+    3.403573812e-10, 3.512160221e-10, 3.616250995e-10, 3.716405763e-10,
+    3.813085643e-10, 3.906675681e-10, 3.997501187e-10, 4.085839862e-10,
+    4.171930964e-10, 4.255982353e-10, 4.338175974e-10, 4.418672181e-10,
+    4.497613196e-10, 4.575125889e-10, 4.651324048e-10, 4.726310238e-10,
+    4.800177347e-10, 4.873009868e-10, 4.944884981e-10, 5.015873466e-10,
+    5.086040482e-10, 5.155446229e-10, 5.224146520e-10, 5.292193275e-10,
+    5.359634953e-10, 5.426516925e-10, 5.492881800e-10, 5.558769721e-10,
+    5.624218613e-10, 5.689264417e-10, 5.753941290e-10, 5.818281786e-10,
+    5.882317021e-10, 5.946076818e-10, 6.009589843e-10, 6.072883728e-10,
+    6.135985177e-10, 6.198920075e-10, 6.261713578e-10, 6.324390202e-10,
+    6.386973906e-10, 6.449488167e-10, 6.511956053e-10, 6.574400293e-10,
+    6.636843339e-10, 6.699307434e-10, 6.761814667e-10, 6.824387039e-10,
+    6.887046513e-10, 6.949815079e-10, 7.012714804e-10, 7.075767893e-10,
+    7.138996747e-10, 7.202424015e-10, 7.266072661e-10, 7.329966016e-10,
+    7.394127850e-10, 7.458582428e-10, 7.523354585e-10, 7.588469793e-10,
+    7.653954238e-10, 7.719834898e-10, 7.786139632e-10, 7.852897266e-10,
+    7.920137693e-10, 7.987891979e-10, 8.056192475e-10, 8.125072942e-10,
+    8.194568683e-10, 8.264716694e-10, 8.335555823e-10, 8.407126946e-10,
+    8.479473165e-10, 8.552640026e-10, 8.626675754e-10, 8.701631525e-10,
+    8.777561764e-10, 8.854524480e-10, 8.932581641e-10, 9.011799601e-10,
+    9.092249580e-10, 9.174008206e-10, 9.257158144e-10, 9.341788804e-10,
+    9.427997160e-10, 9.515888694e-10, 9.605578494e-10, 9.697192525e-10,
+    9.790869128e-10, 9.886760771e-10, 9.985036135e-10, 1.008588259e-09,
+    1.018950917e-09, 1.029615015e-09, 1.040606944e-09, 1.051956589e-09,
+    1.063697999e-09, 1.075870210e-09, 1.088518296e-09, 1.101694708e-09,
+    1.115461010e-09, 1.129890161e-09, 1.145069570e-09, 1.161105243e-09,
+    1.178127561e-09, 1.196299505e-09, 1.215828698e-09, 1.236985629e-09,
+    1.260132330e-09, 1.285769684e-09, 1.314620185e-09, 1.347783956e-09,
+    1.387063532e-09, 1.435740319e-09, 1.500865903e-09, 1.603094794e-09,
+};
+
+static const float liquid_rng_fn[128] = {
+    1.000000000e+00, 9.635996931e-01, 9.362826817e-01, 9.130436480e-01,
+    8.922816508e-01, 8.732430489e-01, 8.555006079e-01, 8.387836053e-01,
+    8.229072114e-01, 8.077382947e-01, 7.931770118e-01, 7.791460859e-01,
+    7.655841739e-01, 7.524415592e-01, 7.396772437e-01, 7.272569183e-01,
+    7.151515074e-01, 7.033360990e-01, 6.917891434e-01, 6.804918410e-01,
+    6.694276673e-01, 6.585820001e-01, 6.479418211e-01, 6.374954773e-01,
+    6.272324852e-01, 6.171433708e-01, 6.072195366e-01, 5.974531509e-01,
+    5.878370544e-01, 5.783646811e-01, 5.690299911e-01, 5.598274127e-01,
+    5.507517931e-01, 5.417983550e-01, 5.329626594e-01, 5.242405727e-01,
+    5.156282382e-01, 5.071220511e-01, 4.987186355e-01, 4.904148253e-01,
+    4.822076463e-01, 4.740943007e-01, 4.660721527e-01, 4.581387163e-01,
+    4.502916437e-01, 4.425287153e-01, 4.348478302e-01, 4.272469983e-01,
+    4.197243320e-01, 4.122780401e-01, 4.049064208e-01, 3.976078565e-01,
+    3.903808082e-01, 3.832238111e-01, 3.761354695e-01, 3.691144537e-01,
+    3.621594954e-01, 3.552693848e-01, 3.484429675e-01, 3.416791412e-01,
+    3.349768533e-01, 3.283350984e-01, 3.217529159e-01, 3.152293881e-01,
+    3.087636380e-01, 3.023548278e-01, 2.960021568e-01, 2.897048604e-01,
+    2.834622082e-01, 2.772735029e-01, 2.711380791e-01, 2.650553023e-01,
+    2.590245674e-01, 2.530452985e-01, 2.471169475e-01, 2.412389935e-01,
+    2.354109423e-01, 2.296323252e-01, 2.239026994e-01, 2.182216466e-01,
+    2.125887731e-01, 2.070037094e-01, 2.014661101e-01, 1.959756531e-01,
+    1.905320403e-01, 1.851349970e-01, 1.797842721e-01, 1.744796383e-01,
+    1.692208922e-01, 1.640078547e-01, 1.588403711e-01, 1.537183122e-01,
+    1.486415742e-01, 1.436100801e-01, 1.386237800e-01, 1.336826526e-01,
+    1.287867062e-01, 1.239359802e-01, 1.191305467e-01, 1.143705124e-01,
+    1.096560210e-01, 1.049872554e-01, 1.003644410e-01, 9.578784912e-02,
+    9.125780083e-02, 8.677467189e-02, 8.233889824e-02, 7.795098251e-02,
+    7.361150188e-02, 6.932111739e-02, 6.508058521e-02, 6.089077035e-02,
+    5.675266348e-02, 5.266740190e-02, 4.863629586e-02, 4.466086220e-02,
+    4.074286807e-02, 3.688438879e-02, 3.308788615e-02, 2.935631744e-02,
+    2.569329194e-02, 2.210330462e-02, 1.859210274e-02, 1.516729801e-02,
+    1.183947866e-02, 8.624484413e-03, 5.548995221e-03, 2.669629084e-03,
+};
+
+// right-most layer edge
+#define LIQUID_RNG_ZIGGURAT_R   (3.442620f)
+
+// rotate left
+#define LIQUID_RNG_ROTL(x,k)    (((x) << (k)) | ((x) >> (32 - (k))))
+
+// slow path of Gauss sample: wedge or tail of layer _iz
+float liquid_rng_randnf_fix(liquid_rng * _q,
+                            int32_t      _hz,
+                            unsigned int _iz);
+
+// seed generator state, expanding seed with splitmix64
+//  _q      :   generator state
+//  _seed   :   seed value
+void liquid_rng_seed(liquid_rng *      _q,
+                     unsigned long int _seed)
+{
+    uint64_t z = (uint64_t)_seed;
+    unsigned int i;
+    for (i=0; i<2; i++) {
+        z += 0x9e3779b97f4a7c15ULL;
+        uint64_t v = z;
+        v = (v ^ (v >> 30)) * 0xbf58476d1ce4e5b9ULL;
+        v = (v ^ (v >> 27)) * 0x94d049bb133111ebULL;
+        v =  v ^ (v >> 31);
+        _q->s[2*i+0] = (uint32_t)(v      );
+        _q->s[2*i+1] = (uint32_t)(v >> 32);
+    }
+}
+
+// generate next 32-bit output
+uint32_t liquid_rng_next(liquid_rng * _q)
+{
+    uint32_t r = LIQUID_RNG_ROTL(_q->s[1] * 5, 7) * 9;
+    uint32_t t = _q->s[1] << 9;
+    _q->s[2] ^= _q->s[0];
+    _q->s[3] ^= _q->s[1];
+    _q->s[1] ^= _q->s[2];
+    _q->s[0] ^= _q->s[3];
+    _q->s[2] ^= t;
+    _q->s[3]  = LIQUID_RNG_ROTL(_q->s[3], 11);
+    return r;
+}
+
+// uniform random number in (0,1)
+float liquid_rng_randf(liquid_rng * _q)
+{
+    return ((float)(liquid_rng_next(_q) >> 8) + 0.5f) * (1.0f / 16777216.0f);
+}
+
+// Gauss random number, N(0,1)
+float liquid_rng_randnf(liquid_rng * _q)
+{
+    // low 7 bits select layer; remaining 25 bits (with sign) give the
+    // abscissa, keeping the two independent
+    uint32_t     u  = liquid_rng_next(_q);
+    unsigned int iz = u & 127;
+    int32_t      hz = (int32_t)(u & ~127U);
+    uint32_t     az = hz < 0 ? -(uint32_t)hz : (uint32_t)hz;
+    if (az < liquid_rng_kn[iz])
+        return (float)hz * liquid_rng_wn[iz];
+    return liquid_rng_randnf_fix(_q, hz, iz);
+}
+
+// generate block of Gauss random numbers, N(0,1)
+//  _q      :   generator state
+//  _y      :   output array [size: _n x 1]
+//  _n      :   number of samples
+void liquid_rng_randnf_block(liquid_rng * _q,
+                             float *      _y,
+                             unsigned int _n)
+{
+    // generator state is kept in registers, written back only when the
+    // (rare) slow path needs it
+    uint32_t s0 = _q->s[0];
+    uint32_t s1 = _q->s[1];
+    uint32_t s2 = _q->s[2];
+    uint32_t s3 = _q->s[3];
+    unsigned int i;
+    for (i=0; i<_n; i++) {
+        uint32_t u = LIQUID_RNG_ROTL(s1 * 5, 7) * 9;
+        uint32_t t = s1 << 9;
+        s2 ^= s0;
+        s3 ^= s1;
+        s1 ^= s2;
+        s0 ^= s3;
+        s2 ^= t;
+        s3  = LIQUID_RNG_ROTL(s3, 11);
+
+        unsigned int iz = u & 127;
+        int32_t      hz = (int32_t)(u & ~127U);
+        uint32_t     az = hz < 0 ? -(uint32_t)hz : (uint32_t)hz;
+        if (az < liquid_rng_kn[iz]) {
+            _y[i] = (float)hz * liquid_rng_wn[iz];
+        } else {
+            _q->s[0] = s0; _q->s[1] = s1; _q->s[2] = s2; _q->s[3] = s3;
+            _y[i] = liquid_rng_randnf_fix(_q, hz, iz);
+            s0 = _q->s[0]; s1 = _q->s[1]; s2 = _q->s[2]; s3 = _q->s[3];
+        }
+    }
+    _q->s[0] = s0;
+    _q->s[1] = s1;
+    _q->s[2] = s2;
+    _q->s[3] = s3;
+}
+
+// slow path of Gauss sample: wedge or tail of layer _iz
+float liquid_rng_randnf_fix(liquid_rng * _q,
+                            int32_t      _hz,
+                            unsigned int _iz)
+{
+    for (;;) {
+        float x = (float)_hz * liquid_rng_wn[_iz];
+
+        // base layer: sample from tail beyond r
+        if (_iz == 0) {
+            float y;
+            do {
+                x = -logf(liquid_rng_randf(_q)) / LIQUID_RNG_ZIGGURAT_R;
+                y = -logf(liquid_rng_randf(_q));
+            } while (y+y < x*x);
+            return _hz > 0 ? LIQUID_RNG_ZIGGURAT_R + x : -LIQUID_RNG_ZIGGURAT_R - x;
+        }
+
+        // wedge: accept under density
+        float f0 = liquid_rng_fn[_iz];
+        float f1 = liquid_rng_fn[_iz-1];
+        if (f0 + liquid_rng_randf(_q)*(f1 - f0) < expf(-0.5f*x*x))
+            return x;
+
+        // reject; draw again
+        uint32_t u  = liquid_rng_next(_q);
+        _iz = u & 127;
+        _hz = (int32_t)(u & ~127U);
+        uint32_t az = _hz < 0 ? -(uint32_t)_hz : (uint32_t)_hz;
+        if (az < liquid_rng_kn[_iz])
+            return (float)_hz * liquid_rng_wn[_iz];
+    }
+}
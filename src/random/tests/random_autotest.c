@@ -20,8 +20,10 @@
  * THE SOFTWARE.
  */
 
+#include <stdlib.h>
+#include <math.h>
 #include "autotest/autotest.h"
-#include "liquid.h"
+#include "liquid.internal.h"
 
 #define LIQUID_RANDOM_AUTOTEST_NUM_TRIALS (100000)
 #define LIQUID_RANDOM_AUTOTEST_ERROR_TOL  (0.1)
@@ -135,3 +137,38 @@ void autotest_randricekf()
     CONTEND_DELTA(m2, omega, tol);
 }
 
+
+// Gauss, re-entrant generator (ziggurat): moments and tail probability
+void autotest_liquid_rng_randnf()
+{
+    unsigned long int N = 10*LIQUID_RANDOM_AUTOTEST_NUM_TRIALS;
+    unsigned long int i;
+    float * x = (float*) malloc(N*sizeof(float));
+    float m1=0.0f, m2=0.0f, m4=0.0f;
+    unsigned long int num_tail = 0;
+
+    liquid_rng q;
+    liquid_rng_seed(&q, 1);
+    liquid_rng_randnf_block(&q, x, N);
+    for (i=0; i<N; i++) {
+        m1 += x[i];
+        m2 += x[i]*x[i];
+        m4 += x[i]*x[i]*x[i]*x[i];
+        num_tail += fabsf(x[i]) > 3.0f;
+    }
+    m1 /= (float) N;
+    m2 /= (float) N;
+    m4 /= (float) N;
+
+    CONTEND_DELTA(m1, 0.0f, 0.01f);
+    CONTEND_DELTA(m2, 1.0f, 0.01f);
+    CONTEND_DELTA(m4, 3.0f, 0.05f);
+    CONTEND_DELTA((float)num_tail / (float)N, 2.6998e-3f, 2e-4f);
+
+    // scalar and block methods produce the same stream
+    liquid_rng_seed(&q, 1);
+    for (i=0; i<1000; i++)
+        CONTEND_EQUALITY(liquid_rng_randnf(&q), x[i]);
+
+    free(x);
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// memory.c
+//
+// Allocation wrappers for objects with memory accounting
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "liquid.internal.h"
+
+#if HAVE_PTHREAD_H && HAVE_LIBPTHREAD
+#  include <pthread.h>
+static pthread_mutex_t liquid_alloc_hook_lock = PTHREAD_MUTEX_INITIALIZER;
+#  define LIQUID_ALLOC_HOOK_LOCK()   pthread_mutex_lock  (&liquid_alloc_hook_lock)
+#  define LIQUID_ALLOC_HOOK_UNLOCK() pthread_mutex_unlock(&liquid_alloc_hook_lock)
+#else
+#  define LIQUID_ALLOC_HOOK_LOCK()
+#  define LIQUID_ALLOC_HOOK_UNLOCK()
+#endif
+
+// global allocation hook; function and user data are always read and
+// written together under lock so that a hook never sees another hook's
+// user data
+static liquid_alloc_hook liquid_alloc_hook_fn       = NULL;
+static void *            liquid_alloc_hook_userdata = NULL;
+
+// set global allocation hook (NULL to disable)
+void liquid_set_alloc_hook(liquid_alloc_hook _hook,
+                           void *            _userdata)
+{
+    LIQUID_ALLOC_HOOK_LOCK();
+    liquid_alloc_hook_fn       = _hook;
+    liquid_alloc_hook_userdata = _userdata;
+    LIQUID_ALLOC_HOOK_UNLOCK();
+}
+
+// notify hook (if set); the hook is invoked outside the lock so that it
+// may itself allocate through the library
+static void liquid_alloc_hook_notify(const char *      _name,
+                                     void *            _ptr,
+                                     unsigned long int _size)
+{
+    LIQUID_ALLOC_HOOK_LOCK();
+    liquid_alloc_hook hook     = liquid_alloc_hook_fn;
+    void *            userdata = liquid_alloc_hook_userdata;
+    LIQUID_ALLOC_HOOK_UNLOCK();
+
+    if (hook != NULL)
+        hook(_name, _ptr, _size, userdata);
+}
+
+// allocate memory, notifying hook
+void * liquid_malloc(unsigned long int _size,
+                     const char *      _name)
+{
+    void * p = malloc(_size);
+    liquid_alloc_hook_notify(_name, p, _size);
+    return p;
+}
+
+// re-allocate memory, notifying hook of release of old block and
+// allocation of new block
+void * liquid_realloc(void *            _ptr,
+                      unsigned long int _size,
+                      const char *      _name)
+{
+    // old block is invalid once realloc() returns; report it first
+    if (_ptr != NULL)
+        liquid_alloc_hook_notify(_name, _ptr, 0);
+    void * p = realloc(_ptr, _size);
+    liquid_alloc_hook_notify(_name, p, _size);
+    return p;
+}
+
+// free memory, notifying hook
+void liquid_free(void *       _ptr,
+                 const char * _name)
+{
+    if (_ptr != NULL)
+        liquid_alloc_hook_notify(_name, _ptr, 0);
+    free(_ptr);
+}
@@ -0,0 +1,199 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+//
+// profile.c
+//
+// Opt-in instrumentation of internal processing stages. Counters are
+// only updated when the library is configured with --enable-profile;
+// otherwise the instrumentation macros compile to nothing.
+//
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "liquid.internal.h"
+
+#if LIQUID_PROFILE && HAVE_PTHREAD_H && HAVE_LIBPTHREAD
+#  define LIQUID_PROFILE_THREADS 1
+#  include <pthread.h>
+#else
+#  define LIQUID_PROFILE_THREADS 0
+#endif
+
+#if LIQUID_PROFILE
+// global registry of live profiles
+static liquid_profile_s ** liquid_profile_registry     = NULL;
+static unsigned int        liquid_profile_registry_len = 0;
+#  if LIQUID_PROFILE_THREADS
+static pthread_mutex_t     liquid_profile_registry_lock = PTHREAD_MUTEX_INITIALIZER;
+#    define LIQUID_PROFILE_LOCK()   pthread_mutex_lock  (&liquid_profile_registry_lock)
+#    define LIQUID_PROFILE_UNLOCK() pthread_mutex_unlock(&liquid_profile_registry_lock)
+#  else
+#    define LIQUID_PROFILE_LOCK()
+#    define LIQUID_PROFILE_UNLOCK()
+#  endif
+#endif
+
+// is instrumentation compiled into the library?
+int liquid_profile_is_enabled()
+{
+#if LIQUID_PROFILE
+    return 1;
+#else
+    return 0;
+#endif
+}
+
+// initialize profile with object name and stage names
+//  _p          :   profile
+//  _name       :   object name, e.g. "flexframesync"
+//  _stages     :   stage names [size: _num_stages x 1]
+//  _num_stages :   number of stages
+void liquid_profile_init(liquid_profile_s * _p,
+                         const char *       _name,
+                         const char **      _stages,
+                         unsigned int       _num_stages)
+{
+    if (_num_stages > LIQUID_PROFILE_MAX_STAGES) {
+        fprintf(stderr,"error: liquid_profile_init(), number of stages exceeds %u\n", LIQUID_PROFILE_MAX_STAGES);
+        exit(1);
+    }
+
+    memset(_p, 0, sizeof(liquid_profile_s));
+    _p->name       = _name;
+    _p->num_stages = _num_stages;
+    unsigned int i;
+    for (i=0; i<_num_stages; i++)
+        _p->stages[i].name = _stages[i];
+}
+
+// reset profile counters
+void liquid_profile_reset(liquid_profile_s * _p)
+{
+    if (_p == NULL)
+        return;
+
+    unsigned int i;
+    for (i=0; i<_p->num_stages; i++) {
+        _p->stages[i].num_calls   = 0;
+        _p->stages[i].num_samples = 0;
+        _p->stages[i].num_cycles  = 0;
+    }
+}
+
+// print profile
+void liquid_profile_print(liquid_profile_s * _p)
+{
+    if (_p == NULL)
+        return;
+
+    unsigned long long total = 0;
+    unsigned int i;
+    for (i=0; i<_p->num_stages; i++)
+        total += _p->stages[i].num_cycles;
+
+    printf("profile: %s\n", _p->name);
+    for (i=0; i<_p->num_stages; i++) {
+        liquid_profile_stage_s * s = &_p->stages[i];
+        float percent = total > 0 ? 100.0f * (float)s->num_cycles / (float)total : 0.0f;
+        float cps     = s->num_samples > 0 ? (float)s->num_cycles / (float)s->num_samples : 0.0f;
+        printf("  %-12s : %12lu calls, %12lu samples, %14llu cycles (%6.2f %%), %10.2f c/s\n",
+                s->name, s->num_calls, s->num_samples, s->num_cycles, percent, cps);
+    }
+}
+
+// add profile to global registry
+void liquid_profile_register(liquid_profile_s * _p)
+{
+#if LIQUID_PROFILE
+    LIQUID_PROFILE_LOCK();
+    liquid_profile_registry = (liquid_profile_s**) realloc(liquid_profile_registry,
+        (liquid_profile_registry_len+1)*sizeof(liquid_profile_s*));
+    liquid_profile_registry[liquid_profile_registry_len++] = _p;
+    LIQUID_PROFILE_UNLOCK();
+#endif
+}
+
+// remove profile from global registry
+void liquid_profile_unregister(liquid_profile_s * _p)
+{
+#if LIQUID_PROFILE
+    LIQUID_PROFILE_LOCK();
+    unsigned int i;
+    for (i=0; i<liquid_profile_registry_len; i++) {
+        if (liquid_profile_registry[i] == _p) {
+            memmove(&liquid_profile_registry[i], &liquid_profile_registry[i+1],
+                    (liquid_profile_registry_len-i-1)*sizeof(liquid_profile_s*));
+            liquid_profile_registry_len--;
+            break;
+        }
+    }
+    if (liquid_profile_registry_len == 0) {
+        free(liquid_profile_registry);
+        liquid_profile_registry = NULL;
+    }
+    LIQUID_PROFILE_UNLOCK();
+#endif
+}
+
+// print profiles of all objects currently registered
+void liquid_profile_registry_print()
+{
+#if LIQUID_PROFILE
+    LIQUID_PROFILE_LOCK();
+    printf("liquid profile registry: %u object(s)\n", liquid_profile_registry_len);
+    unsigned int i;
+    for (i=0; i<liquid_profile_registry_len; i++)
+        liquid_profile_print(liquid_profile_registry[i]);
+    LIQUID_PROFILE_UNLOCK();
+#else
+    printf("liquid profile registry: disabled (configure with --enable-profile)\n");
+#endif
+}
+
+// reset profiles of all objects currently registered
+void liquid_profile_registry_reset()
+{
+#if LIQUID_PROFILE
+    LIQUID_PROFILE_LOCK();
+    unsigned int i;
+    for (i=0; i<liquid_profile_registry_len; i++)
+        liquid_profile_reset(liquid_profile_registry[i]);
+    LIQUID_PROFILE_UNLOCK();
+#endif
+}
+
+// read cycle counter (time-stamp counter where available, otherwise
+// a monotonic clock in nanoseconds)
+unsigned long long liquid_profile_clock()
+{
+#if defined(__x86_64__) || defined(__i386__)
+    return __builtin_ia32_rdtsc();
+#else
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (unsigned long long)ts.tv_sec * 1000000000ULL + (unsigned long long)ts.tv_nsec;
+#endif
+}
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2007 - 2019 Joseph Gaeddert
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy
+ * of this software and associated documentation files (the "Software"), to deal
+ * in the Software without restriction, including without limitation the rights
+ * to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the Software is
+ * furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in
+ * all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+ * IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+ * OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN
+ * THE SOFTWARE.
+ */
+
+#include <stdlib.h>
+#include <string.h>
+#include "autotest/autotest.h"
+#include "liquid.h"
+
+// allocation tracker: live blocks reported through the allocation hook
+#define MEMORY_TRACKER_MAX_BLOCKS (1024)
+typedef struct {
+    const char *      name [MEMORY_TRACKER_MAX_BLOCKS];
+    void *            ptr  [MEMORY_TRACKER_MAX_BLOCKS];
+    unsigned long int size [MEMORY_TRACKER_MAX_BLOCKS];
+    unsigned int      num_blocks;
+    unsigned int      num_allocs;   // total allocations reported
+} memory_tracker;
+
+static void memory_tracker_hook(const char *      _name,
+                                void *            _ptr,
+                                unsigned long int _size,
+                                void *            _userdata)
+{
+    memory_tracker * t = (memory_tracker*) _userdata;
+    unsigned int i;
+    if (_size == 0) {
+        // release: remove block
+        for (i=0; i<t->num_blocks; i++) {
+            if (t->ptr[i] == _ptr) {
+                t->num_blocks--;
+                t->name[i] = t->name[t->num_blocks];
+                t->ptr [i] = t->ptr [t->num_blocks];
+                t->size[i] = t->size[t->num_blocks];
+                return;
+            }
+        }
+    } else if (t->num_blocks < MEMORY_TRACKER_MAX_BLOCKS) {
+        // allocation: add block
+        t->num_allocs++;
+        t->name[t->num_blocks] = _name;
+        t->ptr [t->num_blocks] = _ptr;
+        t->size[t->num_blocks] = _size;
+        t->num_blocks++;
+    }
+}
+
+// total size of live blocks allocated by any object in the list
+static unsigned long int memory_tracker_total(memory_tracker * _t,
+                                              const char **    _names,
+                                              unsigned int     _num_names)
+{
+    unsigned long int total = 0;
+    unsigned int i, j;
+    for (i=0; i<_t->num_blocks; i++) {
+        for (j=0; j<_num_names; j++) {
+            if (strcmp(_t->name[i], _names[j]) == 0)
+                total += _t->size[i];
+        }
+    }
+    return total;
+}
+
+// 
+// AUTOTEST : flexframesync memory usage matches allocations, including
+//            payload buffer growth on reconfiguration
+//
+void autotest_memory_flexframesync()
+{
+    memory_tracker t;
+    t.num_blocks = 0;
+    t.num_allocs = 0;
+    liquid_set_alloc_hook(memory_tracker_hook, &t);
+    const char * names[] = {"flexframesync", "qdetector_cccf", "qpacketmodem",
+                            "packetizer", "fec", "interleaver"};
+
+    flexframesync fs = flexframesync_create(NULL,NULL);
+    unsigned long int n0 = flexframesync_get_memory_usage(fs);
+    CONTEND_EQUALITY( n0, memory_tracker_total(&t, names, 6) );
+
+    // receive frame with large payload
+    unsigned int i, payload_len = 1200;
+    unsigned char header[14] = {0};
+    unsigned char payload[payload_len];
+    for (i=0; i<payload_len; i++)
+        payload[i] = rand() & 0xff;
+    flexframegenprops_s fgprops;
+    flexframegenprops_init_default(&fgprops);
+    flexframegen fg = flexframegen_create(&fgprops);
+    flexframegen_assemble(fg, header, payload, payload_len);
+    float complex buf[64];
+    int frame_complete = 0;
+    while (!frame_complete) {
+        frame_complete = flexframegen_write_samples(fg, buf, 64);
+        flexframesync_execute(fs, buf, 64);
+    }
+    flexframegen_destroy(fg);
+
+    // payload buffers have grown
+    unsigned long int n1 = flexframesync_get_memory_usage(fs);
+    if (liquid_autotest_verbose)
+        printf("flexframesync memory usage: %lu -> %lu bytes\n", n0, n1);
+    CONTEND_GREATER_THAN( n1, n0 + payload_len );
+    CONTEND_EQUALITY( n1, memory_tracker_total(&t, names, 6) );
+
+    // all memory released
+    flexframesync_destroy(fs);
+    CONTEND_EQUALITY( memory_tracker_total(&t, names, 6), 0 );
+    liquid_set_alloc_hook(NULL, NULL);
+}
+
+// 
+// AUTOTEST : firpfbch2 memory usage for full- and half-precision windows
+//
+void autotest_memory_firpfbch2()
+{
+    memory_tracker t;
+    t.num_blocks = 0;
+    t.num_allocs = 0;
+    liquid_set_alloc_hook(memory_tracker_hook, &t);
+    const char * names[] = {"firpfbch2_crcf", "windowcf"};
+
+    firpfbch2_crcf q = firpfbch2_crcf_create_kaiser(LIQUID_ANALYZER, 64, 4, 60.0f);
+    unsigned long int n32 = firpfbch2_crcf_get_memory_usage(q);
+    CONTEND_EQUALITY( n32, memory_tracker_total(&t, names, 2) );
+
+    // prototype filter buffers are reported, and released before return
+    CONTEND_GREATER_THAN( t.num_allocs, t.num_blocks );
+
+    firpfbch2_crcf_set_storage(q, LIQUID_STORAGE_FLOAT16);
+    unsigned long int n16 = firpfbch2_crcf_get_memory_usage(q);
+    if (liquid_autotest_verbose)
+        printf("firpfbch2 memory usage: %lu (float32), %lu (float16) bytes\n", n32, n16);
+    CONTEND_LESS_THAN( n16, n32 );
+    CONTEND_EQUALITY( n16, memory_tracker_total(&t, names, 2) );
+
+    firpfbch2_crcf_destroy(q);
+    CONTEND_EQUALITY( memory_tracker_total(&t, names, 2), 0 );
+    liquid_set_alloc_hook(NULL, NULL);
+}
+
+// 
+// AUTOTEST : spwaterfall memory usage is dominated by history
+//
+void autotest_memory_spwaterfall()
+{
+    memory_tracker t;
+    t.num_blocks = 0;
+    t.num_allocs = 0;
+    liquid_set_alloc_hook(memory_tracker_hook, &t);
+    const char * names[] = {"spwaterfallcf"};
+
+    unsigned int nfft = 256, time = 200;
+    spwaterfallcf q = spwaterfallcf_create_default(nfft, time);
+    unsigned long int n = spwaterfallcf_get_memory_usage(q);
+    CONTEND_GREATER_THAN( n, 2*nfft*time*sizeof(float) );
+    CONTEND_EQUALITY( n, memory_tracker_total(&t, names, 1) );
+
+    spwaterfallcf_set_storage(q, LIQUID_STORAGE_BFLOAT16);
+    CONTEND_EQUALITY( spwaterfallcf_get_memory_usage(q), memory_tracker_total(&t, names, 1) );
+    CONTEND_LESS_THAN( spwaterfallcf_get_memory_usage(q), n );
+
+    spwaterfallcf_destroy(q);
+    CONTEND_EQUALITY( memory_tracker_total(&t, names, 1), 0 );
+    liquid_set_alloc_hook(NULL, NULL);
+}
@@ -30,6 +30,34 @@
 #include <math.h>
 #include <complex.h>
 
+#if T_COMPLEX && HAVE_SSE2 && HAVE_EMMINTRIN_H
+#include <emmintrin.h>  // SSE2
+#endif
+
+#if T_COMPLEX
+// minimax polynomial approximations to arctan(t) for t in [0,1] as
+// t*p(t^2), with 2 through 7 terms in p; coefficients in ascending
+// order, followed by the maximum absolute error [radians]
+#define VECTOR_ATAN_NUM_POLY (6)
+static const float vector_atan_poly[VECTOR_ATAN_NUM_POLY][8] = {
+    {9.723941179e-01f, -1.919479544e-01f, 0, 0, 0, 0, 0, 4.952e-03f},
+    {9.953579548e-01f, -2.886902380e-01f, 7.933904142e-02f, 0, 0, 0, 0, 6.086e-04f},
+    {9.992138126e-01f, -3.211749693e-01f, 1.462644636e-01f, -3.898651416e-02f,
+     0, 0, 0, 8.137e-05f},
+    {9.998663295e-01f, -3.303047855e-01f, 1.801592947e-01f, -8.515635090e-02f,
+     2.084511419e-02f, 0, 0, 1.144e-05f},
+    {9.999772191e-01f, -3.326228279e-01f, 1.935403761e-01f, -1.164264820e-01f,
+     5.264735147e-02f, -1.171913573e-02f, 0, 1.662e-06f},
+    {9.999961115e-01f, -3.331736805e-01f, 1.980781556e-01f, -1.323334210e-01f,
+     7.962367237e-02f, -3.360422057e-02f, 6.811793291e-03f, 2.474e-07f},
+};
+
+// approximate arg{ conj(_a) _b } using polynomial coefficients _c
+float VECTOR(_cargdiff_poly)(T *           _a,
+                             T *           _b,
+                             const float * _c);
+#endif
+
 // compute complex phase rotation: x[i] = exp{ j theta[i] }
 //  _theta  :   input primitive array [size: _n x 1]
 //  _n      :   array length
@@ -141,3 +169,128 @@ void VECTOR(_abs)(T *          _x,
     }
 }
 
+
+// compute phase difference between consecutive elements (frequency
+// discriminator): y[i] = arg{ conj(x[i]) x[i+1] }, where arg{*} is
+// approximated by a polynomial to within _tol radians
+//  _x      :   input array [size: _n+1 x 1]
+//  _n      :   number of phase differences
+//  _tol    :   maximum absolute error [radians], 0 for full precision
+//  _y      :   output primitive array [size: _n x 1]
+void VECTOR(_cargdiff)(T *          _x,
+                       unsigned int _n,
+                       TP           _tol,
+                       TP *         _y)
+{
+    unsigned int i = 0;
+#if T_COMPLEX
+    // choose least number of polynomial terms meeting tolerance
+    unsigned int p = 0;
+    while (p < VECTOR_ATAN_NUM_POLY && vector_atan_poly[p][7] > _tol)
+        p++;
+
+    if (p == VECTOR_ATAN_NUM_POLY) {
+        // full precision
+        for (i=0; i<_n; i++)
+            _y[i] = cargf( conjf(_x[i])*_x[i+1] );
+        return;
+    }
+
+    // polynomial coefficients, evaluated with all terms since higher
+    // terms are zero
+    const float * c = vector_atan_poly[p];
+
+#if HAVE_SSE2 && HAVE_EMMINTRIN_H
+    // compute in groups of 4
+    const __m128 sign  = _mm_set1_ps(-0.0f);
+    const __m128 pi    = _mm_set1_ps((float)M_PI);
+    const __m128 pi_2  = _mm_set1_ps((float)M_PI_2);
+    const __m128 fmin  = _mm_set1_ps(1e-30f);
+    const __m128 zero  = _mm_setzero_ps();
+    float * v = (float*) _x;
+    for (i=0; i+4<=_n; i+=4) {
+        // de-interleave consecutive samples
+        __m128 a0 = _mm_loadu_ps(&v[2*i  ]);
+        __m128 a1 = _mm_loadu_ps(&v[2*i+4]);
+        __m128 b0 = _mm_loadu_ps(&v[2*i+2]);
+        __m128 b1 = _mm_loadu_ps(&v[2*i+6]);
+        __m128 ar = _mm_shuffle_ps(a0, a1, _MM_SHUFFLE(2,0,2,0));
+        __m128 ai = _mm_shuffle_ps(a0, a1, _MM_SHUFFLE(3,1,3,1));
+        __m128 br = _mm_shuffle_ps(b0, b1, _MM_SHUFFLE(2,0,2,0));
+        __m128 bi = _mm_shuffle_ps(b0, b1, _MM_SHUFFLE(3,1,3,1));
+
+        // conj(a)*b
+        __m128 re = _mm_add_ps(_mm_mul_ps(ar,br), _mm_mul_ps(ai,bi));
+        __m128 im = _mm_sub_ps(_mm_mul_ps(ar,bi), _mm_mul_ps(ai,br));
+
+        // reduce to t = min/max in [0,1]
+        __m128 ax = _mm_andnot_ps(sign, re);
+        __m128 ay = _mm_andnot_ps(sign, im);
+        __m128 mx = _mm_max_ps(_mm_max_ps(ax, ay), fmin);
+        __m128 mn = _mm_min_ps(ax, ay);
+        __m128 t  = _mm_div_ps(mn, mx);
+        __m128 s  = _mm_mul_ps(t, t);
+
+        // evaluate polynomial (Horner)
+        __m128 r = _mm_set1_ps(c[6]);
+        r = _mm_add_ps(_mm_mul_ps(r,s), _mm_set1_ps(c[5]));
+        r = _mm_add_ps(_mm_mul_ps(r,s), _mm_set1_ps(c[4]));
+        r = _mm_add_ps(_mm_mul_ps(r,s), _mm_set1_ps(c[3]));
+        r = _mm_add_ps(_mm_mul_ps(r,s), _mm_set1_ps(c[2]));
+        r = _mm_add_ps(_mm_mul_ps(r,s), _mm_set1_ps(c[1]));
+        r = _mm_add_ps(_mm_mul_ps(r,s), _mm_set1_ps(c[0]));
+        r = _mm_mul_ps(r, t);
+
+        // restore octant and quadrant
+        __m128 m0 = _mm_cmpgt_ps(ay, ax);
+        r = _mm_or_ps(_mm_and_ps(m0, _mm_sub_ps(pi_2, r)), _mm_andnot_ps(m0, r));
+        __m128 m1 = _mm_cmplt_ps(re, zero);
+        r = _mm_or_ps(_mm_and_ps(m1, _mm_sub_ps(pi,   r)), _mm_andnot_ps(m1, r));
+        r = _mm_or_ps(r, _mm_and_ps(sign, im));
+        _mm_storeu_ps(&_y[i], r);
+    }
+#endif
+
+    // compute remaining
+    for ( ; i<_n; i++)
+        _y[i] = VECTOR(_cargdiff_poly)(&_x[i], &_x[i+1], c);
+#else
+    for (i=0; i<_n; i++)
+        _y[i] = _x[i]*_x[i+1] >= 0 ? 0 : M_PI;
+#endif
+}
+
+#if T_COMPLEX
+// approximate arg{ conj(_a) _b } using polynomial coefficients _c,
+// with the same sequence of operations as the SIMD version
+float VECTOR(_cargdiff_poly)(T *           _a,
+                             T *           _b,
+                             const float * _c)
+{
+    float re = crealf(*_a)*crealf(*_b) + cimagf(*_a)*cimagf(*_b);
+    float im = crealf(*_a)*cimagf(*_b) - cimagf(*_a)*crealf(*_b);
+
+    // reduce to t = min/max in [0,1]
+    float ax = fabsf(re);
+    float ay = fabsf(im);
+    float mx = ax > ay ? ax : ay;
+    float mn = ax < ay ? ax : ay;
+    float t  = mn / (mx > 1e-30f ? mx : 1e-30f);
+    float s  = t*t;
+
+    // evaluate polynomial (Horner)
+    float r = _c[6];
+    r = r*s + _c[5];
+    r = r*s + _c[4];
+    r = r*s + _c[3];
+    r = r*s + _c[2];
+    r = r*s + _c[1];
+    r = r*s + _c[0];
+    r *= t;
+
+    // restore octant and quadrant
+    if (ay > ax)   r = (float)M_PI_2 - r;
+    if (re < 0.0f) r = (float)M_PI   - r;
+    return copysignf(r, im);
+}
+#endif